@@ -0,0 +1,20 @@
+// Copyright DevTools. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class AssetAnalysisCommon : ModuleRules
+{
+	public AssetAnalysisCommon(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"AssetRegistry"
+			}
+		);
+	}
+}
@@ -0,0 +1,5 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, AssetAnalysisCommon)
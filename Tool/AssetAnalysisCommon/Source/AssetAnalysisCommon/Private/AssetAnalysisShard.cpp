@@ -0,0 +1,122 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetAnalysisShard.h"
+#include "AssetRegistry/AssetData.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// ========== FAssetAnalysisShards ==========
+
+bool FAssetAnalysisShards::IsPackageInShard(FName PackageName, int32 ShardIndex, int32 ShardCount)
+{
+	if (ShardCount <= 1)
+	{
+		return true;
+	}
+
+	const uint32 Hash = FCrc::StrCrc32(*PackageName.ToString());
+	return (int32)(Hash % (uint32)ShardCount) == ShardIndex;
+}
+
+void FAssetAnalysisShards::FilterAssets(TArray<FAssetData>& InOutAssets, int32 ShardIndex, int32 ShardCount)
+{
+	if (ShardCount <= 1)
+	{
+		return;
+	}
+
+	InOutAssets.RemoveAll([ShardIndex, ShardCount](const FAssetData& AssetData)
+	{
+		return !IsPackageInShard(AssetData.PackageName, ShardIndex, ShardCount);
+	});
+}
+
+bool FAssetAnalysisShards::ParseShardRange(const TCHAR* Params, int32& OutShardIndex, int32& OutShardCount)
+{
+	OutShardIndex = 0;
+	OutShardCount = 1;
+	FParse::Value(Params, TEXT("ShardIndex="), OutShardIndex);
+	FParse::Value(Params, TEXT("ShardCount="), OutShardCount);
+
+	return OutShardCount >= 1 && OutShardIndex >= 0 && OutShardIndex < OutShardCount;
+}
+
+FString FAssetAnalysisShards::GetShardFileName(int32 ShardIndex, int32 ShardCount)
+{
+	return FString::Printf(TEXT("Shard_%d_of_%d.bin"), ShardIndex, ShardCount);
+}
+
+bool FAssetAnalysisShards::FindShardFiles(const FString& ShardDirectory, TArray<FString>& OutFilePaths)
+{
+	OutFilePaths.Reset();
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(ShardDirectory / TEXT("*.bin")), true, false);
+	FileNames.Sort();
+
+	OutFilePaths.Reserve(FileNames.Num());
+	for (const FString& FileName : FileNames)
+	{
+		OutFilePaths.Add(ShardDirectory / FileName);
+	}
+
+	return OutFilePaths.Num() > 0;
+}
+
+void FAssetAnalysisShards::SerializeHeader(FArchive& Ar, uint32& Magic, int32& Version, FString& AnalyzedPath, int32& ShardIndex, int32& ShardCount)
+{
+	Ar << Magic;
+	Ar << Version;
+	Ar << AnalyzedPath;
+	Ar << ShardIndex;
+	Ar << ShardCount;
+}
+
+// ========== FAssetAnalysisShardValidator ==========
+
+bool FAssetAnalysisShardValidator::Accept(const FString& FilePath, const FString& AnalyzedPath, int32 ShardIndex, int32 ShardCount)
+{
+	if (ExpectedShardCount == INDEX_NONE && ShardCount >= 1)
+	{
+		ExpectedShardCount = ShardCount;
+		ExpectedPath = AnalyzedPath;
+		FoundShards.Init(false, ExpectedShardCount);
+	}
+
+	if (ShardCount != ExpectedShardCount || AnalyzedPath != ExpectedPath ||
+		!FoundShards.IsValidIndex(ShardIndex) || FoundShards[ShardIndex])
+	{
+		UE_LOG(LogTemp, Error, TEXT("[AssetAnalysisShard] Shard %s does not match the other shards"), *FilePath);
+		bMismatch = true;
+		return false;
+	}
+
+	FoundShards[ShardIndex] = true;
+	return true;
+}
+
+void FAssetAnalysisShardValidator::Reject(const FString& FilePath)
+{
+	UE_LOG(LogTemp, Error, TEXT("[AssetAnalysisShard] Failed to read shard: %s"), *FilePath);
+	bMismatch = true;
+}
+
+bool FAssetAnalysisShardValidator::Finish()
+{
+	if (ExpectedShardCount == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[AssetAnalysisShard] No readable shards"));
+		return false;
+	}
+
+	for (int32 ShardIndex = 0; ShardIndex < FoundShards.Num(); ++ShardIndex)
+	{
+		if (!FoundShards[ShardIndex])
+		{
+			UE_LOG(LogTemp, Error, TEXT("[AssetAnalysisShard] Missing shard %d of %d"), ShardIndex, ExpectedShardCount);
+			bMismatch = true;
+		}
+	}
+
+	return !bMismatch;
+}
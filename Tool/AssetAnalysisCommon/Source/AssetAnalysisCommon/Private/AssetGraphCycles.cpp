@@ -0,0 +1,44 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetGraphCycles.h"
+
+void FAssetGraphCycles::Reset()
+{
+	Packages.Reset();
+	PackageCycleGroup.Reset();
+	CycleGroups.Reset();
+}
+
+int32 FAssetGraphCycles::GetCycleGroupIndex(FName PackageName) const
+{
+	const int32* GroupIndex = PackageCycleGroup.Find(PackageName);
+	return GroupIndex ? *GroupIndex : INDEX_NONE;
+}
+
+bool FAssetGraphCycles::GetCircularPaths(FName PackageName, TArray<FString>& OutCircularPaths) const
+{
+	const int32 GroupIndex = GetCycleGroupIndex(PackageName);
+	if (GroupIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FString PackageString = PackageName.ToString();
+	const FAssetGraphCycleGroup& Group = CycleGroups[GroupIndex];
+
+	if (Group.PackageNames.Num() == 1)
+	{
+		// 自己参照
+		OutCircularPaths.Add(FString::Printf(TEXT("%s <-> %s"), *PackageString, *PackageString));
+		return true;
+	}
+
+	for (const FString& Member : Group.PackageNames)
+	{
+		if (Member != PackageString)
+		{
+			OutCircularPaths.Add(FString::Printf(TEXT("%s <-> %s"), *PackageString, *Member));
+		}
+	}
+	return true;
+}
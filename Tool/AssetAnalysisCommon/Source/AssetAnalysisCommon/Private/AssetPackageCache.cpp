@@ -0,0 +1,175 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetPackageCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+
+// ========== FAssetCacheNameTable ==========
+
+void FAssetCacheNameTable::Serialize(FArchive& Ar, FName& Name)
+{
+	if (Ar.IsLoading())
+	{
+		int32 NameIndex = INDEX_NONE;
+		Ar << NameIndex;
+		Name = Names.IsValidIndex(NameIndex) ? Names[NameIndex] : NAME_None;
+		return;
+	}
+
+	int32 NameIndex = INDEX_NONE;
+	if (const int32* ExistingIndex = NameIndices.Find(Name))
+	{
+		NameIndex = *ExistingIndex;
+	}
+	else
+	{
+		NameIndex = Names.Add(Name);
+		NameIndices.Add(Name, NameIndex);
+	}
+	Ar << NameIndex;
+}
+
+void FAssetCacheNameTable::SerializeTable(FArchive& Ar)
+{
+	// FNameはアーカイブの種類に依存しないよう文字列で保存
+	TArray<FString> NameStrings;
+	if (Ar.IsSaving())
+	{
+		NameStrings.Reserve(Names.Num());
+		for (const FName& Name : Names)
+		{
+			NameStrings.Add(Name.IsNone() ? FString() : Name.ToString());
+		}
+	}
+
+	Ar << NameStrings;
+
+	if (Ar.IsLoading())
+	{
+		Names.Reset(NameStrings.Num());
+		NameIndices.Reset();
+		for (const FString& NameString : NameStrings)
+		{
+			Names.Add(NameString.IsEmpty() ? NAME_None : FName(*NameString));
+		}
+	}
+}
+
+// ========== FAssetPackageState ==========
+
+bool FAssetPackageState::GetCurrent(FName PackageName, FAssetPackageState& OutState)
+{
+	// ワーカースレッドからも呼ばれるためGetModuleCheckedを使用
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FAssetPackageData PackageData;
+	if (AssetRegistry.TryGetAssetPackageData(PackageName, PackageData) != UE::AssetRegistry::EExists::Exists)
+	{
+		return false;
+	}
+
+	OutState.SavedHash = PackageData.PackageSavedHash;
+	OutState.DiskSize = PackageData.DiskSize;
+	return true;
+}
+
+bool FAssetPackageState::IsPackageDirty(FName PackageName)
+{
+	const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+	return Package && Package->IsDirty();
+}
+
+// ========== FAssetPackageCacheBase ==========
+
+FAssetPackageCacheBase::FAssetPackageCacheBase()
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FAssetPackageCacheBase::OnAssetUpdated);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetPackageCacheBase::OnAssetRenamed);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetPackageCacheBase::OnAssetRemoved);
+}
+
+FAssetPackageCacheBase::~FAssetPackageCacheBase()
+{
+	// シャットダウン時はレジストリが先に破棄されている場合がある
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+	}
+}
+
+bool FAssetPackageCacheBase::SaveFile(const FString& FilePath, uint32 Magic, int32 Version, TFunctionRef<void(FArchive&, FAssetCacheNameTable&)> WriteBody)
+{
+	// 名前テーブルは本体を書き終えてから確定するため、本体を先に書く
+	FAssetCacheNameTable NameTable;
+	TArray<uint8> BodyBytes;
+	{
+		FMemoryWriter BodyWriter(BodyBytes);
+		WriteBody(BodyWriter, NameTable);
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << Magic;
+	Writer << Version;
+	NameTable.SerializeTable(Writer);
+	Writer.Serialize(BodyBytes.GetData(), BodyBytes.Num());
+
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FAssetPackageCacheBase::LoadFile(const FString& FilePath, uint32 Magic, int32 Version, TFunctionRef<void(FArchive&, FAssetCacheNameTable&)> ReadBody)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 FileMagic = 0;
+	int32 FileVersion = 0;
+	Reader << FileMagic;
+	Reader << FileVersion;
+	if (FileMagic != Magic || FileVersion != Version)
+	{
+		return false;
+	}
+
+	FAssetCacheNameTable NameTable;
+	NameTable.SerializeTable(Reader);
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	ReadBody(Reader, NameTable);
+	return !Reader.IsError();
+}
+
+void FAssetPackageCacheBase::OnAssetUpdated(const FAssetData& AssetData)
+{
+	OnPackageChanged(AssetData.PackageName);
+}
+
+void FAssetPackageCacheBase::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	OnPackageChanged(AssetData.PackageName);
+	OnPackageChanged(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
+
+void FAssetPackageCacheBase::OnAssetRemoved(const FAssetData& AssetData)
+{
+	OnPackageChanged(AssetData.PackageName);
+}
@@ -0,0 +1,234 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+struct FAssetData;
+
+/**
+ * シャード分析の共通処理（アセットコスト分析・BP分析で共有）
+ * プロジェクトを複数マシンで分割分析するため、パッケージ名のハッシュで担当を決め、
+ * レポートをそのままバイナリで書き出して統合時に読み戻す
+ */
+struct ASSETANALYSISCOMMON_API FAssetAnalysisShards
+{
+	/**
+	 * パッケージが指定シャードの担当か
+	 * マシン間で一致するよう、FNameのハッシュではなく文字列のCRCで判定する
+	 */
+	static bool IsPackageInShard(FName PackageName, int32 ShardIndex, int32 ShardCount);
+
+	/** 担当外のアセットを除く */
+	static void FilterAssets(TArray<FAssetData>& InOutAssets, int32 ShardIndex, int32 ShardCount);
+
+	/**
+	 * コマンドラインの -ShardIndex= -ShardCount= を読み取る
+	 * @return 範囲が正しいか
+	 */
+	static bool ParseShardRange(const TCHAR* Params, int32& OutShardIndex, int32& OutShardCount);
+
+	/** シャードファイル名（Shard_<Index>_of_<Count>.bin） */
+	static FString GetShardFileName(int32 ShardIndex, int32 ShardCount);
+
+	/**
+	 * ディレクトリ内のシャードファイル（名前順）
+	 * @return 1つ以上見つかったか
+	 */
+	static bool FindShardFiles(const FString& ShardDirectory, TArray<FString>& OutFilePaths);
+
+	/** ファイル先頭の共通部分を読み書き */
+	static void SerializeHeader(FArchive& Ar, uint32& Magic, int32& Version, FString& AnalyzedPath, int32& ShardIndex, int32& ShardCount);
+};
+
+/**
+ * 統合するシャードの検証（シャード総数・分析パスの一致、重複、欠け）
+ */
+class ASSETANALYSISCOMMON_API FAssetAnalysisShardValidator
+{
+public:
+	/**
+	 * 読み込んだシャードを受け入れるか
+	 * 最初のシャードの分割設定を基準にする
+	 */
+	bool Accept(const FString& FilePath, const FString& AnalyzedPath, int32 ShardIndex, int32 ShardCount);
+
+	/** 読み込めなかったシャード */
+	void Reject(const FString& FilePath);
+
+	/**
+	 * 欠けたシャードを確認
+	 * @return 全シャードが揃っていればtrue
+	 */
+	bool Finish();
+
+private:
+	/** 基準のシャード総数（未確定はINDEX_NONE） */
+	int32 ExpectedShardCount = INDEX_NONE;
+
+	/** 基準の分析パス */
+	FString ExpectedPath;
+
+	/** 受け入れたシャード */
+	TBitArray<> FoundShards;
+
+	/** 不一致・読み込み失敗があったか */
+	bool bMismatch = false;
+};
+
+/**
+ * シャード分析結果（レポート型・循環グループ型で共通化）
+ * ファイル: マジック, バージョン, 分析パス, シャード番号, 総数, レポート配列, 循環グループ配列
+ * ReportType・CycleGroupTypeはUSTRUCT（StaticStructでバイナリ化する）
+ */
+template <typename ReportType, typename CycleGroupType>
+struct TAssetAnalysisShard
+{
+	/** 分析パス */
+	FString AnalyzedPath;
+
+	/** シャード番号（0始まり） */
+	int32 ShardIndex = 0;
+
+	/** シャード総数 */
+	int32 ShardCount = 1;
+
+	/** 担当アセットのレポート */
+	TArray<ReportType> Reports;
+
+	/** 循環グループ（パス全体から計算するため全シャードで同一） */
+	TArray<CycleGroupType> CycleGroups;
+
+	/** ファイルへ保存（Magic・Versionは各ツールの形式） */
+	bool Save(const FString& FilePath, uint32 Magic, int32 Version) const
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		FString PathCopy = AnalyzedPath;
+		int32 IndexCopy = ShardIndex;
+		int32 CountCopy = ShardCount;
+		FAssetAnalysisShards::SerializeHeader(Writer, Magic, Version, PathCopy, IndexCopy, CountCopy);
+
+		SaveStructs(Writer, Reports);
+		SaveStructs(Writer, CycleGroups);
+
+		return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+	}
+
+	/**
+	 * ファイルから読み込み
+	 * @return 読み込めたか（形式が異なる場合はfalse）
+	 */
+	bool Load(const FString& FilePath, uint32 ExpectedMagic, int32 ExpectedVersion)
+	{
+		Reset();
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		FAssetAnalysisShards::SerializeHeader(Reader, Magic, Version, AnalyzedPath, ShardIndex, ShardCount);
+		if (Magic != ExpectedMagic || Version != ExpectedVersion)
+		{
+			Reset();
+			return false;
+		}
+
+		LoadStructs(Reader, Reports);
+		LoadStructs(Reader, CycleGroups);
+
+		if (Reader.IsError())
+		{
+			Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * シャードファイルを全て読み込んで統合
+	 * 分析パスと循環グループは最初のシャードから取り、レポートはシャードごとにOnReportsへ渡す（移動してよい）
+	 * @return 全シャードが同じ分割設定で揃っていればtrue（不一致のシャードは読み飛ばして統合を続ける）
+	 */
+	static bool Merge(const TArray<FString>& FilePaths, uint32 Magic, int32 Version,
+		TAssetAnalysisShard& OutMerged, TFunctionRef<void(TArray<ReportType>&)> OnReports)
+	{
+		OutMerged.Reset();
+
+		FAssetAnalysisShardValidator Validator;
+		bool bFirst = true;
+
+		for (const FString& FilePath : FilePaths)
+		{
+			TAssetAnalysisShard Shard;
+			if (!Shard.Load(FilePath, Magic, Version))
+			{
+				Validator.Reject(FilePath);
+				continue;
+			}
+
+			if (!Validator.Accept(FilePath, Shard.AnalyzedPath, Shard.ShardIndex, Shard.ShardCount))
+			{
+				continue;
+			}
+
+			if (bFirst)
+			{
+				bFirst = false;
+				OutMerged.AnalyzedPath = Shard.AnalyzedPath;
+				OutMerged.ShardCount = Shard.ShardCount;
+				OutMerged.CycleGroups = MoveTemp(Shard.CycleGroups);
+			}
+
+			OnReports(Shard.Reports);
+		}
+
+		return Validator.Finish();
+	}
+
+	/** 全て破棄 */
+	void Reset()
+	{
+		AnalyzedPath.Reset();
+		ShardIndex = 0;
+		ShardCount = 1;
+		Reports.Reset();
+		CycleGroups.Reset();
+	}
+
+private:
+	template <typename StructType>
+	static void SaveStructs(FArchive& Ar, const TArray<StructType>& Items)
+	{
+		int32 NumItems = Items.Num();
+		Ar << NumItems;
+		for (const StructType& Item : Items)
+		{
+			StructType ItemCopy = Item;
+			StructType::StaticStruct()->SerializeBin(Ar, &ItemCopy);
+		}
+	}
+
+	template <typename StructType>
+	static void LoadStructs(FArchive& Ar, TArray<StructType>& OutItems)
+	{
+		int32 NumItems = 0;
+		Ar << NumItems;
+		for (int32 Index = 0; Index < NumItems && !Ar.IsError(); ++Index)
+		{
+			StructType& Item = OutItems.AddDefaulted_GetRef();
+			StructType::StaticStruct()->SerializeBin(Ar, &Item);
+		}
+	}
+};
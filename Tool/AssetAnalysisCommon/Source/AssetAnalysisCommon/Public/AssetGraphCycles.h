@@ -0,0 +1,74 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 循環グループ（強連結成分）
+ */
+struct FAssetGraphCycleGroup
+{
+	/** グループに含まれるパッケージ（ソート済み） */
+	TArray<FString> PackageNames;
+};
+
+/**
+ * 循環参照の分析結果（アセットコスト分析・BP分析で共有）
+ * FAssetRegistryGraph::ComputeCycles が共有グラフ上でTarjan法により強連結成分（SCC）を求めて生成する
+ * パッケージごとの所属グループをO(1)で参照できる
+ */
+class ASSETANALYSISCOMMON_API FAssetGraphCycles
+{
+public:
+	/** 全て破棄 */
+	void Reset();
+
+	/** 計算範囲（起点から到達可能）に含まれるパッケージか */
+	bool ContainsPackage(FName PackageName) const { return Packages.Contains(PackageName); }
+
+	/**
+	 * パッケージが属する循環グループを取得
+	 * @return グループインデックス（循環に含まれない場合はINDEX_NONE）
+	 */
+	int32 GetCycleGroupIndex(FName PackageName) const;
+
+	/** 循環グループ一覧 */
+	const TArray<FAssetGraphCycleGroup>& GetCycleGroups() const { return CycleGroups; }
+
+	/**
+	 * 循環グループを各ツールの型（PackageNamesを持つ構造体）へ変換
+	 */
+	template <typename GroupType>
+	TArray<GroupType> MakeCycleGroups() const
+	{
+		TArray<GroupType> Result;
+		Result.Reserve(CycleGroups.Num());
+		for (const FAssetGraphCycleGroup& Group : CycleGroups)
+		{
+			Result.AddDefaulted_GetRef().PackageNames = Group.PackageNames;
+		}
+		return Result;
+	}
+
+	/**
+	 * 循環参照パスを取得（同じグループの他パッケージとの組を列挙）
+	 * @return 循環に含まれる場合true
+	 */
+	bool GetCircularPaths(FName PackageName, TArray<FString>& OutCircularPaths) const;
+
+	/** 計算範囲のパッケージ数 */
+	int32 NumPackages() const { return Packages.Num(); }
+
+private:
+	friend class FAssetRegistryGraph;
+
+	/** 計算範囲のパッケージ */
+	TSet<FName> Packages;
+
+	/** パッケージ → 循環グループインデックス（循環に含まれるパッケージのみ） */
+	TMap<FName, int32> PackageCycleGroup;
+
+	/** 循環グループ（要素数2以上、または自己参照のSCC） */
+	TArray<FAssetGraphCycleGroup> CycleGroups;
+};
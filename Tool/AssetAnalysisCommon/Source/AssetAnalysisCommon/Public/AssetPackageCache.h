@@ -0,0 +1,233 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+
+struct FAssetData;
+
+/**
+ * キャッシュファイルの名前テーブル
+ * FNameは保存時に表へ集め、本体にはインデックスのみを書く
+ */
+class ASSETANALYSISCOMMON_API FAssetCacheNameTable
+{
+public:
+	/** 名前を読み書き（保存時は表へ追加、読み込み時は表から引く） */
+	void Serialize(FArchive& Ar, FName& Name);
+
+	/** 表を読み書き */
+	void SerializeTable(FArchive& Ar);
+
+private:
+	/** インデックス → 名前 */
+	TArray<FName> Names;
+
+	/** 名前 → インデックス（保存時） */
+	TMap<FName, int32> NameIndices;
+};
+
+/**
+ * パッケージの保存状態（キャッシュの有効性判定に使う）
+ */
+struct ASSETANALYSISCOMMON_API FAssetPackageState
+{
+	/** 保存時のパッケージハッシュ */
+	FIoHash SavedHash;
+
+	/** 保存時のディスクサイズ */
+	int64 DiskSize = 0;
+
+	/** レジストリから現在の状態を取得（ワーカースレッドから呼んでよい） */
+	static bool GetCurrent(FName PackageName, FAssetPackageState& OutState);
+
+	/** ロード済みで未保存の変更があるか */
+	static bool IsPackageDirty(FName PackageName);
+
+	bool operator==(const FAssetPackageState& Other) const { return SavedHash == Other.SavedHash && DiskSize == Other.DiskSize; }
+	bool operator!=(const FAssetPackageState& Other) const { return !(*this == Other); }
+
+	friend FArchive& operator<<(FArchive& Ar, FAssetPackageState& State)
+	{
+		Ar << State.SavedHash;
+		Ar << State.DiskSize;
+		return Ar;
+	}
+};
+
+/**
+ * パッケージ単位の永続キャッシュの基底（アセットコスト分析・BP分析で共有）
+ * - アセットレジストリの更新・名前変更・削除イベントでOnPackageChangedを呼ぶ
+ * - ファイル形式: マジック, バージョン, 名前テーブル, 本体
+ * ゲームスレッド専用
+ */
+class ASSETANALYSISCOMMON_API FAssetPackageCacheBase
+{
+public:
+	FAssetPackageCacheBase();
+	virtual ~FAssetPackageCacheBase();
+
+	FAssetPackageCacheBase(const FAssetPackageCacheBase&) = delete;
+	FAssetPackageCacheBase& operator=(const FAssetPackageCacheBase&) = delete;
+
+	/**
+	 * キャッシュファイルを書き出す
+	 * @param WriteBody 本体の書き込み（名前は名前テーブル経由で書く）
+	 */
+	static bool SaveFile(const FString& FilePath, uint32 Magic, int32 Version, TFunctionRef<void(FArchive&, FAssetCacheNameTable&)> WriteBody);
+
+	/**
+	 * キャッシュファイルを読み込む
+	 * @return 読み込めたか（ファイルが無い・形式が異なる・壊れている場合はfalse）
+	 */
+	static bool LoadFile(const FString& FilePath, uint32 Magic, int32 Version, TFunctionRef<void(FArchive&, FAssetCacheNameTable&)> ReadBody);
+
+protected:
+	/** パッケージが変更・名前変更・削除された */
+	virtual void OnPackageChanged(FName PackageName) = 0;
+
+private:
+	/** レジストリイベント */
+	void OnAssetUpdated(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetRemoved(const FAssetData& AssetData);
+
+	/** イベントハンドル */
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetRemovedHandle;
+};
+
+/**
+ * 保存状態で検証するパッケージ単位の永続キャッシュ
+ * パッケージ名 → (保存状態, PayloadType) を保持し、参照時は毎回現在の保存状態と比較する
+ * 派生クラスはペイロードの内容・読み書き・無効化の範囲を決める
+ */
+template <typename PayloadType>
+class TAssetPackageCache : public FAssetPackageCacheBase
+{
+public:
+	/** キャッシュエントリ */
+	struct FEntry
+	{
+		/** 記録時のパッケージ状態 */
+		FAssetPackageState State;
+
+		/** ツールごとの内容 */
+		PayloadType Payload;
+	};
+
+	/**
+	 * 有効なエントリを検索
+	 * イベントを取りこぼした場合に備えて自身の保存状態だけは毎回確認する
+	 */
+	const PayloadType* FindValid(FName PackageName) const
+	{
+		const FEntry* Entry = Entries.Find(PackageName);
+		FAssetPackageState CurrentState;
+		if (!Entry || !FAssetPackageState::GetCurrent(PackageName, CurrentState) || CurrentState != Entry->State)
+		{
+			return nullptr;
+		}
+		return &Entry->Payload;
+	}
+
+	/** エントリを検索（保存状態は確認しない） */
+	PayloadType* Find(FName PackageName)
+	{
+		FEntry* Entry = Entries.Find(PackageName);
+		return Entry ? &Entry->Payload : nullptr;
+	}
+
+	/**
+	 * 現在の保存状態でエントリを記録（既存のペイロードは維持）
+	 * レジストリに無いパッケージは空の状態で記録され、参照時に無効になる
+	 */
+	PayloadType& Record(FName PackageName)
+	{
+		FEntry& Entry = Entries.FindOrAdd(PackageName);
+		if (!FAssetPackageState::GetCurrent(PackageName, Entry.State))
+		{
+			Entry.State = FAssetPackageState();
+		}
+		return Entry.Payload;
+	}
+
+	/** エントリを破棄 */
+	void Remove(FName PackageName) { Entries.Remove(PackageName); }
+
+	/** 全キャッシュを破棄 */
+	void Reset() { Entries.Reset(); }
+
+	/** キャッシュ済みパッケージ数 */
+	int32 Num() const { return Entries.Num(); }
+
+protected:
+	/**
+	 * ファイルからエントリを読み込み、保存後に状態が変わったパッケージを返す（破棄は派生側で行う）
+	 * @return 読み込めたか（旧フォーマットは破棄して作り直す）
+	 */
+	bool LoadEntries(const FString& FilePath, uint32 Magic, int32 Version,
+		TFunctionRef<void(FArchive&, PayloadType&, FAssetCacheNameTable&)> SerializePayload, TArray<FName>& OutChangedPackages)
+	{
+		Reset();
+		OutChangedPackages.Reset();
+
+		const bool bLoaded = LoadFile(FilePath, Magic, Version, [this, &SerializePayload](FArchive& Ar, FAssetCacheNameTable& NameTable)
+		{
+			int32 NumEntries = 0;
+			Ar << NumEntries;
+			Entries.Reserve(NumEntries);
+
+			for (int32 Index = 0; Index < NumEntries && !Ar.IsError(); ++Index)
+			{
+				FName PackageName;
+				NameTable.Serialize(Ar, PackageName);
+
+				FEntry& Entry = Entries.Add(PackageName);
+				Ar << Entry.State;
+				SerializePayload(Ar, Entry.Payload, NameTable);
+			}
+		});
+
+		if (!bLoaded)
+		{
+			Reset();
+			return false;
+		}
+
+		for (const TPair<FName, FEntry>& Pair : Entries)
+		{
+			FAssetPackageState CurrentState;
+			if (!FAssetPackageState::GetCurrent(Pair.Key, CurrentState) || CurrentState != Pair.Value.State)
+			{
+				OutChangedPackages.Add(Pair.Key);
+			}
+		}
+		return true;
+	}
+
+	/** エントリをファイルへ書き出す（SerializePayloadは書き込み用の複製を受け取る） */
+	bool SaveEntries(const FString& FilePath, uint32 Magic, int32 Version,
+		TFunctionRef<void(FArchive&, PayloadType&, FAssetCacheNameTable&)> SerializePayload) const
+	{
+		return SaveFile(FilePath, Magic, Version, [this, &SerializePayload](FArchive& Ar, FAssetCacheNameTable& NameTable)
+		{
+			int32 NumEntries = Entries.Num();
+			Ar << NumEntries;
+
+			for (const TPair<FName, FEntry>& Pair : Entries)
+			{
+				FName PackageName = Pair.Key;
+				FEntry EntryCopy = Pair.Value;
+				NameTable.Serialize(Ar, PackageName);
+				Ar << EntryCopy.State;
+				SerializePayload(Ar, EntryCopy.Payload, NameTable);
+			}
+		});
+	}
+
+	/** パッケージ名 → エントリ */
+	TMap<FName, FEntry> Entries;
+};
@@ -30,6 +30,8 @@ public class AssetDependencyCostInspector : ModuleRules
 				"UnrealEd",
 				"EditorStyle",
 				"AssetRegistry",
+				"AssetRegistryGraph",
+				"AssetAnalysisCommon",
 				"ContentBrowser",
 				"ToolMenus",
 				"WorkspaceMenuStructure",
@@ -46,7 +48,9 @@ public class AssetDependencyCostInspector : ModuleRules
 				"ToolWidgets",
 				"EditorWidgets",
 				"RenderCore",
-				"RHI"
+				"RHI",
+				"Json",
+				"JsonUtilities"
 			}
 		);
 
@@ -0,0 +1,162 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetAnalysisContext.h"
+#include "AssetRegistryGraph.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+
+FAssetAnalysisContext FAssetAnalysisContext::FromPath(const FString& InAssetPath, bool bLoadAsset)
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	FAssetData FoundData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(InAssetPath));
+	if (FoundData.IsValid())
+	{
+		FAssetAnalysisContext Context = FromAssetData(FoundData, bLoadAsset);
+		Context.AssetPath = InAssetPath;
+		return Context;
+	}
+
+	// レジストリに無い場合はロードを試みる（未スキャンのパス等）
+	FAssetAnalysisContext Context;
+	Context.AssetPath = InAssetPath;
+
+	if (bLoadAsset)
+	{
+		if (UObject* Loaded = LoadObject<UObject>(nullptr, *InAssetPath))
+		{
+			Context.Asset = Loaded;
+			Context.AssetData = FAssetData(Loaded);
+		}
+	}
+
+	Context.ResolvePackageData();
+	return Context;
+}
+
+FAssetAnalysisContext FAssetAnalysisContext::FromAssetData(const FAssetData& InAssetData, bool bLoadAsset)
+{
+	FAssetAnalysisContext Context;
+	Context.AssetPath = InAssetData.GetObjectPathString();
+	Context.AssetData = InAssetData;
+
+	if (bLoadAsset && InAssetData.IsValid())
+	{
+		Context.Asset = InAssetData.GetAsset();
+	}
+
+	Context.ResolvePackageData();
+	return Context;
+}
+
+FAssetAnalysisContext FAssetAnalysisContext::FromObject(UObject* InAsset)
+{
+	FAssetAnalysisContext Context;
+
+	if (!InAsset)
+	{
+		return Context;
+	}
+
+	Context.AssetPath = InAsset->GetPathName();
+	Context.Asset = InAsset;
+	Context.AssetData = FAssetData(InAsset);
+	Context.ResolvePackageData();
+	return Context;
+}
+
+FName FAssetAnalysisContext::GetPackageName() const
+{
+	if (AssetData.IsValid())
+	{
+		return AssetData.PackageName;
+	}
+	return FName(*FPackageName::ObjectPathToPackageName(AssetPath));
+}
+
+bool FAssetAnalysisContext::LoadAsset()
+{
+	check(IsInGameThread());
+
+	if (!Asset.IsValid() && AssetData.IsValid())
+	{
+		Asset = AssetData.GetAsset();
+	}
+	return Asset.IsValid();
+}
+
+void FAssetAnalysisContext::ResolveDependencyStats(int32 MaxDepth)
+{
+	// 直接依存は共有グラフから取得（他のアセットの分析で取得済みのパッケージは問い合わせない）
+	FAssetRegistryGraph& RegistryGraph = FAssetRegistryGraph::Get();
+
+	DirectDependencyCount = 0;
+	TotalDependencyCount = 0;
+	MaxDependencyDepth = 0;
+	DependencyPackages.Reset();
+
+	const FName RootPackage = GetPackageName();
+
+	TSet<FName> Visited;
+	Visited.Add(RootPackage);
+
+	TArray<FName> Frontier;
+	Frontier.Add(RootPackage);
+
+	// 幅優先で深度ごとに辿る
+	for (int32 Depth = 1; Depth <= MaxDepth && Frontier.Num() > 0; ++Depth)
+	{
+		TArray<FName> NextFrontier;
+
+		for (const FName& PackageName : Frontier)
+		{
+			// エンジンアセットは除外
+			TArray<FName> Dependencies;
+			RegistryGraph.GetDependencies(PackageName, Dependencies, EAssetGraphFilter::ExcludeEngineAndScript);
+
+			for (const FName& DependencyName : Dependencies)
+			{
+				if (Depth == 1)
+				{
+					DirectDependencyCount++;
+				}
+
+				bool bAlreadyVisited = false;
+				Visited.Add(DependencyName, &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					TotalDependencyCount++;
+					MaxDependencyDepth = FMath::Max(MaxDependencyDepth, Depth);
+					NextFrontier.Add(DependencyName);
+					DependencyPackages.Add(DependencyName);
+				}
+			}
+		}
+
+		Frontier = MoveTemp(NextFrontier);
+	}
+
+	bHasDependencyStats = true;
+}
+
+void FAssetAnalysisContext::ResolvePackageData()
+{
+	const FName PackageName = GetPackageName();
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+
+	// ワーカースレッドからも呼ばれるためGetModuleCheckedを使用
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	FAssetPackageData PackageData;
+	if (AssetRegistry.TryGetAssetPackageData(PackageName, PackageData) == UE::AssetRegistry::EExists::Exists)
+	{
+		DiskSize = PackageData.DiskSize;
+		bHasPackageData = true;
+	}
+}
@@ -7,6 +7,7 @@
 #include "Engine/SkeletalMesh.h"
 #include "Engine/Texture.h"
 #include "Engine/Texture2D.h"
+#include "Engine/VolumeTexture.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstance.h"
@@ -19,6 +20,74 @@
 #include "UObject/UObjectIterator.h"
 #include "Serialization/ArchiveCountMem.h"
 #include "HAL/PlatformFileManager.h"
+#include "AssetCostBatchAnalysis.h"
+#include "AssetDependencyGraphCache.h"
+#include "AssetGraphCycles.h"
+#include "AssetRegistryGraph.h"
+#include "AssetCostCache.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** ツリー内の参照回数をノードへ反映 */
+	void ApplyReferenceCounts(FAssetDependencyNode& Node, const TMap<FString, int32>& ReferenceCounts)
+	{
+		for (FAssetDependencyNode& Child : Node.Children)
+		{
+			Child.Info.ReferenceCount = ReferenceCounts.FindRef(Child.Info.AssetPath);
+			ApplyReferenceCounts(Child, ReferenceCounts);
+		}
+	}
+
+	/** 頂点あたりのバイト数（位置 + タンジェント + UV、フル精度想定） */
+	int64 EstimateBytesPerVertex(int32 NumUVChannels)
+	{
+		return sizeof(FVector3f) + 8 + 8 * FMath::Max(1, NumUVChannels);
+	}
+
+	/** LOD0のサイズからLODチェーン全体を推定（LODごとに概ね半減） */
+	int64 EstimateLODChainSize(int64 LOD0Size, int32 NumLODs)
+	{
+		int64 TotalSize = 0;
+		int64 LODSize = LOD0Size;
+		for (int32 LODIndex = 0; LODIndex < FMath::Max(1, NumLODs); ++LODIndex)
+		{
+			TotalSize += LODSize;
+			LODSize /= 2;
+		}
+		return TotalSize;
+	}
+
+	/** NaniteEnabledタグを取得 */
+	bool IsNaniteEnabledByTag(const FAssetData& AssetData)
+	{
+		FString NaniteValue;
+		return AssetData.GetTagValue(TEXT("NaniteEnabled"), NaniteValue) && NaniteValue.ToBool();
+	}
+
+	/** Dimensionsタグ（"幅x高さ"）を解析 */
+	bool ParseTextureDimensions(const FAssetData& AssetData, int32& OutWidth, int32& OutHeight)
+	{
+		FString Dimensions;
+		FString WidthStr;
+		FString HeightStr;
+		if (!AssetData.GetTagValue(TEXT("Dimensions"), Dimensions) || !Dimensions.Split(TEXT("x"), &WidthStr, &HeightStr))
+		{
+			return false;
+		}
+
+		OutWidth = FCString::Atoi(*WidthStr);
+		OutHeight = FCString::Atoi(*HeightStr);
+		return OutWidth > 0 && OutHeight > 0;
+	}
+
+	/** レジストリ情報からスライス数を推定（キューブマップは6面） */
+	int32 GetTextureSliceCountFromRegistry(const FAssetData& AssetData)
+	{
+		return AssetData.AssetClassPath.GetAssetName() == TEXT("TextureCube") ? 6 : 1;
+	}
+}
 
 UAssetCostAnalyzer::UAssetCostAnalyzer()
 {
@@ -27,56 +96,112 @@ UAssetCostAnalyzer::UAssetCostAnalyzer()
 
 FAssetCostReport UAssetCostAnalyzer::AnalyzeAsset(const FString& AssetPath)
 {
+	// キャッシュヒット時はロードしない
+	if (CostCache.IsValid())
+	{
+		if (const FAssetCostReport* CachedReport = FindCachedReport(FAssetAnalysisContext::FromPath(AssetPath, false), true))
+		{
+			return *CachedReport;
+		}
+	}
+
+	return AnalyzeAssetInContext(FAssetAnalysisContext::FromPath(AssetPath, ShouldLoadAssets()));
+}
+
+FAssetCostReport UAssetCostAnalyzer::AnalyzeAssetInContext(const FAssetAnalysisContext& Context, FAssetDependencyGraphCache* RunGraph)
+{
+	// 変更のないパッケージは前回のレポートを再利用
+	const bool bBuildsDependencyTree = !Context.bHasDependencyStats;
+	if (const FAssetCostReport* CachedReport = FindCachedReport(Context, bBuildsDependencyTree))
+	{
+		return *CachedReport;
+	}
+
 	FAssetCostReport Report;
-	Report.AssetPath = AssetPath;
+	Report.AssetPath = Context.AssetPath;
 	Report.AnalysisTime = FDateTime::Now();
 
-	// アセットをロード
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset)
+	UObject* Asset = Context.GetAsset();
+
+	// レジストリのみモードでは未ロードのままレジストリ情報から推定する
+	const bool bEstimateFromRegistry = !Asset && !ShouldLoadAssets() && Context.AssetData.IsValid();
+	if (!Asset && !bEstimateFromRegistry)
 	{
 		Report.HumanReadableSummary = TEXT("アセットをロードできませんでした");
 		return Report;
 	}
 
-	Report.AssetName = Asset->GetName();
-	Report.Category = GetAssetCategory(Asset->GetClass());
+	if (Asset)
+	{
+		Report.AssetName = Asset->GetName();
+		Report.Category = GetAssetCategory(Asset->GetClass());
+	}
+	else
+	{
+		Report.AssetName = Context.AssetData.AssetName.ToString();
+		Report.Category = GetAssetCategory(Context.AssetData.GetClass());
+	}
 
-	// 各コストを計算
-	Report.MemoryCost = CalculateMemoryCost(AssetPath);
-	Report.StreamingInfo = GetStreamingInfo(AssetPath);
-	Report.LoadTiming = AnalyzeLoadTiming(AssetPath);
-	Report.UE5Cost = CalculateUE5Cost(AssetPath);
+	// 各コストを計算（解決済みコンテキストを共有）
+	Report.MemoryCost = CalculateMemoryCostInContext(Context);
+	Report.StreamingInfo = GetStreamingInfoInContext(Context);
+	Report.LoadTiming = AnalyzeLoadTimingInContext(Context);
+	Report.UE5Cost = CalculateUE5CostInContext(Context);
 
-	// 依存ツリーを構築
-	Report.DependencyTree = BuildDependencyTree(AssetPath, 10);
+	if (Context.bHasDependencyStats)
+	{
+		// バッチ分析ではレジストリ上で事前計算済みの統計を使い、ツリー構築を省略
+		Report.DirectDependencyCount = Context.DirectDependencyCount;
+		Report.TotalDependencyCount = Context.TotalDependencyCount;
+		Report.MaxDependencyDepth = Context.MaxDependencyDepth;
 
-	// 依存関係統計を計算
-	TSet<FString> AllDependencies;
-	TQueue<const FAssetDependencyNode*> NodeQueue;
-	NodeQueue.Enqueue(&Report.DependencyTree);
+		// 依存込みコストは深さ制限内の各パッケージを一度ずつ加算（コストはグラフ上でパッケージごとに一度だけ計算）
+		// 依存先はロードせずレジストリ情報から推定する（時間分割の1スライス内で閉包全体をロードしない）
+		FAssetDependencyGraphCache LocalGraph;
+		FAssetDependencyGraphCache& Graph = SelectDependencyGraph(RunGraph, LocalGraph);
 
-	int32 MaxDepth = 0;
-	while (!NodeQueue.IsEmpty())
+		int64 DependencyCost = 0;
+		for (const FName& PackageName : Context.DependencyPackages)
+		{
+			DependencyCost += GetRegistryMemoryCost(Graph, Graph.FindOrAddNode(PackageName));
+		}
+		Report.MemoryCost.TotalCostWithDependencies = Report.MemoryCost.MemorySize + DependencyCost;
+	}
+	else
 	{
-		const FAssetDependencyNode* CurrentNode;
-		NodeQueue.Dequeue(CurrentNode);
+		// 依存ツリーを構築
+		Report.DependencyTree = BuildDependencyTreeInContext(Context, 10, RunGraph);
 
-		MaxDepth = FMath::Max(MaxDepth, CurrentNode->Info.Depth);
+		// 依存関係統計を計算
+		TSet<FString> AllDependencies;
+		TQueue<const FAssetDependencyNode*> NodeQueue;
+		NodeQueue.Enqueue(&Report.DependencyTree);
 
-		for (const FAssetDependencyNode& Child : CurrentNode->Children)
+		int32 MaxDepth = 0;
+		while (!NodeQueue.IsEmpty())
 		{
-			AllDependencies.Add(Child.Info.AssetPath);
-			NodeQueue.Enqueue(&Child);
+			const FAssetDependencyNode* CurrentNode;
+			NodeQueue.Dequeue(CurrentNode);
+
+			MaxDepth = FMath::Max(MaxDepth, CurrentNode->Info.Depth);
+
+			for (const FAssetDependencyNode& Child : CurrentNode->Children)
+			{
+				AllDependencies.Add(Child.Info.AssetPath);
+				NodeQueue.Enqueue(&Child);
+			}
 		}
-	}
 
-	Report.DirectDependencyCount = Report.DependencyTree.Children.Num();
-	Report.TotalDependencyCount = AllDependencies.Num();
-	Report.MaxDependencyDepth = MaxDepth;
+		Report.DirectDependencyCount = Report.DependencyTree.Children.Num();
+		Report.TotalDependencyCount = AllDependencies.Num();
+		Report.MaxDependencyDepth = MaxDepth;
+
+		// 共有依存は一度だけ集計されている（依存数・深さと同じく深さ制限内のみ）
+		Report.MemoryCost.TotalCostWithDependencies = Report.MemoryCost.MemorySize + Report.DependencyTree.SubtreeTotalCost;
+	}
 
 	// 循環参照を検出
-	DetectCircularReferences(AssetPath, Report.CircularReferences);
+	DetectCircularReferences(Context, Report.CircularReferences);
 
 	// 問題と最適化推奨を生成
 	DetectIssues(Report);
@@ -110,6 +235,11 @@ FAssetCostReport UAssetCostAnalyzer::AnalyzeAsset(const FString& AssetPath)
 
 	Report.HumanReadableSummary = GenerateHumanReadableSummary(Report);
 
+	if (CostCache.IsValid())
+	{
+		CostCache->StoreReport(Context.GetPackageName(), Report, GetCostCacheSettingsHash(), bBuildsDependencyTree, Context.DependencyPackages);
+	}
+
 	return Report;
 }
 
@@ -122,7 +252,8 @@ FAssetCostReport UAssetCostAnalyzer::AnalyzeLoadedAsset(UObject* Asset)
 		return EmptyReport;
 	}
 
-	return AnalyzeAsset(Asset->GetPathName());
+	// ロード済みなので再ロードせずにコンテキストを作成
+	return AnalyzeAssetInContext(FAssetAnalysisContext::FromObject(Asset));
 }
 
 FProjectCostSummary UAssetCostAnalyzer::AnalyzeFolder(const FString& FolderPath)
@@ -142,69 +273,138 @@ FProjectCostSummary UAssetCostAnalyzer::AnalyzeFolder(const FString& FolderPath)
 	TArray<FAssetData> AssetDataList;
 	AssetRegistry.GetAssets(Filter, AssetDataList);
 
-	TArray<FAssetCostReport> AllReports;
 	TMap<EAssetCategory, FCategoryCostSummary> CategoryMap;
 
+	// 循環グループを一度だけ計算し、各レポートから参照する
+	Summary.CycleGroups = AnalyzeProjectCycles(FolderPath);
+
+	// 依存グラフは実行中のアセット間で共有し、共有パッケージの依存取得・コスト計算を一度で済ませる
+	FAssetDependencyGraphCache RunGraph;
+
 	for (const FAssetData& AssetData : AssetDataList)
 	{
-		FString AssetPath = AssetData.GetObjectPathString();
-		FAssetCostReport Report = AnalyzeAsset(AssetPath);
+		// レジストリ情報は取得済みなので検索を省略
+		FAssetAnalysisContext Context = FAssetAnalysisContext::FromAssetData(AssetData, false);
 
-		AllReports.Add(Report);
-		Summary.TotalAssetCount++;
-		Summary.TotalMemoryCost += Report.MemoryCost.MemorySize;
-		Summary.TotalDiskSize += Report.MemoryCost.DiskSize;
-
-		// カテゴリ別集計
-		if (!CategoryMap.Contains(Report.Category))
+		// キャッシュヒット時はロードしない
+		if (ShouldLoadAssets() && !FindCachedReport(Context, true))
 		{
-			FCategoryCostSummary CatSummary;
-			CatSummary.Category = Report.Category;
-			CatSummary.CategoryName = GetCategoryName(Report.Category);
-			CategoryMap.Add(Report.Category, CatSummary);
+			Context.LoadAsset();
 		}
 
-		FCategoryCostSummary& CatSummary = CategoryMap[Report.Category];
-		CatSummary.AssetCount++;
-		CatSummary.TotalMemoryCost += Report.MemoryCost.MemorySize;
-		CatSummary.TotalDiskSize += Report.MemoryCost.DiskSize;
+		FAssetCostReport Report = AnalyzeAssetInContext(Context, &RunGraph);
+		AccumulateReport(Summary, CategoryMap, Report);
+	}
 
-		if (Report.MemoryCost.MemorySize > CatSummary.HeaviestAssetCost)
-		{
-			CatSummary.HeaviestAssetCost = Report.MemoryCost.MemorySize;
-			CatSummary.HeaviestAsset = Report.AssetName;
-		}
+	FinalizeSummary(Summary, CategoryMap);
+	SaveCostCache();
 
-		// 統計
-		if (Report.UE5Cost.bNaniteEnabled)
-		{
-			Summary.NaniteAssetCount++;
-		}
-		if (Report.StreamingInfo.bIsStreamable)
-		{
-			Summary.StreamableAssetCount++;
-		}
-		if (Report.CircularReferences.Num() > 0)
-		{
-			Summary.CircularReferenceCount++;
-		}
+	return Summary;
+}
+
+FProjectCostSummary UAssetCostAnalyzer::AnalyzeProject()
+{
+	return AnalyzeFolder(TEXT("/Game"));
+}
+
+TSharedRef<FAssetCostBatchAnalysis> UAssetCostAnalyzer::AnalyzeFolderAsync(const FString& FolderPath, const FAssetCostBatchSettings& Settings)
+{
+	TSharedRef<FAssetCostBatchAnalysis> Batch = MakeShared<FAssetCostBatchAnalysis>(this, FolderPath, Settings);
+	Batch->Start();
+	return Batch;
+}
+
+TSharedRef<FAssetCostBatchAnalysis> UAssetCostAnalyzer::AnalyzeProjectAsync(const FAssetCostBatchSettings& Settings)
+{
+	return AnalyzeFolderAsync(TEXT("/Game"), Settings);
+}
+
+void UAssetCostAnalyzer::AccumulateReport(FProjectCostSummary& Summary, TMap<EAssetCategory, FCategoryCostSummary>& CategoryMap, const FAssetCostReport& Report) const
+{
+	Summary.TotalAssetCount++;
+	Summary.TotalMemoryCost += Report.MemoryCost.MemorySize;
+	Summary.TotalDiskSize += Report.MemoryCost.DiskSize;
+
+	// カテゴリ別集計
+	if (!CategoryMap.Contains(Report.Category))
+	{
+		FCategoryCostSummary CatSummary;
+		CatSummary.Category = Report.Category;
+		CatSummary.CategoryName = GetCategoryName(Report.Category);
+		CategoryMap.Add(Report.Category, CatSummary);
+	}
+
+	FCategoryCostSummary& CatSummary = CategoryMap[Report.Category];
+	CatSummary.AssetCount++;
+	CatSummary.TotalMemoryCost += Report.MemoryCost.MemorySize;
+	CatSummary.TotalDiskSize += Report.MemoryCost.DiskSize;
+
+	if (Report.MemoryCost.MemorySize > CatSummary.HeaviestAssetCost)
+	{
+		CatSummary.HeaviestAssetCost = Report.MemoryCost.MemorySize;
+		CatSummary.HeaviestAsset = Report.AssetName;
+	}
+
+	// 統計
+	if (Report.UE5Cost.bNaniteEnabled)
+	{
+		Summary.NaniteAssetCount++;
+	}
+	if (Report.StreamingInfo.bIsStreamable)
+	{
+		Summary.StreamableAssetCount++;
+	}
+	if (Report.CircularReferences.Num() > 0)
+	{
+		Summary.CircularReferenceCount++;
+	}
+	if (Report.MemoryCost.CostSource == EAssetCostSource::Estimated)
+	{
+		Summary.EstimatedAssetCount++;
+	}
 
-		// 問題のあるアセット
-		if (Report.OverallCostLevel == EAssetCostLevel::Critical ||
-			Report.OverallCostLevel == EAssetCostLevel::High)
+	// 問題のあるアセット
+	if (Report.OverallCostLevel == EAssetCostLevel::Critical ||
+		Report.OverallCostLevel == EAssetCostLevel::High)
+	{
+		Summary.ProblematicAssets.Add(Report.AssetPath);
+	}
+
+	// 最も重いアセットTop10（全レポートを保持せず逐次挿入）
+	const int32 MaxHeaviest = 10;
+	const int64 ReportCost = Report.MemoryCost.TotalCostWithDependencies;
+	int32 InsertIndex = Summary.HeaviestAssets.IndexOfByPredicate([ReportCost](const FAssetCostReport& Existing)
+	{
+		return ReportCost > Existing.MemoryCost.TotalCostWithDependencies;
+	});
+	if (InsertIndex == INDEX_NONE)
+	{
+		InsertIndex = Summary.HeaviestAssets.Num();
+	}
+	if (InsertIndex < MaxHeaviest)
+	{
+		Summary.HeaviestAssets.Insert(Report, InsertIndex);
+		if (Summary.HeaviestAssets.Num() > MaxHeaviest)
 		{
-			Summary.ProblematicAssets.Add(AssetPath);
+			Summary.HeaviestAssets.RemoveAt(MaxHeaviest, Summary.HeaviestAssets.Num() - MaxHeaviest);
 		}
 	}
+}
+
+void UAssetCostAnalyzer::FinalizeSummary(FProjectCostSummary& Summary, const TMap<EAssetCategory, FCategoryCostSummary>& CategoryMap)
+{
+	// 途中経過の表示でも繰り返し呼べるよう毎回作り直す
+	Summary.CategorySummaries.Reset();
 
 	// カテゴリ別パーセンテージを計算
-	for (auto& Pair : CategoryMap)
+	for (const auto& Pair : CategoryMap)
 	{
+		FCategoryCostSummary CatSummary = Pair.Value;
 		if (Summary.TotalMemoryCost > 0)
 		{
-			Pair.Value.Percentage = (float)Pair.Value.TotalMemoryCost / Summary.TotalMemoryCost * 100.0f;
+			CatSummary.Percentage = (float)CatSummary.TotalMemoryCost / Summary.TotalMemoryCost * 100.0f;
 		}
-		Summary.CategorySummaries.Add(Pair.Value);
+		Summary.CategorySummaries.Add(CatSummary);
 	}
 
 	// コストでソート
@@ -212,39 +412,29 @@ FProjectCostSummary UAssetCostAnalyzer::AnalyzeFolder(const FString& FolderPath)
 	{
 		return A.TotalMemoryCost > B.TotalMemoryCost;
 	});
-
-	// 最も重いアセットTop10
-	AllReports.Sort([](const FAssetCostReport& A, const FAssetCostReport& B)
-	{
-		return A.MemoryCost.TotalCostWithDependencies > B.MemoryCost.TotalCostWithDependencies;
-	});
-
-	int32 TopCount = FMath::Min(10, AllReports.Num());
-	for (int32 i = 0; i < TopCount; ++i)
-	{
-		Summary.HeaviestAssets.Add(AllReports[i]);
-	}
-
-	return Summary;
 }
 
-FProjectCostSummary UAssetCostAnalyzer::AnalyzeProject()
+FAssetMemoryCost UAssetCostAnalyzer::CalculateMemoryCost(const FString& AssetPath)
 {
-	return AnalyzeFolder(TEXT("/Game"));
+	return CalculateMemoryCostInContext(FAssetAnalysisContext::FromPath(AssetPath, ShouldLoadAssets()));
 }
 
-FAssetMemoryCost UAssetCostAnalyzer::CalculateMemoryCost(const FString& AssetPath)
+FAssetMemoryCost UAssetCostAnalyzer::CalculateMemoryCostInContext(const FAssetAnalysisContext& Context)
 {
 	FAssetMemoryCost Cost;
 
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+	UObject* Asset = Context.GetAsset();
 	if (!Asset)
 	{
-		return Cost;
+		// レジストリのみモードでは未ロードのまま推定
+		if (ShouldLoadAssets() || !Context.AssetData.IsValid())
+		{
+			return Cost;
+		}
+		Cost = EstimateMemoryCostFromRegistry(Context);
 	}
-
 	// アセットタイプに応じたコスト計算
-	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset))
+	else if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Asset))
 	{
 		Cost = CalculateStaticMeshCost(StaticMesh);
 	}
@@ -269,19 +459,8 @@ FAssetMemoryCost UAssetCostAnalyzer::CalculateMemoryCost(const FString& AssetPat
 		Cost = CalculateGenericCost(Asset);
 	}
 
-	// ディスクサイズを取得
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
-	if (AssetData.IsValid())
-	{
-		FAssetPackageData PackageData;
-		if (AssetRegistry.TryGetAssetPackageData(AssetData.PackageName, PackageData) == UE::AssetRegistry::EExists::Exists)
-		{
-			Cost.DiskSize = PackageData.DiskSize;
-		}
-	}
+	// ディスクサイズ（コンテキストで解決済み）
+	Cost.DiskSize = Context.DiskSize;
 
 	// 圧縮率
 	if (Cost.DiskSize > 0 && Cost.MemorySize > 0)
@@ -295,33 +474,76 @@ FAssetMemoryCost UAssetCostAnalyzer::CalculateMemoryCost(const FString& AssetPat
 }
 
 FAssetDependencyNode UAssetCostAnalyzer::BuildDependencyTree(const FString& AssetPath, int32 MaxDepth)
+{
+	// 依存ツリーはレジストリのみで構築できるのでルートはロードしない
+	return BuildDependencyTreeInContext(FAssetAnalysisContext::FromPath(AssetPath, false), MaxDepth);
+}
+
+FAssetDependencyNode UAssetCostAnalyzer::BuildDependencyTreeInContext(const FAssetAnalysisContext& Context, int32 MaxDepth, FAssetDependencyGraphCache* RunGraph)
 {
 	FAssetDependencyNode RootNode;
-	RootNode.Info.AssetPath = AssetPath;
+	RootNode.Info.AssetPath = Context.AssetPath;
 	RootNode.Info.Depth = 0;
 
 	// アセット名を取得
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	if (Context.AssetData.IsValid())
+	{
+		RootNode.Info.AssetName = Context.AssetData.AssetName.ToString();
+		RootNode.Info.Category = GetAssetCategory(Context.AssetData.GetClass());
+	}
 
-	FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
-	if (AssetData.IsValid())
+	FAssetDependencyGraphCache LocalGraph;
+	FAssetDependencyGraphCache& Graph = SelectDependencyGraph(RunGraph, LocalGraph);
+
+	// 依存クエリはパッケージ名で行う
+	const int32 RootIndex = Graph.FindOrAddNode(Context.GetPackageName());
+
+	// 各パッケージは最短の深さで展開する（最初に辿った経路が深いと深さ制限で子が切り捨てられるため）
+	TMap<int32, int32> ShortestDepths;
+	ShortestDepths.Add(RootIndex, 0);
+	TArray<int32> Queue;
+	Queue.Add(RootIndex);
+	for (int32 QueueHead = 0; QueueHead < Queue.Num(); ++QueueHead)
 	{
-		RootNode.Info.AssetName = AssetData.AssetName.ToString();
-		RootNode.Info.Category = GetAssetCategory(AssetData.GetClass());
+		const int32 CurrentIndex = Queue[QueueHead];
+		const int32 NextDepth = ShortestDepths[CurrentIndex] + 1;
+		if (NextDepth > MaxDepth)
+		{
+			continue;
+		}
+
+		const TArray<int32> Dependencies = Graph.ResolveDependencies(CurrentIndex);
+		for (int32 DepIndex : Dependencies)
+		{
+			if (!ShortestDepths.Contains(DepIndex))
+			{
+				ShortestDepths.Add(DepIndex, NextDepth);
+				Queue.Add(DepIndex);
+			}
+		}
 	}
 
-	TSet<FString> VisitedAssets;
-	VisitedAssets.Add(AssetPath);
+	TSet<int32> ExpandedNodes;
+	ExpandedNodes.Add(RootIndex);
 
-	CollectDependenciesRecursive(AssetPath, VisitedAssets, RootNode, 0, MaxDepth);
+	TSet<int32> ActivePath;
+	ActivePath.Add(RootIndex);
+
+	TMap<FString, int32> ReferenceCounts;
+
+	CollectDependenciesRecursive(Graph, RootIndex, ShortestDepths, ExpandedNodes, ActivePath, ReferenceCounts, RootNode, 0, MaxDepth);
+	ApplyReferenceCounts(RootNode, ReferenceCounts);
 
 	return RootNode;
 }
 
 void UAssetCostAnalyzer::CollectDependenciesRecursive(
-	const FString& AssetPath,
-	TSet<FString>& VisitedAssets,
+	FAssetDependencyGraphCache& Graph,
+	int32 NodeIndex,
+	const TMap<int32, int32>& ShortestDepths,
+	TSet<int32>& ExpandedNodes,
+	TSet<int32>& ActivePath,
+	TMap<FString, int32>& ReferenceCounts,
 	FAssetDependencyNode& OutNode,
 	int32 CurrentDepth,
 	int32 MaxDepth)
@@ -331,104 +553,212 @@ void UAssetCostAnalyzer::CollectDependenciesRecursive(
 		return;
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	TArray<FAssetIdentifier> Dependencies;
-	AssetRegistry.GetDependencies(FAssetIdentifier(FName(*AssetPath)), Dependencies);
+	// 再帰中にグラフへノードが追加されるためコピーして保持
+	const TArray<int32> Dependencies = Graph.ResolveDependencies(NodeIndex);
 
 	int64 SubtreeCost = 0;
 	int32 SubtreeCount = 0;
 
-	for (const FAssetIdentifier& DepId : Dependencies)
+	for (int32 DepIndex : Dependencies)
 	{
-		FString DepPath = DepId.PackageName.ToString();
-
-		// エンジンアセットはスキップ
-		if (DepPath.StartsWith(TEXT("/Engine")) || DepPath.StartsWith(TEXT("/Script")))
-		{
-			continue;
-		}
+		const FAssetDependencyGraphNode& DepNode = Graph.GetNode(DepIndex);
 
 		FAssetDependencyNode ChildNode;
-		ChildNode.Info.AssetPath = DepPath;
+		ChildNode.Info.AssetPath = DepNode.PackageName.ToString();
+		ChildNode.Info.AssetName = DepNode.AssetName;
+		ChildNode.Info.Category = DepNode.Category;
 		ChildNode.Info.Depth = CurrentDepth + 1;
 
-		// アセット情報を取得
-		FAssetData DepAssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(DepPath));
-		if (DepAssetData.IsValid())
-		{
-			ChildNode.Info.AssetName = DepAssetData.AssetName.ToString();
-			ChildNode.Info.Category = GetAssetCategory(DepAssetData.GetClass());
-		}
-		else
-		{
-			ChildNode.Info.AssetName = FPaths::GetBaseFilename(DepPath);
-		}
+		// メモリコスト（パッケージごとに一度だけ計算）
+		ChildNode.Info.MemoryCost = GetCachedMemoryCost(Graph, DepIndex);
 
-		// メモリコストを計算
-		FAssetMemoryCost DepCost = CalculateMemoryCost(DepPath);
-		ChildNode.Info.MemoryCost = DepCost.MemorySize;
+		ReferenceCounts.FindOrAdd(ChildNode.Info.AssetPath)++;
 
-		// 循環参照チェック
-		if (VisitedAssets.Contains(DepPath))
+		if (ActivePath.Contains(DepIndex))
 		{
+			// 探索経路上の祖先へ戻る辺 = 循環参照
 			ChildNode.Info.bIsInCircularReference = true;
 		}
+		else if (ExpandedNodes.Contains(DepIndex) || ShortestDepths.FindRef(DepIndex) != CurrentDepth + 1)
+		{
+			// 別経路で展開済み、またはより浅い経路で展開される: 共有依存として表示
+			ChildNode.Info.bIsShared = true;
+		}
 		else
 		{
-			VisitedAssets.Add(DepPath);
+			ExpandedNodes.Add(DepIndex);
+			ActivePath.Add(DepIndex);
 
 			// 再帰的に依存を収集
-			CollectDependenciesRecursive(DepPath, VisitedAssets, ChildNode, CurrentDepth + 1, MaxDepth);
-		}
+			CollectDependenciesRecursive(Graph, DepIndex, ShortestDepths, ExpandedNodes, ActivePath, ReferenceCounts, ChildNode, CurrentDepth + 1, MaxDepth);
+
+			ActivePath.Remove(DepIndex);
 
-		SubtreeCost += ChildNode.Info.MemoryCost + ChildNode.SubtreeTotalCost;
-		SubtreeCount += 1 + ChildNode.SubtreeAssetCount;
+			// 深さ制限内の各パッケージは展開した位置でのみ集計する（共有・循環参照は再加算しない）
+			SubtreeCost += ChildNode.Info.MemoryCost + ChildNode.SubtreeTotalCost;
+			SubtreeCount += 1 + ChildNode.SubtreeAssetCount;
+		}
 
-		OutNode.Children.Add(ChildNode);
+		OutNode.Children.Add(MoveTemp(ChildNode));
 	}
 
 	OutNode.SubtreeTotalCost = SubtreeCost;
 	OutNode.SubtreeAssetCount = SubtreeCount;
 }
 
-FAssetStreamingInfo UAssetCostAnalyzer::GetStreamingInfo(const FString& AssetPath)
+FAssetDependencyGraphCache& UAssetCostAnalyzer::SelectDependencyGraph(FAssetDependencyGraphCache* RunGraph, FAssetDependencyGraphCache& LocalGraph) const
 {
-	FAssetStreamingInfo Info;
+	// 永続キャッシュ → 実行単位のキャッシュ → 呼び出しごとのキャッシュの順に使う
+	return PersistentDependencyGraph.IsValid() ? *PersistentDependencyGraph
+		: RunGraph ? *RunGraph
+		: LocalGraph;
+}
 
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset)
+int64 UAssetCostAnalyzer::GetCachedMemoryCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex)
+{
+	FAssetDependencyGraphNode& Node = Graph.GetNode(NodeIndex);
+	if (!Node.bCostResolved)
 	{
-		return Info;
+		Node.bCostResolved = true;
+
+		if (!Node.AssetPath.IsEmpty())
+		{
+			Node.MemoryCost = CalculateMemoryCostInContext(FAssetAnalysisContext::FromPath(Node.AssetPath, ShouldLoadAssets())).MemorySize;
+		}
 	}
+	return Node.MemoryCost;
+}
 
-	// テクスチャのStreaming情報
-	if (UTexture2D* Texture = Cast<UTexture2D>(Asset))
+int64 UAssetCostAnalyzer::GetRegistryMemoryCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex)
+{
+	FAssetDependencyGraphNode& Node = Graph.GetNode(NodeIndex);
+	if (Node.bCostResolved)
 	{
-		Info.bIsStreamable = Texture->IsStreamable();
-		Info.NumMipLevels = Texture->GetNumMips();
-		Info.NumResidentMips = Texture->GetNumResidentMips();
+		return Node.MemoryCost;
+	}
 
-		// 各MIPレベルのサイズを計算
-		int64 TotalSize = 0;
-		int64 ResidentSize = 0;
+	if (!Node.bEstimateResolved)
+	{
+		Node.bEstimateResolved = true;
 
-		for (int32 MipIndex = 0; MipIndex < Info.NumMipLevels; ++MipIndex)
+		if (!Node.AssetPath.IsEmpty())
 		{
-			int32 MipWidth = FMath::Max(1, Texture->GetSizeX() >> MipIndex);
-			int32 MipHeight = FMath::Max(1, Texture->GetSizeY() >> MipIndex);
-			int64 MipSize = MipWidth * MipHeight * 4; // 簡易計算
-
-			TotalSize += MipSize;
-			if (MipIndex >= Info.NumMipLevels - Info.NumResidentMips)
+			const FAssetAnalysisContext Context = FAssetAnalysisContext::FromPath(Node.AssetPath, false);
+			if (Context.AssetData.IsValid())
 			{
-				ResidentSize += MipSize;
+				Node.EstimatedMemoryCost = EstimateMemoryCostFromRegistry(Context).MemorySize;
 			}
 		}
+	}
+	return Node.EstimatedMemoryCost;
+}
 
-		Info.ResidentSize = ResidentSize;
-		Info.StreamedSize = TotalSize - ResidentSize;
+void UAssetCostAnalyzer::GetDependenciesSortedByCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex, TArray<int32>& OutDependencies)
+{
+	// 返される参照は次のFindOrAddNodeまでしか有効でないためコピーする
+	OutDependencies = Graph.ResolveDependencies(NodeIndex);
+
+	for (int32 DepIndex : OutDependencies)
+	{
+		GetCachedMemoryCost(Graph, DepIndex);
+	}
+
+	OutDependencies.StableSort([&Graph](int32 A, int32 B)
+	{
+		return Graph.GetNode(A).MemoryCost > Graph.GetNode(B).MemoryCost;
+	});
+}
+
+void UAssetCostAnalyzer::SetUsePersistentDependencyCache(bool bEnable)
+{
+	if (bEnable && !PersistentDependencyGraph.IsValid())
+	{
+		PersistentDependencyGraph = MakeShared<FAssetDependencyGraphCache>();
+	}
+	else if (!bEnable)
+	{
+		PersistentDependencyGraph.Reset();
+	}
+}
+
+void UAssetCostAnalyzer::ClearDependencyCache()
+{
+	if (PersistentDependencyGraph.IsValid())
+	{
+		PersistentDependencyGraph->Reset();
+	}
+}
+
+void UAssetCostAnalyzer::SetUseCostCache(bool bEnable)
+{
+	if (bEnable && !CostCache.IsValid())
+	{
+		CostCache = MakeShared<FAssetCostCache>();
+		CostCache->Load(FAssetCostCache::GetDefaultCachePath());
+	}
+	else if (!bEnable)
+	{
+		CostCache.Reset();
+	}
+}
+
+bool UAssetCostAnalyzer::SaveCostCache()
+{
+	return CostCache.IsValid() && CostCache->Save(FAssetCostCache::GetDefaultCachePath());
+}
+
+void UAssetCostAnalyzer::ClearCostCache()
+{
+	if (CostCache.IsValid())
+	{
+		CostCache->Reset();
+	}
+	IFileManager::Get().Delete(*FAssetCostCache::GetDefaultCachePath(), false, false, true);
+}
+
+const FAssetCostReport* UAssetCostAnalyzer::FindCachedReport(const FAssetAnalysisContext& Context, bool bRequireDependencyTree) const
+{
+	if (!CostCache.IsValid())
+	{
+		return nullptr;
+	}
+	return CostCache->FindReport(Context.GetPackageName(), GetCostCacheSettingsHash(), bRequireDependencyTree);
+}
+
+uint32 UAssetCostAnalyzer::GetCostCacheSettingsHash() const
+{
+	// 閾値はレベル判定・推奨に影響するため、値が変わったら別の結果として扱う
+	TArray<uint8> ThresholdBytes;
+	FMemoryWriter Writer(ThresholdBytes);
+	FAssetCostThresholds ThresholdsCopy = Thresholds;
+	FAssetCostThresholds::StaticStruct()->SerializeBin(Writer, &ThresholdsCopy);
+
+	return HashCombine(FCrc::MemCrc32(ThresholdBytes.GetData(), ThresholdBytes.Num()), GetTypeHash(AnalysisMode));
+}
+
+FAssetStreamingInfo UAssetCostAnalyzer::GetStreamingInfo(const FString& AssetPath)
+{
+	return GetStreamingInfoInContext(FAssetAnalysisContext::FromPath(AssetPath, ShouldLoadAssets()));
+}
+
+FAssetStreamingInfo UAssetCostAnalyzer::GetStreamingInfoInContext(const FAssetAnalysisContext& Context)
+{
+	FAssetStreamingInfo Info;
+
+	UObject* Asset = Context.GetAsset();
+	if (!Asset)
+	{
+		// レジストリのみモードでは未ロードのまま推定
+		if (ShouldLoadAssets() || !Context.AssetData.IsValid())
+		{
+			return Info;
+		}
+		Info = EstimateStreamingInfoFromRegistry(Context);
+	}
+	// テクスチャのStreaming情報
+	else if (UTexture* Texture = Cast<UTexture>(Asset))
+	{
+		Info = GetTextureStreamingInfo(Texture);
 	}
 	// StaticMeshのStreaming情報
 	else if (UStaticMesh* Mesh = Cast<UStaticMesh>(Asset))
@@ -458,26 +788,91 @@ FAssetStreamingInfo UAssetCostAnalyzer::GetStreamingInfo(const FString& AssetPat
 	return Info;
 }
 
+FAssetStreamingInfo UAssetCostAnalyzer::GetTextureStreamingInfo(UTexture* Texture)
+{
+	FAssetStreamingInfo Info;
+	Info.bIsStreamable = Texture->IsStreamable();
+
+	UTexture2D* Texture2D = Cast<UTexture2D>(Texture);
+
+	// 実行プラットフォーム向けに生成済みのプラットフォームデータ（ピクセルフォーマット・MIP構成・スライス数）を使用
+	FTexturePlatformData** PlatformDataPtr = Texture->GetRunningPlatformData();
+	const FTexturePlatformData* PlatformData = PlatformDataPtr ? *PlatformDataPtr : nullptr;
+
+	if (PlatformData && PlatformData->Mips.Num() > 0)
+	{
+		const EPixelFormat Format = PlatformData->PixelFormat;
+		const int32 TopSizeX = PlatformData->Mips[0].SizeX;
+		const int32 TopSizeY = PlatformData->Mips[0].SizeY;
+
+		// ボリュームテクスチャはMIPごとに奥行きが変わる、それ以外はキューブ面/配列要素数を乗算
+		const bool bIsVolume = Texture->IsA<UVolumeTexture>();
+		const int32 NumSlices = FMath::Max(1, PlatformData->GetNumSlices());
+
+		Info.NumMipLevels = PlatformData->Mips.Num();
+		Info.NumResidentMips = Texture2D ? FMath::Min(Texture2D->GetNumResidentMips(), Info.NumMipLevels) : Info.NumMipLevels;
+
+		const TArray<int64>& MipSizes = TextureMipSizes.GetMipSizes(Format, TopSizeX, TopSizeY);
+
+		int64 TotalSize = 0;
+		int64 ResidentSize = 0;
+
+		for (int32 MipIndex = 0; MipIndex < Info.NumMipLevels; ++MipIndex)
+		{
+			if (!MipSizes.IsValidIndex(MipIndex))
+			{
+				break;
+			}
+
+			const int32 Depth = bIsVolume ? FMath::Max(1, PlatformData->Mips[MipIndex].SizeZ) : NumSlices;
+			const int64 MipSize = MipSizes[MipIndex] * Depth;
+
+			TotalSize += MipSize;
+			if (MipIndex >= Info.NumMipLevels - Info.NumResidentMips)
+			{
+				ResidentSize += MipSize;
+			}
+		}
+
+		Info.ResidentSize = ResidentSize;
+		Info.StreamedSize = TotalSize - ResidentSize;
+	}
+	else
+	{
+		// プラットフォームデータが無い場合は表面サイズとソースのフォーマットから算出
+		const int32 SizeX = FMath::Max(1, (int32)Texture->GetSurfaceWidth());
+		const int32 SizeY = FMath::Max(1, (int32)Texture->GetSurfaceHeight());
+		const EPixelFormat Format = Texture2D ? Texture2D->GetPixelFormat() : PF_B8G8R8A8;
+
+		Info.NumMipLevels = FMath::FloorLog2(FMath::Max(SizeX, SizeY)) + 1;
+		Info.NumResidentMips = Info.NumMipLevels;
+		Info.ResidentSize = TextureMipSizes.GetMipRangeSize(Format, SizeX, SizeY, 0, Info.NumMipLevels);
+	}
+
+	return Info;
+}
+
 FAssetLoadTiming UAssetCostAnalyzer::AnalyzeLoadTiming(const FString& AssetPath)
 {
-	FAssetLoadTiming Timing;
+	// レジストリ情報のみで分析できるのでロードしない
+	return AnalyzeLoadTimingInContext(FAssetAnalysisContext::FromPath(AssetPath, false));
+}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+FAssetLoadTiming UAssetCostAnalyzer::AnalyzeLoadTimingInContext(const FAssetAnalysisContext& Context)
+{
+	FAssetLoadTiming Timing;
 
-	FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
-	if (!AssetData.IsValid())
+	if (!Context.AssetData.IsValid())
 	{
 		return Timing;
 	}
 
 	// ディスクサイズから読み込み時間を推定（簡易計算）
-	FAssetPackageData PackageData;
-	if (AssetRegistry.TryGetAssetPackageData(AssetData.PackageName, PackageData) == UE::AssetRegistry::EExists::Exists)
+	if (Context.bHasPackageData)
 	{
 		// SSD想定: 500MB/s、HDD想定: 100MB/s（中間値を使用）
 		float ReadSpeedMBps = 300.0f;
-		Timing.EstimatedLoadTimeMs = (PackageData.DiskSize / (1024.0f * 1024.0f)) / ReadSpeedMBps * 1000.0f;
+		Timing.EstimatedLoadTimeMs = (Context.DiskSize / (1024.0f * 1024.0f)) / ReadSpeedMBps * 1000.0f;
 	}
 
 	// 非同期ロード可能性
@@ -493,12 +888,22 @@ FAssetLoadTiming UAssetCostAnalyzer::AnalyzeLoadTiming(const FString& AssetPath)
 }
 
 FUE5SpecificCost UAssetCostAnalyzer::CalculateUE5Cost(const FString& AssetPath)
+{
+	return CalculateUE5CostInContext(FAssetAnalysisContext::FromPath(AssetPath, ShouldLoadAssets()));
+}
+
+FUE5SpecificCost UAssetCostAnalyzer::CalculateUE5CostInContext(const FAssetAnalysisContext& Context)
 {
 	FUE5SpecificCost Cost;
 
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+	UObject* Asset = Context.GetAsset();
 	if (!Asset)
 	{
+		// 未ロード時はレジストリタグからNanite有効フラグのみ取得
+		if (!ShouldLoadAssets() && Context.AssetData.IsValid())
+		{
+			Cost.bNaniteEnabled = IsNaniteEnabledByTag(Context.AssetData);
+		}
 		return Cost;
 	}
 
@@ -537,6 +942,162 @@ void UAssetCostAnalyzer::CollectNaniteInfo(UStaticMesh* Mesh, FUE5SpecificCost&
 	}
 }
 
+FAssetMemoryCost UAssetCostAnalyzer::EstimateMemoryCostFromRegistry(const FAssetAnalysisContext& Context) const
+{
+	FAssetMemoryCost Cost;
+
+	switch (GetAssetCategory(Context.AssetData.GetClass()))
+	{
+	case EAssetCategory::StaticMesh:
+		Cost = EstimateStaticMeshCost(Context.AssetData);
+		break;
+	case EAssetCategory::SkeletalMesh:
+		Cost = EstimateSkeletalMeshCost(Context.AssetData);
+		break;
+	case EAssetCategory::Texture:
+		Cost = EstimateTextureCost(Context.AssetData);
+		break;
+	default:
+		break;
+	}
+
+	// タグから推定できない場合はパッケージサイズ（シリアライズサイズ）を使う
+	if (Cost.MemorySize <= 0)
+	{
+		Cost.MemorySize = Context.DiskSize;
+	}
+
+	Cost.CostSource = EAssetCostSource::Estimated;
+	return Cost;
+}
+
+FAssetMemoryCost UAssetCostAnalyzer::EstimateStaticMeshCost(const FAssetData& AssetData) const
+{
+	FAssetMemoryCost Cost;
+
+	int32 NumVertices = 0;
+	int32 NumTriangles = 0;
+	int32 NumLODs = 1;
+	int32 NumUVChannels = 1;
+	AssetData.GetTagValue(TEXT("Vertices"), NumVertices);
+	AssetData.GetTagValue(TEXT("Triangles"), NumTriangles);
+	AssetData.GetTagValue(TEXT("LODs"), NumLODs);
+	AssetData.GetTagValue(TEXT("UVChannels"), NumUVChannels);
+
+	// 頂点バッファ + インデックスバッファ（32bit想定）
+	const int64 LOD0Size = NumVertices * EstimateBytesPerVertex(NumUVChannels) + (int64)NumTriangles * 3 * sizeof(uint32);
+	Cost.MemorySize = EstimateLODChainSize(LOD0Size, NumLODs);
+	Cost.GPUMemorySize = Cost.MemorySize;
+
+	// Naniteデータサイズ（計測時と同じ概算）
+	if (IsNaniteEnabledByTag(AssetData))
+	{
+		Cost.NaniteDataSize = Cost.MemorySize * 2;
+		Cost.MemorySize += Cost.NaniteDataSize;
+	}
+
+	return Cost;
+}
+
+FAssetMemoryCost UAssetCostAnalyzer::EstimateSkeletalMeshCost(const FAssetData& AssetData) const
+{
+	FAssetMemoryCost Cost;
+
+	int32 NumVertices = 0;
+	int32 NumTriangles = 0;
+	int32 NumBones = 0;
+	int32 NumLODs = 1;
+	AssetData.GetTagValue(TEXT("Vertices"), NumVertices);
+	AssetData.GetTagValue(TEXT("Triangles"), NumTriangles);
+	AssetData.GetTagValue(TEXT("Bones"), NumBones);
+	AssetData.GetTagValue(TEXT("LODs"), NumLODs);
+
+	// スキンウェイト（4インフルエンス: インデックス + ウェイト）を頂点に加算
+	const int64 BytesPerVertex = EstimateBytesPerVertex(1) + 8;
+	const int64 LOD0Size = NumVertices * BytesPerVertex + (int64)NumTriangles * 3 * sizeof(uint32);
+	Cost.MemorySize = EstimateLODChainSize(LOD0Size, NumLODs);
+
+	// 参照ポーズと逆バインド行列
+	Cost.MemorySize += (int64)NumBones * sizeof(FMatrix44f) * 2;
+	Cost.GPUMemorySize = Cost.MemorySize;
+
+	return Cost;
+}
+
+FAssetMemoryCost UAssetCostAnalyzer::EstimateTextureCost(const FAssetData& AssetData) const
+{
+	FAssetMemoryCost Cost;
+
+	int32 Width = 0;
+	int32 Height = 0;
+	if (!ParseTextureDimensions(AssetData, Width, Height))
+	{
+		return Cost;
+	}
+
+	const EPixelFormat Format = GetPixelFormatFromRegistry(AssetData);
+
+	// 常駐MIPは不明なので全MIPを常駐とみなす（上限側の推定）
+	const int32 NumMips = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
+	Cost.MemorySize = TextureMipSizes.GetMipRangeSize(Format, Width, Height, 0, NumMips) * GetTextureSliceCountFromRegistry(AssetData);
+	Cost.GPUMemorySize = Cost.MemorySize;
+
+	return Cost;
+}
+
+EPixelFormat UAssetCostAnalyzer::GetPixelFormatFromRegistry(const FAssetData& AssetData) const
+{
+	FString FormatName;
+	AssetData.GetTagValue(TEXT("Format"), FormatName);
+
+	// 不明なフォーマットは非圧縮RGBA8とみなす
+	const EPixelFormat Format = FormatName.IsEmpty() ? PF_Unknown : TextureMipSizes.FindPixelFormatByName(FormatName);
+	return Format != PF_Unknown ? Format : PF_B8G8R8A8;
+}
+
+FAssetStreamingInfo UAssetCostAnalyzer::EstimateStreamingInfoFromRegistry(const FAssetAnalysisContext& Context) const
+{
+	FAssetStreamingInfo Info;
+	const FAssetData& AssetData = Context.AssetData;
+
+	switch (GetAssetCategory(AssetData.GetClass()))
+	{
+	case EAssetCategory::Texture:
+	{
+		int32 Width = 0;
+		int32 Height = 0;
+		if (ParseTextureDimensions(AssetData, Width, Height))
+		{
+			const EPixelFormat Format = GetPixelFormatFromRegistry(AssetData);
+			const int32 NumSlices = GetTextureSliceCountFromRegistry(AssetData);
+
+			Info.NumMipLevels = FMath::FloorLog2(FMath::Max(Width, Height)) + 1;
+			Info.bIsStreamable = Info.NumMipLevels > 1;
+
+			// 常駐MIPはエンジンの最小常駐数を想定
+			Info.NumResidentMips = FMath::Min(Info.NumMipLevels, UTexture2D::GetStaticMinTextureResidentMipCount());
+
+			const int32 FirstResidentMip = Info.NumMipLevels - Info.NumResidentMips;
+			const int64 TotalSize = TextureMipSizes.GetMipRangeSize(Format, Width, Height, 0, Info.NumMipLevels) * NumSlices;
+			Info.ResidentSize = TextureMipSizes.GetMipRangeSize(Format, Width, Height, FirstResidentMip, Info.NumResidentMips) * NumSlices;
+			Info.StreamedSize = TotalSize - Info.ResidentSize;
+		}
+		break;
+	}
+	case EAssetCategory::StaticMesh:
+		AssetData.GetTagValue(TEXT("LODs"), Info.NumLODs);
+		break;
+	case EAssetCategory::SkeletalMesh:
+		Info.bIsStreamable = true;
+		AssetData.GetTagValue(TEXT("LODs"), Info.NumLODs);
+		break;
+	default:
+		break;
+	}
+
+	return Info;
+}
+
 FAssetMemoryCost UAssetCostAnalyzer::CalculateStaticMeshCost(UStaticMesh* Mesh)
 {
 	FAssetMemoryCost Cost;
@@ -881,30 +1442,65 @@ FString UAssetCostAnalyzer::GenerateHumanReadableSummary(const FAssetCostReport&
 	return FString::Join(Parts, TEXT(" | "));
 }
 
-void UAssetCostAnalyzer::DetectCircularReferences(const FString& RootAsset, TArray<FString>& OutCircularPaths)
+TArray<FAssetCycleGroup> UAssetCostAnalyzer::AnalyzeProjectCycles(const FString& RootPath)
 {
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	SetCycleAnalysis(MakeShared<FAssetGraphCycles>(FAssetRegistryGraph::Get().ComputeCycles(RootPath)));
 
-	TArray<FAssetIdentifier> Dependencies;
-	AssetRegistry.GetDependencies(FAssetIdentifier(FName(*RootAsset)), Dependencies);
+	return CycleAnalysis->MakeCycleGroups<FAssetCycleGroup>();
+}
+
+void UAssetCostAnalyzer::SetCycleAnalysis(TSharedPtr<FAssetGraphCycles> InCycleAnalysis)
+{
+	CycleAnalysis = InCycleAnalysis;
 
-	for (const FAssetIdentifier& DepId : Dependencies)
+	if (CycleAnalysis.IsValid() && !GraphPackagesChangedHandle.IsValid())
 	{
-		TArray<FAssetIdentifier> ReverseDeps;
-		AssetRegistry.GetReferencers(DepId, ReverseDeps);
+		GraphPackagesChangedHandle = FAssetRegistryGraph::Get().OnPackagesChanged().AddUObject(this, &UAssetCostAnalyzer::OnGraphPackagesChanged);
+	}
+}
 
-		for (const FAssetIdentifier& RevDep : ReverseDeps)
+void UAssetCostAnalyzer::OnGraphPackagesChanged(const TArray<FName>& ChangedPackages)
+{
+	if (!CycleAnalysis.IsValid())
+	{
+		return;
+	}
+
+	// 範囲外のパッケージは範囲内から到達できないため、範囲内の変更のみが循環グループを変えうる
+	for (const FName& PackageName : ChangedPackages)
+	{
+		if (CycleAnalysis->ContainsPackage(PackageName))
 		{
-			if (RevDep.PackageName.ToString() == RootAsset)
-			{
-				OutCircularPaths.Add(FString::Printf(TEXT("%s <-> %s"),
-					*RootAsset, *DepId.PackageName.ToString()));
-			}
+			CycleAnalysis.Reset();
+			return;
 		}
 	}
 }
 
+void UAssetCostAnalyzer::DetectCircularReferences(const FAssetAnalysisContext& Context, TArray<FString>& OutCircularPaths)
+{
+	const FName PackageName = Context.GetPackageName();
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+
+	// プロジェクト単位の分析済みならO(1)で参照
+	if (CycleAnalysis.IsValid() && CycleAnalysis->ContainsPackage(PackageName))
+	{
+		CycleAnalysis->GetCircularPaths(PackageName, OutCircularPaths);
+		return;
+	}
+
+	// 単体分析: 自身から到達可能な範囲のみで計算（自身を含む循環は必ずこの範囲に収まる）
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	const FAssetGraphCycles LocalCycleAnalysis = FAssetRegistryGraph::Get().ComputeCycles(TArray<FName>{ PackageName });
+	LocalCycleAnalysis.GetCircularPaths(PackageName, OutCircularPaths);
+}
+
 TArray<FCategoryCostSummary> UAssetCostAnalyzer::BuildCategorySummaries(const TArray<FAssetCostReport>& Reports)
 {
 	TMap<EAssetCategory, FCategoryCostSummary> CategoryMap;
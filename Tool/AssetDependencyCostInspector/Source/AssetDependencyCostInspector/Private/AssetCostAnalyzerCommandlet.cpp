@@ -0,0 +1,176 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetCostAnalyzerCommandlet.h"
+#include "AssetCostAnalyzer.h"
+#include "AssetCostShard.h"
+#include "AssetDependencyGraphCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAssetCostCommandlet, Log, All);
+
+namespace
+{
+	/** この件数を分析するごとにGCしてロード済みアセットを解放 */
+	constexpr int32 AssetsPerGarbageCollection = 256;
+}
+
+UAssetCostAnalyzerCommandlet::UAssetCostAnalyzerCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Analyzes asset memory cost headlessly, optionally split into shards that are merged into one summary.");
+	HelpUsage = TEXT("-run=AssetCostAnalyzer [-Path=/Game] [-ShardIndex=0 -ShardCount=1] [-Output=File] [-RegistryOnly] [-UseCache] | -Merge [-ShardDir=Dir] [-Output=Summary.json]");
+}
+
+int32 UAssetCostAnalyzerCommandlet::Main(const FString& Params)
+{
+	// コマンドレットではレジストリのスキャンが完了していない
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().SearchAllAssets(true);
+
+	return FParse::Param(*Params, TEXT("Merge")) ? RunMerge(Params) : RunShard(Params);
+}
+
+int32 UAssetCostAnalyzerCommandlet::RunShard(const FString& Params)
+{
+	FString FolderPath = TEXT("/Game");
+	FParse::Value(*Params, TEXT("Path="), FolderPath);
+
+	int32 ShardIndex = 0;
+	int32 ShardCount = 1;
+	if (!FAssetAnalysisShards::ParseShardRange(*Params, ShardIndex, ShardCount))
+	{
+		UE_LOG(LogAssetCostCommandlet, Error, TEXT("Invalid shard %d of %d"), ShardIndex, ShardCount);
+		return 1;
+	}
+
+	FString OutputPath = FAssetCostShard::GetDefaultShardDirectory() / FAssetAnalysisShards::GetShardFileName(ShardIndex, ShardCount);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	UAssetCostAnalyzer* Analyzer = NewObject<UAssetCostAnalyzer>();
+	Analyzer->AddToRoot(); // GC防止
+
+	if (FParse::Param(*Params, TEXT("RegistryOnly")))
+	{
+		Analyzer->SetAnalysisMode(EAssetCostAnalysisMode::RegistryOnly);
+	}
+	if (FParse::Param(*Params, TEXT("UseCache")))
+	{
+		Analyzer->SetUseCostCache(true);
+	}
+
+	FAssetCostShard Shard;
+	Shard.AnalyzedPath = FolderPath;
+	Shard.ShardIndex = ShardIndex;
+	Shard.ShardCount = ShardCount;
+
+	// 循環グループはパス全体で計算し、各シャードのレポートから参照する
+	Shard.CycleGroups = Analyzer->AnalyzeProjectCycles(FolderPath);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*FolderPath));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(Filter, AssetDataList);
+
+	FAssetAnalysisShards::FilterAssets(AssetDataList, ShardIndex, ShardCount);
+
+	UE_LOG(LogAssetCostCommandlet, Display, TEXT("Shard %d of %d: analyzing %d assets under %s"), ShardIndex, ShardCount, AssetDataList.Num(), *FolderPath);
+
+	// 依存グラフはシャード内のアセット間で共有する
+	FAssetDependencyGraphCache RunGraph;
+
+	Shard.Reports.Reserve(AssetDataList.Num());
+	for (int32 AssetIndex = 0; AssetIndex < AssetDataList.Num(); ++AssetIndex)
+	{
+		// レジストリ情報は取得済みなので検索を省略
+		FAssetAnalysisContext Context = FAssetAnalysisContext::FromAssetData(AssetDataList[AssetIndex], false);
+
+		// キャッシュヒット時はロードしない
+		if (Analyzer->ShouldLoadAssets() && !Analyzer->FindCachedReport(Context, true))
+		{
+			Context.LoadAsset();
+		}
+
+		Shard.Reports.Add(Analyzer->AnalyzeAssetInContext(Context, &RunGraph));
+
+		if ((AssetIndex + 1) % AssetsPerGarbageCollection == 0)
+		{
+			UE_LOG(LogAssetCostCommandlet, Display, TEXT("  %d / %d"), AssetIndex + 1, AssetDataList.Num());
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	Analyzer->SaveCostCache();
+	Analyzer->RemoveFromRoot();
+
+	if (!Shard.Save(OutputPath))
+	{
+		UE_LOG(LogAssetCostCommandlet, Error, TEXT("Failed to write shard: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAssetCostCommandlet, Display, TEXT("Wrote %d reports to %s"), Shard.Reports.Num(), *OutputPath);
+	return 0;
+}
+
+int32 UAssetCostAnalyzerCommandlet::RunMerge(const FString& Params)
+{
+	FString ShardDirectory = FAssetCostShard::GetDefaultShardDirectory();
+	FParse::Value(*Params, TEXT("ShardDir="), ShardDirectory);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("AssetDependencyCostInspector") / TEXT("ProjectCostSummary.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FString> ShardFiles;
+	if (!FAssetAnalysisShards::FindShardFiles(ShardDirectory, ShardFiles))
+	{
+		UE_LOG(LogAssetCostCommandlet, Error, TEXT("No shard files in %s"), *ShardDirectory);
+		return 1;
+	}
+
+	UAssetCostAnalyzer* Analyzer = NewObject<UAssetCostAnalyzer>();
+	Analyzer->AddToRoot(); // GC防止
+
+	FProjectCostSummary Summary;
+	Summary.AnalysisTime = FDateTime::Now();
+	TMap<EAssetCategory, FCategoryCostSummary> CategoryMap;
+
+	// 全シャードが同じ分割設定で揃っているかは統合時に確認する
+	FAssetCostShard Merged;
+	const bool bComplete = FAssetCostShard::Merge(ShardFiles, Merged, [&](TArray<FAssetCostReport>& Reports)
+	{
+		for (const FAssetCostReport& Report : Reports)
+		{
+			Analyzer->AccumulateReport(Summary, CategoryMap, Report);
+		}
+	});
+	Summary.AnalyzedPath = Merged.AnalyzedPath;
+	Summary.CycleGroups = MoveTemp(Merged.CycleGroups);
+
+	UAssetCostAnalyzer::FinalizeSummary(Summary, CategoryMap);
+	Analyzer->RemoveFromRoot();
+
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Summary, JsonString) ||
+		!FFileHelper::SaveStringToFile(JsonString, *OutputPath))
+	{
+		UE_LOG(LogAssetCostCommandlet, Error, TEXT("Failed to write summary: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAssetCostCommandlet, Display, TEXT("Merged %d assets (%.1f MB) into %s"),
+		Summary.TotalAssetCount, Summary.TotalMemoryCost / (1024.0 * 1024.0), *OutputPath);
+
+	return bComplete ? 0 : 1;
+}
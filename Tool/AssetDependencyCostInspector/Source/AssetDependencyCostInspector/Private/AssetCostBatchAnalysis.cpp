@@ -0,0 +1,271 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetCostBatchAnalysis.h"
+#include "AssetCostAnalyzer.h"
+#include "AssetDependencyGraphCache.h"
+#include "AssetGraphCycles.h"
+#include "AssetRegistryGraph.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/PlatformTime.h"
+
+FAssetCostBatchAnalysis::FAssetCostBatchAnalysis(UAssetCostAnalyzer* InAnalyzer, const FString& InFolderPath, const FAssetCostBatchSettings& InSettings)
+	: Analyzer(InAnalyzer)
+	, FolderPath(InFolderPath)
+	, Settings(InSettings)
+	, CancellationToken(MakeShared<FAssetCostCancellationToken>())
+{
+	Settings.WorkerChunkSize = FMath::Max(1, Settings.WorkerChunkSize);
+}
+
+FAssetCostBatchAnalysis::~FAssetCostBatchAnalysis()
+{
+	// ワーカーはContextsへ書き込むため、破棄前に必ず終了を待つ
+	CancellationToken->Cancel();
+	UE::Tasks::Wait(RegistryTasks);
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void FAssetCostBatchAnalysis::Start()
+{
+	check(IsInGameThread());
+
+	if (bRunning)
+	{
+		return;
+	}
+
+	// キャンセル後の再実行: 前回のワーカーがContextsへ書き込み終えるまで待ち、新しいトークンで始める
+	UE::Tasks::Wait(RegistryTasks);
+	CycleTask.Wait();
+	RegistryTasks.Reset();
+	CancellationToken = MakeShared<FAssetCostCancellationToken>();
+
+	Summary = FProjectCostSummary();
+	Summary.AnalysisTime = FDateTime::Now();
+	Summary.AnalyzedPath = FolderPath;
+	CategoryMap.Reset();
+	NextAssetIndex = 0;
+	NumCachedAssets = 0;
+	RunGraph = MakeShared<FAssetDependencyGraphCache>();
+
+	UAssetCostAnalyzer* AnalyzerPtr = Analyzer.Get();
+
+	// アセットレジストリから対象を列挙
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*FolderPath));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(Filter, AssetDataList);
+
+	Contexts.Reset(AssetDataList.Num());
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		// 変更のないアセットはキャッシュから即座に集計し、ワーカー/ゲームスレッドの処理対象から外す
+		if (AnalyzerPtr)
+		{
+			if (const FAssetCostReport* CachedReport = AnalyzerPtr->FindCachedReport(FAssetAnalysisContext::FromAssetData(AssetData, false), false))
+			{
+				AnalyzerPtr->AccumulateReport(Summary, CategoryMap, *CachedReport);
+				++NumCachedAssets;
+				continue;
+			}
+		}
+
+		FAssetAnalysisContext& Context = Contexts.AddDefaulted_GetRef();
+		Context.AssetPath = AssetData.GetObjectPathString();
+		Context.AssetData = AssetData;
+
+		// クラス解決はゲームスレッドで行い、ワーカーはマップを参照するだけにする
+		if (!ClassCategoryMap.Contains(AssetData.AssetClassPath))
+		{
+			ClassCategoryMap.Add(AssetData.AssetClassPath, UAssetCostAnalyzer::GetAssetCategory(AssetData.GetClass()));
+		}
+	}
+
+	bRunning = true;
+
+	// 循環グループは共有グラフ上でフォルダ全体から一度だけ計算（タスクは結果のみ保持する）
+	bCycleAnalysisApplied = false;
+	CycleAnalysis = MakeShared<FAssetGraphCycles>();
+	CycleTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [CycleAnalysis = CycleAnalysis, FolderPath = FolderPath]()
+	{
+		*CycleAnalysis = FAssetRegistryGraph::Get().ComputeCycles(FolderPath);
+	});
+
+	LaunchRegistryTasks();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(this, &FAssetCostBatchAnalysis::TickGameThreadSlice));
+}
+
+void FAssetCostBatchAnalysis::Cancel()
+{
+	CancellationToken->Cancel();
+}
+
+float FAssetCostBatchAnalysis::GetProgress() const
+{
+	return GetTotalCount() > 0 ? (float)GetProcessedCount() / GetTotalCount() : 1.0f;
+}
+
+void FAssetCostBatchAnalysis::LaunchRegistryTasks()
+{
+	RegistryTasks.Reset();
+
+	const int32 MaxDependencyDepth = Settings.MaxDependencyDepth;
+
+	// トークンは実行ごとに作り直すため、タスクはこの実行のトークンを保持する
+	const TSharedRef<FAssetCostCancellationToken> RunToken = CancellationToken;
+
+	for (int32 ChunkStart = 0; ChunkStart < Contexts.Num(); ChunkStart += Settings.WorkerChunkSize)
+	{
+		const int32 ChunkEnd = FMath::Min(ChunkStart + Settings.WorkerChunkSize, Contexts.Num());
+
+		// 各タスクは担当範囲のみ書き込むのでロック不要
+		RegistryTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, RunToken, ChunkStart, ChunkEnd, MaxDependencyDepth]()
+		{
+			for (int32 Index = ChunkStart; Index < ChunkEnd; ++Index)
+			{
+				if (RunToken->IsCancelled())
+				{
+					return;
+				}
+
+				const FAssetData AssetData = Contexts[Index].AssetData;
+
+				// ディスクサイズ（ロードしない）
+				FAssetAnalysisContext Resolved = FAssetAnalysisContext::FromAssetData(AssetData, false);
+
+				// カテゴリ判定
+				Resolved.Category = ClassCategoryMap.FindRef(AssetData.AssetClassPath);
+
+				// 依存探索
+				Resolved.ResolveDependencyStats(MaxDependencyDepth);
+
+				Contexts[Index] = MoveTemp(Resolved);
+			}
+		}));
+	}
+}
+
+bool FAssetCostBatchAnalysis::TickGameThreadSlice(float DeltaTime)
+{
+	UAssetCostAnalyzer* AnalyzerPtr = Analyzer.Get();
+	if (!AnalyzerPtr || CancellationToken->IsCancelled())
+	{
+		Finish(true);
+		return false;
+	}
+
+	// 循環グループが揃うまではレポートを作らない
+	if (!bCycleAnalysisApplied)
+	{
+		if (!CycleTask.IsCompleted())
+		{
+			return true;
+		}
+
+		AnalyzerPtr->SetCycleAnalysis(CycleAnalysis);
+		Summary.CycleGroups = CycleAnalysis->MakeCycleGroups<FAssetCycleGroup>();
+		bCycleAnalysisApplied = true;
+	}
+
+	const double SliceStart = FPlatformTime::Seconds();
+	const double SliceBudget = Settings.GameThreadBudgetMs / 1000.0;
+
+	while (NextAssetIndex < Contexts.Num())
+	{
+		// 該当チャンクのワーカー処理が終わるまで待つ
+		const int32 ChunkIndex = NextAssetIndex / Settings.WorkerChunkSize;
+		if (!RegistryTasks[ChunkIndex].IsCompleted())
+		{
+			break;
+		}
+
+		FAssetAnalysisContext& Context = Contexts[NextAssetIndex];
+		if (AnalyzerPtr->ShouldLoadAssets())
+		{
+			Context.LoadAsset();
+		}
+
+		FAssetCostReport Report = AnalyzerPtr->AnalyzeAssetInContext(Context, RunGraph.Get());
+		if (!Context.HasAsset() && AnalyzerPtr->ShouldLoadAssets())
+		{
+			// ロードできなくてもレジストリ情報で集計に含める
+			Report.AssetName = Context.AssetData.AssetName.ToString();
+			Report.Category = Context.Category;
+			Report.MemoryCost.DiskSize = Context.DiskSize;
+		}
+
+		AnalyzerPtr->AccumulateReport(Summary, CategoryMap, Report);
+
+		// 集計済みのアセットは参照・依存リストを保持しない
+		Context.Asset.Reset();
+		Context.DependencyPackages.Empty();
+		++NextAssetIndex;
+
+		if (FPlatformTime::Seconds() - SliceStart >= SliceBudget)
+		{
+			break;
+		}
+	}
+
+	UAssetCostAnalyzer::FinalizeSummary(Summary, CategoryMap);
+	OnProgress.ExecuteIfBound(GetProcessedCount(), GetTotalCount(), Summary);
+
+	if (NextAssetIndex >= Contexts.Num())
+	{
+		Finish(false);
+		return false;
+	}
+
+	return true;
+}
+
+void FAssetCostBatchAnalysis::Finish(bool bCancelled)
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	bRunning = false;
+
+	// キャンセル時は残りのワーカーを止め、Contextsへの書き込みが終わるまで待つ
+	if (bCancelled)
+	{
+		CancellationToken->Cancel();
+		UE::Tasks::Wait(RegistryTasks);
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	UAssetCostAnalyzer::FinalizeSummary(Summary, CategoryMap);
+	RunGraph.Reset();
+
+	if (!bCancelled)
+	{
+		if (UAssetCostAnalyzer* AnalyzerPtr = Analyzer.Get())
+		{
+			AnalyzerPtr->SaveCostCache();
+		}
+	}
+
+	// 完了通知中に自身が破棄されても安全なように保持
+	TSharedRef<FAssetCostBatchAnalysis> KeepAlive = AsShared();
+	OnCompleted.ExecuteIfBound(Summary, bCancelled);
+}
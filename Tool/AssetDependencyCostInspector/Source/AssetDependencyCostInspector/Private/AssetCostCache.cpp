@@ -0,0 +1,207 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetCostCache.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** ファイル識別子 */
+	constexpr uint32 CostCacheMagic = 0x43434441; // "ADCC"
+
+	/** フォーマットバージョン（レポート構造を変更したら更新、3でバッチ分析のレポートにも依存込みコストを保存、4でバッチ分析のレポートに深さ制限内の全依存を記録） */
+	constexpr int32 CostCacheVersion = 4;
+}
+
+FString FAssetCostCache::GetDefaultCachePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetDependencyCostInspector") / TEXT("CostCache.bin");
+}
+
+bool FAssetCostCache::Load(const FString& FilePath)
+{
+	TArray<FName> ChangedPackages;
+	if (!LoadEntries(FilePath, CostCacheMagic, CostCacheVersion, &FAssetCostCache::SerializeRecord, ChangedPackages))
+	{
+		// 旧フォーマットは破棄して作り直す
+		return false;
+	}
+
+	// 前回保存後に変更されたパッケージと、その依存元を破棄
+	InvalidatePackages(ChangedPackages);
+	return true;
+}
+
+bool FAssetCostCache::Save(const FString& FilePath) const
+{
+	return SaveEntries(FilePath, CostCacheMagic, CostCacheVersion, &FAssetCostCache::SerializeRecord);
+}
+
+const FAssetCostReport* FAssetCostCache::FindReport(FName PackageName, uint32 SettingsHash, bool bRequireDependencyTree) const
+{
+	const FAssetCostCacheRecord* Cached = FindValid(PackageName);
+	if (!Cached || !Cached->bHasReport || Cached->SettingsHash != SettingsHash ||
+		(bRequireDependencyTree && !Cached->bHasDependencyTree))
+	{
+		return nullptr;
+	}
+
+	return &Cached->Report;
+}
+
+void FAssetCostCache::StoreReport(FName PackageName, const FAssetCostReport& Report, uint32 SettingsHash, bool bHasDependencyTree, const TArray<FName>& DependencyPackages)
+{
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+
+	FAssetCostCacheRecord& RootRecord = Record(PackageName);
+
+	if (bHasDependencyTree)
+	{
+		RecordTreeEdges(PackageName, Report.DependencyTree);
+	}
+	else
+	{
+		// 依存統計は推移的な値のため、深さ制限内の全パッケージを直接のエッジとして記録する
+		// （途中のパッケージにエッジが無くても、どの深さの変更もルートを無効化する）
+		RootRecord.Dependencies = DependencyPackages;
+
+		// 依存先のハッシュも記録（変更検出用、ここから先はRootRecordを参照しない）
+		for (const FName& Dependency : DependencyPackages)
+		{
+			Record(Dependency);
+		}
+	}
+
+	FAssetCostCacheRecord& Cached = *Find(PackageName);
+	Cached.bHasReport = true;
+	Cached.SettingsHash = SettingsHash;
+	Cached.bHasDependencyTree = bHasDependencyTree;
+	Cached.Report = Report;
+}
+
+void FAssetCostCache::Invalidate(FName PackageName)
+{
+	InvalidatePackages({ PackageName });
+}
+
+int32 FAssetCostCache::NumReports() const
+{
+	int32 Count = 0;
+	for (const TPair<FName, FEntry>& Pair : Entries)
+	{
+		Count += Pair.Value.Payload.bHasReport ? 1 : 0;
+	}
+	return Count;
+}
+
+void FAssetCostCache::SerializeRecord(FArchive& Ar, FAssetCostCacheRecord& CacheRecord, FAssetCacheNameTable& NameTable)
+{
+	int32 NumDependencies = CacheRecord.Dependencies.Num();
+	Ar << NumDependencies;
+	if (Ar.IsLoading())
+	{
+		if (NumDependencies < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		CacheRecord.Dependencies.SetNum(NumDependencies);
+	}
+
+	for (FName& Dependency : CacheRecord.Dependencies)
+	{
+		NameTable.Serialize(Ar, Dependency);
+	}
+
+	Ar << CacheRecord.bHasReport;
+	if (CacheRecord.bHasReport)
+	{
+		Ar << CacheRecord.SettingsHash;
+		Ar << CacheRecord.bHasDependencyTree;
+		FAssetCostReport::StaticStruct()->SerializeBin(Ar, &CacheRecord.Report);
+	}
+}
+
+void FAssetCostCache::RecordTreeEdges(FName NodePackage, const FAssetDependencyNode& Node)
+{
+	FAssetCostCacheRecord& NodeRecord = Entries.FindOrAdd(NodePackage).Payload;
+	NodeRecord.Dependencies.Reset();
+	NodeRecord.Dependencies.Reserve(Node.Children.Num());
+
+	for (const FAssetDependencyNode& Child : Node.Children)
+	{
+		// 子ノードのパスはパッケージ名
+		NodeRecord.Dependencies.AddUnique(FName(*Child.Info.AssetPath));
+	}
+
+	// 再帰中にEntriesが再確保されるため、ここから先はNodeRecordを参照しない
+	for (const FAssetDependencyNode& Child : Node.Children)
+	{
+		const FName ChildPackage(*Child.Info.AssetPath);
+		Record(ChildPackage);
+
+		// 共有・循環ノードは別経路で展開済み
+		if (Child.Children.Num() > 0)
+		{
+			RecordTreeEdges(ChildPackage, Child);
+		}
+	}
+}
+
+void FAssetCostCache::InvalidatePackages(const TArray<FName>& ChangedPackages)
+{
+	if (ChangedPackages.Num() == 0)
+	{
+		return;
+	}
+
+	// 逆エッジ（依存先 → 依存元）
+	TMap<FName, TArray<FName>> Referencers;
+	for (const TPair<FName, FEntry>& Pair : Entries)
+	{
+		for (const FName& Dependency : Pair.Value.Payload.Dependencies)
+		{
+			Referencers.FindOrAdd(Dependency).Add(Pair.Key);
+		}
+	}
+
+	TSet<FName> Visited;
+	TArray<FName> Queue = ChangedPackages;
+	for (const FName& PackageName : ChangedPackages)
+	{
+		Visited.Add(PackageName);
+	}
+
+	while (Queue.Num() > 0)
+	{
+		const FName PackageName = Queue.Pop();
+
+		// 依存元のレポートは依存コストが変わるため破棄（エッジは逆引き用に残す）
+		if (FAssetCostCacheRecord* Cached = Find(PackageName))
+		{
+			Cached->bHasReport = false;
+			Cached->Report = FAssetCostReport();
+		}
+
+		if (const TArray<FName>* PackageReferencers = Referencers.Find(PackageName))
+		{
+			for (const FName& Referencer : *PackageReferencers)
+			{
+				bool bAlreadyVisited = false;
+				Visited.Add(Referencer, &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					Queue.Add(Referencer);
+				}
+			}
+		}
+	}
+
+	// 変更されたパッケージ自身の記録は再分析時に作り直す
+	for (const FName& PackageName : ChangedPackages)
+	{
+		Remove(PackageName);
+	}
+}
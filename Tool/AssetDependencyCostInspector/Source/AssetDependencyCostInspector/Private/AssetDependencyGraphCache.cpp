@@ -0,0 +1,128 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetDependencyGraphCache.h"
+#include "AssetCostAnalyzer.h"
+#include "AssetRegistryGraph.h"
+#include "AssetRegistryGraphModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+
+FAssetDependencyGraphCache::FAssetDependencyGraphCache()
+{
+	PackagesChangedHandle = FAssetRegistryGraph::Get().OnPackagesChanged().AddRaw(this, &FAssetDependencyGraphCache::OnPackagesChanged);
+}
+
+FAssetDependencyGraphCache::~FAssetDependencyGraphCache()
+{
+	// シャットダウン時は共有グラフが先に破棄されている場合がある
+	if (FAssetRegistryGraphModule::IsAvailable())
+	{
+		FAssetRegistryGraph::Get().OnPackagesChanged().Remove(PackagesChangedHandle);
+	}
+}
+
+int32 FAssetDependencyGraphCache::FindOrAddNode(FName PackageName)
+{
+	if (const int32* ExistingIndex = NodeIndexMap.Find(PackageName))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NewIndex = Nodes.AddDefaulted();
+	FAssetDependencyGraphNode& Node = Nodes[NewIndex];
+	Node.PackageName = PackageName;
+
+	// 代表アセットを解決（パッケージ名と同名のアセットを優先）
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	TArray<FAssetData> PackageAssets;
+	AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+
+	const FString ShortName = FPackageName::GetShortName(PackageName);
+	const FAssetData* PrimaryAsset = PackageAssets.FindByPredicate([&ShortName](const FAssetData& AssetData)
+	{
+		return AssetData.AssetName.ToString() == ShortName;
+	});
+	if (!PrimaryAsset && PackageAssets.Num() > 0)
+	{
+		PrimaryAsset = &PackageAssets[0];
+	}
+
+	if (PrimaryAsset)
+	{
+		Node.AssetPath = PrimaryAsset->GetObjectPathString();
+		Node.AssetName = PrimaryAsset->AssetName.ToString();
+		Node.Category = UAssetCostAnalyzer::GetAssetCategory(PrimaryAsset->GetClass());
+	}
+	else
+	{
+		Node.AssetName = ShortName;
+	}
+
+	NodeIndexMap.Add(PackageName, NewIndex);
+	return NewIndex;
+}
+
+const TArray<int32>& FAssetDependencyGraphCache::ResolveDependencies(int32 NodeIndex)
+{
+	if (!Nodes[NodeIndex].bDependenciesResolved)
+	{
+		// 直接依存は共有グラフから取得（レジストリへの問い合わせはパッケージごとに1回）
+		TArray<FName> Dependencies;
+		FAssetRegistryGraph::Get().GetDependencies(Nodes[NodeIndex].PackageName, Dependencies, EAssetGraphFilter::ExcludeEngineAndScript);
+
+		TArray<int32> DependencyIndices;
+		DependencyIndices.Reserve(Dependencies.Num());
+
+		for (const FName& DependencyName : Dependencies)
+		{
+			// FindOrAddNodeでNodesが再確保されるため、ここでは参照を保持しない
+			DependencyIndices.AddUnique(FindOrAddNode(DependencyName));
+		}
+
+		FAssetDependencyGraphNode& Node = Nodes[NodeIndex];
+		Node.Dependencies = MoveTemp(DependencyIndices);
+		Node.bDependenciesResolved = true;
+	}
+
+	return Nodes[NodeIndex].Dependencies;
+}
+
+int32 FAssetDependencyGraphCache::FindNode(FName PackageName) const
+{
+	const int32* ExistingIndex = NodeIndexMap.Find(PackageName);
+	return ExistingIndex ? *ExistingIndex : INDEX_NONE;
+}
+
+void FAssetDependencyGraphCache::Invalidate(FName PackageName)
+{
+	const int32 NodeIndex = FindNode(PackageName);
+	if (NodeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FAssetDependencyGraphNode& Node = Nodes[NodeIndex];
+	Node.Dependencies.Reset();
+	Node.bDependenciesResolved = false;
+	Node.MemoryCost = 0;
+	Node.bCostResolved = false;
+	Node.EstimatedMemoryCost = 0;
+	Node.bEstimateResolved = false;
+}
+
+void FAssetDependencyGraphCache::Reset()
+{
+	Nodes.Reset();
+	NodeIndexMap.Reset();
+}
+
+void FAssetDependencyGraphCache::OnPackagesChanged(const TArray<FName>& ChangedPackages)
+{
+	for (const FName& PackageName : ChangedPackages)
+	{
+		Invalidate(PackageName);
+	}
+}
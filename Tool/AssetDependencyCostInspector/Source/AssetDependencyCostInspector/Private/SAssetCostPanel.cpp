@@ -2,6 +2,8 @@
 
 #include "SAssetCostPanel.h"
 #include "AssetCostAnalyzer.h"
+#include "AssetCostBatchAnalysis.h"
+#include "AssetDependencyGraphCache.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -126,6 +128,31 @@ TSharedRef<SWidget> SAssetCostPanel::BuildToolbar()
 			]
 		]
 
+		// レジストリのみモードチェック
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(2.0f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(SCheckBox)
+			.IsChecked_Lambda([this]()
+			{
+				return (Analyzer && !Analyzer->ShouldLoadAssets()) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			})
+			.OnCheckStateChanged_Lambda([this](ECheckBoxState State)
+			{
+				if (Analyzer)
+				{
+					Analyzer->SetAnalysisMode(State == ECheckBoxState::Checked ? EAssetCostAnalysisMode::RegistryOnly : EAssetCostAnalysisMode::Full);
+				}
+			})
+			.ToolTipText(LOCTEXT("RegistryOnlyTooltip", "アセットをロードせず、レジストリタグとパッケージサイズからコストを推定します"))
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("RegistryOnly", "ロードしない（推定）"))
+			]
+		]
+
 		// 分析ボタン
 		+ SHorizontalBox::Slot()
 		.AutoWidth()
@@ -138,6 +165,9 @@ TSharedRef<SWidget> SAssetCostPanel::BuildToolbar()
 				FString Path = AssetPathInput->GetText().ToString();
 				if (!Path.IsEmpty())
 				{
+					// 明示的な再分析では依存グラフを取り直す
+					TreeGraph.Reset();
+
 					if (bFolderMode)
 					{
 						AnalyzeFolder(Path);
@@ -173,6 +203,27 @@ TSharedRef<SWidget> SAssetCostPanel::BuildToolbar()
 			SNew(SButton)
 			.Text(LOCTEXT("Export", "エクスポート"))
 			.OnClicked(this, &SAssetCostPanel::OnExportClicked)
+		]
+
+		// 進捗
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(4.0f, 2.0f)
+		.VAlign(VAlign_Center)
+		[
+			SAssignNew(ProgressText, STextBlock)
+			.Visibility_Lambda([this]() { return IsBatchRunning() ? EVisibility::Visible : EVisibility::Collapsed; })
+		]
+
+		// キャンセル
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(2.0f)
+		[
+			SNew(SButton)
+			.Text(LOCTEXT("Cancel", "キャンセル"))
+			.Visibility_Lambda([this]() { return IsBatchRunning() ? EVisibility::Visible : EVisibility::Collapsed; })
+			.OnClicked(this, &SAssetCostPanel::OnCancelClicked)
 		];
 }
 
@@ -216,6 +267,7 @@ TSharedRef<SWidget> SAssetCostPanel::BuildDependencyTreePanel()
 			.OnGenerateRow(this, &SAssetCostPanel::OnGenerateTreeRow)
 			.OnGetChildren(this, &SAssetCostPanel::OnGetTreeChildren)
 			.OnSelectionChanged(this, &SAssetCostPanel::OnTreeSelectionChanged)
+			.OnExpansionChanged(this, &SAssetCostPanel::OnTreeExpansionChanged)
 			.SelectionMode(ESelectionMode::Single)
 		];
 }
@@ -361,7 +413,31 @@ TSharedRef<SWidget> SAssetCostPanel::BuildIssuesPanel()
 
 TSharedRef<ITableRow> SAssetCostPanel::OnGenerateTreeRow(TSharedPtr<FAssetCostTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	const FAssetDependencyInfo& Info = Item->Node.Info;
+	if (Item->Kind == FAssetCostTreeItem::EKind::Placeholder)
+	{
+		return SNew(STableRow<TSharedPtr<FAssetCostTreeItem>>, OwnerTable)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("TreeLoading", "読み込み中..."))
+				.ColorAndOpacity(FSlateColor(FLinearColor::Gray))
+			];
+	}
+
+	if (Item->Kind == FAssetCostTreeItem::EKind::ShowMore)
+	{
+		TSharedPtr<FAssetCostTreeItem> ParentItem = Item->Parent.Pin();
+		const int32 NumRemaining = ParentItem.IsValid() ? ParentItem->SortedDependencies.Num() - ParentItem->NumVisibleChildren : 0;
+
+		return SNew(STableRow<TSharedPtr<FAssetCostTreeItem>>, OwnerTable)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.Text(FText::Format(LOCTEXT("TreeShowMore", "さらに表示（残り {0} 件）"), FText::AsNumber(NumRemaining)))
+				.OnClicked(this, &SAssetCostPanel::OnShowMoreClicked, Item)
+			];
+	}
+
+	const FAssetDependencyInfo& Info = Item->Info;
 	FString DisplayName = FPaths::GetBaseFilename(Info.AssetPath);
 	FString CostStr = FormatBytes(Info.MemoryCost);
 
@@ -428,10 +504,23 @@ TSharedRef<ITableRow> SAssetCostPanel::OnGenerateTreeRow(TSharedPtr<FAssetCostTr
 			.VAlign(VAlign_Center)
 			[
 				SNew(STextBlock)
-				.Text(Info.bIsCircular ? FText::FromString(TEXT("⚠")) : FText::GetEmpty())
+				.Text(Info.bIsInCircularReference ? FText::FromString(TEXT("⚠")) : FText::GetEmpty())
 				.ColorAndOpacity(FSlateColor(FLinearColor(0.9f, 0.6f, 0.1f)))
 				.ToolTipText(LOCTEXT("CircularRef", "循環参照"))
-				.Visibility(Info.bIsCircular ? EVisibility::Visible : EVisibility::Collapsed)
+				.Visibility(Info.bIsInCircularReference ? EVisibility::Visible : EVisibility::Collapsed)
+			]
+
+			// 共有依存（別経路で集計済み）
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 0.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("SharedDep", "共有"))
+				.ColorAndOpacity(FSlateColor(FLinearColor::Gray))
+				.ToolTipText(FText::Format(LOCTEXT("SharedDepTooltip", "別経路で集計済みの依存（参照 {0} 回）"), FText::AsNumber(Info.ReferenceCount)))
+				.Visibility(Info.bIsShared ? EVisibility::Visible : EVisibility::Collapsed)
 			]
 		];
 }
@@ -443,10 +532,152 @@ void SAssetCostPanel::OnGetTreeChildren(TSharedPtr<FAssetCostTreeItem> Item, TAr
 
 void SAssetCostPanel::OnTreeSelectionChanged(TSharedPtr<FAssetCostTreeItem> Item, ESelectInfo::Type SelectInfo)
 {
-	if (Item.IsValid())
+	if (Item.IsValid() && Item->Kind == FAssetCostTreeItem::EKind::Node)
 	{
 		// 選択されたアセットの詳細を表示
-		AnalyzeAsset(Item->Node.Info.AssetPath);
+		AnalyzeAsset(Item->Info.AssetPath);
+	}
+}
+
+void SAssetCostPanel::OnTreeExpansionChanged(TSharedPtr<FAssetCostTreeItem> Item, bool bExpanded)
+{
+	if (bExpanded && Item.IsValid() && Item->Kind == FAssetCostTreeItem::EKind::Node && !Item->bChildrenPopulated)
+	{
+		PopulateTreeChildren(Item.ToSharedRef());
+
+		if (DependencyTreeView.IsValid())
+		{
+			DependencyTreeView->RequestTreeRefresh();
+		}
+	}
+}
+
+TSharedRef<FAssetCostTreeItem> SAssetCostPanel::CreateTreeItem(int32 GraphNodeIndex, const TSharedPtr<FAssetCostTreeItem>& Parent)
+{
+	const FAssetDependencyGraphNode& GraphNode = TreeGraph->GetNode(GraphNodeIndex);
+
+	TSharedRef<FAssetCostTreeItem> Item = MakeShared<FAssetCostTreeItem>();
+	Item->GraphNodeIndex = GraphNodeIndex;
+	Item->Parent = Parent;
+	Item->Info.AssetPath = GraphNode.PackageName.ToString();
+	Item->Info.AssetName = GraphNode.AssetName;
+	Item->Info.Category = GraphNode.Category;
+	Item->Info.MemoryCost = GraphNode.MemoryCost;
+	Item->Info.Depth = Parent.IsValid() ? Parent->Info.Depth + 1 : 0;
+
+	// 別の行で表示済みのパッケージは共有依存として表示
+	int32& RefCount = TreeNodeRefCounts.FindOrAdd(GraphNodeIndex);
+	++RefCount;
+	Item->Info.ReferenceCount = RefCount;
+	Item->Info.bIsShared = RefCount > 1;
+
+	// 祖先に同じパッケージがあれば循環参照（それ以上は展開しない）
+	for (TSharedPtr<FAssetCostTreeItem> Ancestor = Parent; Ancestor.IsValid(); Ancestor = Ancestor->Parent.Pin())
+	{
+		if (Ancestor->GraphNodeIndex == GraphNodeIndex)
+		{
+			Item->Info.bIsInCircularReference = true;
+			break;
+		}
+	}
+
+	// 展開矢印を出すため直接依存の有無だけを解決する（子のコストは展開時に計算）
+	if (!Item->Info.bIsInCircularReference && TreeGraph->ResolveDependencies(GraphNodeIndex).Num() > 0)
+	{
+		TSharedRef<FAssetCostTreeItem> Placeholder = MakeShared<FAssetCostTreeItem>();
+		Placeholder->Kind = FAssetCostTreeItem::EKind::Placeholder;
+		Placeholder->Parent = Item;
+		Item->Children.Add(Placeholder);
+	}
+
+	return Item;
+}
+
+void SAssetCostPanel::PopulateTreeChildren(const TSharedRef<FAssetCostTreeItem>& Item)
+{
+	if (Item->bChildrenPopulated || !Analyzer || !TreeGraph.IsValid())
+	{
+		return;
+	}
+
+	Item->bChildrenPopulated = true;
+	Analyzer->GetDependenciesSortedByCost(*TreeGraph, Item->GraphNodeIndex, Item->SortedDependencies);
+
+	Item->Children.Reset();
+	Item->NumVisibleChildren = FMath::Min(TreeChildPageSize, Item->SortedDependencies.Num());
+	RebuildVisibleChildren(Item);
+}
+
+void SAssetCostPanel::RebuildVisibleChildren(const TSharedRef<FAssetCostTreeItem>& Item)
+{
+	// 既存の子は展開状態を保つため残し、末尾の「さらに表示」行だけ作り直す
+	if (Item->Children.Num() > 0 && Item->Children.Last()->Kind == FAssetCostTreeItem::EKind::ShowMore)
+	{
+		Item->Children.Pop();
+	}
+
+	for (int32 ChildIndex = Item->Children.Num(); ChildIndex < Item->NumVisibleChildren; ++ChildIndex)
+	{
+		Item->Children.Add(CreateTreeItem(Item->SortedDependencies[ChildIndex], Item));
+	}
+
+	if (Item->NumVisibleChildren < Item->SortedDependencies.Num())
+	{
+		TSharedRef<FAssetCostTreeItem> ShowMore = MakeShared<FAssetCostTreeItem>();
+		ShowMore->Kind = FAssetCostTreeItem::EKind::ShowMore;
+		ShowMore->Parent = Item;
+		Item->Children.Add(ShowMore);
+	}
+}
+
+FReply SAssetCostPanel::OnShowMoreClicked(TSharedPtr<FAssetCostTreeItem> ShowMoreItem)
+{
+	TSharedPtr<FAssetCostTreeItem> ParentItem = ShowMoreItem.IsValid() ? ShowMoreItem->Parent.Pin() : nullptr;
+	if (ParentItem.IsValid())
+	{
+		ParentItem->NumVisibleChildren = FMath::Min(ParentItem->NumVisibleChildren + TreeChildPageSize, ParentItem->SortedDependencies.Num());
+		RebuildVisibleChildren(ParentItem.ToSharedRef());
+
+		if (DependencyTreeView.IsValid())
+		{
+			DependencyTreeView->RequestTreeRefresh();
+		}
+	}
+	return FReply::Handled();
+}
+
+void SAssetCostPanel::RebuildDependencyTree()
+{
+	TreeItems.Empty();
+	TreeNodeRefCounts.Reset();
+
+	if (!TreeGraph.IsValid())
+	{
+		TreeGraph = MakeShared<FAssetDependencyGraphCache>();
+	}
+
+	TSharedPtr<FAssetCostTreeItem> RootItem;
+	if (Analyzer && !CurrentReport.AssetPath.IsEmpty())
+	{
+		// ルートと第1階層のみを生成し、それ以降は展開時に生成
+		const FAssetAnalysisContext Context = FAssetAnalysisContext::FromPath(CurrentReport.AssetPath, false);
+		const int32 RootIndex = TreeGraph->FindOrAddNode(Context.GetPackageName());
+
+		RootItem = CreateTreeItem(RootIndex, nullptr);
+		RootItem->Info.AssetPath = CurrentReport.AssetPath;
+		RootItem->Info.MemoryCost = CurrentReport.MemoryCost.MemorySize;
+		PopulateTreeChildren(RootItem.ToSharedRef());
+
+		TreeItems.Add(RootItem);
+	}
+
+	if (DependencyTreeView.IsValid())
+	{
+		if (RootItem.IsValid())
+		{
+			DependencyTreeView->SetItemExpansion(RootItem, true);
+		}
+		DependencyTreeView->RequestTreeRefresh();
 	}
 }
 
@@ -458,6 +689,8 @@ void SAssetCostPanel::AnalyzeSelectedAssets()
 
 	if (SelectedAssets.Num() > 0)
 	{
+		TreeGraph.Reset();
+
 		// 最初の選択アセットを分析
 		AnalyzeAsset(SelectedAssets[0].GetObjectPathString());
 	}
@@ -482,18 +715,67 @@ void SAssetCostPanel::AnalyzeFolder(const FString& FolderPath)
 		return;
 	}
 
+	// 実行中の分析は破棄して新しく開始
+	if (ActiveBatch.IsValid())
+	{
+		ActiveBatch->Cancel();
+		ActiveBatch.Reset();
+	}
+
 	bFolderMode = true;
-	ProjectSummary = Analyzer->AnalyzeFolder(FolderPath);
+	ProjectSummary = FProjectCostSummary();
+
+	if (ProgressText.IsValid())
+	{
+		ProgressText->SetText(LOCTEXT("BatchStarting", "分析準備中..."));
+	}
+
+	// エディタを止めないよう非同期で分析
+	TSharedRef<FAssetCostBatchAnalysis> Batch = Analyzer->AnalyzeFolderAsync(FolderPath, FAssetCostBatchSettings());
+	Batch->OnProgress.BindSP(this, &SAssetCostPanel::OnBatchProgress);
+	Batch->OnCompleted.BindSP(this, &SAssetCostPanel::OnBatchCompleted);
+	ActiveBatch = Batch;
+}
+
+void SAssetCostPanel::OnBatchProgress(int32 Processed, int32 Total, const FProjectCostSummary& PartialSummary)
+{
+	ProjectSummary = PartialSummary;
+
+	if (ProgressText.IsValid())
+	{
+		const float Percent = Total > 0 ? (float)Processed / Total * 100.0f : 100.0f;
+		ProgressText->SetText(FText::FromString(FString::Printf(TEXT("%d / %d (%.0f%%)"), Processed, Total, Percent)));
+	}
+}
 
-	// 最初のレポートを表示
-	if (ProjectSummary.AssetReports.Num() > 0)
+void SAssetCostPanel::OnBatchCompleted(const FProjectCostSummary& Summary, bool bCancelled)
+{
+	ProjectSummary = Summary;
+	ActiveBatch.Reset();
+
+	// 最も重いアセットを表示
+	if (ProjectSummary.HeaviestAssets.Num() > 0)
 	{
-		CurrentReport = ProjectSummary.AssetReports[0];
+		CurrentReport = ProjectSummary.HeaviestAssets[0];
 	}
 
 	RefreshDisplay();
 }
 
+FReply SAssetCostPanel::OnCancelClicked()
+{
+	if (ActiveBatch.IsValid())
+	{
+		ActiveBatch->Cancel();
+	}
+	return FReply::Handled();
+}
+
+bool SAssetCostPanel::IsBatchRunning() const
+{
+	return ActiveBatch.IsValid() && ActiveBatch->IsRunning();
+}
+
 void SAssetCostPanel::RefreshDisplay()
 {
 	// 概要テキスト
@@ -539,12 +821,14 @@ void SAssetCostPanel::RefreshDisplay()
 			TEXT("メモリ: %s\n")
 			TEXT("GPU: %s\n")
 			TEXT("Naniteデータ: %s\n")
-			TEXT("依存含む合計: %s"),
+			TEXT("依存含む合計: %s\n")
+			TEXT("算出: %s"),
 			*FormatBytes(Mem.DiskSize),
 			*FormatBytes(Mem.MemorySize),
 			*FormatBytes(Mem.GPUMemorySize),
 			*FormatBytes(Mem.NaniteDataSize),
-			*FormatBytes(Mem.TotalWithDependencies)
+			*FormatBytes(Mem.TotalCostWithDependencies),
+			Mem.CostSource == EAssetCostSource::Estimated ? TEXT("推定（レジストリ）") : TEXT("計測")
 		);
 		MemoryCostText->SetText(FText::FromString(MemStr));
 	}
@@ -606,16 +890,7 @@ void SAssetCostPanel::RefreshDisplay()
 	}
 
 	// 依存ツリー更新
-	TreeItems.Empty();
-	if (!CurrentReport.AssetPath.IsEmpty())
-	{
-		FAssetDependencyNode RootNode = Analyzer->BuildDependencyTree(CurrentReport.AssetPath, 5);
-		TreeItems.Add(MakeShared<FAssetCostTreeItem>(RootNode));
-	}
-	if (DependencyTreeView.IsValid())
-	{
-		DependencyTreeView->RequestTreeRefresh();
-	}
+	RebuildDependencyTree();
 
 	// 問題リスト更新
 	if (IssuesContainer.IsValid())
@@ -852,36 +1127,33 @@ FReply SAssetCostPanel::OnExportClicked()
 			if (OutputPath.EndsWith(TEXT(".csv")))
 			{
 				// CSV形式
-				Content = TEXT("AssetPath,Category,CostLevel,DiskSize,MemorySize,GPUMemory,DependencyCount\n");
+				Content = TEXT("AssetPath,Category,CostLevel,DiskSize,MemorySize,GPUMemory,DependencyCount,CostSource\n");
+
+				auto AppendReportRow = [&Content](const FAssetCostReport& Report)
+				{
+					Content += FString::Printf(
+						TEXT("%s,%s,%s,%lld,%lld,%lld,%d,%s\n"),
+						*Report.AssetPath,
+						*UAssetCostAnalyzer::GetCategoryName(Report.Category),
+						*UAssetCostAnalyzer::GetCostLevelString(Report.OverallCostLevel),
+						Report.MemoryCost.DiskSize,
+						Report.MemoryCost.MemorySize,
+						Report.MemoryCost.GPUMemorySize,
+						Report.TotalDependencyCount,
+						Report.MemoryCost.CostSource == EAssetCostSource::Estimated ? TEXT("Estimated") : TEXT("Measured")
+					);
+				};
 
 				if (bFolderMode)
 				{
-					for (const FAssetCostReport& Report : ProjectSummary.AssetReports)
+					for (const FAssetCostReport& Report : ProjectSummary.HeaviestAssets)
 					{
-						Content += FString::Printf(
-							TEXT("%s,%s,%s,%lld,%lld,%lld,%d\n"),
-							*Report.AssetPath,
-							*UAssetCostAnalyzer::GetCategoryName(Report.Category),
-							*UAssetCostAnalyzer::GetCostLevelString(Report.OverallCostLevel),
-							Report.MemoryCost.DiskSize,
-							Report.MemoryCost.MemorySize,
-							Report.MemoryCost.GPUMemorySize,
-							Report.TotalDependencyCount
-						);
+						AppendReportRow(Report);
 					}
 				}
 				else
 				{
-					Content += FString::Printf(
-						TEXT("%s,%s,%s,%lld,%lld,%lld,%d\n"),
-						*CurrentReport.AssetPath,
-						*UAssetCostAnalyzer::GetCategoryName(CurrentReport.Category),
-						*UAssetCostAnalyzer::GetCostLevelString(CurrentReport.OverallCostLevel),
-						CurrentReport.MemoryCost.DiskSize,
-						CurrentReport.MemoryCost.MemorySize,
-						CurrentReport.MemoryCost.GPUMemorySize,
-						CurrentReport.TotalDependencyCount
-					);
+					AppendReportRow(CurrentReport);
 				}
 			}
 			else
@@ -0,0 +1,75 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TextureMipSizeCache.h"
+#include "RenderUtils.h"
+
+const TArray<int64>& FTextureMipSizeCache::GetMipSizes(EPixelFormat Format, int32 SizeX, int32 SizeY)
+{
+	FMipChainKey Key;
+	Key.Format = Format;
+	Key.SizeX = FMath::Max(1, SizeX);
+	Key.SizeY = FMath::Max(1, SizeY);
+
+	if (const TArray<int64>* Existing = MipChains.Find(Key))
+	{
+		return *Existing;
+	}
+
+	TArray<int64>& MipSizes = MipChains.Add(Key);
+
+	const int32 NumMips = FMath::FloorLog2(FMath::Max(Key.SizeX, Key.SizeY)) + 1;
+	MipSizes.Reserve(NumMips);
+
+	for (int32 MipIndex = 0; MipIndex < NumMips; ++MipIndex)
+	{
+		// ブロック単位に切り上げて計算（4x4ブロックの圧縮フォーマットでは小さいMIPも1ブロック分を占める）
+		MipSizes.Add((int64)CalcTextureMipMapSize(Key.SizeX, Key.SizeY, Format, MipIndex));
+	}
+
+	return MipSizes;
+}
+
+int64 FTextureMipSizeCache::GetMipRangeSize(EPixelFormat Format, int32 SizeX, int32 SizeY, int32 FirstMip, int32 NumMips)
+{
+	const TArray<int64>& MipSizes = GetMipSizes(Format, SizeX, SizeY);
+
+	int64 TotalSize = 0;
+	const int32 LastMip = FMath::Min(MipSizes.Num(), FirstMip + NumMips);
+	for (int32 MipIndex = FMath::Max(0, FirstMip); MipIndex < LastMip; ++MipIndex)
+	{
+		TotalSize += MipSizes[MipIndex];
+	}
+	return TotalSize;
+}
+
+EPixelFormat FTextureMipSizeCache::FindPixelFormatByName(const FString& FormatName)
+{
+	if (const EPixelFormat* Existing = FormatNames.Find(FormatName))
+	{
+		return *Existing;
+	}
+
+	// レジストリのFormatタグは "PF_" 付き、GPixelFormatsの名前は接頭辞なし
+	FString BareName = FormatName;
+	BareName.RemoveFromStart(TEXT("PF_"));
+
+	EPixelFormat Result = PF_Unknown;
+	for (int32 FormatIndex = 0; FormatIndex < PF_MAX; ++FormatIndex)
+	{
+		const FPixelFormatInfo& Info = GPixelFormats[FormatIndex];
+		if (Info.Name && BareName.Equals(Info.Name, ESearchCase::IgnoreCase))
+		{
+			Result = (EPixelFormat)FormatIndex;
+			break;
+		}
+	}
+
+	FormatNames.Add(FormatName, Result);
+	return Result;
+}
+
+void FTextureMipSizeCache::Reset()
+{
+	MipChains.Reset();
+	FormatNames.Reset();
+}
@@ -0,0 +1,95 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "AssetCostTypes.h"
+
+/**
+ * アセット分析コンテキスト
+ * 1回の分析で使うUObject・FAssetData・パッケージ情報を一度だけ解決し、
+ * 各コスト計算に共有する（計算ごとのLoadObject/レジストリ検索を避ける）
+ */
+struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetAnalysisContext
+{
+	/** 分析対象のアセットパス（オブジェクトパス） */
+	FString AssetPath;
+
+	/** アセットレジストリ情報 */
+	FAssetData AssetData;
+
+	/** 解決済みアセット（未ロードの場合は無効） */
+	TWeakObjectPtr<UObject> Asset;
+
+	/** パッケージのディスクサイズ（バイト） */
+	int64 DiskSize = 0;
+
+	/** パッケージ情報を取得できたか */
+	bool bHasPackageData = false;
+
+	// ========== レジストリのみの事前計算（ワーカースレッドで実行可能） ==========
+
+	/** レジストリのクラス情報から判定したカテゴリ */
+	EAssetCategory Category = EAssetCategory::Other;
+
+	/** 依存統計が事前計算済みか（trueの場合は依存ツリー構築を省略） */
+	bool bHasDependencyStats = false;
+
+	/** 直接依存数 */
+	int32 DirectDependencyCount = 0;
+
+	/** 総依存数（推移的） */
+	int32 TotalDependencyCount = 0;
+
+	/** 最大依存深度 */
+	int32 MaxDependencyDepth = 0;
+
+	/** 深さ制限内の依存パッケージ（重複なし、依存込みコストの集計に使う） */
+	TArray<FName> DependencyPackages;
+
+	/**
+	 * アセットパスからコンテキストを解決
+	 * @param InAssetPath アセットパス
+	 * @param bLoadAsset trueの場合はUObjectもロードする
+	 */
+	static FAssetAnalysisContext FromPath(const FString& InAssetPath, bool bLoadAsset = true);
+
+	/**
+	 * レジストリ情報からコンテキストを解決（レジストリ検索を省略）
+	 * @param InAssetData アセットレジストリ情報
+	 * @param bLoadAsset trueの場合はUObjectもロードする
+	 */
+	static FAssetAnalysisContext FromAssetData(const FAssetData& InAssetData, bool bLoadAsset = true);
+
+	/**
+	 * ロード済みアセットからコンテキストを解決（再ロードしない）
+	 */
+	static FAssetAnalysisContext FromObject(UObject* InAsset);
+
+	/** 解決済みアセットを取得 */
+	UObject* GetAsset() const { return Asset.Get(); }
+
+	/** UObjectが解決済みか */
+	bool HasAsset() const { return Asset.IsValid(); }
+
+	/** 依存関係クエリ用のパッケージ名を取得 */
+	FName GetPackageName() const;
+
+	/**
+	 * 未ロードならUObjectをロード（ゲームスレッドのみ）
+	 * @return ロードできたか
+	 */
+	bool LoadAsset();
+
+	/**
+	 * レジストリのみで依存統計を計算（ロード不要・スレッドセーフ）
+	 * @param MaxDepth 探索する最大深度
+	 */
+	void ResolveDependencyStats(int32 MaxDepth);
+
+private:
+	/** パッケージ情報（ディスクサイズ）を解決 */
+	void ResolvePackageData();
+};
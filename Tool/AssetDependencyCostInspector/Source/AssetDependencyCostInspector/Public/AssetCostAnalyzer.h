@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "AssetCostTypes.h"
+#include "AssetAnalysisContext.h"
+#include "TextureMipSizeCache.h"
 #include "AssetCostAnalyzer.generated.h"
 
 class UStaticMesh;
@@ -11,6 +13,11 @@ class USkeletalMesh;
 class UTexture;
 class UMaterialInterface;
 class USoundBase;
+class FAssetCostBatchAnalysis;
+class FAssetDependencyGraphCache;
+class FAssetGraphCycles;
+class FAssetCostCache;
+struct FAssetCostBatchSettings;
 
 /**
  * アセットコストアナライザー
@@ -89,6 +96,97 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
 	FUE5SpecificCost CalculateUE5Cost(const FString& AssetPath);
 
+	/**
+	 * 指定パス配下の循環参照グループを検出
+	 * 依存グラフを一度だけ構築してSCCを計算し、以降のレポートはその結果を参照する
+	 * @param RootPath 起点パス
+	 * @return 全ての循環グループ
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	TArray<FAssetCycleGroup> AnalyzeProjectCycles(const FString& RootPath = TEXT("/Game"));
+
+	// ========== コンテキストベースAPI ==========
+
+	/**
+	 * 解決済みコンテキストを使ってアセットを分析
+	 * UObject/FAssetDataの解決は呼び出し側で一度だけ行う
+	 * @param RunGraph 実行単位で共有する依存グラフ（nullptrの場合は呼び出しごとに構築、永続キャッシュ有効時はそちらを優先）
+	 */
+	FAssetCostReport AnalyzeAssetInContext(const FAssetAnalysisContext& Context, FAssetDependencyGraphCache* RunGraph = nullptr);
+
+	/** メモリコストを計算（コンテキスト版） */
+	FAssetMemoryCost CalculateMemoryCostInContext(const FAssetAnalysisContext& Context);
+
+	/** Streaming情報を取得（コンテキスト版） */
+	FAssetStreamingInfo GetStreamingInfoInContext(const FAssetAnalysisContext& Context);
+
+	/** 読み込みタイミングを分析（コンテキスト版） */
+	FAssetLoadTiming AnalyzeLoadTimingInContext(const FAssetAnalysisContext& Context);
+
+	/** UE5特有コストを計算（コンテキスト版） */
+	FUE5SpecificCost CalculateUE5CostInContext(const FAssetAnalysisContext& Context);
+
+	/**
+	 * 依存ツリーを構築（コンテキスト版）
+	 * サブツリー合計は深さ制限内で展開したパッケージのみを一度ずつ集計する
+	 * @param RunGraph 実行単位で共有する依存グラフ（nullptrの場合は呼び出しごとに構築、永続キャッシュ有効時はそちらを優先）
+	 */
+	FAssetDependencyNode BuildDependencyTreeInContext(const FAssetAnalysisContext& Context, int32 MaxDepth = 10, FAssetDependencyGraphCache* RunGraph = nullptr);
+
+	// ========== 依存ツリーの遅延展開API ==========
+
+	/**
+	 * 直接依存をコスト降順で取得
+	 * 直接依存のコストのみを計算し、孫以降は展開されるまで解決しない
+	 * @param Graph 依存グラフ（呼び出し側で保持し、展開間で共有）
+	 * @param NodeIndex 展開するノード
+	 * @param OutDependencies コスト降順のノードインデックス
+	 */
+	void GetDependenciesSortedByCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex, TArray<int32>& OutDependencies);
+
+	/**
+	 * キャッシュ済みのメモリコストを取得（未計算なら一度だけ計算）
+	 */
+	int64 GetCachedMemoryCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex);
+
+	/**
+	 * ロードせずにメモリコストを取得（計算済みのコストがあればそれを使い、無ければレジストリ情報から一度だけ推定）
+	 * ゲームスレッドの時間予算内で処理する依存統計の集計用
+	 */
+	int64 GetRegistryMemoryCost(FAssetDependencyGraphCache& Graph, int32 NodeIndex);
+
+	// ========== 非同期バッチAPI ==========
+
+	/**
+	 * フォルダ内の全アセットを非同期で分析
+	 * レジストリのみの処理はワーカースレッド、ロードが必要な処理はゲームスレッドで時間分割して実行
+	 * @param FolderPath フォルダパス
+	 * @param Settings バッチ設定
+	 * @return 実行中のバッチ（進捗デリゲート・キャンセル用）
+	 */
+	TSharedRef<FAssetCostBatchAnalysis> AnalyzeFolderAsync(const FString& FolderPath, const FAssetCostBatchSettings& Settings);
+
+	/**
+	 * プロジェクト全体を非同期で分析
+	 */
+	TSharedRef<FAssetCostBatchAnalysis> AnalyzeProjectAsync(const FAssetCostBatchSettings& Settings);
+
+	/**
+	 * レポートをサマリーに加算（逐次集計用）
+	 */
+	void AccumulateReport(FProjectCostSummary& Summary, TMap<EAssetCategory, FCategoryCostSummary>& CategoryMap, const FAssetCostReport& Report) const;
+
+	/**
+	 * 集計を確定（カテゴリ割合の計算とソート）
+	 */
+	static void FinalizeSummary(FProjectCostSummary& Summary, const TMap<EAssetCategory, FCategoryCostSummary>& CategoryMap);
+
+	/**
+	 * 循環参照分析の結果を設定（ワーカーで構築済みのものを渡す場合）
+	 * 分析範囲内のパッケージが共有グラフで変更されると破棄され、以降の単体分析は到達範囲で計算し直す
+	 */
+	void SetCycleAnalysis(TSharedPtr<FAssetGraphCycles> InCycleAnalysis);
+
 	// ========== 設定 ==========
 
 	/**
@@ -103,6 +201,61 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
 	void SetThresholds(const FAssetCostThresholds& NewThresholds) { Thresholds = NewThresholds; }
 
+	/**
+	 * 分析モードを取得
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	EAssetCostAnalysisMode GetAnalysisMode() const { return AnalysisMode; }
+
+	/**
+	 * 分析モードを設定
+	 * RegistryOnlyではアセットを一切ロードせず、レジストリタグとパッケージサイズから推定する
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	void SetAnalysisMode(EAssetCostAnalysisMode NewMode) { AnalysisMode = NewMode; }
+
+	/** 分析時にアセットをロードするか */
+	bool ShouldLoadAssets() const { return AnalysisMode == EAssetCostAnalysisMode::Full; }
+
+	/**
+	 * 永続コストキャッシュを使うか設定
+	 * 有効化時にSaved/のキャッシュファイルを読み込み、変更のないアセットは前回のレポートを再利用する
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	void SetUseCostCache(bool bEnable);
+
+	/**
+	 * コストキャッシュをファイルへ保存
+	 * @return 保存できたか（キャッシュ無効時はfalse）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	bool SaveCostCache();
+
+	/**
+	 * コストキャッシュを破棄（ファイルも削除）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	void ClearCostCache();
+
+	/**
+	 * キャッシュ済みレポートを検索（キャッシュ無効時・変更済みの場合はnullptr）
+	 * @param bRequireDependencyTree 依存ツリーを含むレポートのみ受け付けるか
+	 */
+	const FAssetCostReport* FindCachedReport(const FAssetAnalysisContext& Context, bool bRequireDependencyTree) const;
+
+	/**
+	 * 依存グラフキャッシュを分析間で保持するか設定
+	 * 無効の場合はフォルダ分析の実行ごと（単体分析では呼び出しごと）にキャッシュを作り直す
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	void SetUsePersistentDependencyCache(bool bEnable);
+
+	/**
+	 * 依存グラフキャッシュを破棄
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Cost Analyzer")
+	void ClearDependencyCache();
+
 	// ========== ユーティリティ ==========
 
 	/**
@@ -134,19 +287,66 @@ protected:
 	UPROPERTY()
 	FAssetCostThresholds Thresholds;
 
+	/** 分析モード */
+	UPROPERTY()
+	EAssetCostAnalysisMode AnalysisMode = EAssetCostAnalysisMode::Full;
+
+	/** 分析間で共有する依存グラフ（永続キャッシュ有効時のみ） */
+	TSharedPtr<FAssetDependencyGraphCache> PersistentDependencyGraph;
+
+	/** 使用する依存グラフ（永続キャッシュ → 実行単位 → 呼び出し側のローカルの順） */
+	FAssetDependencyGraphCache& SelectDependencyGraph(FAssetDependencyGraphCache* RunGraph, FAssetDependencyGraphCache& LocalGraph) const;
+
+	/** プロジェクト単位の循環参照分析（未構築の場合は単体分析時に到達範囲で計算） */
+	TSharedPtr<FAssetGraphCycles> CycleAnalysis;
+
+	/** 共有グラフの変更通知（範囲内のパッケージが変わったら循環参照分析を破棄） */
+	void OnGraphPackagesChanged(const TArray<FName>& ChangedPackages);
+
+	/** 共有グラフの変更通知ハンドル（循環参照分析を初めて設定したときに登録） */
+	FDelegateHandle GraphPackagesChangedHandle;
+
+	/** 永続コストキャッシュ（有効時のみ） */
+	TSharedPtr<FAssetCostCache> CostCache;
+
+	/** キャッシュ照合用の分析設定ハッシュ（閾値・モード） */
+	uint32 GetCostCacheSettingsHash() const;
+
+	/** フォーマット・サイズごとのテクスチャMIPサイズ（フォルダ分析で同構成のテクスチャを再計算しない） */
+	mutable FTextureMipSizeCache TextureMipSizes;
+
 	// ========== 内部ヘルパー ==========
 
 	/**
-	 * 依存関係を再帰的に収集
+	 * 依存関係を再帰的に収集し、OutNodeのサブツリー合計（コスト・アセット数）を設定する
+	 * 直接依存とコストは共有の依存グラフ（永続・実行単位・呼び出し単位のいずれか）から取得し、パッケージごとに一度だけ計算する
+	 * 各パッケージはMaxDepth以内の最短の深さで一度だけ展開・集計し、それ以外の参照は共有ノード、祖先への参照は循環参照として表示のみ行う（合計に再加算しない）
+	 * @param Graph 依存グラフキャッシュ
+	 * @param NodeIndex 展開するノード
+	 * @param ShortestDepths ルートからの最短の深さ（深さ制限内のノードのみ）
+	 * @param ExpandedNodes 展開済みノード
+	 * @param ActivePath 現在の探索経路（循環検出用）
+	 * @param ReferenceCounts ツリー内の参照回数
+	 * @param CurrentDepth OutNodeの深さ（MaxDepthに達したら子を展開しない）
 	 */
 	void CollectDependenciesRecursive(
-		const FString& AssetPath,
-		TSet<FString>& VisitedAssets,
+		FAssetDependencyGraphCache& Graph,
+		int32 NodeIndex,
+		const TMap<int32, int32>& ShortestDepths,
+		TSet<int32>& ExpandedNodes,
+		TSet<int32>& ActivePath,
+		TMap<FString, int32>& ReferenceCounts,
 		FAssetDependencyNode& OutNode,
 		int32 CurrentDepth,
 		int32 MaxDepth
 	);
 
+	/**
+	 * TextureのStreaming情報を計算
+	 * プラットフォームデータのピクセルフォーマット（ブロックサイズ）とスライス/面数からMIPごとのサイズを求める
+	 */
+	FAssetStreamingInfo GetTextureStreamingInfo(UTexture* Texture);
+
 	/**
 	 * StaticMeshのコストを計算
 	 */
@@ -177,6 +377,36 @@ protected:
 	 */
 	FAssetMemoryCost CalculateGenericCost(UObject* Asset);
 
+	/**
+	 * レジストリ情報からメモリコストを推定（ロードなし）
+	 */
+	FAssetMemoryCost EstimateMemoryCostFromRegistry(const FAssetAnalysisContext& Context) const;
+
+	/**
+	 * StaticMeshのコストを推定（Vertices/Triangles/LODsタグ）
+	 */
+	FAssetMemoryCost EstimateStaticMeshCost(const FAssetData& AssetData) const;
+
+	/**
+	 * SkeletalMeshのコストを推定（Vertices/Triangles/Bonesタグ）
+	 */
+	FAssetMemoryCost EstimateSkeletalMeshCost(const FAssetData& AssetData) const;
+
+	/**
+	 * Textureのコストを推定（Dimensions/Formatタグ）
+	 */
+	FAssetMemoryCost EstimateTextureCost(const FAssetData& AssetData) const;
+
+	/**
+	 * Textureのピクセルフォーマットをレジストリから解決（Formatタグ、不明な場合はPF_B8G8R8A8）
+	 */
+	EPixelFormat GetPixelFormatFromRegistry(const FAssetData& AssetData) const;
+
+	/**
+	 * レジストリ情報からStreaming情報を推定（ロードなし）
+	 */
+	FAssetStreamingInfo EstimateStreamingInfoFromRegistry(const FAssetAnalysisContext& Context) const;
+
 	/**
 	 * Nanite情報を収集
 	 */
@@ -203,10 +433,10 @@ protected:
 	FString GenerateHumanReadableSummary(const FAssetCostReport& Report);
 
 	/**
-	 * 循環参照を検出
+	 * 循環参照を検出（SCCの所属グループを参照）
 	 */
 	void DetectCircularReferences(
-		const FString& RootAsset,
+		const FAssetAnalysisContext& Context,
 		TArray<FString>& OutCircularPaths
 	);
 
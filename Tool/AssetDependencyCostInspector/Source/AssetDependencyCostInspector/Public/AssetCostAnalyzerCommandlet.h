@@ -0,0 +1,38 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetCostAnalyzerCommandlet.generated.h"
+
+class UAssetCostAnalyzer;
+
+/**
+ * アセットコスト分析コマンドレット
+ * エディタUIなしでプロジェクト分析を実行し、複数マシンへの分割（シャード）と結果の統合に対応する
+ *
+ * シャード分析:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=AssetCostAnalyzer -Path=/Game -ShardIndex=0 -ShardCount=4 [-Output=File.bin] [-RegistryOnly] [-UseCache]
+ * 統合:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=AssetCostAnalyzer -Merge [-ShardDir=Dir] [-Output=Summary.json]
+ */
+UCLASS()
+class ASSETDEPENDENCYCOSTINSPECTOR_API UAssetCostAnalyzerCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAssetCostAnalyzerCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** 担当アセットを分析してシャードファイルを書き出す */
+	int32 RunShard(const FString& Params);
+
+	/** シャードファイルを読み込んでサマリーを書き出す */
+	int32 RunMerge(const FString& Params);
+};
@@ -0,0 +1,158 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "AssetCostTypes.h"
+#include "AssetAnalysisContext.h"
+
+class UAssetCostAnalyzer;
+class FAssetGraphCycles;
+class FAssetDependencyGraphCache;
+
+/** 進捗通知（処理済み数、総数、途中経過サマリー） */
+DECLARE_DELEGATE_ThreeParams(FOnAssetCostBatchProgress, int32 /*Processed*/, int32 /*Total*/, const FProjectCostSummary& /*PartialSummary*/);
+
+/** 完了通知（最終サマリー、キャンセルされたか） */
+DECLARE_DELEGATE_TwoParams(FOnAssetCostBatchCompleted, const FProjectCostSummary& /*Summary*/, bool /*bCancelled*/);
+
+/**
+ * バッチ分析のキャンセルトークン
+ * UIスレッドとワーカースレッドの両方から参照される
+ */
+class ASSETDEPENDENCYCOSTINSPECTOR_API FAssetCostCancellationToken
+{
+public:
+	/** キャンセルを要求 */
+	void Cancel() { bCancelled.store(true, std::memory_order_relaxed); }
+
+	/** キャンセル要求済みか */
+	bool IsCancelled() const { return bCancelled.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> bCancelled{ false };
+};
+
+/**
+ * バッチ分析設定
+ */
+struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetCostBatchSettings
+{
+	/** 1フレームあたりにゲームスレッドで使う時間（ミリ秒） */
+	float GameThreadBudgetMs = 8.0f;
+
+	/** ワーカータスク1つが担当するアセット数 */
+	int32 WorkerChunkSize = 256;
+
+	/** 依存統計の最大探索深度 */
+	int32 MaxDependencyDepth = 10;
+};
+
+/**
+ * 非同期バッチ分析
+ * - ワーカーステージ: ディスクサイズ、カテゴリ判定、依存探索、循環グループ計算（レジストリのみ）
+ * - ゲームスレッドステージ: UObjectが必要なコスト計算をフレームごとに時間分割して実行
+ * 結果はFProjectCostSummaryへ逐次集計される
+ */
+class ASSETDEPENDENCYCOSTINSPECTOR_API FAssetCostBatchAnalysis : public TSharedFromThis<FAssetCostBatchAnalysis>
+{
+public:
+	FAssetCostBatchAnalysis(UAssetCostAnalyzer* InAnalyzer, const FString& InFolderPath, const FAssetCostBatchSettings& InSettings);
+	~FAssetCostBatchAnalysis();
+
+	/** 分析を開始（ゲームスレッドから呼ぶ） */
+	void Start();
+
+	/** 分析をキャンセル */
+	void Cancel();
+
+	/** 実行中か */
+	bool IsRunning() const { return bRunning; }
+
+	/** 処理済みアセット数（キャッシュから再利用した分を含む） */
+	int32 GetProcessedCount() const { return NumCachedAssets + NextAssetIndex; }
+
+	/** 総アセット数 */
+	int32 GetTotalCount() const { return NumCachedAssets + Contexts.Num(); }
+
+	/** キャッシュから再利用したアセット数 */
+	int32 GetCachedCount() const { return NumCachedAssets; }
+
+	/** 進捗率（0-1） */
+	float GetProgress() const;
+
+	/** 現在までのサマリー */
+	const FProjectCostSummary& GetSummary() const { return Summary; }
+
+	/** 現在の実行のキャンセルトークン（UIから共有可能、再実行すると別のトークンになる） */
+	TSharedRef<FAssetCostCancellationToken> GetCancellationToken() const { return CancellationToken; }
+
+	/** 進捗デリゲート */
+	FOnAssetCostBatchProgress OnProgress;
+
+	/** 完了デリゲート */
+	FOnAssetCostBatchCompleted OnCompleted;
+
+private:
+	/** ワーカーステージを起動 */
+	void LaunchRegistryTasks();
+
+	/** ゲームスレッドの時間分割処理 */
+	bool TickGameThreadSlice(float DeltaTime);
+
+	/** 終了処理 */
+	void Finish(bool bCancelled);
+
+	/** アナライザー */
+	TWeakObjectPtr<UAssetCostAnalyzer> Analyzer;
+
+	/** 分析パス */
+	FString FolderPath;
+
+	/** 設定 */
+	FAssetCostBatchSettings Settings;
+
+	/** アセットごとのコンテキスト（ワーカーが事前計算を書き込む） */
+	TArray<FAssetAnalysisContext> Contexts;
+
+	/** 実行中のアセット間で共有する依存グラフ（依存込みコストの集計、ゲームスレッドのみ） */
+	TSharedPtr<FAssetDependencyGraphCache> RunGraph;
+
+	/** カテゴリ判定用（ゲームスレッドで事前に構築し、ワーカーは読み取りのみ） */
+	TMap<FTopLevelAssetPath, EAssetCategory> ClassCategoryMap;
+
+	/** チャンクごとのワーカータスク */
+	TArray<UE::Tasks::FTask> RegistryTasks;
+
+	/** 循環参照分析（ワーカーで構築し、完了後にアナライザーへ渡す） */
+	TSharedPtr<FAssetGraphCycles> CycleAnalysis;
+
+	/** 循環参照分析タスク */
+	UE::Tasks::FTask CycleTask;
+
+	/** 循環参照分析をアナライザーへ適用済みか */
+	bool bCycleAnalysisApplied = false;
+
+	/** 次にゲームスレッドで処理するアセット */
+	int32 NextAssetIndex = 0;
+
+	/** キャッシュから再利用したアセット数 */
+	int32 NumCachedAssets = 0;
+
+	/** 逐次集計中のサマリー */
+	FProjectCostSummary Summary;
+
+	/** カテゴリ別集計 */
+	TMap<EAssetCategory, FCategoryCostSummary> CategoryMap;
+
+	/** キャンセルトークン（Startのたびに作り直す） */
+	TSharedRef<FAssetCostCancellationToken> CancellationToken;
+
+	/** ティッカーハンドル */
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** 実行中フラグ */
+	bool bRunning = false;
+};
@@ -0,0 +1,90 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetPackageCache.h"
+#include "AssetCostTypes.h"
+
+/**
+ * コストキャッシュのパッケージごとの内容
+ */
+struct FAssetCostCacheRecord
+{
+	/** 直接依存（依存統計のみのレポートは深さ制限内の全依存） */
+	TArray<FName> Dependencies;
+
+	/** レポートを記録済みか（依存先として状態だけ記録したパッケージはfalse） */
+	bool bHasReport = false;
+
+	/** 分析設定のハッシュ */
+	uint32 SettingsHash = 0;
+
+	/** 依存ツリーを含むか */
+	bool bHasDependencyTree = false;
+
+	/** レポート本体 */
+	FAssetCostReport Report;
+};
+
+/**
+ * 永続コストキャッシュ
+ * パッケージ名 + 保存ハッシュをキーに前回のFAssetCostReportと依存エッジを保持し、
+ * 変更のないアセットの再分析を省略する（保存状態の検証・ファイル形式・レジストリイベントはTAssetPackageCacheで共通）
+ * - ファイル: Saved/AssetDependencyCostInspector/CostCache.bin（バイナリ）
+ * - 読み込み時にレジストリの現在のハッシュと比較し、変更パッケージとその依存元を破棄
+ * - 実行中はアセットレジストリの更新/リネーム/削除イベントで依存元まで無効化
+ * ゲームスレッド専用
+ */
+class ASSETDEPENDENCYCOSTINSPECTOR_API FAssetCostCache : public TAssetPackageCache<FAssetCostCacheRecord>
+{
+public:
+	/** 既定のキャッシュファイルパス */
+	static FString GetDefaultCachePath();
+
+	/**
+	 * キャッシュファイルを読み込み、変更されたパッケージを無効化
+	 * @return 読み込めたか（ファイルが無い場合はfalse）
+	 */
+	bool Load(const FString& FilePath);
+
+	/** キャッシュファイルへ保存 */
+	bool Save(const FString& FilePath) const;
+
+	/**
+	 * キャッシュ済みレポートを検索
+	 * @param PackageName パッケージ名
+	 * @param SettingsHash 分析設定のハッシュ（閾値・モードが異なる結果は使わない）
+	 * @param bRequireDependencyTree 依存ツリーを含むレポートのみ受け付けるか
+	 * @return 有効なレポート（無い場合はnullptr）
+	 */
+	const FAssetCostReport* FindReport(FName PackageName, uint32 SettingsHash, bool bRequireDependencyTree) const;
+
+	/**
+	 * レポートを保存
+	 * 依存ツリーを含む場合はツリー内の全エッジ、含まない場合は依存統計で辿った全パッケージへのエッジを記録する
+	 * @param DependencyPackages 依存統計で辿った深さ制限内の全パッケージ（依存ツリーを含む場合は使わない）
+	 */
+	void StoreReport(FName PackageName, const FAssetCostReport& Report, uint32 SettingsHash, bool bHasDependencyTree, const TArray<FName>& DependencyPackages);
+
+	/** パッケージとその依存元（推移的）のレポートを無効化 */
+	void Invalidate(FName PackageName);
+
+	/** キャッシュ済みレポート数 */
+	int32 NumReports() const;
+
+protected:
+	//~ Begin FAssetPackageCacheBase Interface
+	virtual void OnPackageChanged(FName PackageName) override { Invalidate(PackageName); }
+	//~ End FAssetPackageCacheBase Interface
+
+private:
+	/** パッケージごとの内容を読み書き */
+	static void SerializeRecord(FArchive& Ar, FAssetCostCacheRecord& CacheRecord, FAssetCacheNameTable& NameTable);
+
+	/** 依存ツリーからエッジを記録 */
+	void RecordTreeEdges(FName NodePackage, const FAssetDependencyNode& Node);
+
+	/** 変更パッケージ群から依存元を辿って無効化 */
+	void InvalidatePackages(const TArray<FName>& ChangedPackages);
+};
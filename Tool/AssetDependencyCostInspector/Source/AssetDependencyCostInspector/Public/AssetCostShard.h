@@ -0,0 +1,40 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetAnalysisShard.h"
+#include "AssetCostTypes.h"
+#include "Misc/Paths.h"
+
+/**
+ * アセットコスト分析のシャード
+ * 分割・ファイル形式・統合はTAssetAnalysisShardで共通（集計は統合時にAccumulateReportで行う）
+ * - ファイル: Saved/AssetDependencyCostInspector/Shards/Shard_<Index>_of_<Count>.bin
+ */
+struct FAssetCostShard : public TAssetAnalysisShard<FAssetCostReport, FAssetCycleGroup>
+{
+	/** ファイル識別子（"ADCS"） */
+	static constexpr uint32 Magic = 0x53434441;
+
+	/** フォーマットバージョン（レポート構造を変更したら更新） */
+	static constexpr int32 Version = 1;
+
+	/** 既定のシャード出力ディレクトリ */
+	static FString GetDefaultShardDirectory()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("AssetDependencyCostInspector") / TEXT("Shards");
+	}
+
+	/** ファイルへ保存 */
+	bool Save(const FString& FilePath) const { return TAssetAnalysisShard::Save(FilePath, Magic, Version); }
+
+	/** ファイルから読み込み */
+	bool Load(const FString& FilePath) { return TAssetAnalysisShard::Load(FilePath, Magic, Version); }
+
+	/** シャードファイルを全て読み込んで統合 */
+	static bool Merge(const TArray<FString>& FilePaths, FAssetCostShard& OutMerged, TFunctionRef<void(TArray<FAssetCostReport>&)> OnReports)
+	{
+		return TAssetAnalysisShard::Merge(FilePaths, Magic, Version, OutMerged, OnReports);
+	}
+};
@@ -45,6 +45,32 @@ enum class EAssetCategory : uint8
 	Other
 };
 
+/**
+ * コスト値の算出方法
+ */
+UENUM(BlueprintType)
+enum class EAssetCostSource : uint8
+{
+	/** ロードしたオブジェクトから計測 */
+	Measured UMETA(DisplayName = "Measured"),
+
+	/** レジストリタグ・パッケージサイズから推定（ロードなし） */
+	Estimated UMETA(DisplayName = "Estimated")
+};
+
+/**
+ * 分析モード
+ */
+UENUM(BlueprintType)
+enum class EAssetCostAnalysisMode : uint8
+{
+	/** アセットをロードして計測 */
+	Full UMETA(DisplayName = "Full (Load Assets)"),
+
+	/** アセットレジストリのみで推定（ロードしない、CI向け） */
+	RegistryOnly UMETA(DisplayName = "Registry Only (No Load)")
+};
+
 /**
  * メモリコスト詳細
  */
@@ -85,6 +111,10 @@ struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetMemoryCost
 	UPROPERTY(BlueprintReadOnly, Category = "Cost")
 	EAssetCostLevel CostLevel = EAssetCostLevel::Low;
 
+	/** 算出方法（計測/推定） */
+	UPROPERTY(BlueprintReadOnly, Category = "Cost")
+	EAssetCostSource CostSource = EAssetCostSource::Measured;
+
 	/** 人間向けサイズ文字列を取得 */
 	FString GetFormattedSize() const
 	{
@@ -236,6 +266,10 @@ struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetDependencyInfo
 	UPROPERTY(BlueprintReadOnly, Category = "Dependency")
 	bool bIsInCircularReference = false;
 
+	/** 共有依存か（別経路で既に集計済みのため、サブツリーコストに再加算しない） */
+	UPROPERTY(BlueprintReadOnly, Category = "Dependency")
+	bool bIsShared = false;
+
 	/** 参照カウント（何箇所から参照されているか） */
 	UPROPERTY(BlueprintReadOnly, Category = "Dependency")
 	int32 ReferenceCount = 1;
@@ -455,6 +489,19 @@ struct ASSETDEPENDENCYCOSTINSPECTOR_API FCategoryCostSummary
 	int64 HeaviestAssetCost = 0;
 };
 
+/**
+ * 循環参照グループ（依存グラフの強連結成分）
+ */
+USTRUCT(BlueprintType)
+struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetCycleGroup
+{
+	GENERATED_BODY()
+
+	/** グループに含まれるパッケージ */
+	UPROPERTY(BlueprintReadOnly, Category = "Summary")
+	TArray<FString> PackageNames;
+};
+
 /**
  * プロジェクト全体のコストサマリー
  */
@@ -506,6 +553,14 @@ struct ASSETDEPENDENCYCOSTINSPECTOR_API FProjectCostSummary
 	/** 循環参照を持つアセット数 */
 	UPROPERTY(BlueprintReadOnly, Category = "Summary")
 	int32 CircularReferenceCount = 0;
+
+	/** コストが推定値のアセット数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Summary")
+	int32 EstimatedAssetCount = 0;
+
+	/** 検出された循環グループ */
+	UPROPERTY(BlueprintReadOnly, Category = "Summary")
+	TArray<FAssetCycleGroup> CycleGroups;
 };
 
 /**
@@ -0,0 +1,96 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetCostTypes.h"
+
+/**
+ * 依存グラフのノード（パッケージ単位）
+ */
+struct ASSETDEPENDENCYCOSTINSPECTOR_API FAssetDependencyGraphNode
+{
+	/** パッケージ名 */
+	FName PackageName;
+
+	/** 代表アセットのオブジェクトパス（見つからない場合は空） */
+	FString AssetPath;
+
+	/** アセット名 */
+	FString AssetName;
+
+	/** アセットカテゴリ */
+	EAssetCategory Category = EAssetCategory::Other;
+
+	/** 直接依存（/Engine, /Scriptは除外済み）のノードインデックス */
+	TArray<int32> Dependencies;
+
+	/** 直接依存を解決済みか */
+	bool bDependenciesResolved = false;
+
+	/** メモリコスト（バイト） */
+	int64 MemoryCost = 0;
+
+	/** メモリコストを計算済みか */
+	bool bCostResolved = false;
+
+	/** レジストリ情報からの推定メモリコスト（バイト、ロードしない集計用） */
+	int64 EstimatedMemoryCost = 0;
+
+	/** 推定メモリコストを計算済みか */
+	bool bEstimateResolved = false;
+};
+
+/**
+ * 依存グラフキャッシュ
+ * パッケージごとの直接依存とコストを一度だけ保持し、BuildDependencyTree間で共有する
+ * 直接依存は共有グラフ（FAssetRegistryGraph）から取得し、共有グラフの変更通知で該当パッケージを無効化する
+ * ノードはフラット配列で保持し、インデックスで参照する（追加時に参照が無効化されるため）
+ */
+class ASSETDEPENDENCYCOSTINSPECTOR_API FAssetDependencyGraphCache
+{
+public:
+	FAssetDependencyGraphCache();
+	~FAssetDependencyGraphCache();
+
+	/**
+	 * パッケージのノードを検索または追加
+	 * @return ノードインデックス
+	 */
+	int32 FindOrAddNode(FName PackageName);
+
+	/**
+	 * 直接依存を解決（初回のみ共有グラフへ問い合わせ）
+	 * @return ノードインデックス配列への参照（次のFindOrAddNodeまで有効）
+	 */
+	const TArray<int32>& ResolveDependencies(int32 NodeIndex);
+
+	/** ノードを取得 */
+	FAssetDependencyGraphNode& GetNode(int32 NodeIndex) { return Nodes[NodeIndex]; }
+	const FAssetDependencyGraphNode& GetNode(int32 NodeIndex) const { return Nodes[NodeIndex]; }
+
+	/** パッケージのノードインデックスを検索（無い場合はINDEX_NONE） */
+	int32 FindNode(FName PackageName) const;
+
+	/** パッケージのキャッシュを無効化（依存とコストを再取得させる） */
+	void Invalidate(FName PackageName);
+
+	/** 全キャッシュを破棄 */
+	void Reset();
+
+	/** ノード数 */
+	int32 Num() const { return Nodes.Num(); }
+
+private:
+	/** 共有グラフの変更通知 */
+	void OnPackagesChanged(const TArray<FName>& ChangedPackages);
+
+	/** フラットなノード配列 */
+	TArray<FAssetDependencyGraphNode> Nodes;
+
+	/** パッケージ名 → ノードインデックス */
+	TMap<FName, int32> NodeIndexMap;
+
+	/** 共有グラフの変更通知ハンドル */
+	FDelegateHandle PackagesChangedHandle;
+};
@@ -8,25 +8,51 @@
 #include "AssetCostTypes.h"
 
 class UAssetCostAnalyzer;
+class FAssetCostBatchAnalysis;
+class FAssetDependencyGraphCache;
 class ITableRow;
 class STableViewBase;
 
 /**
  * 依存ノード表示用アイテム
+ * ノード本体（依存・コスト）は依存グラフのフラット配列に一度だけ保持し、アイテムはインデックスで参照する
+ * 子は展開されたときに初めて生成する
  */
 class FAssetCostTreeItem : public TSharedFromThis<FAssetCostTreeItem>
 {
 public:
-	FAssetCostTreeItem(const FAssetDependencyNode& InNode)
-		: Node(InNode)
+	/** 行の種類 */
+	enum class EKind : uint8
 	{
-		for (const FAssetDependencyNode& ChildNode : Node.Children)
-		{
-			Children.Add(MakeShared<FAssetCostTreeItem>(ChildNode));
-		}
-	}
+		/** 依存ノード */
+		Node,
+		/** 展開前の子のプレースホルダー（展開矢印の表示用） */
+		Placeholder,
+		/** 「さらに表示」行 */
+		ShowMore
+	};
 
-	FAssetDependencyNode Node;
+	EKind Kind = EKind::Node;
+
+	/** 依存グラフ上のノードインデックス */
+	int32 GraphNodeIndex = INDEX_NONE;
+
+	/** 表示情報 */
+	FAssetDependencyInfo Info;
+
+	/** 親アイテム */
+	TWeakPtr<FAssetCostTreeItem> Parent;
+
+	/** 子を生成済みか */
+	bool bChildrenPopulated = false;
+
+	/** コスト降順に並べた直接依存（生成済みの場合のみ有効） */
+	TArray<int32> SortedDependencies;
+
+	/** 表示中の子の数（「さらに表示」で増加） */
+	int32 NumVisibleChildren = 0;
+
+	/** 子アイテム */
 	TArray<TSharedPtr<FAssetCostTreeItem>> Children;
 };
 
@@ -62,6 +88,22 @@ private:
 	TSharedRef<ITableRow> OnGenerateTreeRow(TSharedPtr<FAssetCostTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
 	void OnGetTreeChildren(TSharedPtr<FAssetCostTreeItem> Item, TArray<TSharedPtr<FAssetCostTreeItem>>& OutChildren);
 	void OnTreeSelectionChanged(TSharedPtr<FAssetCostTreeItem> Item, ESelectInfo::Type SelectInfo);
+	void OnTreeExpansionChanged(TSharedPtr<FAssetCostTreeItem> Item, bool bExpanded);
+
+	/** 依存ツリーのアイテムを生成（グラフノードから表示情報を作成） */
+	TSharedRef<FAssetCostTreeItem> CreateTreeItem(int32 GraphNodeIndex, const TSharedPtr<FAssetCostTreeItem>& Parent);
+
+	/** 直接依存をコスト順に解決し、上位の子アイテムを生成 */
+	void PopulateTreeChildren(const TSharedRef<FAssetCostTreeItem>& Item);
+
+	/** 表示中の子アイテム（上位N件 +「さらに表示」行）を再構築 */
+	void RebuildVisibleChildren(const TSharedRef<FAssetCostTreeItem>& Item);
+
+	/** 「さらに表示」行のクリック */
+	FReply OnShowMoreClicked(TSharedPtr<FAssetCostTreeItem> ShowMoreItem);
+
+	/** 依存ツリーを現在のレポートのルートで作り直す */
+	void RebuildDependencyTree();
 
 	/** コストレベルに応じた色を取得 */
 	FSlateColor GetCostLevelColor(EAssetCostLevel Level) const;
@@ -82,6 +124,18 @@ private:
 	/** エクスポートボタン */
 	FReply OnExportClicked();
 
+	/** キャンセルボタン */
+	FReply OnCancelClicked();
+
+	/** バッチ分析の進捗コールバック */
+	void OnBatchProgress(int32 Processed, int32 Total, const FProjectCostSummary& PartialSummary);
+
+	/** バッチ分析の完了コールバック */
+	void OnBatchCompleted(const FProjectCostSummary& Summary, bool bCancelled);
+
+	/** バッチ分析中か */
+	bool IsBatchRunning() const;
+
 private:
 	/** コストアナライザー */
 	UPROPERTY()
@@ -93,9 +147,18 @@ private:
 	/** プロジェクトサマリー（フォルダ分析時） */
 	FProjectCostSummary ProjectSummary;
 
-	/** 依存ツリーアイテム */
+	/** 依存ツリーアイテム（ルートのみ） */
 	TArray<TSharedPtr<FAssetCostTreeItem>> TreeItems;
 
+	/** 依存ツリーの遅延展開用グラフ（ノードのフラット配列、明示的な再分析時に破棄） */
+	TSharedPtr<FAssetDependencyGraphCache> TreeGraph;
+
+	/** 表示中のツリーでのノードごとの出現回数（共有依存の表示用） */
+	TMap<int32, int32> TreeNodeRefCounts;
+
+	/** 展開時に一度に表示する子の数 */
+	static constexpr int32 TreeChildPageSize = 50;
+
 	/** ツリービュー */
 	TSharedPtr<STreeView<TSharedPtr<FAssetCostTreeItem>>> DependencyTreeView;
 
@@ -115,6 +178,12 @@ private:
 	/** アセットパス入力 */
 	TSharedPtr<SEditableTextBox> AssetPathInput;
 
+	/** 進捗テキスト */
+	TSharedPtr<STextBlock> ProgressText;
+
+	/** 実行中のフォルダ分析 */
+	TSharedPtr<FAssetCostBatchAnalysis> ActiveBatch;
+
 	/** 分析モード（単一/フォルダ） */
 	bool bFolderMode = false;
 };
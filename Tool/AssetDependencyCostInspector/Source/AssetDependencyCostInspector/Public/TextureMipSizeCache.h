@@ -0,0 +1,66 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+/**
+ * テクスチャMIPサイズキャッシュ
+ * ピクセルフォーマットのブロックサイズ（BC/ASTC/ETC等）に基づいて1スライスあたりの各MIPサイズを計算し、
+ * フォーマット + 最上位MIPサイズごとに保持する（同じ構成のテクスチャでは再計算しない）
+ * ゲームスレッド専用
+ */
+class ASSETDEPENDENCYCOSTINSPECTOR_API FTextureMipSizeCache
+{
+public:
+	/**
+	 * 1スライスあたりの各MIPサイズを取得（1x1まで）
+	 * @param Format ピクセルフォーマット
+	 * @param SizeX 最上位MIPの幅
+	 * @param SizeY 最上位MIPの高さ
+	 * @return MIPごとのバイト数（次のGetMipSizesまで有効）
+	 */
+	const TArray<int64>& GetMipSizes(EPixelFormat Format, int32 SizeX, int32 SizeY);
+
+	/**
+	 * MIP範囲の合計サイズ（1スライスあたり）
+	 * @param FirstMip 開始MIP
+	 * @param NumMips MIP数（チェーン末尾で打ち切り）
+	 */
+	int64 GetMipRangeSize(EPixelFormat Format, int32 SizeX, int32 SizeY, int32 FirstMip, int32 NumMips);
+
+	/**
+	 * ピクセルフォーマット名（例: PF_DXT1 / DXT1）からEPixelFormatを解決
+	 * @return 見つからない場合はPF_Unknown
+	 */
+	EPixelFormat FindPixelFormatByName(const FString& FormatName);
+
+	/** 全キャッシュを破棄 */
+	void Reset();
+
+private:
+	/** キャッシュキー */
+	struct FMipChainKey
+	{
+		EPixelFormat Format = PF_Unknown;
+		int32 SizeX = 0;
+		int32 SizeY = 0;
+
+		bool operator==(const FMipChainKey& Other) const
+		{
+			return Format == Other.Format && SizeX == Other.SizeX && SizeY == Other.SizeY;
+		}
+
+		friend uint32 GetTypeHash(const FMipChainKey& Key)
+		{
+			return HashCombine(HashCombine(::GetTypeHash((int32)Key.Format), ::GetTypeHash(Key.SizeX)), ::GetTypeHash(Key.SizeY));
+		}
+	};
+
+	/** フォーマット・サイズ → MIPごとのサイズ */
+	TMap<FMipChainKey, TArray<int64>> MipChains;
+
+	/** フォーマット名 → EPixelFormat */
+	TMap<FString, EPixelFormat> FormatNames;
+};
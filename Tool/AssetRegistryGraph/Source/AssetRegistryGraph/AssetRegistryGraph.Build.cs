@@ -0,0 +1,28 @@
+// Copyright DevTools. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class AssetRegistryGraph : ModuleRules
+{
+	public AssetRegistryGraph(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"AssetRegistry",
+				"AssetAnalysisCommon"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Engine"
+			}
+		);
+	}
+}
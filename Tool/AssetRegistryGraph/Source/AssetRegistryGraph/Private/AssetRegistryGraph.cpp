@@ -0,0 +1,792 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetRegistryGraph.h"
+#include "AssetRegistryGraphModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeRWLock.h"
+
+FAssetRegistryGraph::FAssetRegistryGraph()
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAssetRegistryGraph::OnAssetAdded);
+	AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FAssetRegistryGraph::OnAssetUpdated);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetRegistryGraph::OnAssetRenamed);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetRegistryGraph::OnAssetRemoved);
+	FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FAssetRegistryGraph::OnFilesLoaded);
+}
+
+FAssetRegistryGraph::~FAssetRegistryGraph()
+{
+	// シャットダウン時はレジストリが先に破棄されている場合がある
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+}
+
+FAssetRegistryGraph& FAssetRegistryGraph::Get()
+{
+	return FAssetRegistryGraphModule::Get().GetGraph();
+}
+
+// ========== ノード ==========
+
+int32 FAssetRegistryGraph::FindOrAddPackage(FName PackageName)
+{
+	FWriteScopeLock WriteLock(Lock);
+	return FindOrAddPackageLocked(PackageName);
+}
+
+int32 FAssetRegistryGraph::FindOrAddPackage(FName PackageName, uint32& OutGeneration)
+{
+	FWriteScopeLock WriteLock(Lock);
+	OutGeneration = Generation;
+	return FindOrAddPackageLocked(PackageName);
+}
+
+int32 FAssetRegistryGraph::FindPackage(FName PackageName) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const int32* ExistingIndex = NodeIndexMap.Find(PackageName);
+	return ExistingIndex ? *ExistingIndex : INDEX_NONE;
+}
+
+FName FAssetRegistryGraph::GetPackageName(int32 PackageIndex) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Nodes.IsValidIndex(PackageIndex) ? Nodes[PackageIndex].PackageName : NAME_None;
+}
+
+bool FAssetRegistryGraph::PassesFilter(int32 PackageIndex, EAssetGraphFilter Filter) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return PassesFilterLocked(PackageIndex, Filter);
+}
+
+int32 FAssetRegistryGraph::FindOrAddPackageLocked(FName PackageName)
+{
+	if (const int32* ExistingIndex = NodeIndexMap.Find(PackageName))
+	{
+		return *ExistingIndex;
+	}
+
+	const FString PackageString = PackageName.ToString();
+
+	FNode& Node = Nodes.AddDefaulted_GetRef();
+	Node.PackageName = PackageName;
+	Node.bIsScript = PackageString.StartsWith(TEXT("/Script"));
+	Node.bIsEngine = PackageString.StartsWith(TEXT("/Engine"));
+	Node.bIsGame = PackageString.StartsWith(TEXT("/Game"));
+
+	const int32 NewIndex = Nodes.Num() - 1;
+	NodeIndexMap.Add(PackageName, NewIndex);
+	return NewIndex;
+}
+
+bool FAssetRegistryGraph::PassesFilterLocked(int32 PackageIndex, EAssetGraphFilter Filter) const
+{
+	if (!Nodes.IsValidIndex(PackageIndex))
+	{
+		return false;
+	}
+
+	const FNode& Node = Nodes[PackageIndex];
+	switch (Filter)
+	{
+	case EAssetGraphFilter::ExcludeScript:
+		return !Node.bIsScript;
+	case EAssetGraphFilter::ExcludeEngineAndScript:
+		return !Node.bIsScript && !Node.bIsEngine;
+	case EAssetGraphFilter::GameOnly:
+		return Node.bIsGame;
+	default:
+		return true;
+	}
+}
+
+// ========== 辺 ==========
+
+void FAssetRegistryGraph::GetDependencies(int32 PackageIndex, TArray<int32>& OutDependencies, EAssetGraphFilter Filter)
+{
+	OutDependencies.Reset();
+	ResolveDependencies(PackageIndex);
+
+	FReadScopeLock ReadLock(Lock);
+	if (!Nodes.IsValidIndex(PackageIndex))
+	{
+		return;
+	}
+
+	for (int32 DependencyIndex : Nodes[PackageIndex].Dependencies)
+	{
+		if (PassesFilterLocked(DependencyIndex, Filter))
+		{
+			OutDependencies.Add(DependencyIndex);
+		}
+	}
+}
+
+void FAssetRegistryGraph::GetDependencies(FName PackageName, TArray<FName>& OutDependencies, EAssetGraphFilter Filter)
+{
+	OutDependencies.Reset();
+
+	// 問い合わせ中にノードが破棄された場合は、新しい世代のインデックスで取得し直す
+	for (;;)
+	{
+		uint32 StartGeneration = 0;
+		const int32 PackageIndex = FindOrAddPackage(PackageName, StartGeneration);
+		ResolveDependencies(PackageIndex);
+
+		FReadScopeLock ReadLock(Lock);
+		if (Generation != StartGeneration)
+		{
+			continue;
+		}
+
+		// 名前への変換も同じロック内で行う（取得したインデックスが別のパッケージを指さない）
+		for (int32 DependencyIndex : Nodes[PackageIndex].Dependencies)
+		{
+			if (PassesFilterLocked(DependencyIndex, Filter))
+			{
+				OutDependencies.Add(Nodes[DependencyIndex].PackageName);
+			}
+		}
+		return;
+	}
+}
+
+void FAssetRegistryGraph::GetReferencers(int32 PackageIndex, TArray<int32>& OutReferencers, EAssetGraphFilter Filter)
+{
+	OutReferencers.Reset();
+	ResolveStaleDependencies();
+	ResolveReferencers(PackageIndex);
+
+	FReadScopeLock ReadLock(Lock);
+	if (!Nodes.IsValidIndex(PackageIndex))
+	{
+		return;
+	}
+
+	for (int32 ReferencerIndex : Nodes[PackageIndex].Referencers)
+	{
+		if (PassesFilterLocked(ReferencerIndex, Filter))
+		{
+			OutReferencers.Add(ReferencerIndex);
+		}
+	}
+}
+
+void FAssetRegistryGraph::GetReferencers(FName PackageName, TArray<FName>& OutReferencers, EAssetGraphFilter Filter)
+{
+	OutReferencers.Reset();
+
+	// 問い合わせ中にノードが破棄された場合は、新しい世代のインデックスで取得し直す
+	for (;;)
+	{
+		uint32 StartGeneration = 0;
+		const int32 PackageIndex = FindOrAddPackage(PackageName, StartGeneration);
+		ResolveStaleDependencies();
+		ResolveReferencers(PackageIndex);
+
+		FReadScopeLock ReadLock(Lock);
+		if (Generation != StartGeneration)
+		{
+			continue;
+		}
+
+		for (int32 ReferencerIndex : Nodes[PackageIndex].Referencers)
+		{
+			if (PassesFilterLocked(ReferencerIndex, Filter))
+			{
+				OutReferencers.Add(Nodes[ReferencerIndex].PackageName);
+			}
+		}
+		return;
+	}
+}
+
+void FAssetRegistryGraph::ResolveDependencies(int32 PackageIndex)
+{
+	FName PackageName;
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (!Nodes.IsValidIndex(PackageIndex))
+		{
+			return;
+		}
+
+		const FNode& Node = Nodes[PackageIndex];
+		if (Node.bDependenciesResolved && !Node.bDependenciesStale)
+		{
+			return;
+		}
+		PackageName = Node.PackageName;
+	}
+
+	// レジストリへの問い合わせはロックの外で行う（ワーカースレッドのためGetModuleCheckedを使用）
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetIdentifier> Found;
+	AssetRegistry.GetDependencies(FAssetIdentifier(PackageName), Found);
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// 問い合わせ中に破棄された場合、または並行して他のスレッドが取得済みにした場合
+	if (!Nodes.IsValidIndex(PackageIndex) || Nodes[PackageIndex].PackageName != PackageName)
+	{
+		return;
+	}
+	if (Nodes[PackageIndex].bDependenciesResolved && !Nodes[PackageIndex].bDependenciesStale)
+	{
+		return;
+	}
+
+	TArray<int32> NewDependencies;
+	NewDependencies.Reserve(Found.Num());
+	for (const FAssetIdentifier& Identifier : Found)
+	{
+		if (Identifier.PackageName.IsNone())
+		{
+			continue;
+		}
+
+		// インターンでノード配列が再確保されるため、ノードの参照は後で取る（自己参照も辺として残す）
+		NewDependencies.AddUnique(FindOrAddPackageLocked(Identifier.PackageName));
+	}
+
+	// 参照元を取得済みのノードの逆向きの辺を差分で直す
+	for (int32 OldDependency : Nodes[PackageIndex].Dependencies)
+	{
+		FNode& DependencyNode = Nodes[OldDependency];
+		if (DependencyNode.bReferencersResolved && !NewDependencies.Contains(OldDependency))
+		{
+			DependencyNode.Referencers.Remove(PackageIndex);
+		}
+	}
+	for (int32 NewDependency : NewDependencies)
+	{
+		FNode& DependencyNode = Nodes[NewDependency];
+		if (DependencyNode.bReferencersResolved)
+		{
+			DependencyNode.Referencers.AddUnique(PackageIndex);
+		}
+	}
+
+	FNode& Node = Nodes[PackageIndex];
+	Node.Dependencies = MoveTemp(NewDependencies);
+	if (!Node.bDependenciesResolved)
+	{
+		++NumResolved;
+	}
+	Node.bDependenciesResolved = true;
+	if (Node.bDependenciesStale)
+	{
+		Node.bDependenciesStale = false;
+		StaleNodes.RemoveSingleSwap(PackageIndex);
+	}
+	++Revision;
+}
+
+void FAssetRegistryGraph::ResolveReferencers(int32 PackageIndex)
+{
+	FName PackageName;
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (!Nodes.IsValidIndex(PackageIndex) || Nodes[PackageIndex].bReferencersResolved)
+		{
+			return;
+		}
+		PackageName = Nodes[PackageIndex].PackageName;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetIdentifier> Found;
+	AssetRegistry.GetReferencers(FAssetIdentifier(PackageName), Found);
+
+	FWriteScopeLock WriteLock(Lock);
+
+	if (!Nodes.IsValidIndex(PackageIndex) || Nodes[PackageIndex].PackageName != PackageName || Nodes[PackageIndex].bReferencersResolved)
+	{
+		return;
+	}
+
+	TArray<int32> NewReferencers;
+	NewReferencers.Reserve(Found.Num());
+	for (const FAssetIdentifier& Identifier : Found)
+	{
+		if (Identifier.PackageName.IsNone())
+		{
+			continue;
+		}
+
+		NewReferencers.AddUnique(FindOrAddPackageLocked(Identifier.PackageName));
+	}
+
+	FNode& Node = Nodes[PackageIndex];
+	Node.Referencers = MoveTemp(NewReferencers);
+	Node.bReferencersResolved = true;
+	++Revision;
+}
+
+void FAssetRegistryGraph::ResolveStaleDependencies()
+{
+	TArray<int32> PendingNodes;
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (StaleNodes.Num() == 0)
+		{
+			return;
+		}
+		PendingNodes = StaleNodes;
+	}
+
+	for (int32 PackageIndex : PendingNodes)
+	{
+		ResolveDependencies(PackageIndex);
+	}
+}
+
+// ========== 循環参照 ==========
+
+FAssetGraphCycles FAssetRegistryGraph::ComputeCycles(const TArray<FName>& RootPackages, EAssetGraphFilter Filter)
+{
+	FAssetGraphCycles Cycles;
+
+	// 辿っている間にノードが破棄された（スキャン完了・Reset）場合、集めたインデックスは別のパッケージを指すため最初からやり直す
+	for (;;)
+	{
+		// 到達可能なノードの依存を先に取得しておく（レジストリへの問い合わせはロックの外で行う）
+		TArray<int32> ReachableNodes;
+		TSet<int32> ReachedNodes;
+		ReachableNodes.Reserve(RootPackages.Num());
+
+		uint32 StartGeneration = 0;
+		{
+			FWriteScopeLock WriteLock(Lock);
+			StartGeneration = Generation;
+			for (const FName& RootPackage : RootPackages)
+			{
+				const int32 RootIndex = FindOrAddPackageLocked(RootPackage);
+				bool bAlreadyReached = false;
+				ReachedNodes.Add(RootIndex, &bAlreadyReached);
+				if (!bAlreadyReached)
+				{
+					ReachableNodes.Add(RootIndex);
+				}
+			}
+		}
+
+		TArray<int32> Dependencies;
+		for (int32 Cursor = 0; Cursor < ReachableNodes.Num(); ++Cursor)
+		{
+			if (GetGeneration() != StartGeneration)
+			{
+				break;
+			}
+
+			GetDependencies(ReachableNodes[Cursor], Dependencies, Filter);
+			for (int32 DependencyIndex : Dependencies)
+			{
+				bool bAlreadyReached = false;
+				ReachedNodes.Add(DependencyIndex, &bAlreadyReached);
+				if (!bAlreadyReached)
+				{
+					ReachableNodes.Add(DependencyIndex);
+				}
+			}
+		}
+
+		FReadScopeLock ReadLock(Lock);
+		if (Generation != StartGeneration)
+		{
+			continue;
+		}
+
+		ComputeCyclesLocked(ReachableNodes, Filter, Cycles);
+		return Cycles;
+	}
+}
+
+FAssetGraphCycles FAssetRegistryGraph::ComputeCycles(const FString& RootPath, EAssetGraphFilter Filter)
+{
+	// ワーカースレッドからも呼ばれるためGetModuleCheckedを使用
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FARFilter AssetFilter;
+	AssetFilter.PackagePaths.Add(FName(*RootPath));
+	AssetFilter.bRecursivePaths = true;
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(AssetFilter, AssetDataList);
+
+	TArray<FName> RootPackages;
+	RootPackages.Reserve(AssetDataList.Num());
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		RootPackages.AddUnique(AssetData.PackageName);
+	}
+
+	return ComputeCycles(RootPackages, Filter);
+}
+
+void FAssetRegistryGraph::ComputeCyclesLocked(const TArray<int32>& ReachableNodes, EAssetGraphFilter Filter, FAssetGraphCycles& OutCycles) const
+{
+	OutCycles.Reset();
+	OutCycles.Packages.Reserve(ReachableNodes.Num());
+
+	// 問い合わせ後に破棄されたノードは除く
+	for (int32 NodeIndex : ReachableNodes)
+	{
+		if (Nodes.IsValidIndex(NodeIndex))
+		{
+			OutCycles.Packages.Add(Nodes[NodeIndex].PackageName);
+		}
+	}
+
+	// 作業配列はグラフ全体のインデックスで引く（到達範囲の名前表や辺の複製は作らない）
+	const int32 NumNodes = Nodes.Num();
+
+	TArray<int32> VisitIndex;
+	VisitIndex.Init(INDEX_NONE, NumNodes);
+
+	TArray<int32> LowLink;
+	LowLink.Init(0, NumNodes);
+
+	TBitArray<> OnStack(false, NumNodes);
+	TArray<int32> ComponentStack;
+
+	// 深い依存チェーンでスタックを溢れさせないよう、再帰を明示的なスタックで置き換える
+	struct FDfsFrame
+	{
+		int32 Node;
+		int32 NextEdge;
+	};
+	TArray<FDfsFrame> CallStack;
+
+	int32 NextVisitIndex = 0;
+
+	auto Visit = [&](int32 Node)
+	{
+		VisitIndex[Node] = NextVisitIndex;
+		LowLink[Node] = NextVisitIndex;
+		++NextVisitIndex;
+
+		ComponentStack.Push(Node);
+		OnStack[Node] = true;
+		CallStack.Add({ Node, 0 });
+	};
+
+	for (int32 Root : ReachableNodes)
+	{
+		if (!Nodes.IsValidIndex(Root) || VisitIndex[Root] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Visit(Root);
+
+		while (CallStack.Num() > 0)
+		{
+			const int32 Node = CallStack.Last().Node;
+			const TArray<int32>& Edges = Nodes[Node].Dependencies;
+
+			if (CallStack.Last().NextEdge < Edges.Num())
+			{
+				const int32 Target = Edges[CallStack.Last().NextEdge++];
+				if (!PassesFilterLocked(Target, Filter))
+				{
+					continue;
+				}
+
+				if (VisitIndex[Target] == INDEX_NONE)
+				{
+					Visit(Target);
+				}
+				else if (OnStack[Target])
+				{
+					LowLink[Node] = FMath::Min(LowLink[Node], VisitIndex[Target]);
+				}
+				continue;
+			}
+
+			// 全ての辺を処理済み: SCCの根なら成分を取り出す
+			if (LowLink[Node] == VisitIndex[Node])
+			{
+				TArray<int32> Component;
+				int32 Member;
+				do
+				{
+					Member = ComponentStack.Pop();
+					OnStack[Member] = false;
+					Component.Add(Member);
+				}
+				while (Member != Node);
+
+				// 単一ノードは自己参照がある場合のみ循環とみなす
+				const bool bIsCycle = Component.Num() > 1 || Edges.Contains(Node);
+				if (bIsCycle)
+				{
+					const int32 GroupIndex = OutCycles.CycleGroups.AddDefaulted();
+					FAssetGraphCycleGroup& Group = OutCycles.CycleGroups[GroupIndex];
+					Group.PackageNames.Reserve(Component.Num());
+
+					for (int32 ComponentNode : Component)
+					{
+						const FName ComponentName = Nodes[ComponentNode].PackageName;
+						OutCycles.PackageCycleGroup.Add(ComponentName, GroupIndex);
+						Group.PackageNames.Add(ComponentName.ToString());
+					}
+					Group.PackageNames.Sort();
+				}
+			}
+
+			CallStack.Pop();
+
+			if (CallStack.Num() > 0)
+			{
+				const int32 Parent = CallStack.Last().Node;
+				LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Node]);
+			}
+		}
+	}
+}
+
+// ========== 管理 ==========
+
+void FAssetRegistryGraph::Invalidate(FName PackageName)
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		MarkChangedLocked(PackageName, false);
+	}
+	BroadcastChanged(PackageName);
+}
+
+void FAssetRegistryGraph::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+	ResetLocked();
+}
+
+void FAssetRegistryGraph::ResetLocked()
+{
+	Nodes.Empty();
+	NodeIndexMap.Empty();
+	StaleNodes.Empty();
+	NumResolved = 0;
+	++Revision;
+
+	// 以前の世代のインデックスを持つ処理に作り直しを知らせる
+	++Generation;
+}
+
+int32 FAssetRegistryGraph::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Nodes.Num();
+}
+
+int32 FAssetRegistryGraph::GetNumResolved() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return NumResolved;
+}
+
+uint32 FAssetRegistryGraph::GetRevision() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Revision;
+}
+
+uint32 FAssetRegistryGraph::GetGeneration() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Generation;
+}
+
+SIZE_T FAssetRegistryGraph::GetAllocatedSize() const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	SIZE_T Size = Nodes.GetAllocatedSize() + NodeIndexMap.GetAllocatedSize() + StaleNodes.GetAllocatedSize();
+	for (const FNode& Node : Nodes)
+	{
+		Size += Node.Dependencies.GetAllocatedSize() + Node.Referencers.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FAssetRegistryGraph::MarkChangedLocked(FName PackageName, bool bRemoved)
+{
+	const int32* ExistingIndex = NodeIndexMap.Find(PackageName);
+	if (!ExistingIndex)
+	{
+		// 削除されたパッケージは、まだ問い合わせていなければ辺も無い
+		if (bRemoved || PackageName.IsNone())
+		{
+			return;
+		}
+
+		// 追加・更新されたパッケージは、取得済みの参照元一覧に含まれていない可能性があるためインターンし、
+		// 参照元の問い合わせ前に依存を取得させて逆向きの辺を足す
+		const int32 NewIndex = FindOrAddPackageLocked(PackageName);
+		Nodes[NewIndex].bDependenciesStale = true;
+		StaleNodes.Add(NewIndex);
+
+		// インデックスを保持する処理（実行中の循環参照の計算など）に、見えていなかった辺があることを知らせる
+		++Revision;
+		++Generation;
+		return;
+	}
+
+	const int32 PackageIndex = *ExistingIndex;
+	FNode& Node = Nodes[PackageIndex];
+
+	if (bRemoved)
+	{
+		for (int32 DependencyIndex : Node.Dependencies)
+		{
+			FNode& DependencyNode = Nodes[DependencyIndex];
+			if (DependencyNode.bReferencersResolved)
+			{
+				DependencyNode.Referencers.Remove(PackageIndex);
+			}
+		}
+
+		if (Node.bDependenciesResolved)
+		{
+			--NumResolved;
+		}
+		if (Node.bDependenciesStale)
+		{
+			StaleNodes.RemoveSingleSwap(PackageIndex);
+		}
+
+		Node.Dependencies.Empty();
+		Node.Referencers.Empty();
+		Node.bDependenciesResolved = false;
+		Node.bReferencersResolved = false;
+		Node.bDependenciesStale = false;
+	}
+	else if (!Node.bDependenciesStale)
+	{
+		// 古い依存は逆向きの辺の差分用に残し、次の問い合わせ時に取得し直す
+		// （依存を未取得のノードも、新しい依存先の参照元一覧に足すため取得させる）
+		Node.bDependenciesStale = true;
+		StaleNodes.Add(PackageIndex);
+	}
+
+	++Revision;
+}
+
+void FAssetRegistryGraph::BroadcastChanged(FName PackageName)
+{
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+
+	TArray<FName> ChangedPackages;
+	ChangedPackages.Add(PackageName);
+	PackagesChangedDelegate.Broadcast(ChangedPackages);
+}
+
+// ========== レジストリの変更通知 ==========
+
+void FAssetRegistryGraph::OnAssetAdded(const FAssetData& AssetData)
+{
+	// 初回スキャン中の追加はスキャン完了時にまとめて破棄する
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		return;
+	}
+
+	{
+		FWriteScopeLock WriteLock(Lock);
+		MarkChangedLocked(AssetData.PackageName, false);
+	}
+	BroadcastChanged(AssetData.PackageName);
+}
+
+void FAssetRegistryGraph::OnAssetUpdated(const FAssetData& AssetData)
+{
+	// 初回スキャン中の内容はスキャン完了時にまとめて破棄する
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		return;
+	}
+
+	{
+		FWriteScopeLock WriteLock(Lock);
+		MarkChangedLocked(AssetData.PackageName, false);
+	}
+	BroadcastChanged(AssetData.PackageName);
+}
+
+void FAssetRegistryGraph::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		return;
+	}
+
+	const FName OldPackageName(*FPackageName::ObjectPathToPackageName(OldObjectPath));
+	{
+		FWriteScopeLock WriteLock(Lock);
+		MarkChangedLocked(OldPackageName, true);
+		MarkChangedLocked(AssetData.PackageName, false);
+	}
+	BroadcastChanged(OldPackageName);
+	BroadcastChanged(AssetData.PackageName);
+}
+
+void FAssetRegistryGraph::OnAssetRemoved(const FAssetData& AssetData)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		return;
+	}
+
+	{
+		FWriteScopeLock WriteLock(Lock);
+		MarkChangedLocked(AssetData.PackageName, true);
+	}
+	BroadcastChanged(AssetData.PackageName);
+}
+
+void FAssetRegistryGraph::OnFilesLoaded()
+{
+	// スキャン中に取得した依存は不完全なため破棄し、利用側にも取得し直させる
+	TArray<FName> ResolvedPackages;
+	{
+		FWriteScopeLock WriteLock(Lock);
+		for (const FNode& Node : Nodes)
+		{
+			if (Node.bDependenciesResolved || Node.bReferencersResolved)
+			{
+				ResolvedPackages.Add(Node.PackageName);
+			}
+		}
+
+		ResetLocked();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[AssetRegistryGraph] Asset scan finished, discarded %d packages resolved during scan"), ResolvedPackages.Num());
+
+	if (ResolvedPackages.Num() > 0)
+	{
+		PackagesChangedDelegate.Broadcast(ResolvedPackages);
+	}
+}
@@ -0,0 +1,27 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "AssetRegistryGraphModule.h"
+#include "AssetRegistryGraph.h"
+
+void FAssetRegistryGraphModule::StartupModule()
+{
+	Graph = MakeUnique<FAssetRegistryGraph>();
+}
+
+void FAssetRegistryGraphModule::ShutdownModule()
+{
+	Graph.Reset();
+}
+
+FAssetRegistryGraphModule& FAssetRegistryGraphModule::Get()
+{
+	// ワーカースレッドからも呼ばれるためGetModuleCheckedを使用
+	return FModuleManager::GetModuleChecked<FAssetRegistryGraphModule>("AssetRegistryGraph");
+}
+
+bool FAssetRegistryGraphModule::IsAvailable()
+{
+	return FModuleManager::Get().IsModuleLoaded("AssetRegistryGraph");
+}
+
+IMPLEMENT_MODULE(FAssetRegistryGraphModule, AssetRegistryGraph)
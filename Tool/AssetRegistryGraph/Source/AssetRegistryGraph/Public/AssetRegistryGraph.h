@@ -0,0 +1,210 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetGraphCycles.h"
+
+struct FAssetData;
+
+/**
+ * 依存・参照元の取得時に除外するパッケージ
+ */
+enum class EAssetGraphFilter : uint8
+{
+	/** 全て */
+	None,
+	/** /Script（ネイティブクラス）を除外 */
+	ExcludeScript,
+	/** /Engine と /Script を除外 */
+	ExcludeEngineAndScript,
+	/** /Game 配下のみ */
+	GameOnly
+};
+
+/** パッケージの依存が変わった通知（ゲームスレッド、変わったパッケージ名） */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAssetGraphPackagesChanged, const TArray<FName>& /*ChangedPackages*/);
+
+/**
+ * アセットレジストリのパッケージ依存グラフ（エディタ内で共有）
+ * パッケージ名をインデックスへインターンし、直接依存と参照元をインデックス配列で保持する
+ * - 各パッケージの依存・参照元は初回の問い合わせ時のみレジストリから取得し、以降は全てのツールで共有する
+ * - レジストリの変更通知（追加・更新・名前変更・削除）を受けたパッケージのみ取得し直し、逆向きの辺も差分で直す
+ * - レジストリの初回スキャン中に取得した内容は不完全なため、スキャン完了時に破棄する
+ * 読み取りはワーカースレッドからも行ってよい（内部でロックする）
+ * インデックスは破棄（Reset・スキャン完了）と未取得パッケージの追加ごとに増える世代の中でのみ有効。名前を受け取るAPIと循環参照の計算は、
+ * 途中で世代が進んだ場合に新しい世代でやり直す。インデックスを保持する利用側は GetGeneration() で世代を確かめる
+ */
+class ASSETREGISTRYGRAPH_API FAssetRegistryGraph
+{
+public:
+	FAssetRegistryGraph();
+	~FAssetRegistryGraph();
+
+	/** 共有インスタンス（AssetRegistryGraphモジュールが保持、ワーカースレッドからも取得可） */
+	static FAssetRegistryGraph& Get();
+
+	// ========== ノード ==========
+
+	/** パッケージのインデックスを検索または追加 */
+	int32 FindOrAddPackage(FName PackageName);
+
+	/**
+	 * パッケージのインデックスを検索または追加し、インデックスの世代も返す
+	 * @param OutGeneration インデックスが有効な世代（GetGeneration()と異なればインデックスは無効）
+	 */
+	int32 FindOrAddPackage(FName PackageName, uint32& OutGeneration);
+
+	/** パッケージのインデックスを検索（無い場合はINDEX_NONE） */
+	int32 FindPackage(FName PackageName) const;
+
+	/** インデックスのパッケージ名 */
+	FName GetPackageName(int32 PackageIndex) const;
+
+	/** パッケージがフィルタを通るか */
+	bool PassesFilter(int32 PackageIndex, EAssetGraphFilter Filter) const;
+
+	// ========== 辺 ==========
+
+	/** 直接依存のインデックス（未取得ならレジストリから取得） */
+	void GetDependencies(int32 PackageIndex, TArray<int32>& OutDependencies, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	/** 直接依存のパッケージ名（未取得ならレジストリから取得） */
+	void GetDependencies(FName PackageName, TArray<FName>& OutDependencies, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	/** 直接の参照元のインデックス（未取得ならレジストリから取得） */
+	void GetReferencers(int32 PackageIndex, TArray<int32>& OutReferencers, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	/** 直接の参照元のパッケージ名（未取得ならレジストリから取得） */
+	void GetReferencers(FName PackageName, TArray<FName>& OutReferencers, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	// ========== 循環参照 ==========
+
+	/**
+	 * 起点パッケージから到達可能な範囲で循環グループ（強連結成分）を計算
+	 * 未取得の依存はレジストリから取得し、共有グラフのノード上で直接Tarjan法を行う（ワーカースレッドから呼んでよい）
+	 * @param RootPackages 起点（起点自身はフィルタに関わらず含める）
+	 * @param Filter 辿る依存
+	 */
+	FAssetGraphCycles ComputeCycles(const TArray<FName>& RootPackages, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	/**
+	 * 指定パス配下のパッケージを起点に循環グループを計算
+	 * @param RootPath 起点となるパス（例: /Game）
+	 */
+	FAssetGraphCycles ComputeCycles(const FString& RootPath, EAssetGraphFilter Filter = EAssetGraphFilter::ExcludeEngineAndScript);
+
+	// ========== 管理 ==========
+
+	/** パッケージの依存を取得し直させる（ゲーム側の独自の変更を伝える場合、ゲームスレッドから呼ぶ） */
+	void Invalidate(FName PackageName);
+
+	/** 全て破棄 */
+	void Reset();
+
+	/** インターン済みのパッケージ数 */
+	int32 Num() const;
+
+	/** 依存を取得済みのパッケージ数 */
+	int32 GetNumResolved() const;
+
+	/** 内容が変わるたびに増える番号 */
+	uint32 GetRevision() const;
+
+	/** ノードを破棄して作り直す・未取得のパッケージが追加されるたびに増える番号（異なる世代のインデックスは別のパッケージを指しうる） */
+	uint32 GetGeneration() const;
+
+	/** 使用メモリ（バイト） */
+	SIZE_T GetAllocatedSize() const;
+
+	/** パッケージの依存が変わった通知 */
+	FOnAssetGraphPackagesChanged& OnPackagesChanged() { return PackagesChangedDelegate; }
+
+private:
+	/** ノード（パッケージ） */
+	struct FNode
+	{
+		FName PackageName;
+
+		/** 直接依存・参照元のインデックス */
+		TArray<int32> Dependencies;
+		TArray<int32> Referencers;
+
+		/** 取得済みか */
+		bool bDependenciesResolved = false;
+		bool bReferencersResolved = false;
+
+		/** 変更通知を受けて依存を取得し直す必要があるか（古い依存は逆向きの辺の差分用に残す） */
+		bool bDependenciesStale = false;
+
+		/** パスの種類（フィルタ用、インターン時に判定） */
+		bool bIsScript = false;
+		bool bIsEngine = false;
+		bool bIsGame = false;
+	};
+
+	/** ロック中: インデックスを検索または追加 */
+	int32 FindOrAddPackageLocked(FName PackageName);
+
+	/** ロック中: フィルタを通るか */
+	bool PassesFilterLocked(int32 PackageIndex, EAssetGraphFilter Filter) const;
+
+	/** 直接依存を取得済みにする（レジストリへの問い合わせはロックの外で行う） */
+	void ResolveDependencies(int32 PackageIndex);
+
+	/** 直接の参照元を取得済みにする */
+	void ResolveReferencers(int32 PackageIndex);
+
+	/** 変更通知を受けたパッケージの依存を全て取得し直す（参照元の問い合わせ前に逆向きの辺を揃える） */
+	void ResolveStaleDependencies();
+
+	/** ロック中: ノードを全て破棄し、世代を進める */
+	void ResetLocked();
+
+	/** ロック中: 到達可能なノード上でTarjan法（反復版）を行い、結果を書き込む */
+	void ComputeCyclesLocked(const TArray<int32>& ReachableNodes, EAssetGraphFilter Filter, FAssetGraphCycles& OutCycles) const;
+
+	/** ロック中: パッケージを変更済みにする（未インターンの追加・更新はインターンして世代を進める） */
+	void MarkChangedLocked(FName PackageName, bool bRemoved);
+
+	/** 変更を通知 */
+	void BroadcastChanged(FName PackageName);
+
+	/** レジストリの変更通知 */
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetUpdated(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnFilesLoaded();
+
+	/** ノード配列とインデックス表を保護 */
+	mutable FRWLock Lock;
+
+	/** フラットなノード配列（インデックスは削除されても再利用しない） */
+	TArray<FNode> Nodes;
+
+	/** パッケージ名 → インデックス */
+	TMap<FName, int32> NodeIndexMap;
+
+	/** 依存を取得し直す必要があるノード */
+	TArray<int32> StaleNodes;
+
+	/** 依存を取得済みのノード数 */
+	int32 NumResolved = 0;
+
+	/** 内容が変わるたびに増える番号 */
+	uint32 Revision = 0;
+
+	/** ノードを破棄する・未取得のパッケージが追加されるたびに増える番号（インデックスの有効範囲） */
+	uint32 Generation = 0;
+
+	/** 通知 */
+	FOnAssetGraphPackagesChanged PackagesChangedDelegate;
+
+	/** レジストリの変更通知ハンドル */
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
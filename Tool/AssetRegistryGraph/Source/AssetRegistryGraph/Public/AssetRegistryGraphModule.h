@@ -0,0 +1,33 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FAssetRegistryGraph;
+
+/**
+ * Asset Registry Graphモジュール
+ * 分析系プラグインが共有するパッケージ依存グラフを保持する
+ */
+class ASSETREGISTRYGRAPH_API FAssetRegistryGraphModule : public IModuleInterface
+{
+public:
+	// IModuleInterface
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+	/** モジュールインスタンスを取得 */
+	static FAssetRegistryGraphModule& Get();
+
+	/** モジュールがロードされているか */
+	static bool IsAvailable();
+
+	/** 共有グラフ */
+	FAssetRegistryGraph& GetGraph() const { return *Graph; }
+
+private:
+	/** 共有グラフ */
+	TUniquePtr<FAssetRegistryGraph> Graph;
+};
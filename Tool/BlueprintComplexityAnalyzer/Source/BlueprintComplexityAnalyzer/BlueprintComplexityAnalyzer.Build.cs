@@ -36,6 +36,8 @@ public class BlueprintComplexityAnalyzer : ModuleRules
 				"ToolMenus",
 				"WorkspaceMenuStructure",
 				"AssetRegistry",
+				"AssetRegistryGraph",
+				"AssetAnalysisCommon",
 				"ContentBrowser",
 				"EditorFramework",
 				"LevelEditor",
@@ -48,7 +50,9 @@ public class BlueprintComplexityAnalyzer : ModuleRules
 			{
 				"Projects",
 				"ToolWidgets",
-				"EditorWidgets"
+				"EditorWidgets",
+				"Json",
+				"JsonUtilities"
 			}
 		);
 	}
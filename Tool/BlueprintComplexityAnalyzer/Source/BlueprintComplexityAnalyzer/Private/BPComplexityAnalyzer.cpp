@@ -1,6 +1,11 @@
 // Copyright DevTools. All Rights Reserved.
 
 #include "BPComplexityAnalyzer.h"
+#include "AssetGraphCycles.h"
+#include "AssetRegistryGraph.h"
+#include "BPComplexityCache.h"
+#include "BPGraphSnapshot.h"
+#include "BPRuntimeProfiler.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
@@ -19,6 +24,18 @@
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	/** AnalyzeProjectで同時に発行する非同期ロード数 */
+	constexpr int32 MaxInFlightPackageLoads = 32;
+
+	/** C++化推奨度に列挙する実測上位関数の数 */
+	constexpr int32 MaxHotFunctions = 3;
+}
 
 UBPComplexityAnalyzer::UBPComplexityAnalyzer()
 {
@@ -28,31 +45,48 @@ UBPComplexityAnalyzer::UBPComplexityAnalyzer()
 
 FBPAnalysisReport UBPComplexityAnalyzer::AnalyzeBlueprint(UBlueprint* Blueprint)
 {
-	FBPAnalysisReport Report;
-
 	if (!Blueprint)
 	{
+		FBPAnalysisReport Report;
 		Report.HumanReadableSummary = TEXT("Invalid Blueprint");
 		return Report;
 	}
 
-	// 基本情報
-	Report.BlueprintPath = Blueprint->GetPathName();
-	Report.BlueprintName = Blueprint->GetName();
-	Report.AnalysisTime = FDateTime::Now();
+	return AnalyzeSnapshot(FBPGraphSnapshot::Capture(Blueprint), MakeScoringContext());
+}
 
-	if (Blueprint->ParentClass)
+FBPScoringContext UBPComplexityAnalyzer::MakeScoringContext() const
+{
+	FBPScoringContext Context;
+	Context.Thresholds = Thresholds;
+	Context.RuntimeProfiles = RuntimeProfiles;
+	Context.CycleAnalysis = CycleAnalysis;
+	return Context;
+}
+
+FBPAnalysisReport UBPComplexityAnalyzer::AnalyzeSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context)
+{
+	FBPAnalysisReport Report;
+
+	if (!Snapshot.IsValid())
 	{
-		Report.ParentClassName = Blueprint->ParentClass->GetName();
+		Report.HumanReadableSummary = TEXT("Invalid Blueprint");
+		return Report;
 	}
 
+	// 基本情報
+	Report.BlueprintPath = Snapshot.BlueprintPath;
+	Report.BlueprintName = Snapshot.BlueprintName;
+	Report.ParentClassName = Snapshot.ParentClassName;
+	Report.AnalysisTime = FDateTime::Now();
+
 	// 各メトリクスを分析
-	Report.NodeMetrics = AnalyzeNodeCount(Blueprint);
-	Report.DependencyMetrics = AnalyzeDependencies(Blueprint);
-	Report.TickMetrics = AnalyzeTickUsage(Blueprint);
+	Report.NodeMetrics = AnalyzeNodeCountInSnapshot(Snapshot, Context);
+	Report.DependencyMetrics = AnalyzeDependenciesForPackage(Snapshot.PackageName, Context);
+	Report.TickMetrics = AnalyzeTickUsageInSnapshot(Snapshot, Context);
 
 	// C++化推奨度を計算（他のメトリクスに基づく）
-	Report.CppMigrationMetrics = CalculateCppMigrationScore(Blueprint, Report);
+	Report.CppMigrationMetrics = CalculateCppMigrationScoreFromReport(Report, Context);
 
 	// 総合スコアを計算
 	Report.OverallComplexityScore =
@@ -64,55 +98,59 @@ FBPAnalysisReport UBPComplexityAnalyzer::AnalyzeBlueprint(UBlueprint* Blueprint)
 	Report.OverallHealthLevel = CalculateHealthLevel(Report.OverallComplexityScore);
 
 	// 問題を検出
-	DetectIssues(Report, Report.Issues);
+	DetectIssues(Report, Context, Report.Issues);
 
 	// サマリーと推奨アクションを生成
 	Report.HumanReadableSummary = GenerateHumanReadableSummary(Report);
-	Report.RecommendedActions = GenerateRecommendedActions(Report);
+	Report.RecommendedActions = GenerateRecommendedActions(Report, Context);
 
 	return Report;
 }
 
 FBPProjectAnalysisSummary UBPComplexityAnalyzer::AnalyzeProject(const FString& PathFilter)
 {
-	FBPProjectAnalysisSummary Summary;
-	Summary.AnalysisTime = FDateTime::Now();
-
-	// アセットレジストリからBlueprintを取得
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	FARFilter Filter;
-	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-	Filter.bRecursiveClasses = true;
-	Filter.bRecursivePaths = true;
+	TArray<FAssetData> BlueprintAssets;
+	GetBlueprintAssets(PathFilter, BlueprintAssets);
 
-	if (!PathFilter.IsEmpty())
+	// 循環グループはロードと並行してワーカースレッドで一度だけ計算し、スコアリングはその完了を待つ
+	TSharedPtr<FAssetGraphCycles> NewCycleAnalysis = MakeShared<FAssetGraphCycles>();
+	const FString CycleRootPath = PathFilter.IsEmpty() ? TEXT("/Game") : PathFilter;
+	UE::Tasks::FTask CycleTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [NewCycleAnalysis, CycleRootPath]()
 	{
-		Filter.PackagePaths.Add(FName(*PathFilter));
-	}
-	else
-	{
-		Filter.PackagePaths.Add(TEXT("/Game"));
-	}
+		*NewCycleAnalysis = FAssetRegistryGraph::Get().ComputeCycles(CycleRootPath);
+	});
+	CycleAnalysis = NewCycleAnalysis;
 
-	TArray<FAssetData> BlueprintAssets;
-	AssetRegistry.GetAssets(Filter, BlueprintAssets);
+	TArray<FBPAnalysisReport> ScoredReports;
+	TArray<bool> bHasReport;
+	AnalyzeAssetsPipelined(BlueprintAssets, { CycleTask }, ScoredReports, bHasReport);
 
-	TArray<FBPAnalysisReport> AllReports;
-	float TotalScore = 0.0f;
+	CycleTask.Wait();
+	SaveAnalysisCache();
 
-	for (const FAssetData& AssetData : BlueprintAssets)
+	TArray<FBPAnalysisReport> AllReports;
+	AllReports.Reserve(ScoredReports.Num());
+	for (int32 AssetIndex = 0; AssetIndex < ScoredReports.Num(); ++AssetIndex)
 	{
-		UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
-		if (!Blueprint)
+		if (bHasReport[AssetIndex])
 		{
-			continue;
+			AllReports.Add(MoveTemp(ScoredReports[AssetIndex]));
 		}
+	}
 
-		FBPAnalysisReport Report = AnalyzeBlueprint(Blueprint);
-		AllReports.Add(Report);
+	return BuildProjectSummary(MoveTemp(AllReports), CycleAnalysis->MakeCycleGroups<FBPCycleGroup>());
+}
+
+FBPProjectAnalysisSummary UBPComplexityAnalyzer::BuildProjectSummary(TArray<FBPAnalysisReport> Reports, const TArray<FBPCycleGroup>& CycleGroups) const
+{
+	FBPProjectAnalysisSummary Summary;
+	Summary.AnalysisTime = FDateTime::Now();
+	Summary.CycleGroups = CycleGroups;
 
+	float TotalScore = 0.0f;
+
+	for (const FBPAnalysisReport& Report : Reports)
+	{
 		Summary.TotalBlueprintCount++;
 		TotalScore += Report.OverallComplexityScore;
 
@@ -156,126 +194,591 @@ FBPProjectAnalysisSummary UBPComplexityAnalyzer::AnalyzeProject(const FString& P
 	}
 
 	// 最も複雑なTop10を抽出
-	AllReports.Sort([](const FBPAnalysisReport& A, const FBPAnalysisReport& B)
+	Reports.Sort([](const FBPAnalysisReport& A, const FBPAnalysisReport& B)
 	{
 		return A.OverallComplexityScore > B.OverallComplexityScore;
 	});
 
-	int32 TopCount = FMath::Min(10, AllReports.Num());
+	int32 TopCount = FMath::Min(10, Reports.Num());
 	for (int32 i = 0; i < TopCount; ++i)
 	{
-		Summary.MostComplexBlueprints.Add(AllReports[i]);
+		Summary.MostComplexBlueprints.Add(Reports[i]);
 	}
 
 	return Summary;
 }
 
-FBPAnalysisReport UBPComplexityAnalyzer::AnalyzeBlueprintByPath(const FString& AssetPath)
+void UBPComplexityAnalyzer::GetBlueprintAssets(const FString& PathFilter, TArray<FAssetData>& OutAssets) const
 {
-	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
-	return AnalyzeBlueprint(Blueprint);
+	// アセットレジストリからBlueprintを取得
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+
+	if (!PathFilter.IsEmpty())
+	{
+		Filter.PackagePaths.Add(FName(*PathFilter));
+	}
+	else
+	{
+		Filter.PackagePaths.Add(TEXT("/Game"));
+	}
+
+	AssetRegistry.GetAssets(Filter, OutAssets);
 }
 
-FBPNodeMetrics UBPComplexityAnalyzer::AnalyzeNodeCount(UBlueprint* Blueprint)
+void UBPComplexityAnalyzer::AnalyzeAssetsPipelined(const TArray<FAssetData>& Assets, const TArray<UE::Tasks::FTask>& ScoringPrerequisites,
+	TArray<FBPAnalysisReport>& OutReports, TArray<bool>& bOutHasReport)
 {
-	FBPNodeMetrics Metrics;
+	// パイプライン:
+	// 1. パッケージを一定数まとめて非同期ロード（I/Oを重ねる）
+	// 2. ロード完了順にゲームスレッドでグラフのスナップショットを作成
+	// 3. スナップショットのスコアリングはワーカースレッドで並列実行
+	OutReports.Reset();
+	OutReports.SetNum(Assets.Num());
+	bOutHasReport.Init(false, Assets.Num());
 
-	if (!Blueprint)
+	TArray<UE::Tasks::FTask> ScoringTasks;
+	ScoringTasks.Reserve(Assets.Num());
+
+	// タスクはアナライザーを参照せず、開始時点の設定の複製のみを使う
+	const TSharedRef<const FBPScoringContext> Context = MakeShared<const FBPScoringContext>(MakeScoringContext());
+
+	// 各タスクは自分の要素にのみ書き込む（配列は事前確保済み）
+	auto LaunchScoring = [&Context, &ScoringTasks, &ScoringPrerequisites, &OutReports, &bOutHasReport](int32 AssetIndex, TSharedPtr<const FBPGraphSnapshot> Snapshot)
 	{
-		return Metrics;
+		bOutHasReport[AssetIndex] = true;
+		ScoringTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Context, Snapshot, AssetIndex, &OutReports]()
+		{
+			OutReports[AssetIndex] = AnalyzeSnapshot(*Snapshot, *Context);
+		}, ScoringPrerequisites));
+	};
+
+	// キャッシュヒットはロードせずに即スコアリング
+	TArray<int32> AssetsToLoad;
+	AssetsToLoad.Reserve(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		TSharedPtr<const FBPGraphSnapshot> CachedSnapshot = AnalysisCache.IsValid() ? AnalysisCache->FindSnapshot(Assets[AssetIndex].PackageName) : nullptr;
+		if (CachedSnapshot.IsValid())
+		{
+			LaunchScoring(AssetIndex, CachedSnapshot);
+		}
+		else
+		{
+			AssetsToLoad.Add(AssetIndex);
+		}
 	}
 
-	// カテゴリカウント用マップ
-	TMap<FString, int32> CategoryCounts;
-	int32 LargestGraphNodes = 0;
+	// ロード完了通知（ロード完了順、ゲームスレッドのみで更新）
+	TArray<int32> CompletedAssets;
+	int32 InFlightLoadCount = 0;
+	int32 NextAssetToLoad = 0;
 
-	// 全グラフを分析
-	TArray<UEdGraph*> AllGraphs;
-	Blueprint->GetAllGraphs(AllGraphs);
+	auto IssueLoads = [&]()
+	{
+		while (InFlightLoadCount < MaxInFlightPackageLoads && NextAssetToLoad < AssetsToLoad.Num())
+		{
+			const int32 AssetIndex = AssetsToLoad[NextAssetToLoad++];
+			const FAssetData& AssetData = Assets[AssetIndex];
+
+			// ロード済みならリクエスト不要
+			if (AssetData.IsAssetLoaded())
+			{
+				CompletedAssets.Add(AssetIndex);
+				continue;
+			}
+
+			InFlightLoadCount++;
+			LoadPackageAsync(AssetData.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+				[&CompletedAssets, &InFlightLoadCount, AssetIndex](const FName&, UPackage*, EAsyncLoadingResult::Type)
+			{
+				// 失敗時も通知して待機を終える（アセット取得で弾く）
+				CompletedAssets.Add(AssetIndex);
+				InFlightLoadCount--;
+			}));
+		}
+	};
+
+	IssueLoads();
 
-	for (UEdGraph* Graph : AllGraphs)
+	// 個々のリクエストをフラッシュせず、ロードが完了したものから順にスナップショットを作成する
+	while (InFlightLoadCount > 0 || CompletedAssets.Num() > 0)
 	{
-		if (!Graph)
+		if (CompletedAssets.Num() == 0)
 		{
+			ProcessAsyncLoading(true, false, 0.005);
 			continue;
 		}
 
-		int32 GraphNodeCount = 0;
+		const TArray<int32> ReadyAssets = MoveTemp(CompletedAssets);
+		CompletedAssets.Reset();
 
-		for (UEdGraphNode* Node : Graph->Nodes)
+		// スナップショット作成中もI/Oが途切れないよう次のリクエストを積む
+		IssueLoads();
+
+		for (const int32 AssetIndex : ReadyAssets)
 		{
-			if (!Node)
+			UBlueprint* Blueprint = Cast<UBlueprint>(Assets[AssetIndex].FastGetAsset(false));
+			if (!Blueprint)
 			{
 				continue;
 			}
 
-			Metrics.TotalNodeCount++;
-			GraphNodeCount++;
+			TSharedRef<const FBPGraphSnapshot> Snapshot = MakeShared<const FBPGraphSnapshot>(FBPGraphSnapshot::Capture(Blueprint));
+			if (AnalysisCache.IsValid())
+			{
+				AnalysisCache->StoreSnapshot(Assets[AssetIndex].PackageName, Snapshot);
+			}
+
+			LaunchScoring(AssetIndex, Snapshot);
+		}
+	}
+
+	UE::Tasks::Wait(ScoringTasks);
 
-			// ノードタイプ別カウント
-			if (UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
+	// ベースライン用に最新のレポートを記録（スナップショット未保存のパッケージは無視される）
+	if (AnalysisCache.IsValid())
+	{
+		for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+		{
+			if (bOutHasReport[AssetIndex])
 			{
-				Metrics.FunctionCallCount++;
+				AnalysisCache->StoreReport(Assets[AssetIndex].PackageName, OutReports[AssetIndex]);
 			}
-			else if (Cast<UK2Node_VariableGet>(Node) || Cast<UK2Node_VariableSet>(Node))
+		}
+	}
+}
+
+void UBPComplexityAnalyzer::AnalyzeAssets(const TArray<FAssetData>& Assets, TArray<FBPAnalysisReport>& OutReports)
+{
+	TArray<FBPAnalysisReport> ScoredReports;
+	TArray<bool> bHasReport;
+	AnalyzeAssetsPipelined(Assets, {}, ScoredReports, bHasReport);
+
+	OutReports.Reserve(OutReports.Num() + ScoredReports.Num());
+	for (int32 AssetIndex = 0; AssetIndex < ScoredReports.Num(); ++AssetIndex)
+	{
+		if (bHasReport[AssetIndex])
+		{
+			OutReports.Add(MoveTemp(ScoredReports[AssetIndex]));
+		}
+	}
+}
+
+FBPBaselineDiffReport UBPComplexityAnalyzer::AnalyzeChangedSinceBaseline(const FString& PathFilter)
+{
+	FBPBaselineDiffReport Diff;
+	Diff.AnalysisTime = FDateTime::Now();
+
+	FBPComplexityBaseline Baseline;
+	Diff.bHasBaseline = FBPComplexityCache::LoadBaseline(FBPComplexityCache::GetDefaultBaselinePath(), Baseline);
+	Diff.BaselineTime = Baseline.CreatedTime;
+
+	TArray<FAssetData> BlueprintAssets;
+	GetBlueprintAssets(PathFilter, BlueprintAssets);
+
+	// 保存ハッシュがベースラインと一致し、未保存の変更も無いものはロードしない
+	TArray<FAssetData> ChangedAssets;
+	TArray<const FBPComplexityBaseline::FEntry*> PreviousEntries;
+	TSet<FName> CurrentPackages;
+	CurrentPackages.Reserve(BlueprintAssets.Num());
+
+	for (const FAssetData& AssetData : BlueprintAssets)
+	{
+		CurrentPackages.Add(AssetData.PackageName);
+
+		const FBPComplexityBaseline::FEntry* Entry = Baseline.Entries.Find(AssetData.PackageName);
+		FIoHash CurrentHash;
+		if (Entry &&
+			FBPComplexityCache::GetCurrentPackageHash(AssetData.PackageName, CurrentHash) &&
+			CurrentHash == Entry->SavedHash &&
+			!FBPComplexityCache::IsPackageDirty(AssetData.PackageName))
+		{
+			Diff.UnchangedCount++;
+			continue;
+		}
+
+		ChangedAssets.Add(AssetData);
+		PreviousEntries.Add(Entry);
+	}
+
+	// 循環グループは既存の分析結果、無ければ到達範囲で計算する
+	TArray<FBPAnalysisReport> Reports;
+	TArray<bool> bHasReport;
+	AnalyzeAssetsPipelined(ChangedAssets, {}, Reports, bHasReport);
+	SaveAnalysisCache();
+
+	for (int32 AssetIndex = 0; AssetIndex < ChangedAssets.Num(); ++AssetIndex)
+	{
+		if (!bHasReport[AssetIndex])
+		{
+			continue;
+		}
+
+		const FBPAnalysisReport& Report = Reports[AssetIndex];
+		const FBPComplexityBaseline::FEntry* Previous = PreviousEntries[AssetIndex];
+
+		FBPBaselineChange& Change = Diff.Changes.AddDefaulted_GetRef();
+		Change.BlueprintPath = Report.BlueprintPath;
+		Change.CurrentScore = Report.OverallComplexityScore;
+		Change.CurrentHealthLevel = Report.OverallHealthLevel;
+
+		if (Previous)
+		{
+			Change.ChangeType = EBPBaselineChangeType::Modified;
+			Change.PreviousScore = Previous->Report.OverallComplexityScore;
+			Change.PreviousHealthLevel = Previous->Report.OverallHealthLevel;
+			Change.bIsRegression = Change.CurrentHealthLevel > Change.PreviousHealthLevel;
+		}
+		else
+		{
+			Change.ChangeType = EBPBaselineChangeType::Added;
+			Change.bIsRegression = Change.CurrentHealthLevel != EBPHealthLevel::Green;
+		}
+
+		Diff.ChangedReports.Add(Report);
+	}
+
+	// フィルタ範囲内でベースラインにだけ存在するものは削除扱い
+	const FString RootPath = PathFilter.IsEmpty() ? TEXT("/Game") : PathFilter;
+	for (const TPair<FName, FBPComplexityBaseline::FEntry>& Pair : Baseline.Entries)
+	{
+		if (CurrentPackages.Contains(Pair.Key) || !Pair.Key.ToString().StartsWith(RootPath))
+		{
+			continue;
+		}
+
+		FBPBaselineChange& Change = Diff.Changes.AddDefaulted_GetRef();
+		Change.BlueprintPath = Pair.Value.Report.BlueprintPath.IsEmpty() ? Pair.Key.ToString() : Pair.Value.Report.BlueprintPath;
+		Change.ChangeType = EBPBaselineChangeType::Removed;
+		Change.PreviousScore = Pair.Value.Report.OverallComplexityScore;
+		Change.PreviousHealthLevel = Pair.Value.Report.OverallHealthLevel;
+	}
+
+	for (const FBPBaselineChange& Change : Diff.Changes)
+	{
+		Diff.RegressionCount += Change.bIsRegression ? 1 : 0;
+	}
+
+	// スコアの悪化が大きい順
+	Diff.Changes.StableSort([](const FBPBaselineChange& A, const FBPBaselineChange& B)
+	{
+		return (A.CurrentScore - A.PreviousScore) > (B.CurrentScore - B.PreviousScore);
+	});
+
+	return Diff;
+}
+
+void UBPComplexityAnalyzer::SetUseAnalysisCache(bool bEnable)
+{
+	if (bEnable && !AnalysisCache.IsValid())
+	{
+		AnalysisCache = MakeShared<FBPComplexityCache>();
+		AnalysisCache->Load(FBPComplexityCache::GetDefaultCachePath());
+	}
+	else if (!bEnable)
+	{
+		AnalysisCache.Reset();
+	}
+}
+
+bool UBPComplexityAnalyzer::SaveAnalysisCache()
+{
+	return AnalysisCache.IsValid() && AnalysisCache->Save(FBPComplexityCache::GetDefaultCachePath());
+}
+
+void UBPComplexityAnalyzer::ClearAnalysisCache()
+{
+	if (AnalysisCache.IsValid())
+	{
+		AnalysisCache->Reset();
+	}
+	IFileManager::Get().Delete(*FBPComplexityCache::GetDefaultCachePath(), false, false, true);
+}
+
+bool UBPComplexityAnalyzer::SaveBaseline()
+{
+	return AnalysisCache.IsValid() && AnalysisCache->SaveBaseline(FBPComplexityCache::GetDefaultBaselinePath());
+}
+
+void UBPComplexityAnalyzer::SetRuntimeCaptureDuringPIE(bool bEnable)
+{
+	if (bEnable && !RuntimeProfiler.IsValid())
+	{
+		RuntimeProfiler = MakeShared<FBPRuntimeProfiler>();
+		RuntimeProfiler->OnCaptureFinished.AddUObject(this, &UBPComplexityAnalyzer::SetRuntimeProfiles);
+		RuntimeProfiler->SetCaptureDuringPIE(true);
+	}
+	else if (!bEnable)
+	{
+		RuntimeProfiler.Reset();
+	}
+}
+
+bool UBPComplexityAnalyzer::IsRuntimeCaptureDuringPIEEnabled() const
+{
+	return RuntimeProfiler.IsValid() && RuntimeProfiler->IsCaptureDuringPIEEnabled();
+}
+
+void UBPComplexityAnalyzer::SetRuntimeProfiles(const TArray<FBPRuntimeProfile>& Profiles)
+{
+	// 実行中のタスクが参照している表は書き換えず、新しい表に差し替える
+	TSharedRef<TMap<FString, FBPRuntimeProfile>> NewProfiles = MakeShared<TMap<FString, FBPRuntimeProfile>>();
+	for (const FBPRuntimeProfile& Profile : Profiles)
+	{
+		NewProfiles->Add(Profile.BlueprintPath, Profile);
+	}
+	RuntimeProfiles = NewProfiles;
+}
+
+TArray<FBPRuntimeProfile> UBPComplexityAnalyzer::GetRuntimeProfiles() const
+{
+	TArray<FBPRuntimeProfile> Profiles;
+	if (RuntimeProfiles.IsValid())
+	{
+		RuntimeProfiles->GenerateValueArray(Profiles);
+	}
+	return Profiles;
+}
+
+void UBPComplexityAnalyzer::ClearRuntimeProfiles()
+{
+	RuntimeProfiles.Reset();
+}
+
+const FBPRuntimeProfile* FBPScoringContext::FindRuntimeProfile(const FString& BlueprintPath) const
+{
+	const FBPRuntimeProfile* Profile = RuntimeProfiles.IsValid() ? RuntimeProfiles->Find(BlueprintPath) : nullptr;
+	return (Profile && Profile->CapturedFrames > 0) ? Profile : nullptr;
+}
+
+FBPAnalysisReport UBPComplexityAnalyzer::AnalyzeBlueprintByPath(const FString& AssetPath)
+{
+	TArray<FBPAnalysisReport> Reports = AnalyzeBlueprintsByPath({ AssetPath });
+	if (Reports.Num() == 0)
+	{
+		return AnalyzeBlueprint(nullptr);
+	}
+
+	return MoveTemp(Reports[0]);
+}
+
+TArray<FBPAnalysisReport> UBPComplexityAnalyzer::AnalyzeBlueprintsByPath(const TArray<FString>& AssetPaths, int32 DependencyDepth)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// 幅優先で見つかった順のアセットとスコアリングタスク（同じインデックス）
+	TArray<FAssetData> Assets;
+	TArray<UE::Tasks::TTask<FBPAnalysisReport>> ScoringTasks;
+
+	// ロード完了通知（ロード完了順、ゲームスレッドのみで更新）
+	TArray<int32> CompletedAssets;
+	int32 PendingLoadCount = 0;
+
+	// タスクはアナライザーを参照せず、開始時点の設定の複製のみを使う
+	const TSharedRef<const FBPScoringContext> Context = MakeShared<const FBPScoringContext>(MakeScoringContext());
+
+	TSet<FName> VisitedPackages;
+	TArray<FName> Frontier;
+
+	for (const FString& AssetPath : AssetPaths)
+	{
+		const FName PackageName(*FPackageName::ObjectPathToPackageName(AssetPath));
+		bool bAlreadyVisited = false;
+		VisitedPackages.Add(PackageName, &bAlreadyVisited);
+		if (!bAlreadyVisited)
+		{
+			Frontier.Add(PackageName);
+		}
+	}
+
+	for (int32 Depth = 0; Frontier.Num() > 0; ++Depth)
+	{
+		// 階層内のBlueprintをレジストリから一度に取得
+		FARFilter Filter;
+		Filter.PackageNames = MoveTemp(Frontier);
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+		Frontier.Reset();
+
+		TArray<FAssetData> LevelAssets;
+		AssetRegistry.GetAssets(Filter, LevelAssets);
+
+		// 階層全体のロードを先に発行し、I/Oを重ねる
+		for (FAssetData& AssetData : LevelAssets)
+		{
+			const int32 AssetIndex = Assets.Add(MoveTemp(AssetData));
+			ScoringTasks.AddDefaulted();
+
+			const FAssetData& AddedAsset = Assets[AssetIndex];
+			TSharedPtr<const FBPGraphSnapshot> CachedSnapshot = AnalysisCache.IsValid() ? AnalysisCache->FindSnapshot(AddedAsset.PackageName) : nullptr;
+			if (CachedSnapshot.IsValid())
 			{
-				Metrics.VariableAccessCount++;
+				ScoringTasks[AssetIndex] = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Context, CachedSnapshot]()
+				{
+					return AnalyzeSnapshot(*CachedSnapshot, *Context);
+				});
+				CompletedAssets.Add(AssetIndex);
 			}
-			else if (Cast<UK2Node_IfThenElse>(Node))
+			else if (AddedAsset.IsAssetLoaded())
 			{
-				Metrics.ControlFlowCount++;
+				CompletedAssets.Add(AssetIndex);
 			}
-			else if (Cast<UK2Node_Event>(Node))
+			else
 			{
-				Metrics.EventNodeCount++;
+				PendingLoadCount++;
+				LoadPackageAsync(AddedAsset.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+					[&CompletedAssets, &PendingLoadCount, AssetIndex](const FName&, UPackage*, EAsyncLoadingResult::Type)
+				{
+					// 失敗時も通知して待機を終える（アセット取得で弾く）
+					CompletedAssets.Add(AssetIndex);
+					PendingLoadCount--;
+				}));
 			}
-			else if (Cast<UK2Node_MacroInstance>(Node))
+		}
+
+		// ロードが完了したものから分析し、次の階層を集める
+		while (PendingLoadCount > 0 || CompletedAssets.Num() > 0)
+		{
+			if (CompletedAssets.Num() == 0)
 			{
-				Metrics.MacroCount++;
+				ProcessAsyncLoading(true, false, 0.005);
+				continue;
 			}
-			else if (Cast<UK2Node_CustomEvent>(Node))
+
+			const TArray<int32> ReadyAssets = MoveTemp(CompletedAssets);
+			CompletedAssets.Reset();
+
+			for (const int32 AssetIndex : ReadyAssets)
 			{
-				Metrics.CustomEventCount++;
+				const FAssetData& AssetData = Assets[AssetIndex];
+
+				if (!ScoringTasks[AssetIndex].IsValid())
+				{
+					UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.FastGetAsset(false));
+					if (!Blueprint)
+					{
+						continue;
+					}
+
+					TSharedRef<const FBPGraphSnapshot> Snapshot = MakeShared<const FBPGraphSnapshot>(FBPGraphSnapshot::Capture(Blueprint));
+					if (AnalysisCache.IsValid())
+					{
+						AnalysisCache->StoreSnapshot(AssetData.PackageName, Snapshot);
+					}
+
+					ScoringTasks[AssetIndex] = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Context, Snapshot]()
+					{
+						return AnalyzeSnapshot(*Snapshot, *Context);
+					});
+				}
+
+				if (Depth >= DependencyDepth)
+				{
+					continue;
+				}
+
+				// ネイティブクラスは除外（共有グラフで取得済みのパッケージは問い合わせない）
+				TArray<FName> Dependencies;
+				FAssetRegistryGraph::Get().GetDependencies(AssetData.PackageName, Dependencies, EAssetGraphFilter::ExcludeScript);
+				for (const FName& Dependency : Dependencies)
+				{
+					bool bAlreadyVisited = false;
+					VisitedPackages.Add(Dependency, &bAlreadyVisited);
+					if (!bAlreadyVisited)
+					{
+						Frontier.Add(Dependency);
+					}
+				}
 			}
+		}
+	}
 
-			// カテゴリ別カウント
-			FString Category = GetNodeCategory(Node);
-			CategoryCounts.FindOrAdd(Category)++;
+	TArray<FBPAnalysisReport> Reports;
+	Reports.Reserve(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		if (!ScoringTasks[AssetIndex].IsValid())
+		{
+			continue;
+		}
+
+		Reports.Add(ScoringTasks[AssetIndex].GetResult());
+		if (AnalysisCache.IsValid())
+		{
+			AnalysisCache->StoreReport(Assets[AssetIndex].PackageName, Reports.Last());
 		}
+	}
+
+	return Reports;
+}
+
+FBPNodeMetrics UBPComplexityAnalyzer::AnalyzeNodeCount(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return FBPNodeMetrics();
+	}
+
+	return AnalyzeNodeCountInSnapshot(FBPGraphSnapshot::Capture(Blueprint), MakeScoringContext());
+}
+
+FBPNodeMetrics UBPComplexityAnalyzer::AnalyzeNodeCountInSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context)
+{
+	FBPNodeMetrics Metrics;
+
+	// カテゴリIDごとのカウント
+	TArray<int32> CategoryCounts;
+	CategoryCounts.Init(0, Snapshot.CategoryNames.Num());
+
+	// 全グラフを分析
+	for (int32 GraphIndex = 0; GraphIndex < Snapshot.NumGraphs(); ++GraphIndex)
+	{
+		AnalyzeGraph(Snapshot, GraphIndex, CategoryCounts, Metrics);
 
 		// 最大グラフを更新
-		if (GraphNodeCount > LargestGraphNodes)
+		const int32 GraphNodeCount = Snapshot.GetGraphNodeCount(GraphIndex);
+		if (GraphNodeCount > Metrics.LargestGraphNodeCount)
 		{
-			LargestGraphNodes = GraphNodeCount;
 			Metrics.LargestGraphNodeCount = GraphNodeCount;
-			Metrics.LargestGraphName = Graph->GetName();
+			Metrics.LargestGraphName = Snapshot.GraphNames[GraphIndex];
 		}
 	}
 
-	// カテゴリ別内訳を構築
-	for (const auto& Pair : CategoryCounts)
+	// カテゴリ別内訳を構築（初出順）
+	for (int32 CategoryId = 0; CategoryId < CategoryCounts.Num(); ++CategoryId)
 	{
+		if (CategoryCounts[CategoryId] == 0)
+		{
+			continue;
+		}
+
 		FBPNodeCategoryCount CatCount;
-		CatCount.CategoryName = Pair.Key;
-		CatCount.Count = Pair.Value;
+		CatCount.CategoryName = Snapshot.CategoryNames[CategoryId];
+		CatCount.Count = CategoryCounts[CategoryId];
 		CatCount.Percentage = (Metrics.TotalNodeCount > 0) ?
-			(float)Pair.Value / Metrics.TotalNodeCount * 100.0f : 0.0f;
+			(float)CatCount.Count / Metrics.TotalNodeCount * 100.0f : 0.0f;
 		Metrics.CategoryBreakdown.Add(CatCount);
 	}
 
 	// スコア計算（ノード数ベース）
-	float BaseScore = FMath::Clamp((float)Metrics.TotalNodeCount / (float)Thresholds.NodeCountRed * 100.0f, 0.0f, 100.0f);
-	float GraphScore = FMath::Clamp((float)Metrics.LargestGraphNodeCount / (float)Thresholds.SingleGraphNodeCountRed * 50.0f, 0.0f, 50.0f);
+	float BaseScore = FMath::Clamp((float)Metrics.TotalNodeCount / (float)Context.Thresholds.NodeCountRed * 100.0f, 0.0f, 100.0f);
+	float GraphScore = FMath::Clamp((float)Metrics.LargestGraphNodeCount / (float)Context.Thresholds.SingleGraphNodeCountRed * 50.0f, 0.0f, 50.0f);
 	Metrics.ComplexityScore = FMath::Min(100.0f, BaseScore * 0.6f + GraphScore * 0.4f);
 
 	// 健全性レベル判定
-	if (Metrics.TotalNodeCount >= Thresholds.NodeCountRed ||
-		Metrics.LargestGraphNodeCount >= Thresholds.SingleGraphNodeCountRed)
+	if (Metrics.TotalNodeCount >= Context.Thresholds.NodeCountRed ||
+		Metrics.LargestGraphNodeCount >= Context.Thresholds.SingleGraphNodeCountRed)
 	{
 		Metrics.HealthLevel = EBPHealthLevel::Red;
 	}
-	else if (Metrics.TotalNodeCount >= Thresholds.NodeCountYellow ||
-		Metrics.LargestGraphNodeCount >= Thresholds.SingleGraphNodeCountYellow)
+	else if (Metrics.TotalNodeCount >= Context.Thresholds.NodeCountYellow ||
+		Metrics.LargestGraphNodeCount >= Context.Thresholds.SingleGraphNodeCountYellow)
 	{
 		Metrics.HealthLevel = EBPHealthLevel::Yellow;
 	}
@@ -287,11 +790,61 @@ FBPNodeMetrics UBPComplexityAnalyzer::AnalyzeNodeCount(UBlueprint* Blueprint)
 	return Metrics;
 }
 
+void UBPComplexityAnalyzer::AnalyzeGraph(const FBPGraphSnapshot& Snapshot, int32 GraphIndex, TArray<int32>& InOutCategoryCounts, FBPNodeMetrics& OutMetrics)
+{
+	const int32 FirstNode = Snapshot.GetGraphFirstNode(GraphIndex);
+	const int32 EndNode = FirstNode + Snapshot.GetGraphNodeCount(GraphIndex);
+
+	for (int32 NodeId = FirstNode; NodeId < EndNode; ++NodeId)
+	{
+		OutMetrics.TotalNodeCount++;
+
+		// ノードタイプ別カウント
+		switch (Snapshot.GetNodeKindById(NodeId))
+		{
+		case EBPSnapshotNodeKind::FunctionCall:
+			OutMetrics.FunctionCallCount++;
+			break;
+		case EBPSnapshotNodeKind::VariableAccess:
+			OutMetrics.VariableAccessCount++;
+			break;
+		case EBPSnapshotNodeKind::ControlFlow:
+			OutMetrics.ControlFlowCount++;
+			break;
+		case EBPSnapshotNodeKind::Event:
+			OutMetrics.EventNodeCount++;
+			break;
+		case EBPSnapshotNodeKind::Macro:
+			OutMetrics.MacroCount++;
+			break;
+		case EBPSnapshotNodeKind::CustomEvent:
+			OutMetrics.CustomEventCount++;
+			break;
+		default:
+			break;
+		}
+
+		// カテゴリ別カウント
+		InOutCategoryCounts[Snapshot.NodeCategoryIds[NodeId]]++;
+	}
+}
+
 FBPDependencyMetrics UBPComplexityAnalyzer::AnalyzeDependencies(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return FBPDependencyMetrics();
+	}
+
+	// 依存クエリはパッケージ名で行う
+	return AnalyzeDependenciesForPackage(Blueprint->GetOutermost()->GetFName(), MakeScoringContext());
+}
+
+FBPDependencyMetrics UBPComplexityAnalyzer::AnalyzeDependenciesForPackage(FName PackageName, const FBPScoringContext& Context)
 {
 	FBPDependencyMetrics Metrics;
 
-	if (!Blueprint)
+	if (PackageName.IsNone())
 	{
 		return Metrics;
 	}
@@ -300,32 +853,32 @@ FBPDependencyMetrics UBPComplexityAnalyzer::AnalyzeDependencies(UBlueprint* Blue
 	int32 MaxDepth = 0;
 
 	// 依存関係を再帰的に収集
-	CollectDependenciesRecursive(Blueprint, VisitedAssets, Metrics.Dependencies, 0, MaxDepth);
+	CollectDependenciesRecursive(PackageName, VisitedAssets, Metrics.Dependencies, 0, MaxDepth);
 
 	Metrics.DirectDependencyCount = Metrics.Dependencies.Num();
 	Metrics.TransitiveDependencyCount = VisitedAssets.Num();
 	Metrics.MaxDependencyDepth = MaxDepth;
 
 	// 循環参照を検出
-	DetectCircularReferences(Blueprint, Metrics.CircularReferencePaths);
+	DetectCircularReferences(PackageName, Context, Metrics);
 	Metrics.CircularReferenceCount = Metrics.CircularReferencePaths.Num();
 
 	// スコア計算
-	float DepCountScore = FMath::Clamp((float)Metrics.DirectDependencyCount / (float)Thresholds.DirectDependencyRed * 50.0f, 0.0f, 50.0f);
-	float DepthScore = FMath::Clamp((float)Metrics.MaxDependencyDepth / (float)Thresholds.DependencyDepthRed * 30.0f, 0.0f, 30.0f);
+	float DepCountScore = FMath::Clamp((float)Metrics.DirectDependencyCount / (float)Context.Thresholds.DirectDependencyRed * 50.0f, 0.0f, 50.0f);
+	float DepthScore = FMath::Clamp((float)Metrics.MaxDependencyDepth / (float)Context.Thresholds.DependencyDepthRed * 30.0f, 0.0f, 30.0f);
 	float CircularScore = Metrics.CircularReferenceCount > 0 ? 50.0f : 0.0f;
 
 	Metrics.ComplexityScore = FMath::Min(100.0f, DepCountScore + DepthScore + CircularScore);
 
 	// 健全性レベル判定
 	if (Metrics.CircularReferenceCount > 0 ||
-		Metrics.DirectDependencyCount >= Thresholds.DirectDependencyRed ||
-		Metrics.MaxDependencyDepth >= Thresholds.DependencyDepthRed)
+		Metrics.DirectDependencyCount >= Context.Thresholds.DirectDependencyRed ||
+		Metrics.MaxDependencyDepth >= Context.Thresholds.DependencyDepthRed)
 	{
 		Metrics.HealthLevel = EBPHealthLevel::Red;
 	}
-	else if (Metrics.DirectDependencyCount >= Thresholds.DirectDependencyYellow ||
-		Metrics.MaxDependencyDepth >= Thresholds.DependencyDepthYellow)
+	else if (Metrics.DirectDependencyCount >= Context.Thresholds.DirectDependencyYellow ||
+		Metrics.MaxDependencyDepth >= Context.Thresholds.DependencyDepthYellow)
 	{
 		Metrics.HealthLevel = EBPHealthLevel::Yellow;
 	}
@@ -339,43 +892,46 @@ FBPDependencyMetrics UBPComplexityAnalyzer::AnalyzeDependencies(UBlueprint* Blue
 
 FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsage(UBlueprint* Blueprint)
 {
-	FBPTickMetrics Metrics;
-
 	if (!Blueprint)
 	{
-		return Metrics;
+		return FBPTickMetrics();
 	}
 
-	TArray<UEdGraph*> AllGraphs;
-	Blueprint->GetAllGraphs(AllGraphs);
+	return AnalyzeTickUsageInSnapshot(FBPGraphSnapshot::Capture(Blueprint), MakeScoringContext());
+}
+
+FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsageInSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context)
+{
+	FBPTickMetrics Metrics;
+
+	// 探索用の訪問フラグは全Tickイベントで使い回す
+	TBitArray<> VisitedNodes;
 
-	for (UEdGraph* Graph : AllGraphs)
+	for (int32 GraphIndex = 0; GraphIndex < Snapshot.NumGraphs(); ++GraphIndex)
 	{
-		if (!Graph)
-		{
-			continue;
-		}
+		const int32 FirstNode = Snapshot.GetGraphFirstNode(GraphIndex);
+		const int32 EndNode = FirstNode + Snapshot.GetGraphNodeCount(GraphIndex);
 
-		for (UEdGraphNode* Node : Graph->Nodes)
+		for (int32 NodeId = FirstNode; NodeId < EndNode; ++NodeId)
 		{
-			UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-			if (!EventNode)
+			if (Snapshot.GetNodeKindById(NodeId) != EBPSnapshotNodeKind::Event)
 			{
 				continue;
 			}
 
 			// EventTick を検出
-			FName EventName = EventNode->GetFunctionName();
-			if (EventName == TEXT("ReceiveTick") || EventName.ToString().Contains(TEXT("Tick")))
+			const FString& EventName = Snapshot.GetNodeFunctionName(NodeId);
+			if (EventName.Contains(TEXT("Tick")))
 			{
 				Metrics.bUsesTick = true;
 				Metrics.TickEventCount++;
 
 				FBPTickInfo TickInfo;
-				TickInfo.GraphName = Graph->GetName();
+				TickInfo.GraphName = Snapshot.GraphNames[GraphIndex];
 
 				// Tickからの実行パスを追跡
-				TraceTickExecutionPath(EventNode, TickInfo);
+				VisitedNodes.Init(false, Snapshot.NumNodes());
+				TraceTickExecutionPath(Snapshot, NodeId, VisitedNodes, TickInfo);
 
 				Metrics.TotalNodesInTick += TickInfo.NodeCountInTick;
 				Metrics.TickDetails.Add(TickInfo);
@@ -386,12 +942,12 @@ FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsage(UBlueprint* Blueprint)
 	// 最適化推奨を生成
 	if (Metrics.bUsesTick)
 	{
-		if (Metrics.TotalNodesInTick > Thresholds.TickNodeCountRed)
+		if (Metrics.TotalNodesInTick > Context.Thresholds.TickNodeCountRed)
 		{
 			Metrics.OptimizationSuggestions.Add(TEXT("Tick内の処理量が多すぎます。タイマーまたはイベント駆動への変更を検討してください。"));
 		}
 
-		if (Metrics.TotalNodesInTick > Thresholds.TickNodeCountYellow)
+		if (Metrics.TotalNodesInTick > Context.Thresholds.TickNodeCountYellow)
 		{
 			Metrics.OptimizationSuggestions.Add(TEXT("Tick内でのLoop処理は避け、配列処理は分散させてください。"));
 		}
@@ -399,6 +955,37 @@ FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsage(UBlueprint* Blueprint)
 		Metrics.OptimizationSuggestions.Add(TEXT("Tickの使用を最小限にし、必要な場合はC++での実装を検討してください。"));
 	}
 
+	// 実測プロファイルがある場合はノード数ではなく実測時間で評価
+	const FBPRuntimeProfile* Profile = Context.FindRuntimeProfile(Snapshot.BlueprintPath);
+	if (Profile && (Metrics.bUsesTick || Profile->TickCallCount > 0))
+	{
+		Metrics.bUsesTick = true;
+		Metrics.bHasRuntimeData = true;
+		Metrics.MeasuredTickTimeMs = Profile->TickTimeMs / Profile->CapturedFrames;
+		Metrics.MeasuredTickCallsPerFrame = (float)Profile->TickCallCount / Profile->CapturedFrames;
+
+		const float TickTimeScore = FMath::Clamp(Metrics.MeasuredTickTimeMs / Context.Thresholds.TickTimeRedMs * 80.0f, 0.0f, 80.0f);
+		const float TickCallScore = FMath::Clamp(Metrics.MeasuredTickCallsPerFrame, 0.0f, 20.0f);
+		Metrics.ComplexityScore = FMath::Min(100.0f, TickTimeScore + TickCallScore);
+
+		if (Metrics.MeasuredTickTimeMs >= Context.Thresholds.TickTimeRedMs)
+		{
+			Metrics.HealthLevel = EBPHealthLevel::Red;
+			Metrics.OptimizationSuggestions.Insert(FString::Printf(TEXT("PIEでのTick実測時間が %.3f ms/frame です。C++化またはTick間隔の延長を検討してください。"),
+				Metrics.MeasuredTickTimeMs), 0);
+		}
+		else if (Metrics.MeasuredTickTimeMs >= Context.Thresholds.TickTimeYellowMs)
+		{
+			Metrics.HealthLevel = EBPHealthLevel::Yellow;
+		}
+		else
+		{
+			Metrics.HealthLevel = EBPHealthLevel::Green;
+		}
+
+		return Metrics;
+	}
+
 	// スコア計算
 	if (!Metrics.bUsesTick)
 	{
@@ -407,16 +994,16 @@ FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsage(UBlueprint* Blueprint)
 	}
 	else
 	{
-		float TickNodeScore = FMath::Clamp((float)Metrics.TotalNodesInTick / (float)Thresholds.TickNodeCountRed * 80.0f, 0.0f, 80.0f);
+		float TickNodeScore = FMath::Clamp((float)Metrics.TotalNodesInTick / (float)Context.Thresholds.TickNodeCountRed * 80.0f, 0.0f, 80.0f);
 		float TickCountScore = FMath::Clamp((float)Metrics.TickEventCount * 10.0f, 0.0f, 20.0f);
 
 		Metrics.ComplexityScore = FMath::Min(100.0f, TickNodeScore + TickCountScore);
 
-		if (Metrics.TotalNodesInTick >= Thresholds.TickNodeCountRed)
+		if (Metrics.TotalNodesInTick >= Context.Thresholds.TickNodeCountRed)
 		{
 			Metrics.HealthLevel = EBPHealthLevel::Red;
 		}
-		else if (Metrics.TotalNodesInTick >= Thresholds.TickNodeCountYellow)
+		else if (Metrics.TotalNodesInTick >= Context.Thresholds.TickNodeCountYellow)
 		{
 			Metrics.HealthLevel = EBPHealthLevel::Yellow;
 		}
@@ -431,40 +1018,65 @@ FBPTickMetrics UBPComplexityAnalyzer::AnalyzeTickUsage(UBlueprint* Blueprint)
 
 FBPCppMigrationMetrics UBPComplexityAnalyzer::CalculateCppMigrationScore(UBlueprint* Blueprint, const FBPAnalysisReport& Report)
 {
-	FBPCppMigrationMetrics Metrics;
-
 	if (!Blueprint)
 	{
-		return Metrics;
+		return FBPCppMigrationMetrics();
 	}
 
+	return CalculateCppMigrationScoreFromReport(Report, MakeScoringContext());
+}
+
+FBPCppMigrationMetrics UBPComplexityAnalyzer::CalculateCppMigrationScoreFromReport(const FBPAnalysisReport& Report, const FBPScoringContext& Context)
+{
+	FBPCppMigrationMetrics Metrics;
+
 	float Score = 0.0f;
 	int32 Difficulty = 1;
 
 	// ノード数が多い場合
-	if (Report.NodeMetrics.TotalNodeCount >= Thresholds.NodeCountRed)
+	if (Report.NodeMetrics.TotalNodeCount >= Context.Thresholds.NodeCountRed)
 	{
 		Score += 30.0f;
 		Metrics.Reasons.Add(FString::Printf(TEXT("ノード数が多い (%d nodes)"), Report.NodeMetrics.TotalNodeCount));
 		Metrics.ExpectedImprovements.Add(TEXT("パフォーマンス向上"));
 		Difficulty = FMath::Max(Difficulty, 3);
 	}
-	else if (Report.NodeMetrics.TotalNodeCount >= Thresholds.NodeCountYellow)
+	else if (Report.NodeMetrics.TotalNodeCount >= Context.Thresholds.NodeCountYellow)
 	{
 		Score += 15.0f;
 		Metrics.Reasons.Add(FString::Printf(TEXT("ノード数がやや多い (%d nodes)"), Report.NodeMetrics.TotalNodeCount));
 		Difficulty = FMath::Max(Difficulty, 2);
 	}
 
+	// 実測プロファイルがある場合はTickの静的評価の代わりに実測時間で加点
+	if (const FBPRuntimeProfile* Profile = Context.FindRuntimeProfile(Report.BlueprintPath))
+	{
+		Metrics.bHasRuntimeData = true;
+		Metrics.MeasuredScriptTimeMs = Profile->ExclusiveTimeMs / Profile->CapturedFrames;
+
+		for (int32 FunctionIndex = 0; FunctionIndex < FMath::Min(Profile->Functions.Num(), MaxHotFunctions); ++FunctionIndex)
+		{
+			const FBPRuntimeFunctionProfile& Function = Profile->Functions[FunctionIndex];
+			Metrics.HotFunctions.Add(FString::Printf(TEXT("%s (%.3f ms/frame)"), *Function.FunctionName, Function.ExclusiveTimeMs / Profile->CapturedFrames));
+		}
+
+		if (Metrics.MeasuredScriptTimeMs >= Context.Thresholds.TickTimeYellowMs)
+		{
+			Score += FMath::Clamp(Metrics.MeasuredScriptTimeMs / Context.Thresholds.TickTimeRedMs * 40.0f, 0.0f, 40.0f);
+			Metrics.Reasons.Add(FString::Printf(TEXT("Blueprint関数の実測時間が長い (%.3f ms/frame)"), Metrics.MeasuredScriptTimeMs));
+			Metrics.ExpectedImprovements.Add(TEXT("スクリプト実行時間の削減"));
+			Difficulty = FMath::Max(Difficulty, Metrics.MeasuredScriptTimeMs >= Context.Thresholds.TickTimeRedMs ? 4 : 2);
+		}
+	}
 	// Tick使用の場合
-	if (Report.TickMetrics.bUsesTick)
+	else if (Report.TickMetrics.bUsesTick)
 	{
 		Score += 25.0f;
 		Metrics.Reasons.Add(TEXT("Tickを使用している"));
 		Metrics.ExpectedImprovements.Add(TEXT("Tick処理の最適化"));
 		Difficulty = FMath::Max(Difficulty, 2);
 
-		if (Report.TickMetrics.TotalNodesInTick >= Thresholds.TickNodeCountRed)
+		if (Report.TickMetrics.TotalNodesInTick >= Context.Thresholds.TickNodeCountRed)
 		{
 			Score += 15.0f;
 			Metrics.Reasons.Add(TEXT("Tick内の処理が重い"));
@@ -482,7 +1094,7 @@ FBPCppMigrationMetrics UBPComplexityAnalyzer::CalculateCppMigrationScore(UBluepr
 	}
 
 	// 依存が深い場合
-	if (Report.DependencyMetrics.MaxDependencyDepth >= Thresholds.DependencyDepthRed)
+	if (Report.DependencyMetrics.MaxDependencyDepth >= Context.Thresholds.DependencyDepthRed)
 	{
 		Score += 10.0f;
 		Metrics.Reasons.Add(TEXT("依存関係が深い"));
@@ -557,73 +1169,48 @@ FString UBPComplexityAnalyzer::GetNodeCategory(UEdGraphNode* Node)
 		return TEXT("Unknown");
 	}
 
-	if (Cast<UK2Node_CallFunction>(Node))
-	{
-		return TEXT("Function Call");
-	}
-	else if (Cast<UK2Node_VariableGet>(Node) || Cast<UK2Node_VariableSet>(Node))
-	{
-		return TEXT("Variable Access");
-	}
-	else if (Cast<UK2Node_IfThenElse>(Node))
-	{
-		return TEXT("Control Flow");
-	}
-	else if (Cast<UK2Node_Event>(Node))
-	{
-		return TEXT("Event");
-	}
-	else if (Cast<UK2Node_MacroInstance>(Node))
-	{
-		return TEXT("Macro");
-	}
-	else if (Cast<UK2Node_CustomEvent>(Node))
-	{
-		return TEXT("Custom Event");
-	}
-	else if (Cast<UK2Node_Tunnel>(Node))
-	{
-		return TEXT("Tunnel");
-	}
-
-	return TEXT("Other");
+	return FBPGraphSnapshot::GetKindCategoryName(FBPGraphSnapshot::GetNodeKind(Node));
 }
 
-void UBPComplexityAnalyzer::TraceTickExecutionPath(UEdGraphNode* TickNode, FBPTickInfo& OutInfo)
+void UBPComplexityAnalyzer::TraceTickExecutionPath(const FBPGraphSnapshot& Snapshot, int32 TickNodeId, TBitArray<>& VisitedNodes, FBPTickInfo& OutInfo)
 {
-	if (!TickNode)
+	if (TickNodeId < 0 || TickNodeId >= Snapshot.NumNodes())
 	{
 		return;
 	}
 
-	TSet<UEdGraphNode*> VisitedNodes;
-	TQueue<UEdGraphNode*> NodesToVisit;
-	NodesToVisit.Enqueue(TickNode);
+	TArray<int32> NodesToVisit;
+	NodesToVisit.Add(TickNodeId);
+	VisitedNodes[TickNodeId] = true;
 
-	while (!NodesToVisit.IsEmpty())
+	// 幅優先で辿る（キューは配列 + 先頭インデックス、追加時に訪問済みにする）
+	auto EnqueueTargets = [&](TConstArrayView<int32> Targets)
 	{
-		UEdGraphNode* CurrentNode;
-		NodesToVisit.Dequeue(CurrentNode);
-
-		if (!CurrentNode || VisitedNodes.Contains(CurrentNode))
+		for (int32 TargetId : Targets)
 		{
-			continue;
+			if (!VisitedNodes[TargetId])
+			{
+				VisitedNodes[TargetId] = true;
+				NodesToVisit.Add(TargetId);
+			}
 		}
+	};
 
-		VisitedNodes.Add(CurrentNode);
+	for (int32 QueueHead = 0; QueueHead < NodesToVisit.Num(); ++QueueHead)
+	{
+		const int32 CurrentId = NodesToVisit[QueueHead];
 		OutInfo.NodeCountInTick++;
 
 		// 関数呼び出しを記録
-		if (UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(CurrentNode))
+		if (Snapshot.GetNodeKindById(CurrentId) == EBPSnapshotNodeKind::FunctionCall)
 		{
-			FName FuncName = FuncNode->GetFunctionName();
-			if (FuncName != NAME_None)
+			const FString& FuncNameStr = Snapshot.GetNodeFunctionName(CurrentId);
+			if (!FuncNameStr.IsEmpty())
 			{
-				OutInfo.FunctionsCalledInTick.AddUnique(FuncName.ToString());
+				OutInfo.FunctionsCalledInTick.AddUnique(FuncNameStr);
 			}
 
 			// 重い処理を警告
-			FString FuncNameStr = FuncName.ToString();
 			if (FuncNameStr.Contains(TEXT("GetAllActors")) ||
 				FuncNameStr.Contains(TEXT("LineTrace")) ||
 				FuncNameStr.Contains(TEXT("Overlap")))
@@ -632,32 +1219,21 @@ void UBPComplexityAnalyzer::TraceTickExecutionPath(UEdGraphNode* TickNode, FBPTi
 			}
 		}
 
-		// 出力ピンから次のノードを辿る
-		for (UEdGraphPin* Pin : CurrentNode->Pins)
-		{
-			if (Pin && Pin->Direction == EGPD_Output)
-			{
-				for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-				{
-					if (LinkedPin && LinkedPin->GetOwningNode())
-					{
-						NodesToVisit.Enqueue(LinkedPin->GetOwningNode());
-					}
-				}
-			}
-		}
+		// 出力ピンから次のノードを辿る（従来どおりexec/dataの両方）
+		EnqueueTargets(Snapshot.GetExecTargets(CurrentId));
+		EnqueueTargets(Snapshot.GetDataTargets(CurrentId));
 	}
 }
 
-void UBPComplexityAnalyzer::CollectDependenciesRecursive(UBlueprint* Blueprint, TSet<FString>& VisitedAssets,
+void UBPComplexityAnalyzer::CollectDependenciesRecursive(FName PackageName, TSet<FString>& VisitedAssets,
 	TArray<FBPDependencyInfo>& OutDependencies, int32 CurrentDepth, int32& MaxDepth)
 {
-	if (!Blueprint)
+	if (PackageName.IsNone())
 	{
 		return;
 	}
 
-	FString CurrentPath = Blueprint->GetPathName();
+	FString CurrentPath = PackageName.ToString();
 	if (VisitedAssets.Contains(CurrentPath))
 	{
 		return;
@@ -666,63 +1242,61 @@ void UBPComplexityAnalyzer::CollectDependenciesRecursive(UBlueprint* Blueprint,
 	VisitedAssets.Add(CurrentPath);
 	MaxDepth = FMath::Max(MaxDepth, CurrentDepth);
 
-	// 直接依存を収集
-	TArray<FAssetIdentifier> Dependencies;
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	AssetRegistry.GetDependencies(FAssetIdentifier(FName(*CurrentPath)), Dependencies);
+	// 直接依存を収集（Blueprintアセットのみをカウント）
+	// ワーカースレッドからも呼ばれる（共有グラフは内部でロックする）
+	TArray<FName> Dependencies;
+	FAssetRegistryGraph::Get().GetDependencies(PackageName, Dependencies, EAssetGraphFilter::GameOnly);
 
-	for (const FAssetIdentifier& DepId : Dependencies)
+	for (const FName& Dependency : Dependencies)
 	{
-		FString DepPath = DepId.PackageName.ToString();
-
-		// Blueprintアセットのみをカウント
-		if (!DepPath.StartsWith(TEXT("/Game")))
-		{
-			continue;
-		}
-
 		FBPDependencyInfo DepInfo;
-		DepInfo.AssetPath = DepPath;
+		DepInfo.AssetPath = Dependency.ToString();
 		DepInfo.ReferenceCount = 1;
 
 		OutDependencies.Add(DepInfo);
 	}
 }
 
-void UBPComplexityAnalyzer::DetectCircularReferences(UBlueprint* Blueprint, TArray<FString>& OutCircularPaths)
+TArray<FBPCycleGroup> UBPComplexityAnalyzer::AnalyzeProjectCycles(const FString& PathFilter)
 {
-	if (!Blueprint)
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	const FString CycleRootPath = PathFilter.IsEmpty() ? TEXT("/Game") : PathFilter;
+	TSharedPtr<FAssetGraphCycles> NewCycleAnalysis = MakeShared<FAssetGraphCycles>(FAssetRegistryGraph::Get().ComputeCycles(CycleRootPath));
+	CycleAnalysis = NewCycleAnalysis;
+
+	return CycleAnalysis->MakeCycleGroups<FBPCycleGroup>();
+}
+
+void UBPComplexityAnalyzer::DetectCircularReferences(FName PackageName, const FBPScoringContext& Context, FBPDependencyMetrics& InOutMetrics)
+{
+	if (PackageName.IsNone())
 	{
 		return;
 	}
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	FString CurrentPath = Blueprint->GetPathName();
-	TArray<FAssetIdentifier> Dependencies;
-	AssetRegistry.GetDependencies(FAssetIdentifier(FName(*CurrentPath)), Dependencies);
+	// プロジェクト単位の分析済みならO(1)で参照、未構築なら自身から到達可能な範囲のみで計算
+	TSharedPtr<const FAssetGraphCycles> Analysis = Context.CycleAnalysis;
+	if (!Analysis.IsValid() || !Analysis->ContainsPackage(PackageName))
+	{
+		Analysis = MakeShared<const FAssetGraphCycles>(FAssetRegistryGraph::Get().ComputeCycles(TArray<FName>{ PackageName }));
+	}
 
-	// 各依存先が自分を参照しているかチェック
-	for (const FAssetIdentifier& DepId : Dependencies)
+	const int32 GroupIndex = Analysis->GetCycleGroupIndex(PackageName);
+	if (GroupIndex == INDEX_NONE)
 	{
-		TArray<FAssetIdentifier> ReverseDeps;
-		AssetRegistry.GetDependencies(DepId, ReverseDeps);
+		return;
+	}
 
-		for (const FAssetIdentifier& RevDep : ReverseDeps)
-		{
-			if (RevDep.PackageName.ToString() == CurrentPath)
-			{
-				OutCircularPaths.Add(FString::Printf(TEXT("%s <-> %s"),
-					*CurrentPath, *DepId.PackageName.ToString()));
-			}
-		}
+	Analysis->GetCircularPaths(PackageName, InOutMetrics.CircularReferencePaths);
+
+	for (FBPDependencyInfo& DepInfo : InOutMetrics.Dependencies)
+	{
+		DepInfo.bIsCircular = Analysis->GetCycleGroupIndex(FName(*DepInfo.AssetPath)) == GroupIndex;
 	}
 }
 
-EBPHealthLevel UBPComplexityAnalyzer::CalculateHealthLevel(float Score) const
+EBPHealthLevel UBPComplexityAnalyzer::CalculateHealthLevel(float Score)
 {
 	if (Score >= 70.0f)
 	{
@@ -735,22 +1309,22 @@ EBPHealthLevel UBPComplexityAnalyzer::CalculateHealthLevel(float Score) const
 	return EBPHealthLevel::Green;
 }
 
-void UBPComplexityAnalyzer::DetectIssues(const FBPAnalysisReport& Report, TArray<FBPIssue>& OutIssues)
+void UBPComplexityAnalyzer::DetectIssues(const FBPAnalysisReport& Report, const FBPScoringContext& Context, TArray<FBPIssue>& OutIssues)
 {
 	// ノード数の問題
-	if (Report.NodeMetrics.TotalNodeCount >= Thresholds.NodeCountRed)
+	if (Report.NodeMetrics.TotalNodeCount >= Context.Thresholds.NodeCountRed)
 	{
 		FBPIssue Issue;
 		Issue.Category = TEXT("ノード数");
 		Issue.Description = FString::Printf(TEXT("総ノード数が%dを超えています (%d)"),
-			Thresholds.NodeCountRed, Report.NodeMetrics.TotalNodeCount);
+			Context.Thresholds.NodeCountRed, Report.NodeMetrics.TotalNodeCount);
 		Issue.Severity = EBPHealthLevel::Red;
 		Issue.SuggestedFix = TEXT("機能を複数のBPに分割するか、C++への移行を検討してください。");
 		OutIssues.Add(Issue);
 	}
 
 	// 単一グラフの問題
-	if (Report.NodeMetrics.LargestGraphNodeCount >= Thresholds.SingleGraphNodeCountRed)
+	if (Report.NodeMetrics.LargestGraphNodeCount >= Context.Thresholds.SingleGraphNodeCountRed)
 	{
 		FBPIssue Issue;
 		Issue.Category = TEXT("グラフサイズ");
@@ -774,8 +1348,21 @@ void UBPComplexityAnalyzer::DetectIssues(const FBPAnalysisReport& Report, TArray
 		OutIssues.Add(Issue);
 	}
 
-	// Tick使用
-	if (Report.TickMetrics.bUsesTick && Report.TickMetrics.TotalNodesInTick >= Thresholds.TickNodeCountRed)
+	// Tick使用（実測データがある場合は実測時間で判定）
+	if (Report.TickMetrics.bHasRuntimeData)
+	{
+		if (Report.TickMetrics.MeasuredTickTimeMs >= Context.Thresholds.TickTimeRedMs)
+		{
+			FBPIssue Issue;
+			Issue.Category = TEXT("Tick使用");
+			Issue.Description = FString::Printf(TEXT("Tickの実測時間が長すぎます (%.3f ms/frame, %.1f calls/frame)"),
+				Report.TickMetrics.MeasuredTickTimeMs, Report.TickMetrics.MeasuredTickCallsPerFrame);
+			Issue.Severity = EBPHealthLevel::Red;
+			Issue.SuggestedFix = TEXT("タイマーまたはイベント駆動に変更するか、C++で実装してください。");
+			OutIssues.Add(Issue);
+		}
+	}
+	else if (Report.TickMetrics.bUsesTick && Report.TickMetrics.TotalNodesInTick >= Context.Thresholds.TickNodeCountRed)
 	{
 		FBPIssue Issue;
 		Issue.Category = TEXT("Tick使用");
@@ -787,7 +1374,7 @@ void UBPComplexityAnalyzer::DetectIssues(const FBPAnalysisReport& Report, TArray
 	}
 
 	// 依存深度
-	if (Report.DependencyMetrics.MaxDependencyDepth >= Thresholds.DependencyDepthRed)
+	if (Report.DependencyMetrics.MaxDependencyDepth >= Context.Thresholds.DependencyDepthRed)
 	{
 		FBPIssue Issue;
 		Issue.Category = TEXT("依存深度");
@@ -811,7 +1398,9 @@ FString UBPComplexityAnalyzer::GenerateHumanReadableSummary(const FBPAnalysisRep
 
 	if (Report.TickMetrics.bUsesTick)
 	{
-		Parts.Add(FString::Printf(TEXT("Tick使用 (%d nodes)"), Report.TickMetrics.TotalNodesInTick));
+		Parts.Add(Report.TickMetrics.bHasRuntimeData ?
+			FString::Printf(TEXT("Tick使用 (%.3f ms/frame)"), Report.TickMetrics.MeasuredTickTimeMs) :
+			FString::Printf(TEXT("Tick使用 (%d nodes)"), Report.TickMetrics.TotalNodesInTick));
 	}
 
 	if (Report.DependencyMetrics.CircularReferenceCount > 0)
@@ -827,7 +1416,7 @@ FString UBPComplexityAnalyzer::GenerateHumanReadableSummary(const FBPAnalysisRep
 	return FString::Join(Parts, TEXT(" | "));
 }
 
-TArray<FString> UBPComplexityAnalyzer::GenerateRecommendedActions(const FBPAnalysisReport& Report)
+TArray<FString> UBPComplexityAnalyzer::GenerateRecommendedActions(const FBPAnalysisReport& Report, const FBPScoringContext& Context)
 {
 	TArray<FString> Actions;
 
@@ -836,7 +1425,7 @@ TArray<FString> UBPComplexityAnalyzer::GenerateRecommendedActions(const FBPAnaly
 		Actions.Add(TEXT("【緊急】このBlueprintは即座にリファクタリングが必要です。"));
 	}
 
-	if (Report.NodeMetrics.TotalNodeCount >= Thresholds.NodeCountYellow)
+	if (Report.NodeMetrics.TotalNodeCount >= Context.Thresholds.NodeCountYellow)
 	{
 		Actions.Add(TEXT("機能を複数のBlueprintまたは関数に分割してください。"));
 	}
@@ -851,7 +1440,7 @@ TArray<FString> UBPComplexityAnalyzer::GenerateRecommendedActions(const FBPAnaly
 		Actions.Add(TEXT("循環参照を解消するためにインターフェースを使用してください。"));
 	}
 
-	if (Report.CppMigrationMetrics.MigrationScore >= Thresholds.CppMigrationScoreThreshold)
+	if (Report.CppMigrationMetrics.MigrationScore >= Context.Thresholds.CppMigrationScoreThreshold)
 	{
 		Actions.Add(TEXT("パフォーマンス向上のためC++への移行を検討してください。"));
 	}
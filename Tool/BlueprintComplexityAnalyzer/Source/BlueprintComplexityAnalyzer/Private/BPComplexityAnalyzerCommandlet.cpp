@@ -0,0 +1,144 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "BPComplexityAnalyzerCommandlet.h"
+#include "BPComplexityAnalyzer.h"
+#include "BPAnalysisShard.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBPComplexityCommandlet, Log, All);
+
+namespace
+{
+	/** この件数を分析するごとにGCしてロード済みBlueprintを解放 */
+	constexpr int32 BlueprintsPerGarbageCollection = 256;
+}
+
+UBPComplexityAnalyzerCommandlet::UBPComplexityAnalyzerCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Analyzes Blueprint complexity headlessly, optionally split into shards that are merged into one summary.");
+	HelpUsage = TEXT("-run=BPComplexityAnalyzer [-Path=/Game] [-ShardIndex=0 -ShardCount=1] [-Output=File] [-UseCache] | -Merge [-ShardDir=Dir] [-Output=Summary.json]");
+}
+
+int32 UBPComplexityAnalyzerCommandlet::Main(const FString& Params)
+{
+	// コマンドレットではレジストリのスキャンが完了していない
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().SearchAllAssets(true);
+
+	return FParse::Param(*Params, TEXT("Merge")) ? RunMerge(Params) : RunShard(Params);
+}
+
+int32 UBPComplexityAnalyzerCommandlet::RunShard(const FString& Params)
+{
+	FString PathFilter;
+	FParse::Value(*Params, TEXT("Path="), PathFilter);
+
+	int32 ShardIndex = 0;
+	int32 ShardCount = 1;
+	if (!FAssetAnalysisShards::ParseShardRange(*Params, ShardIndex, ShardCount))
+	{
+		UE_LOG(LogBPComplexityCommandlet, Error, TEXT("Invalid shard %d of %d"), ShardIndex, ShardCount);
+		return 1;
+	}
+
+	FString OutputPath = FBPAnalysisShard::GetDefaultShardDirectory() / FAssetAnalysisShards::GetShardFileName(ShardIndex, ShardCount);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	UBPComplexityAnalyzer* Analyzer = NewObject<UBPComplexityAnalyzer>();
+	Analyzer->AddToRoot(); // GC防止
+
+	if (FParse::Param(*Params, TEXT("UseCache")))
+	{
+		Analyzer->SetUseAnalysisCache(true);
+	}
+
+	FBPAnalysisShard Shard;
+	Shard.AnalyzedPath = PathFilter;
+	Shard.ShardIndex = ShardIndex;
+	Shard.ShardCount = ShardCount;
+
+	// 循環グループはパス全体で計算し、各シャードのレポートから参照する
+	Shard.CycleGroups = Analyzer->AnalyzeProjectCycles(PathFilter);
+
+	TArray<FAssetData> BlueprintAssets;
+	Analyzer->GetBlueprintAssets(PathFilter, BlueprintAssets);
+
+	FAssetAnalysisShards::FilterAssets(BlueprintAssets, ShardIndex, ShardCount);
+
+	UE_LOG(LogBPComplexityCommandlet, Display, TEXT("Shard %d of %d: analyzing %d Blueprints"), ShardIndex, ShardCount, BlueprintAssets.Num());
+
+	// 一定件数ごとに分析してGCし、ロード済みBlueprintが溜まり続けないようにする
+	Shard.Reports.Reserve(BlueprintAssets.Num());
+	for (int32 BatchStart = 0; BatchStart < BlueprintAssets.Num(); BatchStart += BlueprintsPerGarbageCollection)
+	{
+		const int32 BatchCount = FMath::Min(BlueprintsPerGarbageCollection, BlueprintAssets.Num() - BatchStart);
+		TArray<FAssetData> Batch(BlueprintAssets.GetData() + BatchStart, BatchCount);
+
+		Analyzer->AnalyzeAssets(Batch, Shard.Reports);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogBPComplexityCommandlet, Display, TEXT("  %d / %d"), BatchStart + BatchCount, BlueprintAssets.Num());
+	}
+
+	Analyzer->SaveAnalysisCache();
+	Analyzer->RemoveFromRoot();
+
+	if (!Shard.Save(OutputPath))
+	{
+		UE_LOG(LogBPComplexityCommandlet, Error, TEXT("Failed to write shard: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogBPComplexityCommandlet, Display, TEXT("Wrote %d reports to %s"), Shard.Reports.Num(), *OutputPath);
+	return 0;
+}
+
+int32 UBPComplexityAnalyzerCommandlet::RunMerge(const FString& Params)
+{
+	FString ShardDirectory = FBPAnalysisShard::GetDefaultShardDirectory();
+	FParse::Value(*Params, TEXT("ShardDir="), ShardDirectory);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("BlueprintComplexityAnalyzer") / TEXT("ProjectSummary.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FString> ShardFiles;
+	if (!FAssetAnalysisShards::FindShardFiles(ShardDirectory, ShardFiles))
+	{
+		UE_LOG(LogBPComplexityCommandlet, Error, TEXT("No shard files in %s"), *ShardDirectory);
+		return 1;
+	}
+
+	// 全シャードが同じ分割設定で揃っているかは統合時に確認する
+	TArray<FBPAnalysisReport> AllReports;
+	FBPAnalysisShard Merged;
+	const bool bComplete = FBPAnalysisShard::Merge(ShardFiles, Merged, [&AllReports](TArray<FBPAnalysisReport>& Reports)
+	{
+		AllReports.Append(MoveTemp(Reports));
+	});
+
+	// 集計は閾値（C++化推奨判定）を使うため既定設定のアナライザーで行う
+	UBPComplexityAnalyzer* Analyzer = NewObject<UBPComplexityAnalyzer>();
+	const FBPProjectAnalysisSummary Summary = Analyzer->BuildProjectSummary(MoveTemp(AllReports), Merged.CycleGroups);
+
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Summary, JsonString) ||
+		!FFileHelper::SaveStringToFile(JsonString, *OutputPath))
+	{
+		UE_LOG(LogBPComplexityCommandlet, Error, TEXT("Failed to write summary: %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogBPComplexityCommandlet, Display, TEXT("Merged %d Blueprints (Green %d / Yellow %d / Red %d) into %s"),
+		Summary.TotalBlueprintCount, Summary.GreenCount, Summary.YellowCount, Summary.RedCount, *OutputPath);
+
+	return bComplete ? 0 : 1;
+}
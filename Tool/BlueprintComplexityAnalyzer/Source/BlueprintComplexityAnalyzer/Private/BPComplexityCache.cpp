@@ -0,0 +1,238 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "BPComplexityCache.h"
+#include "BPGraphSnapshot.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Misc/Paths.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	/** キャッシュファイル識別子 */
+	constexpr uint32 ComplexityCacheMagic = 0x43435042; // "BPCC"
+
+	/** ベースラインファイル識別子 */
+	constexpr uint32 ComplexityBaselineMagic = 0x42435042; // "BPCB"
+
+	/** フォーマットバージョン（レポート構造を変更したら更新、スナップショットは自身のバージョンを持つ） */
+	constexpr int32 ComplexityCacheVersion = 3;
+}
+
+FBPComplexityCache::FBPComplexityCache()
+{
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBPComplexityCache::OnPackageSaved);
+
+	// コマンドレット等でエディタエンジンが無い場合はコンパイルが起きない
+	if (GEditor)
+	{
+		BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FBPComplexityCache::OnBlueprintPreCompile);
+	}
+}
+
+FBPComplexityCache::~FBPComplexityCache()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+	}
+}
+
+FString FBPComplexityCache::GetDefaultCachePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("BlueprintComplexityAnalyzer") / TEXT("ComplexityCache.bin");
+}
+
+FString FBPComplexityCache::GetDefaultBaselinePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("BlueprintComplexityAnalyzer") / TEXT("Baseline.bin");
+}
+
+bool FBPComplexityCache::Load(const FString& FilePath)
+{
+	TArray<FName> ChangedPackages;
+	if (!LoadEntries(FilePath, ComplexityCacheMagic, ComplexityCacheVersion, &FBPComplexityCache::SerializeRecord, ChangedPackages))
+	{
+		// 旧フォーマットは破棄して作り直す
+		return false;
+	}
+
+	// 前回保存後に変更・削除されたパッケージを破棄
+	for (const FName& PackageName : ChangedPackages)
+	{
+		Remove(PackageName);
+	}
+
+	return true;
+}
+
+bool FBPComplexityCache::Save(const FString& FilePath) const
+{
+	return SaveEntries(FilePath, ComplexityCacheMagic, ComplexityCacheVersion, &FBPComplexityCache::SerializeRecord);
+}
+
+TSharedPtr<const FBPGraphSnapshot> FBPComplexityCache::FindSnapshot(FName PackageName) const
+{
+	const FBPComplexityCacheRecord* Cached = FindValid(PackageName);
+	if (!Cached || IsPackageDirty(PackageName))
+	{
+		return nullptr;
+	}
+
+	return Cached->Snapshot;
+}
+
+void FBPComplexityCache::StoreSnapshot(FName PackageName, const TSharedRef<const FBPGraphSnapshot>& Snapshot)
+{
+	if (PackageName.IsNone())
+	{
+		return;
+	}
+
+	// 未保存の内容はディスク上のハッシュと対応しない
+	FAssetPackageState CurrentState;
+	if (IsPackageDirty(PackageName) || !FAssetPackageState::GetCurrent(PackageName, CurrentState))
+	{
+		Remove(PackageName);
+		return;
+	}
+
+	FBPComplexityCacheRecord& Cached = Record(PackageName);
+	Cached.Snapshot = Snapshot;
+	Cached.bHasReport = false;
+	Cached.Report = FBPAnalysisReport();
+}
+
+void FBPComplexityCache::StoreReport(FName PackageName, const FBPAnalysisReport& Report)
+{
+	if (FBPComplexityCacheRecord* Cached = Find(PackageName))
+	{
+		Cached->bHasReport = true;
+		Cached->Report = Report;
+	}
+}
+
+bool FBPComplexityCache::SaveBaseline(const FString& FilePath) const
+{
+	int32 NumReports = 0;
+	for (const TPair<FName, FEntry>& Pair : Entries)
+	{
+		NumReports += Pair.Value.Payload.bHasReport ? 1 : 0;
+	}
+
+	if (NumReports == 0)
+	{
+		return false;
+	}
+
+	return SaveFile(FilePath, ComplexityBaselineMagic, ComplexityCacheVersion, [this, NumReports](FArchive& Ar, FAssetCacheNameTable& NameTable)
+	{
+		FDateTime CreatedTime = FDateTime::Now();
+		int32 NumEntries = NumReports;
+		Ar << CreatedTime;
+		Ar << NumEntries;
+
+		for (const TPair<FName, FEntry>& Pair : Entries)
+		{
+			if (!Pair.Value.Payload.bHasReport)
+			{
+				continue;
+			}
+
+			FName PackageName = Pair.Key;
+			FIoHash SavedHash = Pair.Value.State.SavedHash;
+			NameTable.Serialize(Ar, PackageName);
+			Ar << SavedHash;
+
+			FBPAnalysisReport Report = Pair.Value.Payload.Report;
+			FBPAnalysisReport::StaticStruct()->SerializeBin(Ar, &Report);
+		}
+	});
+}
+
+bool FBPComplexityCache::LoadBaseline(const FString& FilePath, FBPComplexityBaseline& OutBaseline)
+{
+	OutBaseline = FBPComplexityBaseline();
+
+	const bool bLoaded = LoadFile(FilePath, ComplexityBaselineMagic, ComplexityCacheVersion, [&OutBaseline](FArchive& Ar, FAssetCacheNameTable& NameTable)
+	{
+		Ar << OutBaseline.CreatedTime;
+
+		int32 NumEntries = 0;
+		Ar << NumEntries;
+		OutBaseline.Entries.Reserve(NumEntries);
+
+		for (int32 Index = 0; Index < NumEntries && !Ar.IsError(); ++Index)
+		{
+			FName PackageName;
+			NameTable.Serialize(Ar, PackageName);
+
+			FBPComplexityBaseline::FEntry& Entry = OutBaseline.Entries.Add(PackageName);
+			Ar << Entry.SavedHash;
+			FBPAnalysisReport::StaticStruct()->SerializeBin(Ar, &Entry.Report);
+		}
+	});
+
+	if (!bLoaded)
+	{
+		OutBaseline = FBPComplexityBaseline();
+		return false;
+	}
+
+	return true;
+}
+
+bool FBPComplexityCache::GetCurrentPackageHash(FName PackageName, FIoHash& OutHash)
+{
+	FAssetPackageState CurrentState;
+	if (!FAssetPackageState::GetCurrent(PackageName, CurrentState))
+	{
+		return false;
+	}
+
+	OutHash = CurrentState.SavedHash;
+	return true;
+}
+
+bool FBPComplexityCache::IsPackageDirty(FName PackageName)
+{
+	return FAssetPackageState::IsPackageDirty(PackageName);
+}
+
+void FBPComplexityCache::SerializeRecord(FArchive& Ar, FBPComplexityCacheRecord& CacheRecord, FAssetCacheNameTable& NameTable)
+{
+	// Serializeは非constのため書き込み時は複製
+	TSharedRef<FBPGraphSnapshot> Snapshot = (Ar.IsSaving() && CacheRecord.Snapshot.IsValid())
+		? MakeShared<FBPGraphSnapshot>(*CacheRecord.Snapshot)
+		: MakeShared<FBPGraphSnapshot>();
+	Ar << *Snapshot;
+	if (Ar.IsLoading())
+	{
+		CacheRecord.Snapshot = Snapshot;
+	}
+
+	Ar << CacheRecord.bHasReport;
+	if (CacheRecord.bHasReport)
+	{
+		FBPAnalysisReport::StaticStruct()->SerializeBin(Ar, &CacheRecord.Report);
+	}
+}
+
+void FBPComplexityCache::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (Package)
+	{
+		Invalidate(Package->GetFName());
+	}
+}
+
+void FBPComplexityCache::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	if (Blueprint)
+	{
+		Invalidate(Blueprint->GetOutermost()->GetFName());
+	}
+}
@@ -0,0 +1,304 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "BPGraphSnapshot.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Tunnel.h"
+#include "EdGraphSchema_K2.h"
+
+FBPGraphSnapshot FBPGraphSnapshot::Capture(UBlueprint* Blueprint)
+{
+	check(IsInGameThread());
+
+	FBPGraphSnapshot Snapshot;
+	if (!Blueprint)
+	{
+		return Snapshot;
+	}
+
+	Snapshot.BlueprintPath = Blueprint->GetPathName();
+	Snapshot.BlueprintName = Blueprint->GetName();
+	Snapshot.PackageName = Blueprint->GetOutermost()->GetFName();
+
+	if (Blueprint->ParentClass)
+	{
+		Snapshot.ParentClassName = Blueprint->ParentClass->GetName();
+	}
+
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+
+	// 1パス目: ノードにIDを振り、種別・カテゴリ・関数名を記録
+	TArray<const UEdGraphNode*> NodeObjects;
+	TMap<const UEdGraphNode*, int32> NodeIds;
+	TMap<FString, uint16> CategoryIds;
+	TMap<FName, int32> FunctionNameIds;
+
+	for (UEdGraph* Graph : AllGraphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		Snapshot.GraphNames.Add(Graph->GetName());
+		Snapshot.GraphNodeOffsets.Add(NodeObjects.Num());
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			NodeIds.Add(Node, NodeObjects.Num());
+			NodeObjects.Add(Node);
+
+			const EBPSnapshotNodeKind Kind = GetNodeKind(Node);
+			Snapshot.NodeKinds.Add((uint8)Kind);
+
+			const FString CategoryName = GetKindCategoryName(Kind);
+			uint16* CategoryId = CategoryIds.Find(CategoryName);
+			if (!CategoryId)
+			{
+				CategoryId = &CategoryIds.Add(CategoryName, (uint16)Snapshot.CategoryNames.Add(CategoryName));
+			}
+			Snapshot.NodeCategoryIds.Add(*CategoryId);
+
+			FName FunctionName;
+			if (const UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				FunctionName = FuncNode->GetFunctionName();
+			}
+			else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+			{
+				FunctionName = EventNode->GetFunctionName();
+			}
+
+			int32 FunctionNameId = INDEX_NONE;
+			if (FunctionName != NAME_None)
+			{
+				if (const int32* ExistingId = FunctionNameIds.Find(FunctionName))
+				{
+					FunctionNameId = *ExistingId;
+				}
+				else
+				{
+					FunctionNameId = Snapshot.FunctionNames.Add(FunctionName.ToString());
+					FunctionNameIds.Add(FunctionName, FunctionNameId);
+				}
+			}
+			Snapshot.NodeFunctionNameIds.Add(FunctionNameId);
+		}
+	}
+	Snapshot.GraphNodeOffsets.Add(NodeObjects.Num());
+
+	// 2パス目: 出力ピンの接続をID順にCSRへ追記
+	Snapshot.ExecEdgeOffsets.Reserve(NodeObjects.Num() + 1);
+	Snapshot.DataEdgeOffsets.Reserve(NodeObjects.Num() + 1);
+
+	for (const UEdGraphNode* Node : NodeObjects)
+	{
+		Snapshot.ExecEdgeOffsets.Add(Snapshot.ExecEdgeTargets.Num());
+		Snapshot.DataEdgeOffsets.Add(Snapshot.DataEdgeTargets.Num());
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin || Pin->Direction != EGPD_Output)
+			{
+				continue;
+			}
+
+			TArray<int32>& Targets = (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec) ? Snapshot.ExecEdgeTargets : Snapshot.DataEdgeTargets;
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32* LinkedId = LinkedPin ? NodeIds.Find(LinkedPin->GetOwningNode()) : nullptr;
+				if (LinkedId)
+				{
+					Targets.Add(*LinkedId);
+				}
+			}
+		}
+	}
+
+	Snapshot.ExecEdgeOffsets.Add(Snapshot.ExecEdgeTargets.Num());
+	Snapshot.DataEdgeOffsets.Add(Snapshot.DataEdgeTargets.Num());
+
+	return Snapshot;
+}
+
+EBPSnapshotNodeKind FBPGraphSnapshot::GetNodeKind(const UEdGraphNode* Node)
+{
+	if (Cast<UK2Node_CallFunction>(Node))
+	{
+		return EBPSnapshotNodeKind::FunctionCall;
+	}
+	else if (Cast<UK2Node_VariableGet>(Node) || Cast<UK2Node_VariableSet>(Node))
+	{
+		return EBPSnapshotNodeKind::VariableAccess;
+	}
+	else if (Cast<UK2Node_IfThenElse>(Node))
+	{
+		return EBPSnapshotNodeKind::ControlFlow;
+	}
+	else if (Cast<UK2Node_Event>(Node))
+	{
+		return EBPSnapshotNodeKind::Event;
+	}
+	else if (Cast<UK2Node_MacroInstance>(Node))
+	{
+		return EBPSnapshotNodeKind::Macro;
+	}
+	else if (Cast<UK2Node_CustomEvent>(Node))
+	{
+		return EBPSnapshotNodeKind::CustomEvent;
+	}
+	else if (Cast<UK2Node_Tunnel>(Node))
+	{
+		return EBPSnapshotNodeKind::Tunnel;
+	}
+
+	return EBPSnapshotNodeKind::Other;
+}
+
+const TCHAR* FBPGraphSnapshot::GetKindCategoryName(EBPSnapshotNodeKind Kind)
+{
+	switch (Kind)
+	{
+	case EBPSnapshotNodeKind::FunctionCall:
+		return TEXT("Function Call");
+	case EBPSnapshotNodeKind::VariableAccess:
+		return TEXT("Variable Access");
+	case EBPSnapshotNodeKind::ControlFlow:
+		return TEXT("Control Flow");
+	case EBPSnapshotNodeKind::Event:
+		return TEXT("Event");
+	case EBPSnapshotNodeKind::Macro:
+		return TEXT("Macro");
+	case EBPSnapshotNodeKind::CustomEvent:
+		return TEXT("Custom Event");
+	case EBPSnapshotNodeKind::Tunnel:
+		return TEXT("Tunnel");
+	default:
+		return TEXT("Other");
+	}
+}
+
+const FString& FBPGraphSnapshot::GetNodeFunctionName(int32 NodeId) const
+{
+	static const FString EmptyName;
+	const int32 FunctionNameId = NodeFunctionNameIds[NodeId];
+	return FunctionNames.IsValidIndex(FunctionNameId) ? FunctionNames[FunctionNameId] : EmptyName;
+}
+
+void FBPGraphSnapshot::Serialize(FArchive& Ar)
+{
+	uint32 Version = SerializationVersion;
+	Ar << Version;
+
+	if (Ar.IsLoading() && Version != SerializationVersion)
+	{
+		Ar.SetError();
+		*this = FBPGraphSnapshot();
+		return;
+	}
+
+	// FNameはアーカイブの種類に依存しないよう文字列で保存
+	FString PackageNameString = PackageName.IsNone() ? FString() : PackageName.ToString();
+
+	Ar << BlueprintPath;
+	Ar << BlueprintName;
+	Ar << ParentClassName;
+	Ar << PackageNameString;
+	Ar << GraphNames;
+	Ar << GraphNodeOffsets;
+	Ar << NodeKinds;
+	Ar << NodeCategoryIds;
+	Ar << NodeFunctionNameIds;
+	Ar << ExecEdgeOffsets;
+	Ar << ExecEdgeTargets;
+	Ar << DataEdgeOffsets;
+	Ar << DataEdgeTargets;
+	Ar << CategoryNames;
+	Ar << FunctionNames;
+
+	if (Ar.IsLoading())
+	{
+		PackageName = PackageNameString.IsEmpty() ? NAME_None : FName(*PackageNameString);
+
+		if (Ar.IsError() || !IsConsistent())
+		{
+			Ar.SetError();
+			*this = FBPGraphSnapshot();
+		}
+	}
+}
+
+bool FBPGraphSnapshot::IsConsistent() const
+{
+	const int32 NodeCount = NodeKinds.Num();
+
+	if (GraphNodeOffsets.Num() != GraphNames.Num() + 1 ||
+		NodeCategoryIds.Num() != NodeCount ||
+		NodeFunctionNameIds.Num() != NodeCount ||
+		ExecEdgeOffsets.Num() != NodeCount + 1 ||
+		DataEdgeOffsets.Num() != NodeCount + 1)
+	{
+		return false;
+	}
+
+	if (GraphNodeOffsets[0] != 0 || GraphNodeOffsets.Last() != NodeCount)
+	{
+		return false;
+	}
+
+	for (int32 GraphIndex = 0; GraphIndex < GraphNames.Num(); ++GraphIndex)
+	{
+		if (GraphNodeOffsets[GraphIndex] > GraphNodeOffsets[GraphIndex + 1])
+		{
+			return false;
+		}
+	}
+
+	for (int32 NodeId = 0; NodeId < NodeCount; ++NodeId)
+	{
+		if (NodeKinds[NodeId] > (uint8)EBPSnapshotNodeKind::Other ||
+			!CategoryNames.IsValidIndex(NodeCategoryIds[NodeId]) ||
+			(NodeFunctionNameIds[NodeId] != INDEX_NONE && !FunctionNames.IsValidIndex(NodeFunctionNameIds[NodeId])) ||
+			ExecEdgeOffsets[NodeId] > ExecEdgeOffsets[NodeId + 1] ||
+			DataEdgeOffsets[NodeId] > DataEdgeOffsets[NodeId + 1])
+		{
+			return false;
+		}
+	}
+
+	if (ExecEdgeOffsets[0] != 0 || ExecEdgeOffsets.Last() != ExecEdgeTargets.Num() ||
+		DataEdgeOffsets[0] != 0 || DataEdgeOffsets.Last() != DataEdgeTargets.Num())
+	{
+		return false;
+	}
+
+	auto AreTargetsValid = [NodeCount](const TArray<int32>& Targets)
+	{
+		for (int32 Target : Targets)
+		{
+			if (Target < 0 || Target >= NodeCount)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	return AreTargetsValid(ExecEdgeTargets) && AreTargetsValid(DataEdgeTargets);
+}
@@ -0,0 +1,235 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "BPRuntimeProfiler.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/Class.h"
+#include "UObject/Script.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBPRuntimeProfiler, Log, All);
+
+FBPRuntimeProfiler::FBPRuntimeProfiler()
+{
+}
+
+FBPRuntimeProfiler::~FBPRuntimeProfiler()
+{
+	StopCapture();
+	SetCaptureDuringPIE(false);
+}
+
+void FBPRuntimeProfiler::SetCaptureDuringPIE(bool bEnable)
+{
+	if (bEnable == bCaptureDuringPIE)
+	{
+		return;
+	}
+
+	bCaptureDuringPIE = bEnable;
+
+	if (bEnable)
+	{
+		PostPIEStartedHandle = FEditorDelegates::PostPIEStarted.AddRaw(this, &FBPRuntimeProfiler::OnPostPIEStarted);
+		EndPIEHandle = FEditorDelegates::EndPIE.AddRaw(this, &FBPRuntimeProfiler::OnEndPIE);
+	}
+	else
+	{
+		FEditorDelegates::PostPIEStarted.Remove(PostPIEStartedHandle);
+		FEditorDelegates::EndPIE.Remove(EndPIEHandle);
+	}
+}
+
+void FBPRuntimeProfiler::StartCapture()
+{
+	check(IsInGameThread());
+
+	if (bCapturing)
+	{
+		return;
+	}
+
+#if DO_BLUEPRINT_GUARD
+	EnterScriptHandle = FBlueprintContextTracker::OnEnterScriptContext.AddRaw(this, &FBPRuntimeProfiler::OnEnterScriptContext);
+	ExitScriptHandle = FBlueprintContextTracker::OnExitScriptContext.AddRaw(this, &FBPRuntimeProfiler::OnExitScriptContext);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FBPRuntimeProfiler::OnEndFrame);
+	CallStack.Reset();
+	bCapturing = true;
+#else
+	UE_LOG(LogBPRuntimeProfiler, Warning, TEXT("Blueprint runtime capture requires DO_BLUEPRINT_GUARD; nothing will be recorded."));
+#endif
+}
+
+void FBPRuntimeProfiler::StopCapture()
+{
+	if (!bCapturing)
+	{
+		return;
+	}
+
+#if DO_BLUEPRINT_GUARD
+	FBlueprintContextTracker::OnEnterScriptContext.Remove(EnterScriptHandle);
+	FBlueprintContextTracker::OnExitScriptContext.Remove(ExitScriptHandle);
+#endif
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	// 途中のフレームは破棄（退出を受け取れないため）
+	for (const FStackFrame& Frame : CallStack)
+	{
+		Records[Frame.RecordIndex].ActiveDepth--;
+	}
+	CallStack.Reset();
+	bCapturing = false;
+}
+
+void FBPRuntimeProfiler::Reset()
+{
+	RecordIndices.Reset();
+	Records.Reset();
+	CallStack.Reset();
+	CapturedFrames = 0;
+}
+
+TArray<FBPRuntimeProfile> FBPRuntimeProfiler::BuildProfiles() const
+{
+	TMap<FString, FBPRuntimeProfile> ProfilesByPath;
+
+	for (const FFunctionRecord& Record : Records)
+	{
+		if (Record.BlueprintPath.IsEmpty() || Record.CallCount == 0)
+		{
+			continue;
+		}
+
+		FBPRuntimeProfile& Profile = ProfilesByPath.FindOrAdd(Record.BlueprintPath);
+		Profile.BlueprintPath = Record.BlueprintPath;
+		Profile.CapturedFrames = CapturedFrames;
+
+		FBPRuntimeFunctionProfile& FunctionProfile = Profile.Functions.AddDefaulted_GetRef();
+		FunctionProfile.FunctionName = Record.FunctionName;
+		FunctionProfile.CallCount = Record.CallCount;
+		FunctionProfile.InclusiveTimeMs = (float)FPlatformTime::ToMilliseconds64(Record.InclusiveCycles);
+		FunctionProfile.ExclusiveTimeMs = (float)FPlatformTime::ToMilliseconds64(Record.ExclusiveCycles);
+		FunctionProfile.bIsTickFunction = Record.bIsTickFunction;
+
+		Profile.CallCount += FunctionProfile.CallCount;
+		Profile.ExclusiveTimeMs += FunctionProfile.ExclusiveTimeMs;
+
+		if (Record.bIsTickFunction)
+		{
+			Profile.TickTimeMs += FunctionProfile.InclusiveTimeMs;
+			Profile.TickCallCount += FunctionProfile.CallCount;
+		}
+	}
+
+	TArray<FBPRuntimeProfile> Profiles;
+	Profiles.Reserve(ProfilesByPath.Num());
+	for (TPair<FString, FBPRuntimeProfile>& Pair : ProfilesByPath)
+	{
+		Pair.Value.Functions.Sort([](const FBPRuntimeFunctionProfile& A, const FBPRuntimeFunctionProfile& B)
+		{
+			return A.ExclusiveTimeMs > B.ExclusiveTimeMs;
+		});
+		Profiles.Add(MoveTemp(Pair.Value));
+	}
+
+	Profiles.Sort([](const FBPRuntimeProfile& A, const FBPRuntimeProfile& B)
+	{
+		return A.ExclusiveTimeMs > B.ExclusiveTimeMs;
+	});
+
+	return Profiles;
+}
+
+int32 FBPRuntimeProfiler::FindOrAddRecord(const UFunction* Function)
+{
+	if (const int32* ExistingIndex = RecordIndices.Find(Function))
+	{
+		return *ExistingIndex;
+	}
+
+	FFunctionRecord Record;
+	Record.FunctionName = Function->GetName();
+
+	// Tickの判定は静的分析（イベント名にTickを含む）と揃える
+	Record.bIsTickFunction = Record.FunctionName.Contains(TEXT("Tick"));
+
+	// 関数を定義したBlueprint（親Blueprintの関数は親に計上）
+	if (const UBlueprint* Blueprint = UBlueprint::GetBlueprintFromClass(Function->GetOwnerClass()))
+	{
+		Record.BlueprintPath = Blueprint->GetPathName();
+	}
+
+	const int32 NewIndex = Records.Add(MoveTemp(Record));
+	RecordIndices.Add(Function, NewIndex);
+	return NewIndex;
+}
+
+void FBPRuntimeProfiler::OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* ContextObject, const UFunction* ContextFunction)
+{
+	if (!ContextFunction || !IsInGameThread())
+	{
+		return;
+	}
+
+	const int32 RecordIndex = FindOrAddRecord(ContextFunction);
+	FFunctionRecord& Record = Records[RecordIndex];
+
+	FStackFrame& Frame = CallStack.AddDefaulted_GetRef();
+	Frame.RecordIndex = RecordIndex;
+	Frame.bIsRecursive = Record.ActiveDepth > 0;
+	Record.ActiveDepth++;
+
+	// 記録処理自体の時間を含めないよう最後に計測を開始
+	Frame.StartCycles = FPlatformTime::Cycles64();
+}
+
+void FBPRuntimeProfiler::OnExitScriptContext(const FBlueprintContextTracker& Tracker)
+{
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+
+	// キャプチャ開始前に入ったスクリプトの退出は無視
+	if (!IsInGameThread() || CallStack.Num() == 0)
+	{
+		return;
+	}
+
+	const FStackFrame Frame = CallStack.Pop();
+	const uint64 InclusiveCycles = EndCycles - Frame.StartCycles;
+
+	FFunctionRecord& Record = Records[Frame.RecordIndex];
+	Record.ActiveDepth--;
+	Record.CallCount++;
+	Record.ExclusiveCycles += InclusiveCycles - FMath::Min(InclusiveCycles, Frame.ChildCycles);
+	if (!Frame.bIsRecursive)
+	{
+		Record.InclusiveCycles += InclusiveCycles;
+	}
+
+	if (CallStack.Num() > 0)
+	{
+		CallStack.Last().ChildCycles += InclusiveCycles;
+	}
+}
+
+void FBPRuntimeProfiler::OnEndFrame()
+{
+	CapturedFrames++;
+}
+
+void FBPRuntimeProfiler::OnPostPIEStarted(bool bIsSimulating)
+{
+	Reset();
+	StartCapture();
+}
+
+void FBPRuntimeProfiler::OnEndPIE(bool bIsSimulating)
+{
+	if (!bCapturing)
+	{
+		return;
+	}
+
+	StopCapture();
+	OnCaptureFinished.Broadcast(BuildProfiles());
+}
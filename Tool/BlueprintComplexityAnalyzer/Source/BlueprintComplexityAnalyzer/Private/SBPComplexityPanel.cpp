@@ -11,6 +11,7 @@
 #include "Widgets/Layout/SGridPanel.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/SBoxPanel.h"
 #include "Styling/SlateTypes.h"
@@ -33,6 +34,9 @@ void SBPComplexityPanel::Construct(const FArguments& InArgs)
 	Analyzer = NewObject<UBPComplexityAnalyzer>();
 	Analyzer->AddToRoot(); // GC防止
 
+	// 変更のないBlueprintはプロジェクト分析で再ロードしない
+	Analyzer->SetUseAnalysisCache(true);
+
 	ChildSlot
 	[
 		BuildMainLayout()
@@ -135,6 +139,22 @@ TSharedRef<SWidget> SBPComplexityPanel::BuildToolbar()
 			.OnClicked(this, &SBPComplexityPanel::OnAnalyzeProjectClicked)
 		]
 
+		// PIEプロファイル チェックボックス
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(4.0f)
+		[
+			SNew(SCheckBox)
+			.IsChecked(this, &SBPComplexityPanel::GetRuntimeCaptureCheckState)
+			.OnCheckStateChanged(this, &SBPComplexityPanel::OnRuntimeCaptureCheckStateChanged)
+			.ToolTipText(LOCTEXT("RuntimeCaptureTooltip", "PIE中のBlueprint関数の実行時間を計測し、次回の分析のTick評価・C++化推奨度に反映"))
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("RuntimeCapture", "PIEで計測"))
+			]
+		]
+
 		// スペーサー
 		+ SHorizontalBox::Slot()
 		.FillWidth(1.0f)
@@ -154,6 +174,16 @@ TSharedRef<SWidget> SBPComplexityPanel::BuildToolbar()
 		];
 }
 
+ECheckBoxState SBPComplexityPanel::GetRuntimeCaptureCheckState() const
+{
+	return Analyzer->IsRuntimeCaptureDuringPIEEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SBPComplexityPanel::OnRuntimeCaptureCheckStateChanged(ECheckBoxState NewState)
+{
+	Analyzer->SetRuntimeCaptureDuringPIE(NewState == ECheckBoxState::Checked);
+}
+
 TSharedRef<SWidget> SBPComplexityPanel::BuildTrafficLight()
 {
 	return SNew(SBorder)
@@ -357,9 +387,7 @@ TSharedRef<SWidget> SBPComplexityPanel::BuildTickSection()
 		(CurrentReport.TickMetrics.HealthLevel == EBPHealthLevel::Red ? FLinearColor::Red : FLinearColor::Yellow) :
 		FLinearColor::Green;
 
-	return CreateExpandableSection(
-		LOCTEXT("TickUsage", "Tick使用分析"),
-		SNew(SVerticalBox)
+	TSharedRef<SVerticalBox> Content = SNew(SVerticalBox)
 		+ SVerticalBox::Slot().AutoHeight()
 		[
 			CreateKeyValueRow(TEXT("Tick"), TickStatus, TickColor)
@@ -367,15 +395,33 @@ TSharedRef<SWidget> SBPComplexityPanel::BuildTickSection()
 		+ SVerticalBox::Slot().AutoHeight()
 		[
 			CreateKeyValueRow(TEXT("Tickイベント数"), FString::FromInt(CurrentReport.TickMetrics.TickEventCount))
-		]
+		];
+
+	// PIEの実測値
+	if (CurrentReport.TickMetrics.bHasRuntimeData)
+	{
+		Content->AddSlot().AutoHeight()
+		[
+			CreateKeyValueRow(TEXT("実測時間"),
+				FString::Printf(TEXT("%.3f ms/frame"), CurrentReport.TickMetrics.MeasuredTickTimeMs),
+				UBPComplexityAnalyzer::GetHealthLevelColor(CurrentReport.TickMetrics.HealthLevel))
+		];
+		Content->AddSlot().AutoHeight()
+		[
+			CreateKeyValueRow(TEXT("実測呼び出し"),
+				FString::Printf(TEXT("%.1f calls/frame"), CurrentReport.TickMetrics.MeasuredTickCallsPerFrame))
+		];
+	}
+
+	return CreateExpandableSection(
+		LOCTEXT("TickUsage", "Tick使用分析"),
+		Content
 	);
 }
 
 TSharedRef<SWidget> SBPComplexityPanel::BuildCppMigrationSection()
 {
-	return CreateExpandableSection(
-		LOCTEXT("CppMigration", "C++化推奨度"),
-		SNew(SVerticalBox)
+	TSharedRef<SVerticalBox> Content = SNew(SVerticalBox)
 		+ SVerticalBox::Slot().AutoHeight()
 		[
 			CreateKeyValueRow(TEXT("推奨度スコア"),
@@ -386,7 +432,29 @@ TSharedRef<SWidget> SBPComplexityPanel::BuildCppMigrationSection()
 		[
 			CreateKeyValueRow(TEXT("移行難易度"),
 				FString::Printf(TEXT("%d / 5"), CurrentReport.CppMigrationMetrics.MigrationDifficulty))
-		]
+		];
+
+	// PIEの実測値
+	if (CurrentReport.CppMigrationMetrics.bHasRuntimeData)
+	{
+		Content->AddSlot().AutoHeight()
+		[
+			CreateKeyValueRow(TEXT("実測スクリプト時間"),
+				FString::Printf(TEXT("%.3f ms/frame"), CurrentReport.CppMigrationMetrics.MeasuredScriptTimeMs))
+		];
+
+		for (const FString& HotFunction : CurrentReport.CppMigrationMetrics.HotFunctions)
+		{
+			Content->AddSlot().AutoHeight()
+			[
+				CreateKeyValueRow(TEXT("  ホット関数"), HotFunction)
+			];
+		}
+	}
+
+	return CreateExpandableSection(
+		LOCTEXT("CppMigration", "C++化推奨度"),
+		Content
 	);
 }
 
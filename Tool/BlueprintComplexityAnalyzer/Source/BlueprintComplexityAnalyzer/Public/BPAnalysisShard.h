@@ -0,0 +1,40 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetAnalysisShard.h"
+#include "BPComplexityTypes.h"
+#include "Misc/Paths.h"
+
+/**
+ * Blueprint複雑度分析のシャード
+ * 分割・ファイル形式・統合はTAssetAnalysisShardで共通（集計は統合時にBuildProjectSummaryで行う）
+ * - ファイル: Saved/BlueprintComplexityAnalyzer/Shards/Shard_<Index>_of_<Count>.bin
+ */
+struct FBPAnalysisShard : public TAssetAnalysisShard<FBPAnalysisReport, FBPCycleGroup>
+{
+	/** ファイル識別子（"BPCS"） */
+	static constexpr uint32 Magic = 0x53435042;
+
+	/** フォーマットバージョン（レポート構造を変更したら更新） */
+	static constexpr int32 Version = 2;
+
+	/** 既定のシャード出力ディレクトリ */
+	static FString GetDefaultShardDirectory()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("BlueprintComplexityAnalyzer") / TEXT("Shards");
+	}
+
+	/** ファイルへ保存 */
+	bool Save(const FString& FilePath) const { return TAssetAnalysisShard::Save(FilePath, Magic, Version); }
+
+	/** ファイルから読み込み */
+	bool Load(const FString& FilePath) { return TAssetAnalysisShard::Load(FilePath, Magic, Version); }
+
+	/** シャードファイルを全て読み込んで統合 */
+	static bool Merge(const TArray<FString>& FilePaths, FBPAnalysisShard& OutMerged, TFunctionRef<void(TArray<FBPAnalysisReport>&)> OnReports)
+	{
+		return TAssetAnalysisShard::Merge(FilePaths, Magic, Version, OutMerged, OnReports);
+	}
+};
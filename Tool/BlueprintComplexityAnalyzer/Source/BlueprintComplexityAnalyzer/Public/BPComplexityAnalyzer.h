@@ -4,11 +4,36 @@
 
 #include "CoreMinimal.h"
 #include "BPComplexityTypes.h"
+#include "Tasks/Task.h"
 #include "BPComplexityAnalyzer.generated.h"
 
 class UBlueprint;
 class UEdGraph;
 class UEdGraphNode;
+class FAssetGraphCycles;
+class FBPComplexityCache;
+class FBPRuntimeProfiler;
+struct FAssetData;
+struct FBPGraphSnapshot;
+
+/**
+ * スコアリングに使う設定と参照データ
+ * 分析の開始時にゲームスレッドで作成し、ワーカースレッドのタスクへ値で渡す（作成後は変更しない）
+ */
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPScoringContext
+{
+	/** 閾値設定（作成時点の複製） */
+	FBPComplexityThresholds Thresholds;
+
+	/** Blueprintパス → 実測プロファイル（無い場合はnull） */
+	TSharedPtr<const TMap<FString, FBPRuntimeProfile>> RuntimeProfiles;
+
+	/** プロジェクト単位の循環参照分析（未構築の場合は到達範囲で計算） */
+	TSharedPtr<const FAssetGraphCycles> CycleAnalysis;
+
+	/** 実測プロファイルを検索（無い場合、またはキャプチャ中に1フレームも経過していない場合はnull） */
+	const FBPRuntimeProfile* FindRuntimeProfile(const FString& BlueprintPath) const;
+};
 
 /**
  * Blueprint複雑度アナライザー
@@ -48,6 +73,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
 	FBPAnalysisReport AnalyzeBlueprintByPath(const FString& AssetPath);
 
+	/**
+	 * 複数のアセットパスと、その依存先のBlueprintをまとめて分析
+	 * 依存は階層ごとに展開し、各階層のパッケージは一度に非同期ロードを発行してロードが完了したものから分析する
+	 * @param AssetPaths アセットパスまたはパッケージ名
+	 * @param DependencyDepth 追跡する依存の階層数（0の場合は指定したBlueprintのみ）
+	 * @return 幅優先で見つかった順のレポート（ロードできなかったBlueprintは含まない）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	TArray<FBPAnalysisReport> AnalyzeBlueprintsByPath(const TArray<FString>& AssetPaths, int32 DependencyDepth = 0);
+
 	// ========== 個別分析API ==========
 
 	/**
@@ -74,6 +109,123 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
 	FBPCppMigrationMetrics CalculateCppMigrationScore(UBlueprint* Blueprint, const FBPAnalysisReport& Report);
 
+	/**
+	 * 循環参照グループを検出
+	 * 依存グラフを一度だけ構築してSCCを計算し、以降のレポートはその結果を参照する
+	 * @param PathFilter 起点パス（空の場合は/Game）
+	 * @return 全ての循環グループ
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	TArray<FBPCycleGroup> AnalyzeProjectCycles(const FString& PathFilter = TEXT(""));
+
+	// ========== キャッシュ・ベースライン ==========
+
+	/**
+	 * 永続複雑度キャッシュを使うか設定
+	 * 有効化時にSaved/のキャッシュファイルを読み込み、変更のないBlueprintはロードせずに前回のスナップショットから再スコアリングする
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	void SetUseAnalysisCache(bool bEnable);
+
+	/**
+	 * 複雑度キャッシュをファイルへ保存
+	 * @return 保存できたか（キャッシュ無効時はfalse）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	bool SaveAnalysisCache();
+
+	/**
+	 * 複雑度キャッシュを破棄（ファイルも削除）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	void ClearAnalysisCache();
+
+	/**
+	 * キャッシュ内の全レポートをベースラインとして保存
+	 * キャッシュ有効時にAnalyzeProjectを実行した後に呼ぶ
+	 * @return 保存できたか
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	bool SaveBaseline();
+
+	/**
+	 * ベースライン以降に追加・変更・削除されたBlueprintを分析
+	 * 保存ハッシュがベースラインと一致し未保存の変更も無いBlueprintはロードも再分析もしない
+	 * @param PathFilter パスフィルタ（空の場合は/Game）
+	 * @return 差分レポート
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	FBPBaselineDiffReport AnalyzeChangedSinceBaseline(const FString& PathFilter = TEXT(""));
+
+	// ========== 実行時プロファイル ==========
+
+	/**
+	 * PIE中にBlueprint関数の実行時間を自動キャプチャするか設定
+	 * PIE終了時の結果は実測プロファイルとして保持され、以降の分析のTick評価・C++化推奨度に反映される
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	void SetRuntimeCaptureDuringPIE(bool bEnable);
+
+	/** PIE自動キャプチャが有効か */
+	UFUNCTION(BlueprintPure, Category = "Blueprint Complexity Analyzer")
+	bool IsRuntimeCaptureDuringPIEEnabled() const;
+
+	/**
+	 * 実測プロファイルを設定（既存のプロファイルは置き換え）
+	 * 外部で計測した結果を取り込む場合に使う
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	void SetRuntimeProfiles(const TArray<FBPRuntimeProfile>& Profiles);
+
+	/** 保持している実測プロファイル */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	TArray<FBPRuntimeProfile> GetRuntimeProfiles() const;
+
+	/** 実測プロファイルを破棄（以降は静的分析のみ） */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Complexity Analyzer")
+	void ClearRuntimeProfiles();
+
+	// ========== スナップショットベースAPI ==========
+	// UObjectにもアナライザーの状態にも触れないため、ワーカースレッドから並列に呼んでよい
+
+	/** 現在の閾値・実測プロファイル・循環参照分析からスコアリング用の参照データを作成（ゲームスレッド） */
+	FBPScoringContext MakeScoringContext() const;
+
+	/**
+	 * スナップショットを分析してレポートを生成
+	 */
+	static FBPAnalysisReport AnalyzeSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context);
+
+	/** ノード数を分析（スナップショット版） */
+	static FBPNodeMetrics AnalyzeNodeCountInSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context);
+
+	/** Tick使用を分析（スナップショット版） */
+	static FBPTickMetrics AnalyzeTickUsageInSnapshot(const FBPGraphSnapshot& Snapshot, const FBPScoringContext& Context);
+
+	/** 依存関係を分析（パッケージ名版、レジストリの読み取りのみ） */
+	static FBPDependencyMetrics AnalyzeDependenciesForPackage(FName PackageName, const FBPScoringContext& Context);
+
+	/** C++化推奨度を計算（レポートのメトリクスのみ使用） */
+	static FBPCppMigrationMetrics CalculateCppMigrationScoreFromReport(const FBPAnalysisReport& Report, const FBPScoringContext& Context);
+
+	// ========== バッチAPI ==========
+
+	/** パスフィルタ（空の場合は/Game）に一致するBlueprintをレジストリから取得 */
+	void GetBlueprintAssets(const FString& PathFilter, TArray<FAssetData>& OutAssets) const;
+
+	/**
+	 * Blueprint群を分析してレポートを追加
+	 * 循環グループは事前にAnalyzeProjectCyclesで計算したものを参照する（未計算の場合は到達範囲で計算）
+	 * @param OutReports ロードできたBlueprintのレポートを末尾に追加
+	 */
+	void AnalyzeAssets(const TArray<FAssetData>& Assets, TArray<FBPAnalysisReport>& OutReports);
+
+	/**
+	 * レポート群からプロジェクトサマリーを集計
+	 * シャードごとの結果を統合する場合にも使う
+	 */
+	FBPProjectAnalysisSummary BuildProjectSummary(TArray<FBPAnalysisReport> Reports, const TArray<FBPCycleGroup>& CycleGroups) const;
+
 	// ========== 設定 ==========
 
 	/**
@@ -107,51 +259,77 @@ protected:
 	UPROPERTY()
 	FBPComplexityThresholds Thresholds;
 
+	/** プロジェクト単位の循環参照分析（未構築の場合は単体分析時に到達範囲で計算） */
+	TSharedPtr<FAssetGraphCycles> CycleAnalysis;
+
+	/** 永続複雑度キャッシュ（無効時はnull） */
+	TSharedPtr<FBPComplexityCache> AnalysisCache;
+
+	/** PIEキャプチャ用プロファイラー（自動キャプチャ無効時はnull） */
+	TSharedPtr<FBPRuntimeProfiler> RuntimeProfiler;
+
+	/** Blueprintパス → 実測プロファイル（更新時は作り直し、分析中のタスクは作成時点のものを参照し続ける） */
+	TSharedPtr<const TMap<FString, FBPRuntimeProfile>> RuntimeProfiles;
+
+	/**
+	 * Blueprint群を分析（非同期ロード → スナップショット作成 → ワーカースレッドでスコアリング）
+	 * キャッシュ有効時はヒットしたBlueprintのロードを省略し、新しいスナップショットとレポートを記録する
+	 * @param ScoringPrerequisites スコアリング開始前に完了が必要なタスク
+	 * @param OutReports アセットと同じ順序のレポート
+	 * @param bOutHasReport レポートを作成できたか（ロード失敗時はfalse）
+	 */
+	void AnalyzeAssetsPipelined(const TArray<FAssetData>& Assets, const TArray<UE::Tasks::FTask>& ScoringPrerequisites,
+		TArray<FBPAnalysisReport>& OutReports, TArray<bool>& bOutHasReport);
+
 	// ========== 内部ヘルパー ==========
 
 	/**
 	 * グラフ内のノードを分析
+	 * @param InOutCategoryCounts カテゴリIDごとのカウント（スナップショットのカテゴリ数で初期化済み）
 	 */
-	void AnalyzeGraph(UEdGraph* Graph, FBPNodeMetrics& OutMetrics);
+	static void AnalyzeGraph(const FBPGraphSnapshot& Snapshot, int32 GraphIndex, TArray<int32>& InOutCategoryCounts, FBPNodeMetrics& OutMetrics);
 
 	/**
 	 * ノードのカテゴリを判定
 	 */
-	FString GetNodeCategory(UEdGraphNode* Node);
+	static FString GetNodeCategory(UEdGraphNode* Node);
 
 	/**
 	 * Tickイベントからの実行パスを追跡
+	 * @param TickNodeId スナップショット上のイベントノード
+	 * @param VisitedNodes 訪問フラグ（ノード数で初期化済み）
 	 */
-	void TraceTickExecutionPath(UEdGraphNode* TickNode, FBPTickInfo& OutInfo);
+	static void TraceTickExecutionPath(const FBPGraphSnapshot& Snapshot, int32 TickNodeId, TBitArray<>& VisitedNodes, FBPTickInfo& OutInfo);
 
 	/**
 	 * 依存関係を再帰的に収集
 	 */
-	void CollectDependenciesRecursive(UBlueprint* Blueprint, TSet<FString>& VisitedAssets,
+	static void CollectDependenciesRecursive(FName PackageName, TSet<FString>& VisitedAssets,
 		TArray<FBPDependencyInfo>& OutDependencies, int32 CurrentDepth, int32& MaxDepth);
 
 	/**
-	 * 循環参照を検出
+	 * 循環参照を検出（SCCの所属グループを参照）
+	 * 同じグループに属する依存にはbIsCircularを設定する
 	 */
-	void DetectCircularReferences(UBlueprint* Blueprint, TArray<FString>& OutCircularPaths);
+	static void DetectCircularReferences(FName PackageName, const FBPScoringContext& Context, FBPDependencyMetrics& InOutMetrics);
 
 	/**
 	 * スコアから健全性レベルを判定
 	 */
-	EBPHealthLevel CalculateHealthLevel(float Score) const;
+	static EBPHealthLevel CalculateHealthLevel(float Score);
 
 	/**
 	 * 問題を検出してリストに追加
 	 */
-	void DetectIssues(const FBPAnalysisReport& Report, TArray<FBPIssue>& OutIssues);
+	static void DetectIssues(const FBPAnalysisReport& Report, const FBPScoringContext& Context, TArray<FBPIssue>& OutIssues);
 
 	/**
 	 * 人間向けサマリーを生成
 	 */
-	FString GenerateHumanReadableSummary(const FBPAnalysisReport& Report);
+	static FString GenerateHumanReadableSummary(const FBPAnalysisReport& Report);
 
 	/**
 	 * 推奨アクションを生成
 	 */
-	TArray<FString> GenerateRecommendedActions(const FBPAnalysisReport& Report);
+	static TArray<FString> GenerateRecommendedActions(const FBPAnalysisReport& Report, const FBPScoringContext& Context);
 };
@@ -0,0 +1,137 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+#include "AssetPackageCache.h"
+#include "BPComplexityTypes.h"
+
+struct FBPGraphSnapshot;
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
+
+/**
+ * ベースライン（プリサブミットチェックの比較元）
+ * パッケージごとに保存時のハッシュとその時点のレポートを保持する
+ */
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPComplexityBaseline
+{
+	struct FEntry
+	{
+		/** ベースライン作成時のパッケージハッシュ */
+		FIoHash SavedHash;
+
+		/** ベースライン作成時のレポート */
+		FBPAnalysisReport Report;
+	};
+
+	/** 作成日時 */
+	FDateTime CreatedTime;
+
+	/** パッケージ名 → エントリ */
+	TMap<FName, FEntry> Entries;
+};
+
+/**
+ * 複雑度キャッシュのパッケージごとの内容
+ */
+struct FBPComplexityCacheRecord
+{
+	/** グラフのスナップショット */
+	TSharedPtr<const FBPGraphSnapshot> Snapshot;
+
+	/** レポートを記録済みか */
+	bool bHasReport = false;
+
+	/** 前回のレポート */
+	FBPAnalysisReport Report;
+};
+
+/**
+ * 永続複雑度キャッシュ
+ * パッケージ名 + 保存ハッシュをキーに、グラフのスナップショットと前回のFBPAnalysisReportを保持する
+ * （保存状態の検証・ファイル形式・レジストリイベントはTAssetPackageCacheで共通）
+ * - ファイル: Saved/BlueprintComplexityAnalyzer/ComplexityCache.bin（バイナリ）
+ * - 読み込み時にレジストリの現在のハッシュと比較し、変更されたパッケージを破棄
+ * - 実行中はパッケージ保存・Blueprintコンパイル・レジストリの更新/リネーム/削除イベントで無効化
+ * - 未保存の変更があるパッケージ（Dirty）はヒットさせない
+ * 依存・循環メトリクスは他パッケージにも左右されるため、ヒット時もスナップショットから再スコアリングする
+ * （ロードとグラフ走査だけを省略する）
+ * ゲームスレッド専用
+ */
+class BLUEPRINTCOMPLEXITYANALYZER_API FBPComplexityCache : public TAssetPackageCache<FBPComplexityCacheRecord>
+{
+public:
+	FBPComplexityCache();
+	~FBPComplexityCache();
+
+	/** 既定のキャッシュファイルパス */
+	static FString GetDefaultCachePath();
+
+	/** 既定のベースラインファイルパス */
+	static FString GetDefaultBaselinePath();
+
+	/**
+	 * キャッシュファイルを読み込み、変更されたパッケージを無効化
+	 * @return 読み込めたか（ファイルが無い場合はfalse）
+	 */
+	bool Load(const FString& FilePath);
+
+	/** キャッシュファイルへ保存 */
+	bool Save(const FString& FilePath) const;
+
+	/**
+	 * キャッシュ済みスナップショットを検索
+	 * @return 保存ハッシュが現在と一致し、未保存の変更が無い場合のみ有効
+	 */
+	TSharedPtr<const FBPGraphSnapshot> FindSnapshot(FName PackageName) const;
+
+	/**
+	 * スナップショットを保存（現在の保存ハッシュを記録、以前のレポートは破棄）
+	 * 未保存の変更があるパッケージは保存しない
+	 */
+	void StoreSnapshot(FName PackageName, const TSharedRef<const FBPGraphSnapshot>& Snapshot);
+
+	/** スナップショット保存済みのパッケージにレポートを記録 */
+	void StoreReport(FName PackageName, const FBPAnalysisReport& Report);
+
+	/** パッケージのキャッシュを無効化 */
+	void Invalidate(FName PackageName) { Remove(PackageName); }
+
+	/**
+	 * レポートを持つ全エントリをベースラインとして保存
+	 * @return 保存できたか（レポートが1件も無い場合はfalse）
+	 */
+	bool SaveBaseline(const FString& FilePath) const;
+
+	/**
+	 * ベースラインを読み込み
+	 * @return 読み込めたか（ファイルが無い・形式が異なる場合はfalse）
+	 */
+	static bool LoadBaseline(const FString& FilePath, FBPComplexityBaseline& OutBaseline);
+
+	/** レジストリから現在のパッケージ保存ハッシュを取得 */
+	static bool GetCurrentPackageHash(FName PackageName, FIoHash& OutHash);
+
+	/** ロード済みで未保存の変更があるか */
+	static bool IsPackageDirty(FName PackageName);
+
+protected:
+	//~ Begin FAssetPackageCacheBase Interface
+	virtual void OnPackageChanged(FName PackageName) override { Invalidate(PackageName); }
+	//~ End FAssetPackageCacheBase Interface
+
+private:
+	/** パッケージごとの内容を読み書き */
+	static void SerializeRecord(FArchive& Ar, FBPComplexityCacheRecord& CacheRecord, FAssetCacheNameTable& NameTable);
+
+	/** エディタイベント */
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+
+	/** イベントハンドル */
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle BlueprintPreCompileHandle;
+};
@@ -218,6 +218,20 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPTickMetrics
 	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
 	TArray<FBPTickInfo> TickDetails;
 
+	// ========== 実測値（PIEキャプチャがある場合） ==========
+
+	/** 実測データがあるか（ある場合はスコア・レベルを実測値で判定） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	bool bHasRuntimeData = false;
+
+	/** Tick処理の実測時間（ms/フレーム、全インスタンス合計） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	float MeasuredTickTimeMs = 0.0f;
+
+	/** Tick呼び出し回数（回/フレーム、全インスタンス合計） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	float MeasuredTickCallsPerFrame = 0.0f;
+
 	/** 最適化推奨事項 */
 	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
 	TArray<FString> OptimizationSuggestions;
@@ -258,6 +272,18 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPCppMigrationMetrics
 	/** C++化推奨の優先度 */
 	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
 	EBPHealthLevel Priority = EBPHealthLevel::Green;
+
+	/** 実測データがあるか（ある場合はTick静的評価の代わりに実測時間で加点） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	bool bHasRuntimeData = false;
+
+	/** Blueprint関数の実測時間（ms/フレーム、子のBlueprint関数を除く） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	float MeasuredScriptTimeMs = 0.0f;
+
+	/** 実測時間の長い関数（上位、"関数名 (x.xxx ms/frame)"） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	TArray<FString> HotFunctions;
 };
 
 /**
@@ -354,6 +380,19 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPAnalysisReport
 	TArray<FString> RecommendedActions;
 };
 
+/**
+ * 循環参照グループ（依存グラフの強連結成分）
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPCycleGroup
+{
+	GENERATED_BODY()
+
+	/** グループに含まれるパッケージ */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	TArray<FString> PackageNames;
+};
+
 /**
  * プロジェクト全体の分析サマリー
  */
@@ -394,6 +433,10 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPProjectAnalysisSummary
 	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
 	TArray<FString> BlueprintsWithCircularReferences;
 
+	/** 検出された循環グループ */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	TArray<FBPCycleGroup> CycleGroups;
+
 	/** C++化推奨Blueprint一覧 */
 	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
 	TArray<FString> BlueprintsRecommendedForCpp;
@@ -403,6 +446,162 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPProjectAnalysisSummary
 	FDateTime AnalysisTime;
 };
 
+/**
+ * 関数ごとの実行時間（PIEキャプチャ）
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPRuntimeFunctionProfile
+{
+	GENERATED_BODY()
+
+	/** 関数名 */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	FString FunctionName;
+
+	/** 呼び出し回数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	int64 CallCount = 0;
+
+	/** 合計時間（ms、呼び出し先を含む） */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	float InclusiveTimeMs = 0.0f;
+
+	/** 合計時間（ms、呼び出し先のBlueprint関数を除く） */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	float ExclusiveTimeMs = 0.0f;
+
+	/** Tickイベントの入口関数か */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	bool bIsTickFunction = false;
+};
+
+/**
+ * Blueprintごとの実行時間（PIEキャプチャ）
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPRuntimeProfile
+{
+	GENERATED_BODY()
+
+	/** Blueprintパス */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	FString BlueprintPath;
+
+	/** キャプチャしたフレーム数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	int32 CapturedFrames = 0;
+
+	/** 全関数の呼び出し回数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	int64 CallCount = 0;
+
+	/** 全関数の合計時間（ms、呼び出し先のBlueprint関数を除く） */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	float ExclusiveTimeMs = 0.0f;
+
+	/** Tick入口関数の合計時間（ms、呼び出し先を含む） */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	float TickTimeMs = 0.0f;
+
+	/** Tick入口関数の呼び出し回数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	int64 TickCallCount = 0;
+
+	/** 関数別（ExclusiveTimeMsの降順） */
+	UPROPERTY(BlueprintReadOnly, Category = "Runtime")
+	TArray<FBPRuntimeFunctionProfile> Functions;
+};
+
+/**
+ * ベースラインからの変更種別
+ */
+UENUM(BlueprintType)
+enum class EBPBaselineChangeType : uint8
+{
+	/** ベースライン以降に追加 */
+	Added UMETA(DisplayName = "Added"),
+
+	/** ベースライン以降に変更 */
+	Modified UMETA(DisplayName = "Modified"),
+
+	/** ベースライン以降に削除 */
+	Removed UMETA(DisplayName = "Removed")
+};
+
+/**
+ * ベースラインから変更されたBlueprint
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPBaselineChange
+{
+	GENERATED_BODY()
+
+	/** Blueprintパス（削除時はパッケージ名） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	FString BlueprintPath;
+
+	/** 変更種別 */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	EBPBaselineChangeType ChangeType = EBPBaselineChangeType::Modified;
+
+	/** ベースライン時の総合スコア */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	float PreviousScore = 0.0f;
+
+	/** 現在の総合スコア */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	float CurrentScore = 0.0f;
+
+	/** ベースライン時の健全性レベル */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	EBPHealthLevel PreviousHealthLevel = EBPHealthLevel::Green;
+
+	/** 現在の健全性レベル */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	EBPHealthLevel CurrentHealthLevel = EBPHealthLevel::Green;
+
+	/** 健全性レベルが悪化したか（追加時はGreen以外） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	bool bIsRegression = false;
+};
+
+/**
+ * ベースラインからの差分レポート
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPBaselineDiffReport
+{
+	GENERATED_BODY()
+
+	/** ベースラインが見つかったか（無い場合は全Blueprintが追加扱い） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	bool bHasBaseline = false;
+
+	/** ベースラインの作成日時 */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	FDateTime BaselineTime;
+
+	/** 変更のなかったBlueprint数（再分析していない） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	int32 UnchangedCount = 0;
+
+	/** 悪化したBlueprint数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	int32 RegressionCount = 0;
+
+	/** 変更一覧（スコアの悪化が大きい順） */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	TArray<FBPBaselineChange> Changes;
+
+	/** 追加・変更されたBlueprintのレポート */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	TArray<FBPAnalysisReport> ChangedReports;
+
+	/** 分析日時 */
+	UPROPERTY(BlueprintReadOnly, Category = "Analysis")
+	FDateTime AnalysisTime;
+};
+
 /**
  * 閾値設定
  */
@@ -457,6 +656,14 @@ struct BLUEPRINTCOMPLEXITYANALYZER_API FBPComplexityThresholds
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Thresholds|Tick")
 	int32 TickNodeCountRed = 30;
 
+	/** Tick実測時間 Yellow閾値（ms/フレーム） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Thresholds|Tick")
+	float TickTimeYellowMs = 0.1f;
+
+	/** Tick実測時間 Red閾値（ms/フレーム） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Thresholds|Tick")
+	float TickTimeRedMs = 0.5f;
+
 	// ========== C++化推奨閾値 ==========
 
 	/** C++化推奨スコア閾値 */
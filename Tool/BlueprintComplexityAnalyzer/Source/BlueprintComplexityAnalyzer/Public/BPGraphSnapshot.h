@@ -0,0 +1,150 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+/**
+ * スナップショット上のノード種別
+ * 判定順はAnalyzeNodeCountのキャスト順と同じ（CustomEventはEventとして判定される）
+ */
+enum class EBPSnapshotNodeKind : uint8
+{
+	FunctionCall,
+	VariableAccess,
+	ControlFlow,
+	Event,
+	Macro,
+	CustomEvent,
+	Tunnel,
+	Other
+};
+
+/**
+ * Blueprintグラフのスナップショット
+ * ゲームスレッドでUEdGraphから必要な情報だけを写し取り、以降のメトリクス計算はUObjectに触れずに行う
+ * - ノードは整数IDで表し、属性は列ごとの配列（SoA）に保持
+ * - 出力ピンの接続はexec/dataそれぞれCSR形式（オフセット + 終点配列）
+ * - カテゴリ名・関数名は文字列テーブルへインターンし、ノードはIDのみを持つ
+ * Serializeでバイナリ化できるため、ワーカースレッドでの分析やキャッシュに使える
+ */
+struct BLUEPRINTCOMPLEXITYANALYZER_API FBPGraphSnapshot
+{
+	/** シリアライズ形式のバージョン */
+	static constexpr uint32 SerializationVersion = 1;
+
+	/** Blueprintパス */
+	FString BlueprintPath;
+
+	/** Blueprint名 */
+	FString BlueprintName;
+
+	/** 親クラス名 */
+	FString ParentClassName;
+
+	/** パッケージ名（依存クエリ用） */
+	FName PackageName;
+
+	// ========== グラフテーブル ==========
+
+	/** グラフ名 */
+	TArray<FString> GraphNames;
+
+	/** 各グラフの先頭ノードID（グラフ数 + 1 要素、ノードはグラフごとに連続） */
+	TArray<int32> GraphNodeOffsets;
+
+	// ========== ノードテーブル（SoA） ==========
+
+	/** 種別（EBPSnapshotNodeKind） */
+	TArray<uint8> NodeKinds;
+
+	/** カテゴリID（CategoryNamesのインデックス） */
+	TArray<uint16> NodeCategoryIds;
+
+	/** 関数名ID（FunctionNamesのインデックス、関数呼び出し・イベント以外はINDEX_NONE） */
+	TArray<int32> NodeFunctionNameIds;
+
+	// ========== 隣接（CSR） ==========
+
+	/** 出力execピンの接続: 各ノードの開始位置（ノード数 + 1 要素） */
+	TArray<int32> ExecEdgeOffsets;
+
+	/** 出力execピンの接続先ノードID */
+	TArray<int32> ExecEdgeTargets;
+
+	/** 出力dataピンの接続: 各ノードの開始位置（ノード数 + 1 要素） */
+	TArray<int32> DataEdgeOffsets;
+
+	/** 出力dataピンの接続先ノードID */
+	TArray<int32> DataEdgeTargets;
+
+	// ========== 文字列テーブル ==========
+
+	/** カテゴリ名（初出順） */
+	TArray<FString> CategoryNames;
+
+	/** 関数名 */
+	TArray<FString> FunctionNames;
+
+	/**
+	 * Blueprintからスナップショットを作成
+	 * ゲームスレッド専用
+	 */
+	static FBPGraphSnapshot Capture(UBlueprint* Blueprint);
+
+	/** ノードの種別を判定 */
+	static EBPSnapshotNodeKind GetNodeKind(const UEdGraphNode* Node);
+
+	/** 種別のカテゴリ名 */
+	static const TCHAR* GetKindCategoryName(EBPSnapshotNodeKind Kind);
+
+	/** 有効なスナップショットか */
+	bool IsValid() const { return !BlueprintPath.IsEmpty(); }
+
+	/** ノード数 */
+	int32 NumNodes() const { return NodeKinds.Num(); }
+
+	/** グラフ数 */
+	int32 NumGraphs() const { return GraphNames.Num(); }
+
+	/** グラフのノードID範囲 */
+	int32 GetGraphFirstNode(int32 GraphIndex) const { return GraphNodeOffsets[GraphIndex]; }
+	int32 GetGraphNodeCount(int32 GraphIndex) const { return GraphNodeOffsets[GraphIndex + 1] - GraphNodeOffsets[GraphIndex]; }
+
+	/** ノードの種別 */
+	EBPSnapshotNodeKind GetNodeKindById(int32 NodeId) const { return (EBPSnapshotNodeKind)NodeKinds[NodeId]; }
+
+	/** ノードの関数名（無い場合は空文字列） */
+	const FString& GetNodeFunctionName(int32 NodeId) const;
+
+	/** 出力execピンの接続先 */
+	TConstArrayView<int32> GetExecTargets(int32 NodeId) const
+	{
+		return TConstArrayView<int32>(ExecEdgeTargets.GetData() + ExecEdgeOffsets[NodeId], ExecEdgeOffsets[NodeId + 1] - ExecEdgeOffsets[NodeId]);
+	}
+
+	/** 出力dataピンの接続先 */
+	TConstArrayView<int32> GetDataTargets(int32 NodeId) const
+	{
+		return TConstArrayView<int32>(DataEdgeTargets.GetData() + DataEdgeOffsets[NodeId], DataEdgeOffsets[NodeId + 1] - DataEdgeOffsets[NodeId]);
+	}
+
+	/**
+	 * シリアライズ
+	 * 読み込み時にバージョンまたはテーブルの整合性が合わない場合はArにエラーを設定し、空のスナップショットにする
+	 */
+	void Serialize(FArchive& Ar);
+
+	friend FArchive& operator<<(FArchive& Ar, FBPGraphSnapshot& Snapshot)
+	{
+		Snapshot.Serialize(Ar);
+		return Ar;
+	}
+
+private:
+	/** テーブル間の要素数と参照範囲が整合しているか */
+	bool IsConsistent() const;
+};
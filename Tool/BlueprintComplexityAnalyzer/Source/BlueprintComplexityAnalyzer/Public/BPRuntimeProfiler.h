@@ -0,0 +1,134 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BPComplexityTypes.h"
+
+class UFunction;
+struct FBlueprintContextTracker;
+
+/**
+ * Blueprint実行時間プロファイラー
+ * スクリプト関数の入退出フック（FBlueprintContextTracker）で関数ごとの呼び出し回数と時間を記録する
+ * - 入れ子のBlueprint関数はスタックで追跡し、包含時間と自己時間（子のBlueprint関数を除く）を分けて集計
+ * - ゲームスレッドの呼び出しのみ記録（ワーカースレッドからのスクリプト実行は無視）
+ * - DO_BLUEPRINT_GUARDが無効なビルドでは何も記録しない
+ * ゲームスレッド専用
+ */
+class BLUEPRINTCOMPLEXITYANALYZER_API FBPRuntimeProfiler
+{
+public:
+	FBPRuntimeProfiler();
+	~FBPRuntimeProfiler();
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnCaptureFinished, const TArray<FBPRuntimeProfile>& /*Profiles*/);
+
+	/** PIE中のキャプチャ完了時（EndPIE時点の結果） */
+	FOnCaptureFinished OnCaptureFinished;
+
+	/**
+	 * PIEの開始・終了に合わせて自動でキャプチャするか
+	 * 開始時に前回の記録は破棄される
+	 */
+	void SetCaptureDuringPIE(bool bEnable);
+
+	/** PIE自動キャプチャが有効か */
+	bool IsCaptureDuringPIEEnabled() const { return bCaptureDuringPIE; }
+
+	/** キャプチャ開始（記録は累積、破棄する場合はReset） */
+	void StartCapture();
+
+	/** キャプチャ停止 */
+	void StopCapture();
+
+	/** キャプチャ中か */
+	bool IsCapturing() const { return bCapturing; }
+
+	/** 記録を破棄 */
+	void Reset();
+
+	/** 記録をBlueprintごとに集計（自己時間の降順） */
+	TArray<FBPRuntimeProfile> BuildProfiles() const;
+
+private:
+	/** 関数ごとの記録 */
+	struct FFunctionRecord
+	{
+		/** 所属Blueprintパス（Blueprint以外のスクリプト関数は空） */
+		FString BlueprintPath;
+
+		/** 関数名 */
+		FString FunctionName;
+
+		/** Tick入口関数か */
+		bool bIsTickFunction = false;
+
+		/** 呼び出し回数 */
+		int64 CallCount = 0;
+
+		/** 包含サイクル */
+		uint64 InclusiveCycles = 0;
+
+		/** 自己サイクル */
+		uint64 ExclusiveCycles = 0;
+
+		/** 現在スタック上にあるフレーム数（再帰時の包含時間の二重計上を防ぐ） */
+		int32 ActiveDepth = 0;
+	};
+
+	/** 呼び出しスタックのフレーム */
+	struct FStackFrame
+	{
+		/** 記録インデックス */
+		int32 RecordIndex = INDEX_NONE;
+
+		/** 開始サイクル */
+		uint64 StartCycles = 0;
+
+		/** 子のBlueprint関数に費やしたサイクル */
+		uint64 ChildCycles = 0;
+
+		/** 同じ関数の外側フレームが既にあるか */
+		bool bIsRecursive = false;
+	};
+
+	/** 関数の記録を取得（初出時はBlueprintパスを解決） */
+	int32 FindOrAddRecord(const UFunction* Function);
+
+	/** スクリプトフック */
+	void OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* ContextObject, const UFunction* ContextFunction);
+	void OnExitScriptContext(const FBlueprintContextTracker& Tracker);
+
+	/** フレーム終了 */
+	void OnEndFrame();
+
+	/** PIEイベント */
+	void OnPostPIEStarted(bool bIsSimulating);
+	void OnEndPIE(bool bIsSimulating);
+
+	/** 関数 → 記録インデックス */
+	TMap<const UFunction*, int32> RecordIndices;
+
+	/** 記録 */
+	TArray<FFunctionRecord> Records;
+
+	/** 呼び出しスタック */
+	TArray<FStackFrame> CallStack;
+
+	/** キャプチャしたフレーム数 */
+	int32 CapturedFrames = 0;
+
+	/** キャプチャ中か */
+	bool bCapturing = false;
+
+	/** PIE自動キャプチャ */
+	bool bCaptureDuringPIE = false;
+
+	/** イベントハンドル */
+	FDelegateHandle EnterScriptHandle;
+	FDelegateHandle ExitScriptHandle;
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle PostPIEStartedHandle;
+	FDelegateHandle EndPIEHandle;
+};
@@ -107,6 +107,10 @@ private:
 	/** レポートをエクスポート */
 	FReply OnExportReportClicked();
 
+	/** PIE計測の切り替え */
+	ECheckBoxState GetRuntimeCaptureCheckState() const;
+	void OnRuntimeCaptureCheckStateChanged(ECheckBoxState NewState);
+
 	/** UIを更新 */
 	void RefreshUI();
 
@@ -0,0 +1,51 @@
+// Copyright DevTools. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DevToolsBenchmark : ModuleRules
+{
+	public DevToolsBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+
+		PrivateIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"UnrealEd",
+				"AssetRegistry",
+				"GameplayAbilities",
+				"AIModule"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"BlueprintGraph",
+				"Kismet",
+				"GameplayTags",
+				"GameplayTasks",
+				"Json",
+				"JsonUtilities",
+				"AssetRegistryGraph",
+				"AssetDependencyCostInspector",
+				"BlueprintComplexityAnalyzer",
+				"GameplayLiveTuningDashboard",
+				"UnifiedDebugPanel"
+			}
+		);
+	}
+}
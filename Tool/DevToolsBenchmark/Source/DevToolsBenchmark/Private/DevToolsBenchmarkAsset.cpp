@@ -0,0 +1,10 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "DevToolsBenchmarkAsset.h"
+
+void UDevToolsBenchmarkAsset::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Payload.GetAllocatedSize());
+}
@@ -0,0 +1,514 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "DevToolsBenchmarkCommandlet.h"
+#include "DevToolsBenchmarkFixtures.h"
+#include "DevToolsBenchmarkMeasure.h"
+#include "AssetCostAnalyzer.h"
+#include "AssetRegistryGraph.h"
+#include "BPComplexityAnalyzer.h"
+#include "DebugDataCollectorSubsystem.h"
+#include "TuningSubsystem.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformProcess.h"
+#include "JsonObjectConverter.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDevToolsBenchmark, Log, All);
+
+namespace
+{
+	/** トランザクション1回あたりの値変更数 */
+	constexpr int32 ChangesPerTransaction = 100;
+
+	/** 収集の計測前に進めるフレーム数（イベントの購読・初回の全収集を除く） */
+	constexpr int32 CollectorWarmupFrames = 30;
+
+	/** 収集の1フレームの時間（収集はリアルタイムで更新間隔を判定するので実時間で合わせる） */
+	constexpr float CollectorFrameSeconds = 1.0f / 60.0f;
+
+	/** 1フレームで状態が変わるアクターの割合 */
+	constexpr float CollectorChurnFraction = 0.05f;
+
+	/** パッケージ名からアセットのパス */
+	FString ToObjectPath(FName PackageName)
+	{
+		const FString PackageString = PackageName.ToString();
+		return PackageString + TEXT(".") + FPackageName::GetShortName(PackageString);
+	}
+
+	/** チューニング用のゲームインスタンス（スイープのワーカーと同じ構成） */
+	UGameInstance* CreateTuningInstance()
+	{
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+		return GameInstance;
+	}
+
+	void DestroyTuningInstance(UGameInstance* GameInstance)
+	{
+		UWorld* World = GameInstance->GetWorld();
+		if (World)
+		{
+			World->BeginTearingDown();
+		}
+		GameInstance->Shutdown();
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+		GameInstance->RemoveFromRoot();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+}
+
+UDevToolsBenchmarkCommandlet::UDevToolsBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Benchmarks the DevTools analyzer, tuning and debug collector hot paths on synthetic fixtures and writes machine-readable results.");
+	HelpUsage = TEXT("-run=DevToolsBenchmark [-Suites=AssetCost,Blueprint,Tuning,DebugCollector] [-Assets=N] [-Blueprints=N] [-Parameters=N] [-Actors=N] [-Seed=N] [-Iterations=N] [-Roots=N] [-Operations=N] [-Frames=N] [-Output=File.json] [-Baseline=File.json] [-Tolerance=0.1] [-KeepFixtures]");
+}
+
+int32 UDevToolsBenchmarkCommandlet::Main(const FString& Params)
+{
+	FDevToolsBenchmarkFixtureSettings FixtureSettings;
+	FParse::Value(*Params, TEXT("Assets="), FixtureSettings.NumAssets);
+	FParse::Value(*Params, TEXT("Blueprints="), FixtureSettings.NumBlueprints);
+	FParse::Value(*Params, TEXT("Parameters="), FixtureSettings.NumParameters);
+	FParse::Value(*Params, TEXT("Actors="), FixtureSettings.NumActors);
+	FParse::Value(*Params, TEXT("Seed="), FixtureSettings.Seed);
+
+	FRunOptions Options;
+	FParse::Value(*Params, TEXT("Iterations="), Options.Iterations);
+	FParse::Value(*Params, TEXT("Roots="), Options.NumRoots);
+	FParse::Value(*Params, TEXT("Operations="), Options.NumOperations);
+	FParse::Value(*Params, TEXT("Frames="), Options.NumFrames);
+	Options.Iterations = FMath::Max(1, Options.Iterations);
+
+	FString SuitesParam = TEXT("AssetCost,Blueprint,Tuning,DebugCollector");
+	FParse::Value(*Params, TEXT("Suites="), SuitesParam);
+	TArray<FString> Suites;
+	SuitesParam.ParseIntoArray(Suites, TEXT(","));
+
+	const bool bAssetCost = Suites.Contains(TEXT("AssetCost"));
+	const bool bBlueprint = Suites.Contains(TEXT("Blueprint"));
+	const bool bTuning = Suites.Contains(TEXT("Tuning"));
+	const bool bDebugCollector = Suites.Contains(TEXT("DebugCollector"));
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("DevToolsBenchmark") / FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FDevToolsBenchmarkFixtures Fixtures(FixtureSettings);
+
+	// 前回残した合成コンテンツはレジストリのスキャン前に消す（規模を変えた場合に古いアセットが混ざらないように）
+	Fixtures.DeleteContent();
+
+	// コマンドレットではレジストリのスキャンが完了していない
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().SearchAllAssets(true);
+
+	FDevToolsBenchmarkReport Report;
+	Report.Timestamp = FDateTime::UtcNow().ToIso8601();
+	Report.EngineVersion = FEngineVersion::Current().ToString();
+	Report.BuildConfiguration = LexToString(FApp::GetBuildConfiguration());
+	Report.Platform = FPlatformProperties::IniPlatformName();
+	Report.MachineName = FPlatformProcess::ComputerName();
+	Report.CPUBrand = FPlatformMisc::GetCPUBrand().TrimStartAndEnd();
+	Report.NumCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	Report.Fixture = FixtureSettings;
+
+	const bool bNeedsContent = bAssetCost || bBlueprint;
+	if (bNeedsContent && !Fixtures.CreateContent())
+	{
+		UE_LOG(LogDevToolsBenchmark, Error, TEXT("Failed to create benchmark content"));
+		Fixtures.DeleteContent();
+		return 1;
+	}
+
+	if (bAssetCost)
+	{
+		RunAssetCostSuite(Fixtures, Options, Report);
+	}
+	if (bBlueprint)
+	{
+		RunBlueprintSuite(Fixtures, Options, Report);
+	}
+	if (bTuning)
+	{
+		RunTuningSuite(Fixtures, Options, Report);
+	}
+	if (bDebugCollector)
+	{
+		RunDebugCollectorSuite(Fixtures, Options, Report);
+	}
+
+	if (bNeedsContent && !FParse::Param(*Params, TEXT("KeepFixtures")))
+	{
+		Fixtures.DeleteContent();
+	}
+
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json) || !FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogDevToolsBenchmark, Error, TEXT("Failed to write results: %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("Wrote %d results to %s"), Report.Results.Num(), *OutputPath);
+
+	FString BaselinePath;
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		double Tolerance = 0.1;
+		FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+		const int32 NumRegressions = CompareWithBaseline(Report, BaselinePath, Tolerance);
+		if (NumRegressions != 0)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+void UDevToolsBenchmarkCommandlet::RunAssetCostSuite(const FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report)
+{
+	const FString AssetRoot = FDevToolsBenchmarkFixtures::GetAssetRoot();
+	const int32 NumAssets = Fixtures.GetAssetPackages().Num();
+
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("AssetCost: %d assets"), NumAssets);
+
+	UAssetCostAnalyzer* Analyzer = NewObject<UAssetCostAnalyzer>();
+	Analyzer->AddToRoot(); // GC防止
+
+	// 共有の依存グラフ（全パッケージの依存を空の状態から取得）
+	{
+		FDevToolsBenchmarkMeasure Measure(TEXT("AssetRegistryGraph.ResolveDependencies"), TEXT("packages"), NumAssets);
+		Measure.Begin();
+		TArray<FName> Dependencies;
+		for (int32 Iteration = 0; Iteration < Options.Iterations; ++Iteration)
+		{
+			FAssetRegistryGraph::Get().Reset();
+			Measure.Sample([&Fixtures, &Dependencies]()
+			{
+				for (FName PackageName : Fixtures.GetAssetPackages())
+				{
+					FAssetRegistryGraph::Get().GetDependencies(PackageName, Dependencies);
+				}
+			});
+		}
+		Report.Results.Add(Measure.End());
+	}
+
+	// フォルダ全体の分析（アセットのロードを含む、最初の1回はロード済みのアセット・依存グラフが無い状態）
+	{
+		FAssetRegistryGraph::Get().Reset();
+		Analyzer->SetAnalysisMode(EAssetCostAnalysisMode::Full);
+
+		int32 NumAnalyzed = 0;
+		Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("AssetCost.AnalyzeFolder"), TEXT("assets"), NumAssets, 1, Options.Iterations + 1,
+			[Analyzer, &AssetRoot, &NumAnalyzed](int32)
+		{
+			NumAnalyzed = Analyzer->AnalyzeFolder(AssetRoot).TotalAssetCount;
+		}));
+		UE_LOG(LogDevToolsBenchmark, Display, TEXT("  AnalyzeFolder: %d assets"), NumAnalyzed);
+	}
+
+	// レジストリのみの分析（ロード無し）
+	{
+		Analyzer->SetAnalysisMode(EAssetCostAnalysisMode::RegistryOnly);
+
+		Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("AssetCost.AnalyzeFolder.RegistryOnly"), TEXT("assets"), NumAssets, 1, Options.Iterations + 1,
+			[Analyzer, &AssetRoot](int32)
+		{
+			Analyzer->AnalyzeFolder(AssetRoot);
+		}));
+
+		Analyzer->SetAnalysisMode(EAssetCostAnalysisMode::Full);
+	}
+
+	// 循環検出（SCC）
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("AssetCost.AnalyzeProjectCycles"), TEXT("assets"), NumAssets, 0, Options.Iterations,
+		[Analyzer, &AssetRoot](int32)
+	{
+		Analyzer->AnalyzeProjectCycles(AssetRoot);
+	}));
+
+	// 依存ツリー（依存の鎖が深い後ろのアセットを起点にする）
+	TArray<FString> Roots;
+	const TArray<FName>& AssetPackages = Fixtures.GetAssetPackages();
+	for (int32 PackageIndex = AssetPackages.Num() - 1; PackageIndex >= 0 && Roots.Num() < Options.NumRoots; --PackageIndex)
+	{
+		Roots.Add(ToObjectPath(AssetPackages[PackageIndex]));
+	}
+
+	if (Roots.Num() > 0)
+	{
+		Analyzer->SetUsePersistentDependencyCache(false);
+		Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("AssetCost.BuildDependencyTree"), TEXT("roots"), 1, 0, Roots.Num(),
+			[Analyzer, &Roots](int32 SampleIndex)
+		{
+			Analyzer->BuildDependencyTree(Roots[SampleIndex]);
+		}));
+
+		// 分析間で依存グラフを保持（最初の起点以降は取得済みの辺を再利用）
+		Analyzer->SetUsePersistentDependencyCache(true);
+		Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("AssetCost.BuildDependencyTree.Persistent"), TEXT("roots"), 1, 0, Roots.Num(),
+			[Analyzer, &Roots](int32 SampleIndex)
+		{
+			Analyzer->BuildDependencyTree(Roots[SampleIndex]);
+		}));
+		Analyzer->SetUsePersistentDependencyCache(false);
+	}
+
+	Analyzer->RemoveFromRoot();
+}
+
+void UDevToolsBenchmarkCommandlet::RunBlueprintSuite(const FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report)
+{
+	const FString BlueprintRoot = FDevToolsBenchmarkFixtures::GetBlueprintRoot();
+	const int32 NumBlueprints = Fixtures.GetBlueprintPackages().Num();
+
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("Blueprint: %d blueprints"), NumBlueprints);
+
+	UBPComplexityAnalyzer* Analyzer = NewObject<UBPComplexityAnalyzer>();
+	Analyzer->AddToRoot(); // GC防止
+
+	FAssetRegistryGraph::Get().Reset();
+
+	// 最初の1回はBlueprintのロードを含む
+	int32 NumAnalyzed = 0;
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Blueprint.AnalyzeProject"), TEXT("blueprints"), NumBlueprints, 1, Options.Iterations + 1,
+		[Analyzer, &BlueprintRoot, &NumAnalyzed](int32)
+	{
+		NumAnalyzed = Analyzer->AnalyzeProject(BlueprintRoot).TotalBlueprintCount;
+	}));
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("  AnalyzeProject: %d blueprints"), NumAnalyzed);
+
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Blueprint.AnalyzeProjectCycles"), TEXT("blueprints"), NumBlueprints, 0, Options.Iterations,
+		[Analyzer, &BlueprintRoot](int32)
+	{
+		Analyzer->AnalyzeProjectCycles(BlueprintRoot);
+	}));
+
+	Analyzer->RemoveFromRoot();
+}
+
+void UDevToolsBenchmarkCommandlet::RunTuningSuite(FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report)
+{
+	TArray<FTuningParameter> Parameters;
+	Fixtures.MakeTuningParameters(Parameters);
+
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("Tuning: %d parameters, %d operations"), Parameters.Num(), Options.NumOperations);
+
+	if (Parameters.Num() == 0)
+	{
+		return;
+	}
+
+	// 値の変更ごとの出力を計測に含めない
+	const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Warning);
+
+	// 登録（毎回新しいサブシステムへ）
+	UGameInstance* GameInstance = nullptr;
+	{
+		FDevToolsBenchmarkMeasure Measure(TEXT("Tuning.RegisterParameters"), TEXT("parameters"), Parameters.Num());
+		Measure.Begin();
+		for (int32 Iteration = 0; Iteration < Options.Iterations; ++Iteration)
+		{
+			if (GameInstance)
+			{
+				DestroyTuningInstance(GameInstance);
+			}
+			GameInstance = CreateTuningInstance();
+
+			UTuningSubsystem* Tuning = GameInstance->GetSubsystem<UTuningSubsystem>();
+			Measure.Sample([Tuning, &Parameters]()
+			{
+				Tuning->RegisterParameters(Parameters);
+			});
+		}
+		Report.Results.Add(Measure.End());
+	}
+
+	UTuningSubsystem* Tuning = GameInstance->GetSubsystem<UTuningSubsystem>();
+	FRandomStream Stream(Report.Fixture.Seed);
+
+	// 暗黙のトランザクション（検証・適用・履歴の追加・通知）
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Tuning.SetParameterValue"), TEXT("changes"), 1, 0, Options.NumOperations,
+		[Tuning, &Parameters, &Stream](int32)
+	{
+		const FTuningParameter& Parameter = Parameters[Stream.RandRange(0, Parameters.Num() - 1)];
+		Tuning->SetParameterValue(Parameter.ParameterId, FDevToolsBenchmarkFixtures::MakeRandomValue(Parameter.DefaultValue.ValueType, Stream));
+	}));
+
+	// まとめた変更（1回のコミットで履歴・通知）
+	const int32 NumTransactions = FMath::Max(1, Options.NumOperations / ChangesPerTransaction);
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Tuning.Transaction"), TEXT("changes"), ChangesPerTransaction, 0, NumTransactions,
+		[Tuning, &Parameters, &Stream](int32)
+	{
+		Tuning->BeginTransaction(TEXT("Benchmark"));
+		for (int32 ChangeIndex = 0; ChangeIndex < ChangesPerTransaction; ++ChangeIndex)
+		{
+			const FTuningParameter& Parameter = Parameters[Stream.RandRange(0, Parameters.Num() - 1)];
+			Tuning->SetParameterValue(Parameter.ParameterId, FDevToolsBenchmarkFixtures::MakeRandomValue(Parameter.DefaultValue.ValueType, Stream));
+		}
+		Tuning->CommitTransaction();
+	}));
+
+	// 全パラメータのプリセットを交互に適用
+	FTuningPreset Presets[2];
+	for (int32 PresetIndex = 0; PresetIndex < 2; ++PresetIndex)
+	{
+		Presets[PresetIndex].PresetId = FGuid::NewGuid();
+		Presets[PresetIndex].PresetName = FString::Printf(TEXT("Benchmark%d"), PresetIndex);
+		for (const FTuningParameter& Parameter : Parameters)
+		{
+			Presets[PresetIndex].ParameterValues.Add(Parameter.ParameterId, FDevToolsBenchmarkFixtures::MakeRandomValue(Parameter.DefaultValue.ValueType, Stream));
+		}
+	}
+
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Tuning.ApplyPreset"), TEXT("parameters"), Parameters.Num(), 0, Options.Iterations * 2,
+		[Tuning, &Presets](int32 SampleIndex)
+	{
+		Tuning->ApplyPreset(Presets[SampleIndex % 2]);
+	}));
+
+	// 検索（パネルの入力ごと）
+	Report.Results.Add(FDevToolsBenchmarkMeasure::Run(TEXT("Tuning.SearchParameterIds"), TEXT("queries"), 1, 0, FMath::Max(1, Options.NumOperations / 10),
+		[Tuning, &Stream](int32)
+	{
+		Tuning->SearchParameterIds(FString::Printf(TEXT("Param%03d"), Stream.RandRange(0, 999)));
+	}));
+
+	DestroyTuningInstance(GameInstance);
+	LogTemp.SetVerbosity(PreviousVerbosity);
+}
+
+void UDevToolsBenchmarkCommandlet::RunDebugCollectorSuite(FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report)
+{
+	UWorld* World = Fixtures.CreateActorWorld();
+	UDebugDataCollectorSubsystem* Collector = World ? World->GetSubsystem<UDebugDataCollectorSubsystem>() : nullptr;
+	if (!Collector)
+	{
+		UE_LOG(LogDevToolsBenchmark, Error, TEXT("DebugCollector: collector subsystem is not available"));
+		Fixtures.DestroyActorWorld();
+		return;
+	}
+
+	const int32 NumActors = Fixtures.GetNumActors();
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("DebugCollector: %d actors, %d frames"), NumActors, Options.NumFrames);
+
+	Collector->WatchActorsWithTag(FDevToolsBenchmarkFixtures::ActorTag);
+	Collector->SetUpdateInterval(CollectorFrameSeconds);
+
+	const float DefaultBudget = Collector->GetCollectBudget();
+	FRandomStream Stream(Report.Fixture.Seed);
+
+	// 変更通知で収集（既定）と、全アクターを毎回収集するポーリング
+	for (const bool bEventDriven : { true, false })
+	{
+		Collector->SetEventDrivenCollection(bEventDriven);
+		Collector->SetCollectBudget(bEventDriven ? DefaultBudget : 1000000.0f);
+
+		FDevToolsBenchmarkMeasure Measure(bEventDriven ? TEXT("DebugCollector.Tick") : TEXT("DebugCollector.Tick.Polling"), TEXT("actors"), NumActors);
+
+		int64 CollectedActors = 0;
+		for (int32 Frame = 0; Frame < CollectorWarmupFrames + Options.NumFrames; ++Frame)
+		{
+			if (Frame == CollectorWarmupFrames)
+			{
+				Measure.Begin();
+			}
+
+			const double FrameStart = FPlatformTime::Seconds();
+
+			Fixtures.ApplyActorChurn(Stream, CollectorChurnFraction);
+			World->Tick(LEVELTICK_All, CollectorFrameSeconds);
+
+			if (Frame >= CollectorWarmupFrames)
+			{
+				Measure.Sample([Collector]()
+				{
+					Collector->Tick(CollectorFrameSeconds);
+				});
+				CollectedActors += Collector->GetLastCollectedActorCount();
+			}
+			else
+			{
+				Collector->Tick(CollectorFrameSeconds);
+			}
+
+			const double Remaining = CollectorFrameSeconds - (FPlatformTime::Seconds() - FrameStart);
+			if (Remaining > 0.0)
+			{
+				FPlatformProcess::Sleep(static_cast<float>(Remaining));
+			}
+		}
+
+		Report.Results.Add(Measure.End());
+		UE_LOG(LogDevToolsBenchmark, Display, TEXT("  %s: %.1f actors collected per frame"),
+			bEventDriven ? TEXT("Event driven") : TEXT("Polling"),
+			Options.NumFrames > 0 ? static_cast<double>(CollectedActors) / Options.NumFrames : 0.0);
+	}
+
+	Collector->ClearAllWatches();
+	Fixtures.DestroyActorWorld();
+}
+
+int32 UDevToolsBenchmarkCommandlet::CompareWithBaseline(const FDevToolsBenchmarkReport& Report, const FString& BaselinePath, double Tolerance)
+{
+	FString Json;
+	FDevToolsBenchmarkReport Baseline;
+	if (!FFileHelper::LoadFileToString(Json, *BaselinePath) || !FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Baseline))
+	{
+		UE_LOG(LogDevToolsBenchmark, Error, TEXT("Failed to read baseline: %s"), *BaselinePath);
+		return 1;
+	}
+
+	if (Baseline.FormatVersion != Report.FormatVersion)
+	{
+		UE_LOG(LogDevToolsBenchmark, Warning, TEXT("Baseline format version %d differs from %d, skipping comparison"), Baseline.FormatVersion, Report.FormatVersion);
+		return 0;
+	}
+
+	int32 NumRegressions = 0;
+	for (const FDevToolsBenchmarkResult& Result : Report.Results)
+	{
+		const FDevToolsBenchmarkResult* Previous = Baseline.FindResult(Result.Name);
+		if (!Previous || Previous->P50Ms <= 0.0)
+		{
+			continue;
+		}
+
+		const double Change = Result.P50Ms / Previous->P50Ms - 1.0;
+		if (Change > Tolerance)
+		{
+			UE_LOG(LogDevToolsBenchmark, Warning, TEXT("Regression: %s p50 %.3f ms -> %.3f ms (%+.1f%%)"),
+				*Result.Name, Previous->P50Ms, Result.P50Ms, Change * 100.0);
+			++NumRegressions;
+		}
+		else
+		{
+			UE_LOG(LogDevToolsBenchmark, Display, TEXT("%s p50 %.3f ms -> %.3f ms (%+.1f%%)"),
+				*Result.Name, Previous->P50Ms, Result.P50Ms, Change * 100.0);
+		}
+	}
+
+	UE_LOG(LogDevToolsBenchmark, Display, TEXT("%d regressions against %s (tolerance %.0f%%)"), NumRegressions, *BaselinePath, Tolerance * 100.0);
+	return NumRegressions;
+}
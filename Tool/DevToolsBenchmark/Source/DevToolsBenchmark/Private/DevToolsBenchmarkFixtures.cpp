@@ -0,0 +1,747 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "DevToolsBenchmarkFixtures.h"
+#include "DevToolsBenchmarkAsset.h"
+#include "TuningTypes.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "GameplayEffect.h"
+#include "AIController.h"
+#include "AI/AISystemBase.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+#include "BehaviorTree/Composites/BTComposite_Sequence.h"
+#include "BehaviorTree/Tasks/BTTask_Wait.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "TextureCompiler.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_VariableGet.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "PackageTools.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectIterator.h"
+
+const FName FDevToolsBenchmarkFixtures::ActorTag(TEXT("DevToolsBenchmark"));
+
+namespace
+{
+	/** 合成コンテンツのフォルダ名（/Game直下） */
+	const TCHAR* ContentFolderName = TEXT("__DevToolsBenchmark__");
+
+	/** サブフォルダあたりのパッケージ数 */
+	constexpr int32 PackagesPerGroup = 256;
+
+	/** この割合の参照を後ろのインデックスへ向けて循環を作る */
+	constexpr float BackReferenceRatio = 0.02f;
+
+	/** ブラックボードのキー */
+	const FName ScoreKey(TEXT("Score"));
+	const FName TargetLocationKey(TEXT("TargetLocation"));
+	const FName AlertedKey(TEXT("bAlerted"));
+	const FName TargetActorKey(TEXT("TargetActor"));
+
+	/** Blueprintのフラグ変数（分岐の条件に使う） */
+	const FName FlagVariableName(TEXT("bBenchmarkFlag"));
+
+	/**
+	 * Index未満のインデックスを選ぶ（近いものほど選ばれやすく、依存の鎖が深くなる）
+	 */
+	int32 PickLowerIndex(FRandomStream& Stream, int32 Index)
+	{
+		const int32 Offset = 1 + FMath::FloorToInt(FMath::Pow(Stream.FRand(), 3.0f) * (Index - 1));
+		return FMath::Clamp(Index - Offset, 0, Index - 1);
+	}
+
+	/**
+	 * イベントノードを取得または追加し、有効にする
+	 */
+	UK2Node_Event* FindOrAddEnabledEvent(UBlueprint* Blueprint, UEdGraph* EventGraph, FName EventName, int32& InOutNodePosY)
+	{
+		UK2Node_Event* EventNode = FBlueprintEditorUtils::FindOverrideForFunction(Blueprint, AActor::StaticClass(), EventName);
+		if (!EventNode)
+		{
+			EventNode = FKismetEditorUtilities::AddDefaultEventNode(Blueprint, EventGraph, EventName, AActor::StaticClass(), InOutNodePosY);
+		}
+
+		// 既定のイベントは無効（ゴースト）ノードとして置かれる
+		if (EventNode)
+		{
+			EventNode->SetEnabledState(ENodeEnabledState::Enabled, false);
+			EventNode->NodeComment.Empty();
+			EventNode->bCommentBubbleVisible = false;
+		}
+		return EventNode;
+	}
+}
+
+FDevToolsBenchmarkFixtures::FDevToolsBenchmarkFixtures(const FDevToolsBenchmarkFixtureSettings& InSettings)
+	: Settings(InSettings)
+{
+}
+
+FDevToolsBenchmarkFixtures::~FDevToolsBenchmarkFixtures()
+{
+	DestroyActorWorld();
+}
+
+// ========== コンテンツ ==========
+
+FString FDevToolsBenchmarkFixtures::GetContentRoot()
+{
+	return FString(TEXT("/Game/")) + ContentFolderName;
+}
+
+FString FDevToolsBenchmarkFixtures::GetAssetRoot()
+{
+	return GetContentRoot() / TEXT("Assets");
+}
+
+FString FDevToolsBenchmarkFixtures::GetBlueprintRoot()
+{
+	return GetContentRoot() / TEXT("Blueprints");
+}
+
+FString FDevToolsBenchmarkFixtures::GetContentDirectory()
+{
+	return FPaths::ProjectContentDir() / ContentFolderName;
+}
+
+FString FDevToolsBenchmarkFixtures::MakePackageName(const FString& Root, const TCHAR* Prefix, int32 Index)
+{
+	return Root / FString::Printf(TEXT("Group_%02d/%s_%05d"), Index / PackagesPerGroup, Prefix, Index);
+}
+
+bool FDevToolsBenchmarkFixtures::CreateContent()
+{
+	FRandomStream Stream(Settings.Seed);
+
+	TArray<UPackage*> Packages;
+	AssetPackages.Reset();
+	BlueprintPackages.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark] Creating %d assets and %d blueprints under %s"),
+		Settings.NumAssets, Settings.NumBlueprints, *GetContentRoot());
+
+	CreateAssets(Stream, Packages);
+	CreateBlueprints(Stream, Packages);
+
+	// テクスチャは保存前にビルドを終える
+	FTextureCompilingManager::Get().FinishAllCompilation();
+
+	TArray<FString> Filenames;
+	if (!SavePackages(Packages, Filenames))
+	{
+		return false;
+	}
+
+	// 依存情報を含めてレジストリへ登録
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.ScanFilesSynchronous(Filenames, true);
+
+	// 計測はディスクからのロードを含める
+	UnloadContentPackages();
+
+	UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark] Saved %d packages"), Filenames.Num());
+	return true;
+}
+
+void FDevToolsBenchmarkFixtures::DeleteContent()
+{
+	UnloadContentPackages();
+
+	const FString Directory = GetContentDirectory();
+	if (IFileManager::Get().DirectoryExists(*Directory))
+	{
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark] Deleted %s"), *Directory);
+	}
+
+	AssetPackages.Reset();
+	BlueprintPackages.Reset();
+}
+
+void FDevToolsBenchmarkFixtures::CreateAssets(FRandomStream& Stream, TArray<UPackage*>& OutPackages)
+{
+	const int32 NumAssets = FMath::Max(0, Settings.NumAssets);
+
+	TArray<UObject*> Assets;
+	TArray<UDevToolsBenchmarkAsset*> DataAssets;
+	Assets.Reserve(NumAssets);
+	DataAssets.Reserve(NumAssets);
+
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+	{
+		// 8件に1件はテクスチャ（実際のリソースサイズを持つ葉）
+		const bool bTexture = (AssetIndex % 8) == 7;
+
+		const FString PackageName = MakePackageName(GetAssetRoot(), bTexture ? TEXT("T") : TEXT("BA"), AssetIndex);
+		UPackage* Package = CreatePackage(*PackageName);
+		const FName AssetName(*FPackageName::GetShortName(PackageName));
+
+		if (bTexture)
+		{
+			const int32 Size = 64 << Stream.RandRange(0, 2);
+
+			UTexture2D* Texture = NewObject<UTexture2D>(Package, AssetName, RF_Public | RF_Standalone);
+			Texture->Source.Init(Size, Size, 1, 1, TSF_BGRA8);
+			uint8* MipData = Texture->Source.LockMip(0);
+			FMemory::Memset(MipData, static_cast<uint8>(Stream.RandRange(0, 255)), Size * Size * 4);
+			Texture->Source.UnlockMip(0);
+			Texture->PostEditChange();
+
+			Assets.Add(Texture);
+			DataAssets.Add(nullptr);
+		}
+		else
+		{
+			UDevToolsBenchmarkAsset* Asset = NewObject<UDevToolsBenchmarkAsset>(Package, AssetName, RF_Public | RF_Standalone);
+			Asset->Payload.SetNumUninitialized(Stream.RandRange(512, 16384));
+			FMemory::Memset(Asset->Payload.GetData(), static_cast<uint8>(AssetIndex), Asset->Payload.Num());
+
+			if (AssetIndex > 0)
+			{
+				const int32 NumReferences = Stream.RandRange(1, 4);
+				for (int32 ReferenceIndex = 0; ReferenceIndex < NumReferences; ++ReferenceIndex)
+				{
+					Asset->References.AddUnique(Assets[PickLowerIndex(Stream, AssetIndex)]);
+				}
+
+				if (Stream.FRand() < 0.2f)
+				{
+					Asset->SoftReferences.Add(Assets[Stream.RandRange(0, AssetIndex - 1)]);
+				}
+			}
+
+			Assets.Add(Asset);
+			DataAssets.Add(Asset);
+		}
+
+		OutPackages.Add(Package);
+		AssetPackages.Add(FName(*PackageName));
+	}
+
+	// 後ろのアセットへの参照で循環を作る
+	for (int32 AssetIndex = 0; AssetIndex < NumAssets - 1; ++AssetIndex)
+	{
+		UDevToolsBenchmarkAsset* Asset = DataAssets[AssetIndex];
+		if (!Asset)
+		{
+			continue;
+		}
+
+		if (Stream.FRand() < BackReferenceRatio)
+		{
+			Asset->References.AddUnique(Assets[Stream.RandRange(AssetIndex + 1, NumAssets - 1)]);
+		}
+		if (Stream.FRand() < BackReferenceRatio)
+		{
+			Asset->SoftReferences.Add(Assets[Stream.RandRange(AssetIndex + 1, NumAssets - 1)]);
+		}
+	}
+}
+
+void FDevToolsBenchmarkFixtures::CreateBlueprints(FRandomStream& Stream, TArray<UPackage*>& OutPackages)
+{
+	const int32 NumBlueprints = FMath::Max(0, Settings.NumBlueprints);
+
+	TArray<UBlueprint*> Blueprints;
+	Blueprints.Reserve(NumBlueprints);
+
+	FEdGraphPinType BoolType;
+	BoolType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
+
+	for (int32 BlueprintIndex = 0; BlueprintIndex < NumBlueprints; ++BlueprintIndex)
+	{
+		const FString PackageName = MakePackageName(GetBlueprintRoot(), TEXT("BP"), BlueprintIndex);
+		UPackage* Package = CreatePackage(*PackageName);
+
+		// 1割は前のBlueprintを親にする（継承の鎖）
+		UClass* ParentClass = AActor::StaticClass();
+		if (BlueprintIndex > 0 && Stream.FRand() < 0.1f)
+		{
+			if (UClass* BlueprintClass = Blueprints[PickLowerIndex(Stream, BlueprintIndex)]->GeneratedClass)
+			{
+				ParentClass = BlueprintClass;
+			}
+		}
+
+		UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+			ParentClass,
+			Package,
+			FName(*FPackageName::GetShortName(PackageName)),
+			BPTYPE_Normal,
+			UBlueprint::StaticClass(),
+			UBlueprintGeneratedClass::StaticClass());
+
+		FBlueprintEditorUtils::AddMemberVariable(Blueprint, FlagVariableName, BoolType);
+
+		if (BlueprintIndex > 0)
+		{
+			const int32 NumReferences = Stream.RandRange(0, 3);
+			for (int32 ReferenceIndex = 0; ReferenceIndex < NumReferences; ++ReferenceIndex)
+			{
+				AddClassReference(Blueprint, Blueprints[PickLowerIndex(Stream, BlueprintIndex)]);
+			}
+		}
+
+		// ノード数は小さいものが多く、一部が大きい分布
+		const int32 NumNodes = FMath::RoundToInt(FMath::Lerp(8.0f, 400.0f, FMath::Pow(Stream.FRand(), 3.0f)));
+		PopulateEventGraph(Blueprint, NumNodes, Stream.FRand() < 0.2f, Stream);
+
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+
+		Blueprints.Add(Blueprint);
+		OutPackages.Add(Package);
+		BlueprintPackages.Add(FName(*PackageName));
+
+		if ((BlueprintIndex + 1) % 100 == 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark]   %d / %d blueprints"), BlueprintIndex + 1, NumBlueprints);
+		}
+	}
+
+	// 後ろのBlueprintへの参照で循環を作る
+	for (int32 BlueprintIndex = 0; BlueprintIndex < NumBlueprints - 1; ++BlueprintIndex)
+	{
+		if (Stream.FRand() < BackReferenceRatio)
+		{
+			UBlueprint* Blueprint = Blueprints[BlueprintIndex];
+			AddClassReference(Blueprint, Blueprints[Stream.RandRange(BlueprintIndex + 1, NumBlueprints - 1)]);
+			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		}
+	}
+}
+
+void FDevToolsBenchmarkFixtures::AddClassReference(UBlueprint* Blueprint, const UBlueprint* Referenced)
+{
+	if (!Referenced || !Referenced->GeneratedClass)
+	{
+		return;
+	}
+
+	FEdGraphPinType ClassType;
+	ClassType.PinCategory = UEdGraphSchema_K2::PC_Object;
+	ClassType.PinSubCategoryObject = Referenced->GeneratedClass;
+
+	FBlueprintEditorUtils::AddMemberVariable(Blueprint, FBlueprintEditorUtils::FindUniqueKismetName(Blueprint, TEXT("Reference")), ClassType);
+}
+
+void FDevToolsBenchmarkFixtures::PopulateEventGraph(UBlueprint* Blueprint, int32 NumNodes, bool bUseTick, FRandomStream& Stream)
+{
+	UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+	if (!EventGraph)
+	{
+		return;
+	}
+
+	const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+	UFunction* PrintFunction = UKismetSystemLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+
+	auto AddPrint = [EventGraph, Schema, PrintFunction](UEdGraphPin*& InOutExecPin, int32 NodePosX, int32 NodePosY)
+	{
+		FGraphNodeCreator<UK2Node_CallFunction> CallCreator(*EventGraph);
+		UK2Node_CallFunction* CallNode = CallCreator.CreateNode();
+		CallNode->SetFromFunction(PrintFunction);
+		CallNode->NodePosX = NodePosX;
+		CallNode->NodePosY = NodePosY;
+		CallCreator.Finalize();
+
+		Schema->TryCreateConnection(InOutExecPin, CallNode->GetExecPin());
+		InOutExecPin = CallNode->GetThenPin();
+	};
+
+	int32 EventPosY = 0;
+	UK2Node_Event* BeginPlayNode = FindOrAddEnabledEvent(Blueprint, EventGraph, GET_FUNCTION_NAME_CHECKED(AActor, ReceiveBeginPlay), EventPosY);
+	if (!BeginPlayNode)
+	{
+		return;
+	}
+
+	UEdGraphPin* ExecPin = BeginPlayNode->FindPin(UEdGraphSchema_K2::PN_Then);
+	int32 NodeCount = 0;
+	while (NodeCount < NumNodes && ExecPin)
+	{
+		const int32 NodePosX = BeginPlayNode->NodePosX + 300 * (NodeCount + 1);
+		const int32 NodePosY = BeginPlayNode->NodePosY;
+
+		// 分岐（条件はフラグ変数）
+		if (Stream.FRand() < 0.15f && NodeCount + 2 <= NumNodes)
+		{
+			FGraphNodeCreator<UK2Node_VariableGet> GetCreator(*EventGraph);
+			UK2Node_VariableGet* GetNode = GetCreator.CreateNode();
+			GetNode->VariableReference.SetSelfMember(FlagVariableName);
+			GetNode->NodePosX = NodePosX;
+			GetNode->NodePosY = NodePosY + 150;
+			GetCreator.Finalize();
+
+			FGraphNodeCreator<UK2Node_IfThenElse> BranchCreator(*EventGraph);
+			UK2Node_IfThenElse* BranchNode = BranchCreator.CreateNode();
+			BranchNode->NodePosX = NodePosX;
+			BranchNode->NodePosY = NodePosY;
+			BranchCreator.Finalize();
+
+			Schema->TryCreateConnection(GetNode->GetValuePin(), BranchNode->GetConditionPin());
+			Schema->TryCreateConnection(ExecPin, BranchNode->GetExecPin());
+			ExecPin = BranchNode->GetThenPin();
+			NodeCount += 2;
+		}
+		else
+		{
+			AddPrint(ExecPin, NodePosX, NodePosY);
+			++NodeCount;
+		}
+	}
+
+	if (bUseTick)
+	{
+		EventPosY += 400;
+		if (UK2Node_Event* TickNode = FindOrAddEnabledEvent(Blueprint, EventGraph, GET_FUNCTION_NAME_CHECKED(AActor, ReceiveTick), EventPosY))
+		{
+			UEdGraphPin* TickExecPin = TickNode->FindPin(UEdGraphSchema_K2::PN_Then);
+			const int32 NumTickNodes = Stream.RandRange(1, 5);
+			for (int32 TickNodeIndex = 0; TickNodeIndex < NumTickNodes && TickExecPin; ++TickNodeIndex)
+			{
+				AddPrint(TickExecPin, TickNode->NodePosX + 300 * (TickNodeIndex + 1), TickNode->NodePosY);
+			}
+		}
+	}
+}
+
+bool FDevToolsBenchmarkFixtures::SavePackages(const TArray<UPackage*>& Packages, TArray<FString>& OutFilenames)
+{
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+
+	for (UPackage* Package : Packages)
+	{
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (!UPackage::SavePackage(Package, Package->FindAssetInPackage(), *Filename, SaveArgs))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[DevToolsBenchmark] Failed to save %s"), *Package->GetName());
+			return false;
+		}
+		OutFilenames.Add(Filename);
+	}
+	return true;
+}
+
+void FDevToolsBenchmarkFixtures::UnloadContentPackages()
+{
+	const FString RootPrefix = GetContentRoot() + TEXT("/");
+
+	TArray<UPackage*> Packages;
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		if (It->GetName().StartsWith(RootPrefix))
+		{
+			Packages.Add(*It);
+		}
+	}
+
+	if (Packages.Num() > 0)
+	{
+		UPackageTools::UnloadPackages(Packages);
+	}
+}
+
+// ========== チューニング ==========
+
+void FDevToolsBenchmarkFixtures::MakeTuningParameters(TArray<FTuningParameter>& OutParameters)
+{
+	if (!TuningTarget.IsValid())
+	{
+		TuningTarget.Reset(NewObject<UDevToolsBenchmarkAsset>(GetTransientPackage(), TEXT("DevToolsBenchmarkTuningTarget")));
+	}
+
+	static const TCHAR* Categories[] = {
+		TEXT("Movement"), TEXT("Combat"), TEXT("Damage"), TEXT("Cooldown"),
+		TEXT("Spawn"), TEXT("Reward"), TEXT("Perception"), TEXT("Camera")
+	};
+	static const TCHAR* Tags[] = {
+		TEXT("Balance"), TEXT("PvP"), TEXT("PvE"), TEXT("Boss"),
+		TEXT("Tutorial"), TEXT("Experimental"), TEXT("Live"), TEXT("Legacy")
+	};
+	const int32 NumLayers = static_cast<int32>(ETuningLayer::Custom) + 1;
+
+	FRandomStream Stream(Settings.Seed);
+	const FString TargetPath = TuningTarget->GetPathName();
+
+	OutParameters.Reset(Settings.NumParameters);
+	for (int32 ParameterIndex = 0; ParameterIndex < Settings.NumParameters; ++ParameterIndex)
+	{
+		FTuningParameter& Parameter = OutParameters.AddDefaulted_GetRef();
+		Parameter.ParameterId = FName(*FString::Printf(TEXT("Benchmark.Param%05d"), ParameterIndex));
+		Parameter.DisplayName = FString::Printf(TEXT("Benchmark Param %d"), ParameterIndex);
+		Parameter.Layer = static_cast<ETuningLayer>(Stream.RandRange(0, NumLayers - 1));
+		Parameter.Category = FString::Printf(TEXT("%s.Group%02d"), Categories[Stream.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(Categories)) - 1)], Stream.RandRange(0, 15));
+
+		const float TypeRoll = Stream.FRand();
+		const ETuningValueType ValueType = TypeRoll < 0.7f ? ETuningValueType::Float
+			: TypeRoll < 0.9f ? ETuningValueType::Integer
+			: ETuningValueType::Boolean;
+
+		Parameter.DefaultValue = MakeRandomValue(ValueType, Stream);
+		Parameter.CurrentValue = Parameter.DefaultValue;
+
+		// 計測中の変更で警告が出ない閾値（Boolは変化率が意味を持たない）
+		Parameter.Threshold.MaxChangePercent = 1000.0f;
+		Parameter.Threshold.bEnabled = ValueType != ETuningValueType::Boolean;
+
+		const int32 NumTags = Stream.RandRange(1, 3);
+		for (int32 TagIndex = 0; TagIndex < NumTags; ++TagIndex)
+		{
+			Parameter.Tags.AddUnique(Tags[Stream.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(Tags)) - 1)]);
+		}
+
+		// 5%はプロパティへ適用
+		if (ParameterIndex % 20 == 0)
+		{
+			Parameter.TargetObjectPath = TargetPath;
+			Parameter.TargetPropertyName = ValueType == ETuningValueType::Float ? TEXT("TuningFloat")
+				: ValueType == ETuningValueType::Integer ? TEXT("TuningInt")
+				: TEXT("bTuningBool");
+		}
+	}
+}
+
+FTuningValue FDevToolsBenchmarkFixtures::MakeRandomValue(ETuningValueType ValueType, FRandomStream& Stream)
+{
+	FTuningValue Value;
+	Value.ValueType = ValueType;
+
+	switch (ValueType)
+	{
+	case ETuningValueType::Integer:
+		Value.IntValue = Stream.RandRange(20, 80);
+		break;
+	case ETuningValueType::Boolean:
+		Value.BoolValue = Stream.FRand() < 0.5f;
+		break;
+	default:
+		Value.FloatValue = Stream.FRandRange(20.0f, 80.0f);
+		break;
+	}
+	return Value;
+}
+
+// ========== アクター ==========
+
+UWorld* FDevToolsBenchmarkFixtures::CreateActorWorld()
+{
+	DestroyActorWorld();
+
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("DevToolsBenchmarkWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+
+	// ゲームモード無しでBeginPlayを開始（以降に生成したアクターもBeginPlayする）
+	World->GetWorldSettings()->NotifyBeginPlay();
+	if (UAISystemBase* AISystem = World->GetAISystem())
+	{
+		AISystem->StartPlay();
+	}
+
+	BehaviorTree.Reset(CreateBehaviorTree());
+	Effect.Reset(CreateGameplayEffect());
+
+	FRandomStream Stream(Settings.Seed);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 ActorIndex = 0; ActorIndex < Settings.NumActors; ++ActorIndex)
+	{
+		const FVector Location(Stream.FRandRange(-50000.0f, 50000.0f), Stream.FRandRange(-50000.0f, 50000.0f), 0.0f);
+		ACharacter* Character = World->SpawnActor<ACharacter>(ACharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParameters);
+		if (!Character)
+		{
+			continue;
+		}
+
+		Character->GetCharacterMovement()->GravityScale = 0.0f;
+		Character->Tags.Add(ActorTag);
+
+		UAbilitySystemComponent* AbilitySystem = NewObject<UAbilitySystemComponent>(Character, TEXT("AbilitySystem"));
+		AbilitySystem->RegisterComponent();
+		AbilitySystem->InitAbilityActorInfo(Character, Character);
+
+		FActorFixture& Fixture = ActorFixtures.AddDefaulted_GetRef();
+		Fixture.Actor = Character;
+		Fixture.AbilitySystem = AbilitySystem;
+
+		const int32 NumAbilities = Stream.RandRange(1, 8);
+		for (int32 AbilityIndex = 0; AbilityIndex < NumAbilities; ++AbilityIndex)
+		{
+			Fixture.Abilities.Add(AbilitySystem->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass(), 1)));
+		}
+
+		const int32 NumEffects = Stream.RandRange(0, 4);
+		for (int32 EffectIndex = 0; EffectIndex < NumEffects; ++EffectIndex)
+		{
+			const FGameplayEffectSpec Spec(Effect.Get(), AbilitySystem->MakeEffectContext(), 1.0f);
+			Fixture.Effects.Add(AbilitySystem->ApplyGameplayEffectSpecToSelf(Spec));
+		}
+
+		// 半数はビヘイビアツリーを実行
+		if (ActorIndex % 2 == 0)
+		{
+			AAIController* Controller = World->SpawnActor<AAIController>(AAIController::StaticClass(), Location, FRotator::ZeroRotator, SpawnParameters);
+			if (Controller)
+			{
+				Controller->Possess(Character);
+				Controller->RunBehaviorTree(BehaviorTree.Get());
+				Fixture.Blackboard = Controller->GetBlackboardComponent();
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark] Spawned %d actors"), ActorFixtures.Num());
+	return World;
+}
+
+void FDevToolsBenchmarkFixtures::DestroyActorWorld()
+{
+	ActorFixtures.Reset();
+
+	if (World)
+	{
+		World->BeginTearingDown();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+		World = nullptr;
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	BehaviorTree.Reset();
+	Effect.Reset();
+}
+
+UBehaviorTree* FDevToolsBenchmarkFixtures::CreateBehaviorTree() const
+{
+	UBlackboardData* Blackboard = NewObject<UBlackboardData>(GetTransientPackage(), TEXT("BB_DevToolsBenchmark"));
+
+	auto AddKey = [Blackboard](FName KeyName, UBlackboardKeyType* KeyType)
+	{
+		FBlackboardEntry& Entry = Blackboard->Keys.AddDefaulted_GetRef();
+		Entry.EntryName = KeyName;
+		Entry.KeyType = KeyType;
+	};
+	AddKey(ScoreKey, NewObject<UBlackboardKeyType_Float>(Blackboard));
+	AddKey(TargetLocationKey, NewObject<UBlackboardKeyType_Vector>(Blackboard));
+	AddKey(AlertedKey, NewObject<UBlackboardKeyType_Bool>(Blackboard));
+	AddKey(TargetActorKey, NewObject<UBlackboardKeyType_Object>(Blackboard));
+
+	UBehaviorTree* Tree = NewObject<UBehaviorTree>(GetTransientPackage(), TEXT("BT_DevToolsBenchmark"));
+	Tree->BlackboardAsset = Blackboard;
+
+	UBTComposite_Sequence* Sequence = NewObject<UBTComposite_Sequence>(Tree);
+	for (int32 TaskIndex = 0; TaskIndex < 2; ++TaskIndex)
+	{
+		FBTCompositeChild& Child = Sequence->Children.AddDefaulted_GetRef();
+		Child.ChildTask = NewObject<UBTTask_Wait>(Tree);
+	}
+	Tree->RootNode = Sequence;
+
+	return Tree;
+}
+
+UGameplayEffect* FDevToolsBenchmarkFixtures::CreateGameplayEffect() const
+{
+	UGameplayEffect* NewEffect = NewObject<UGameplayEffect>(GetTransientPackage(), TEXT("GE_DevToolsBenchmark"));
+	NewEffect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+	return NewEffect;
+}
+
+void FDevToolsBenchmarkFixtures::ApplyActorChurn(FRandomStream& Stream, float Fraction)
+{
+	for (FActorFixture& Fixture : ActorFixtures)
+	{
+		if (Stream.FRand() >= Fraction)
+		{
+			continue;
+		}
+
+		AActor* Actor = Fixture.Actor.Get();
+		UAbilitySystemComponent* AbilitySystem = Fixture.AbilitySystem.Get();
+		if (!Actor || !AbilitySystem)
+		{
+			continue;
+		}
+
+		switch (Stream.RandRange(0, 3))
+		{
+		case 0:
+		{
+			// アビリティの起動・キャンセル
+			const FGameplayAbilitySpecHandle Handle = Fixture.Abilities[Stream.RandRange(0, Fixture.Abilities.Num() - 1)];
+			const FGameplayAbilitySpec* Spec = AbilitySystem->FindAbilitySpecFromHandle(Handle);
+			if (Spec && Spec->IsActive())
+			{
+				AbilitySystem->CancelAbilityHandle(Handle);
+			}
+			else
+			{
+				AbilitySystem->TryActivateAbility(Handle);
+			}
+			break;
+		}
+		case 1:
+		{
+			// エフェクトの付与・解除
+			if (Fixture.Effects.Num() > 0 && Stream.FRand() < 0.5f)
+			{
+				AbilitySystem->RemoveActiveGameplayEffect(Fixture.Effects.Pop());
+			}
+			else
+			{
+				const FGameplayEffectSpec Spec(Effect.Get(), AbilitySystem->MakeEffectContext(), 1.0f);
+				Fixture.Effects.Add(AbilitySystem->ApplyGameplayEffectSpecToSelf(Spec));
+			}
+			break;
+		}
+		case 2:
+		{
+			// ブラックボードの値
+			if (UBlackboardComponent* Blackboard = Fixture.Blackboard.Get())
+			{
+				Blackboard->SetValueAsFloat(ScoreKey, Stream.FRandRange(0.0f, 100.0f));
+				Blackboard->SetValueAsVector(TargetLocationKey, Actor->GetActorLocation() + FVector(Stream.FRandRange(-500.0f, 500.0f), Stream.FRandRange(-500.0f, 500.0f), 0.0f));
+				Blackboard->SetValueAsBool(AlertedKey, Stream.FRand() < 0.5f);
+			}
+			break;
+		}
+		default:
+			// 移動（距離による優先度が変わる）
+			Actor->AddActorWorldOffset(FVector(Stream.FRandRange(-100.0f, 100.0f), Stream.FRandRange(-100.0f, 100.0f), 0.0f));
+			break;
+		}
+	}
+}
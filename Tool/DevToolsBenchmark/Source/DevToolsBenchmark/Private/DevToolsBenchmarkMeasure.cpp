@@ -0,0 +1,148 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "DevToolsBenchmarkMeasure.h"
+#include "Async/Async.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace DevToolsBenchmark
+{
+	/** メモリのサンプリング間隔（秒） */
+	constexpr float MemorySampleInterval = 0.002f;
+
+	double ToMegabytes(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+}
+
+FDevToolsBenchmarkMeasure::FDevToolsBenchmarkMeasure(const FString& InName, const FString& InUnit, int32 InItemsPerSample, int32 InWarmupSamples)
+	: Name(InName)
+	, Unit(InUnit)
+	, ItemsPerSample(FMath::Max(1, InItemsPerSample))
+	, WarmupSamples(FMath::Max(0, InWarmupSamples))
+{
+}
+
+FDevToolsBenchmarkMeasure::~FDevToolsBenchmarkMeasure()
+{
+	// End前に破棄された場合もスレッドは止める
+	bSampling = false;
+	if (SamplerFuture.IsValid())
+	{
+		SamplerFuture.Wait();
+	}
+}
+
+void FDevToolsBenchmarkMeasure::Begin()
+{
+	// 前の計測の一時オブジェクトを基準に含めない
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	Samples.Reset();
+	BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	PeakUsedPhysical = BaselineUsedPhysical;
+
+	// ブロッキングする処理の途中のピークも拾うため専用スレッドで定期的に読む
+	bSampling = true;
+	SamplerFuture = Async(EAsyncExecution::Thread, [this]()
+	{
+		while (bSampling)
+		{
+			UpdatePeakMemory();
+			FPlatformProcess::Sleep(DevToolsBenchmark::MemorySampleInterval);
+		}
+	});
+}
+
+void FDevToolsBenchmarkMeasure::AddSample(double Seconds)
+{
+	Samples.Add(Seconds);
+	UpdatePeakMemory();
+}
+
+FDevToolsBenchmarkResult FDevToolsBenchmarkMeasure::End()
+{
+	bSampling = false;
+	if (SamplerFuture.IsValid())
+	{
+		SamplerFuture.Wait();
+		SamplerFuture = TFuture<void>();
+	}
+	UpdatePeakMemory();
+
+	FDevToolsBenchmarkResult Result;
+	Result.Name = Name;
+	Result.Unit = Unit;
+	Result.ItemsPerSample = ItemsPerSample;
+	Result.BaselineUsedMB = DevToolsBenchmark::ToMegabytes(BaselineUsedPhysical);
+	Result.PeakUsedMB = DevToolsBenchmark::ToMegabytes(PeakUsedPhysical);
+	Result.PeakDeltaMB = DevToolsBenchmark::ToMegabytes(PeakUsedPhysical - BaselineUsedPhysical);
+
+	if (Samples.Num() == 0)
+	{
+		return Result;
+	}
+	Result.FirstMs = Samples[0] * 1000.0;
+
+	// ウォームアップしか無い場合はそれを計測値とする
+	const int32 FirstMeasured = Samples.Num() > WarmupSamples ? WarmupSamples : 0;
+	TArray<double> Measured(Samples.GetData() + FirstMeasured, Samples.Num() - FirstMeasured);
+	Measured.Sort();
+
+	for (double Seconds : Measured)
+	{
+		Result.TotalSeconds += Seconds;
+	}
+
+	Result.Samples = Measured.Num();
+	Result.ItemsPerSecond = Result.TotalSeconds > 0.0 ? static_cast<double>(ItemsPerSample) * Measured.Num() / Result.TotalSeconds : 0.0;
+	Result.MinMs = Measured[0] * 1000.0;
+	Result.MeanMs = Result.TotalSeconds / Measured.Num() * 1000.0;
+	Result.P50Ms = Percentile(Measured, 50.0) * 1000.0;
+	Result.P90Ms = Percentile(Measured, 90.0) * 1000.0;
+	Result.P99Ms = Percentile(Measured, 99.0) * 1000.0;
+	Result.MaxMs = Measured.Last() * 1000.0;
+
+	UE_LOG(LogTemp, Display, TEXT("[DevToolsBenchmark] %-48s %8d x %-6d %12.1f %s/s  p50 %9.3f ms  p99 %9.3f ms  first %9.3f ms  peak +%.1f MB"),
+		*Result.Name, Result.Samples, Result.ItemsPerSample, Result.ItemsPerSecond, *Result.Unit,
+		Result.P50Ms, Result.P99Ms, Result.FirstMs, Result.PeakDeltaMB);
+
+	return Result;
+}
+
+FDevToolsBenchmarkResult FDevToolsBenchmarkMeasure::Run(const FString& Name, const FString& Unit, int32 ItemsPerSample, int32 WarmupSamples, int32 NumSamples, TFunctionRef<void(int32)> Function)
+{
+	FDevToolsBenchmarkMeasure Measure(Name, Unit, ItemsPerSample, WarmupSamples);
+	Measure.Begin();
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		Measure.Sample([&Function, SampleIndex]()
+		{
+			Function(SampleIndex);
+		});
+	}
+	return Measure.End();
+}
+
+double FDevToolsBenchmarkMeasure::Percentile(const TArray<double>& SortedSamples, double Percent)
+{
+	if (SortedSamples.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	const int32 Rank = FMath::CeilToInt(Percent / 100.0 * SortedSamples.Num());
+	return SortedSamples[FMath::Clamp(Rank - 1, 0, SortedSamples.Num() - 1)];
+}
+
+void FDevToolsBenchmarkMeasure::UpdatePeakMemory()
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+	uint64 CurrentPeak = PeakUsedPhysical.load();
+	while (UsedPhysical > CurrentPeak && !PeakUsedPhysical.compare_exchange_weak(CurrentPeak, UsedPhysical))
+	{
+	}
+}
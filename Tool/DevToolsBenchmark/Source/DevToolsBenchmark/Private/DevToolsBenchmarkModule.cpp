@@ -0,0 +1,6 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+// コマンドレットのみを提供するため、モジュールの処理は持たない
+IMPLEMENT_MODULE(FDefaultModuleImpl, DevToolsBenchmark)
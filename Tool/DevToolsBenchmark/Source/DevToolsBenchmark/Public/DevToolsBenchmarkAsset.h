@@ -0,0 +1,44 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DevToolsBenchmarkAsset.generated.h"
+
+/**
+ * ベンチマーク用の合成アセット
+ * 依存グラフの形（ハード・ソフト参照）とメモリコスト（ペイロード）を生成側で決められる
+ * チューニングのベンチマークではプロパティの適用先としても使う
+ */
+UCLASS(NotBlueprintable)
+class DEVTOOLSBENCHMARK_API UDevToolsBenchmarkAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** ハード参照（パッケージのハード依存になる） */
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	TArray<TObjectPtr<UObject>> References;
+
+	/** ソフト参照（パッケージのソフト依存になる） */
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	TArray<TSoftObjectPtr<UObject>> SoftReferences;
+
+	/** メモリコスト用のデータ */
+	UPROPERTY()
+	TArray<uint8> Payload;
+
+	/** チューニングの適用先 */
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float TuningFloat = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 TuningInt = 0;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	bool bTuningBool = false;
+
+	// UObject
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+};
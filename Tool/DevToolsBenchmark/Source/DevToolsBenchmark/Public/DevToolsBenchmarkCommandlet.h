@@ -0,0 +1,63 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DevToolsBenchmarkTypes.h"
+#include "DevToolsBenchmarkCommandlet.generated.h"
+
+class FDevToolsBenchmarkFixtures;
+
+/**
+ * DevToolsのホットパスのベンチマーク
+ * 合成データ（アセット・Blueprint・チューニングパラメータ・GAS/BTアクター）を生成し、
+ * 各処理のスループット・レイテンシのパーセンタイル・使用メモリの最大値をJSONへ書き出す
+ * ベースラインを指定した場合は中央値の悪化を検出して終了コード1を返す
+ *
+ *   UnrealEditor-Cmd.exe Project.uproject -run=DevToolsBenchmark [-Suites=AssetCost,Blueprint,Tuning,DebugCollector] [-Output=File.json] [-Baseline=File.json] -nullrhi
+ */
+UCLASS()
+class DEVTOOLSBENCHMARK_API UDevToolsBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDevToolsBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** 実行オプション */
+	struct FRunOptions
+	{
+		/** 分析系のサンプル数 */
+		int32 Iterations = 3;
+
+		/** 依存ツリーの起点数 */
+		int32 NumRoots = 200;
+
+		/** チューニングの値変更の回数 */
+		int32 NumOperations = 10000;
+
+		/** 収集のフレーム数 */
+		int32 NumFrames = 600;
+	};
+
+	/** アセットコスト分析・依存グラフ */
+	void RunAssetCostSuite(const FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report);
+
+	/** Blueprint複雑度分析 */
+	void RunBlueprintSuite(const FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report);
+
+	/** チューニング（登録・値変更・トランザクション・プリセット） */
+	void RunTuningSuite(FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report);
+
+	/** デバッグパネルの収集（変更通知・ポーリング） */
+	void RunDebugCollectorSuite(FDevToolsBenchmarkFixtures& Fixtures, const FRunOptions& Options, FDevToolsBenchmarkReport& Report);
+
+	/** ベースラインと比較（悪化した計測の数を返す） */
+	static int32 CompareWithBaseline(const FDevToolsBenchmarkReport& Report, const FString& BaselinePath, double Tolerance);
+};
@@ -0,0 +1,142 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "DevToolsBenchmarkTypes.h"
+
+class AActor;
+class UAbilitySystemComponent;
+class UBehaviorTree;
+class UBlackboardComponent;
+class UBlueprint;
+class UDevToolsBenchmarkAsset;
+class UGameplayEffect;
+class UPackage;
+class UWorld;
+struct FTuningParameter;
+struct FTuningValue;
+enum class ETuningValueType : uint8;
+
+/**
+ * ベンチマーク用の合成データ
+ * - コンテンツ: 依存グラフ（循環を含む）を持つアセットとBlueprintを一時フォルダへ保存し、レジストリへ登録する
+ * - チューニング: レイヤー・カテゴリ・タグ・型を散らしたパラメータ（一部はプロパティへ適用）
+ * - アクター: GASを持つキャラクター（半数はAIコントローラーでビヘイビアツリーを実行）を配置したゲームワールド
+ * 同じ設定（シード）なら同じデータを生成する
+ */
+class DEVTOOLSBENCHMARK_API FDevToolsBenchmarkFixtures
+{
+public:
+	explicit FDevToolsBenchmarkFixtures(const FDevToolsBenchmarkFixtureSettings& InSettings);
+	~FDevToolsBenchmarkFixtures();
+
+	/** 監視対象のアクターに付けるタグ */
+	static const FName ActorTag;
+
+	// ========== コンテンツ ==========
+
+	/** 合成コンテンツのルート（/Game/__DevToolsBenchmark__） */
+	static FString GetContentRoot();
+
+	/** アセット・Blueprintのフォルダ */
+	static FString GetAssetRoot();
+	static FString GetBlueprintRoot();
+
+	/** アセットとBlueprintを生成して保存し、レジストリへ登録（残っている合成コンテンツはレジストリのスキャン前にDeleteContentで消しておく） */
+	bool CreateContent();
+
+	/** 合成コンテンツをアンロードしてファイルを削除 */
+	void DeleteContent();
+
+	/** 生成したパッケージ名 */
+	const TArray<FName>& GetAssetPackages() const { return AssetPackages; }
+	const TArray<FName>& GetBlueprintPackages() const { return BlueprintPackages; }
+
+	// ========== チューニング ==========
+
+	/** パラメータを生成 */
+	void MakeTuningParameters(TArray<FTuningParameter>& OutParameters);
+
+	/** 型に合った値（警告の閾値内） */
+	static FTuningValue MakeRandomValue(ETuningValueType ValueType, FRandomStream& Stream);
+
+	// ========== アクター ==========
+
+	/** アクターを配置したゲームワールドを生成（BeginPlay済み） */
+	UWorld* CreateActorWorld();
+
+	/** ワールドを破棄 */
+	void DestroyActorWorld();
+
+	/** 生成したワールド */
+	UWorld* GetActorWorld() const { return World; }
+
+	/** 生成したアクター数 */
+	int32 GetNumActors() const { return ActorFixtures.Num(); }
+
+	/** 1フレーム分の状態変化を起こす（Fraction割合のアクターでアビリティ・エフェクト・ブラックボード・位置のいずれかを変える） */
+	void ApplyActorChurn(FRandomStream& Stream, float Fraction);
+
+private:
+	/** アクター1体分の生成内容 */
+	struct FActorFixture
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystem;
+		TWeakObjectPtr<UBlackboardComponent> Blackboard;
+		TArray<FGameplayAbilitySpecHandle> Abilities;
+		TArray<FActiveGameplayEffectHandle> Effects;
+	};
+
+	/** アセットを生成（パッケージを追加） */
+	void CreateAssets(FRandomStream& Stream, TArray<UPackage*>& OutPackages);
+
+	/** Blueprintを生成してコンパイル（パッケージを追加） */
+	void CreateBlueprints(FRandomStream& Stream, TArray<UPackage*>& OutPackages);
+
+	/** イベントグラフにノードを並べる（BeginPlayから実行ピンで連結、bUseTickならTickも） */
+	static void PopulateEventGraph(UBlueprint* Blueprint, int32 NumNodes, bool bUseTick, FRandomStream& Stream);
+
+	/** 他のBlueprintのクラスを型にした変数を追加（パッケージのハード依存になる） */
+	static void AddClassReference(UBlueprint* Blueprint, const UBlueprint* Referenced);
+
+	/** パッケージを保存（保存したファイル名を追加） */
+	static bool SavePackages(const TArray<UPackage*>& Packages, TArray<FString>& OutFilenames);
+
+	/** 合成コンテンツのパッケージをアンロード */
+	static void UnloadContentPackages();
+
+	/** 合成コンテンツのディスク上のフォルダ */
+	static FString GetContentDirectory();
+
+	/** フォルダ内の連番のパッケージ名（256件ごとにサブフォルダ） */
+	static FString MakePackageName(const FString& Root, const TCHAR* Prefix, int32 Index);
+
+	/** ビヘイビアツリー（シーケンス + 待機、ブラックボード付き） */
+	UBehaviorTree* CreateBehaviorTree() const;
+
+	/** 無期限のエフェクト */
+	UGameplayEffect* CreateGameplayEffect() const;
+
+	/** 規模 */
+	FDevToolsBenchmarkFixtureSettings Settings;
+
+	/** 生成したパッケージ名 */
+	TArray<FName> AssetPackages;
+	TArray<FName> BlueprintPackages;
+
+	/** チューニングの適用先（一時オブジェクト） */
+	TStrongObjectPtr<UDevToolsBenchmarkAsset> TuningTarget;
+
+	/** 生成したワールドと配置したアクター */
+	UWorld* World = nullptr;
+	TArray<FActorFixture> ActorFixtures;
+
+	/** アクターが使う一時アセット */
+	TStrongObjectPtr<UBehaviorTree> BehaviorTree;
+	TStrongObjectPtr<UGameplayEffect> Effect;
+};
@@ -0,0 +1,70 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "DevToolsBenchmarkTypes.h"
+#include <atomic>
+
+/**
+ * 1つのホットパスの計測
+ * サンプルごとの経過時間からスループットとパーセンタイルを求め、計測中は専用スレッドで使用物理メモリの最大値を記録する
+ * 最初のWarmupSamples件はFirstMsにのみ反映し、パーセンタイル・スループットからは除く（キャッシュが空の状態を別に見るため）
+ */
+class DEVTOOLSBENCHMARK_API FDevToolsBenchmarkMeasure
+{
+public:
+	FDevToolsBenchmarkMeasure(const FString& InName, const FString& InUnit, int32 InItemsPerSample, int32 InWarmupSamples = 0);
+	~FDevToolsBenchmarkMeasure();
+
+	/** 計測開始（GC後の使用メモリを基準にし、メモリのサンプリングを開始） */
+	void Begin();
+
+	/** 1サンプル分の処理を計測 */
+	template <typename FunctionType>
+	void Sample(FunctionType&& Function)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Function();
+		AddSample(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+	}
+
+	/** 計測済みの経過時間を追加 */
+	void AddSample(double Seconds);
+
+	/** 計測終了（サンプリングを止めて結果を返す） */
+	FDevToolsBenchmarkResult End();
+
+	/**
+	 * Begin → Function(サンプル番号)をNumSamples回 → End
+	 */
+	static FDevToolsBenchmarkResult Run(const FString& Name, const FString& Unit, int32 ItemsPerSample, int32 WarmupSamples, int32 NumSamples, TFunctionRef<void(int32)> Function);
+
+	/** ソート済みのサンプルのパーセンタイル（最近傍順位法） */
+	static double Percentile(const TArray<double>& SortedSamples, double Percent);
+
+private:
+	/** 使用物理メモリを最大値へ反映 */
+	void UpdatePeakMemory();
+
+	FString Name;
+	FString Unit;
+	int32 ItemsPerSample = 1;
+	int32 WarmupSamples = 0;
+
+	/** サンプル（秒、ウォームアップを含む） */
+	TArray<double> Samples;
+
+	/** 計測開始時の使用物理メモリ（バイト） */
+	uint64 BaselineUsedPhysical = 0;
+
+	/** 計測中の使用物理メモリの最大値（サンプリングスレッドからも更新） */
+	std::atomic<uint64> PeakUsedPhysical { 0 };
+
+	/** サンプリング中か */
+	std::atomic<bool> bSampling { false };
+
+	/** サンプリングスレッド */
+	TFuture<void> SamplerFuture;
+};
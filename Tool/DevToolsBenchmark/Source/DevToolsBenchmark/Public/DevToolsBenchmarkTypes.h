@@ -0,0 +1,154 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DevToolsBenchmarkTypes.generated.h"
+
+/**
+ * 1つのホットパスの計測結果
+ */
+USTRUCT()
+struct DEVTOOLSBENCHMARK_API FDevToolsBenchmarkResult
+{
+	GENERATED_BODY()
+
+	/** 計測名（"スイート.処理"、前回の結果との照合に使用） */
+	UPROPERTY()
+	FString Name;
+
+	/** 処理単位（assets, parameters, actors等） */
+	UPROPERTY()
+	FString Unit;
+
+	/** 計測したサンプル数（ウォームアップを除く） */
+	UPROPERTY()
+	int32 Samples = 0;
+
+	/** 1サンプルあたりの処理数 */
+	UPROPERTY()
+	int32 ItemsPerSample = 0;
+
+	/** 計測したサンプルの合計時間（秒） */
+	UPROPERTY()
+	double TotalSeconds = 0.0;
+
+	/** スループット（処理数/秒） */
+	UPROPERTY()
+	double ItemsPerSecond = 0.0;
+
+	/** 最初のサンプル（キャッシュが空の状態、ウォームアップを含む） */
+	UPROPERTY()
+	double FirstMs = 0.0;
+
+	/** レイテンシ（ミリ秒、ウォームアップを除く） */
+	UPROPERTY()
+	double MinMs = 0.0;
+
+	UPROPERTY()
+	double MeanMs = 0.0;
+
+	UPROPERTY()
+	double P50Ms = 0.0;
+
+	UPROPERTY()
+	double P90Ms = 0.0;
+
+	UPROPERTY()
+	double P99Ms = 0.0;
+
+	UPROPERTY()
+	double MaxMs = 0.0;
+
+	/** 計測開始時の使用物理メモリ（MB、GC後） */
+	UPROPERTY()
+	double BaselineUsedMB = 0.0;
+
+	/** 計測中の使用物理メモリの最大値（MB） */
+	UPROPERTY()
+	double PeakUsedMB = 0.0;
+
+	/** 計測開始時からの増加の最大値（MB） */
+	UPROPERTY()
+	double PeakDeltaMB = 0.0;
+};
+
+/**
+ * 合成データの規模
+ */
+USTRUCT()
+struct DEVTOOLSBENCHMARK_API FDevToolsBenchmarkFixtureSettings
+{
+	GENERATED_BODY()
+
+	/** 依存グラフ用のアセット数（テクスチャを含む） */
+	UPROPERTY()
+	int32 NumAssets = 2000;
+
+	/** Blueprint数 */
+	UPROPERTY()
+	int32 NumBlueprints = 1000;
+
+	/** チューニングパラメータ数 */
+	UPROPERTY()
+	int32 NumParameters = 10000;
+
+	/** 監視するアクター数（GAS、半数はビヘイビアツリーも実行） */
+	UPROPERTY()
+	int32 NumActors = 300;
+
+	/** 乱数シード（同じ値なら同じデータを生成） */
+	UPROPERTY()
+	int32 Seed = 1234;
+};
+
+/**
+ * ベンチマークの結果ファイル
+ */
+USTRUCT()
+struct DEVTOOLSBENCHMARK_API FDevToolsBenchmarkReport
+{
+	GENERATED_BODY()
+
+	/** ファイル形式のバージョン（項目の意味を変えたら更新） */
+	UPROPERTY()
+	int32 FormatVersion = 1;
+
+	/** 実行日時（UTC、ISO 8601） */
+	UPROPERTY()
+	FString Timestamp;
+
+	UPROPERTY()
+	FString EngineVersion;
+
+	UPROPERTY()
+	FString BuildConfiguration;
+
+	UPROPERTY()
+	FString Platform;
+
+	UPROPERTY()
+	FString MachineName;
+
+	UPROPERTY()
+	FString CPUBrand;
+
+	UPROPERTY()
+	int32 NumCores = 0;
+
+	/** 合成データの規模 */
+	UPROPERTY()
+	FDevToolsBenchmarkFixtureSettings Fixture;
+
+	UPROPERTY()
+	TArray<FDevToolsBenchmarkResult> Results;
+
+	/** 名前で結果を検索 */
+	const FDevToolsBenchmarkResult* FindResult(const FString& ResultName) const
+	{
+		return Results.FindByPredicate([&ResultName](const FDevToolsBenchmarkResult& Result)
+		{
+			return Result.Name == ResultName;
+		});
+	}
+};
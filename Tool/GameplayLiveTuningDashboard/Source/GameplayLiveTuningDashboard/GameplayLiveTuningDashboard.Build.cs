@@ -35,7 +35,8 @@ public class GameplayLiveTuningDashboard : ModuleRules
 				"LevelEditor",
 				"PropertyEditor",
 				"Json",
-				"JsonUtilities"
+				"JsonUtilities",
+				"GameplayLiveTuningRuntime"
 			}
 		);
 
@@ -13,6 +13,7 @@
 #include "Widgets/Input/SSpinBox.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Views/STableRow.h"
 #include "EditorStyleSet.h"
@@ -208,8 +209,9 @@ void STuningDashboardPanel::Construct(const FArguments& InArgs)
 	// イベント購読
 	if (TuningSubsystem)
 	{
-		OnParameterChangedHandle = TuningSubsystem->OnParameterChanged.AddLambda(
-			[this](FName ParameterId, const FTuningValue& NewValue)
+		// 変更はトランザクション単位でまとめて通知されるため、ドラッグ中は再構築しない
+		OnParametersChangedHandle = TuningSubsystem->OnParametersChangedNative.AddLambda(
+			[this](const TArray<FName>& ParameterIds)
 			{
 				RefreshParameterList();
 				RefreshHistoryList();
@@ -223,7 +225,13 @@ STuningDashboardPanel::~STuningDashboardPanel()
 {
 	if (TuningSubsystem)
 	{
-		TuningSubsystem->OnParameterChanged.Remove(OnParameterChangedHandle);
+		TuningSubsystem->OnParametersChangedNative.Remove(OnParametersChangedHandle);
+
+		// ドラッグ中にパネルが閉じられた場合はそこまでの変更を確定
+		if (bSliderTransactionActive)
+		{
+			TuningSubsystem->CommitTransaction();
+		}
 	}
 }
 
@@ -259,6 +267,31 @@ TSharedRef<SWidget> STuningDashboardPanel::BuildToolbar()
 			.OnClicked(this, &STuningDashboardPanel::OnEndSessionClicked)
 		]
 
+		// リモートチューニング
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(8.0f, 2.0f, 2.0f, 2.0f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(SCheckBox)
+			.IsChecked(this, &STuningDashboardPanel::GetRemoteHostCheckState)
+			.OnCheckStateChanged(this, &STuningDashboardPanel::OnRemoteHostCheckStateChanged)
+			.ToolTipText(LOCTEXT("RemoteHostTooltip", "接続したゲームインスタンス（-TuningHost=アドレス -TuningToken=トークン で起動）へ変更を送信"))
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("RemoteHost", "リモート待受"))
+			]
+		]
+
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(4.0f, 2.0f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(this, &STuningDashboardPanel::GetRemoteStatusText)
+		]
+
 		+ SHorizontalBox::Slot()
 		.FillWidth(1.0f)
 		[
@@ -397,6 +430,20 @@ TSharedRef<SWidget> STuningDashboardPanel::BuildParameterList()
 			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 		]
 
+		// 検索（ID・表示名・カテゴリの部分一致）
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+		[
+			SNew(SSearchBox)
+			.HintText(LOCTEXT("SearchParameters", "パラメータを検索"))
+			.OnTextChanged_Lambda([this](const FText& NewText)
+			{
+				ParameterSearchText = NewText.ToString();
+				RefreshParameterList();
+			})
+		]
+
 		+ SVerticalBox::Slot()
 		.FillHeight(1.0f)
 		[
@@ -525,12 +572,11 @@ TSharedRef<ITableRow> STuningDashboardPanel::OnGenerateParameterRow(TSharedPtr<F
 	// 変更状態を更新
 	if (TuningSubsystem)
 	{
-		FTuningParameter Param;
-		if (TuningSubsystem->GetParameter(Item->Parameter.ParameterId, Param))
+		if (const FTuningParameter* Param = TuningSubsystem->FindParameter(Item->Parameter.ParameterId))
 		{
-			Item->Parameter = Param;
-			Item->bIsModified = !FMath::IsNearlyZero(Param.CurrentValue.GetDifference(Param.DefaultValue));
-			Item->WarningLevel = Param.Threshold.CheckValue(Param.CurrentValue.GetAsFloat());
+			Item->Parameter = *Param;
+			Item->bIsModified = !FMath::IsNearlyZero(Param->CurrentValue.GetDifference(Param->DefaultValue));
+			Item->WarningLevel = Param->Threshold.CheckValue(Param->CurrentValue.GetAsFloat());
 		}
 	}
 
@@ -561,6 +607,7 @@ TSharedRef<ITableRow> STuningDashboardPanel::OnGenerateParameterRow(TSharedPtr<F
 			[
 				SNew(STextBlock)
 				.Text(FText::FromString(Item->Parameter.DisplayName))
+				.ToolTipText(this, &STuningDashboardPanel::GetRemoteAckTooltip, Item->Parameter.ParameterId)
 				.Font(Item->bIsModified
 					? FCoreStyle::GetDefaultFontStyle("Bold", 10)
 					: FCoreStyle::GetDefaultFontStyle("Regular", 10))
@@ -610,6 +657,11 @@ TSharedRef<SWidget> STuningDashboardPanel::CreateValueEditor(TSharedPtr<FTuningP
 			.Value(Value.FloatValue)
 			.MinValue(Item->Parameter.Threshold.CriticalMinValue)
 			.MaxValue(Item->Parameter.Threshold.CriticalMaxValue)
+			.OnBeginSliderMovement(this, &STuningDashboardPanel::OnSliderMovementBegin)
+			.OnEndSliderMovement_Lambda([this](float)
+			{
+				OnSliderMovementEnd();
+			})
 			.OnValueChanged_Lambda([this, ParamId](float NewValue)
 			{
 				OnParameterValueChanged(ParamId, NewValue);
@@ -622,6 +674,11 @@ TSharedRef<SWidget> STuningDashboardPanel::CreateValueEditor(TSharedPtr<FTuningP
 	case ETuningValueType::Integer:
 		return SNew(SSpinBox<int32>)
 			.Value(Value.IntValue)
+			.OnBeginSliderMovement(this, &STuningDashboardPanel::OnSliderMovementBegin)
+			.OnEndSliderMovement_Lambda([this](int32)
+			{
+				OnSliderMovementEnd();
+			})
 			.OnValueChanged_Lambda([this, ParamId](int32 NewValue)
 			{
 				if (TuningSubsystem)
@@ -714,7 +771,108 @@ void STuningDashboardPanel::OnLayerTabChanged(ETuningLayer NewLayer)
 
 void STuningDashboardPanel::OnParameterValueChanged(FName ParameterId, float NewValue)
 {
-	// リアルタイムプレビュー（コミット前）
+	// ドラッグ中はトランザクション内で即適用（リアルタイムプレビュー、履歴は終了時に1件）
+	if (TuningSubsystem && bSliderTransactionActive)
+	{
+		TuningSubsystem->SetFloatValue(ParameterId, NewValue);
+	}
+}
+
+ECheckBoxState STuningDashboardPanel::GetRemoteHostCheckState() const
+{
+	return TuningSubsystem && TuningSubsystem->IsRemoteHosting() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void STuningDashboardPanel::OnRemoteHostCheckStateChanged(ECheckBoxState NewState)
+{
+	if (!TuningSubsystem)
+	{
+		return;
+	}
+
+	if (NewState == ECheckBoxState::Checked)
+	{
+		TuningSubsystem->StartRemoteHost();
+	}
+	else
+	{
+		TuningSubsystem->StopRemote();
+	}
+}
+
+FText STuningDashboardPanel::GetRemoteStatusText() const
+{
+	if (!TuningSubsystem || !TuningSubsystem->IsRemoteHosting())
+	{
+		return FText::GetEmpty();
+	}
+
+	const TArray<FTuningRemoteTargetStatus> Targets = TuningSubsystem->GetRemoteTargets();
+	if (Targets.Num() == 0)
+	{
+		return FText::Format(LOCTEXT("RemoteNoTargets", "接続待ち（トークン: {0}）"), FText::FromString(TuningSubsystem->GetRemoteSessionToken()));
+	}
+
+	// ターゲットごとの最新の遅延（確認待ちがあれば件数）
+	TArray<FString> Parts;
+	for (const FTuningRemoteTargetStatus& Target : Targets)
+	{
+		FString Part = Target.LastLatencyMs >= 0.0f
+			? FString::Printf(TEXT("%s %.1fms"), *Target.TargetName, Target.LastLatencyMs)
+			: Target.TargetName;
+		if (Target.PendingBatchCount > 0)
+		{
+			Part += FString::Printf(TEXT(" (待ち%d)"), Target.PendingBatchCount);
+		}
+		Parts.Add(Part);
+	}
+
+	return FText::FromString(FString::Join(Parts, TEXT(" / ")));
+}
+
+FText STuningDashboardPanel::GetRemoteAckTooltip(FName ParameterId) const
+{
+	if (!TuningSubsystem)
+	{
+		return FText::GetEmpty();
+	}
+
+	const TArray<FTuningRemoteAck> Acks = TuningSubsystem->GetRemoteAcks(ParameterId);
+	if (Acks.Num() == 0)
+	{
+		return FText::GetEmpty();
+	}
+
+	TArray<FString> Lines;
+	for (const FTuningRemoteAck& Ack : Acks)
+	{
+		Lines.Add(FString::Printf(TEXT("%s: %s %s (%.1fms, %s)"),
+			*Ack.TargetName,
+			Ack.bApplied ? TEXT("反映") : TEXT("未反映"),
+			*Ack.AppliedValue.ToString(),
+			Ack.LatencyMs,
+			*Ack.AckTime.ToString(TEXT("%H:%M:%S"))));
+	}
+
+	return FText::FromString(FString::Join(Lines, TEXT("\n")));
+}
+
+void STuningDashboardPanel::OnSliderMovementBegin()
+{
+	if (TuningSubsystem && !bSliderTransactionActive)
+	{
+		TuningSubsystem->BeginTransaction(TEXT("Slider drag"));
+		bSliderTransactionActive = true;
+	}
+}
+
+void STuningDashboardPanel::OnSliderMovementEnd()
+{
+	if (TuningSubsystem && bSliderTransactionActive)
+	{
+		bSliderTransactionActive = false;
+		TuningSubsystem->CommitTransaction();
+	}
 }
 
 void STuningDashboardPanel::OnParameterValueCommitted(FName ParameterId, float NewValue, ETextCommit::Type CommitType)
@@ -787,8 +945,8 @@ FReply STuningDashboardPanel::OnExportClicked()
 			FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
 			TEXT("Export Tuning Data"),
 			FPaths::ProjectSavedDir(),
-			TEXT("TuningData.json"),
-			TEXT("JSON Files (*.json)|*.json"),
+			TEXT("TuningData.tuning"),
+			TEXT("Tuning Data (*.tuning)|*.tuning|JSON Files (*.json)|*.json"),
 			EFileDialogFlags::None,
 			SaveFilenames
 		);
@@ -816,7 +974,7 @@ FReply STuningDashboardPanel::OnImportClicked()
 			TEXT("Import Tuning Data"),
 			FPaths::ProjectSavedDir(),
 			TEXT(""),
-			TEXT("JSON Files (*.json)|*.json"),
+			TEXT("Tuning Data (*.tuning;*.json)|*.tuning;*.json"),
 			EFileDialogFlags::None,
 			OpenFilenames
 		);
@@ -860,10 +1018,24 @@ void STuningDashboardPanel::RefreshParameterList()
 
 	if (TuningSubsystem)
 	{
-		TArray<FTuningParameter> Params = TuningSubsystem->GetParametersByLayer(CurrentLayer);
-		for (const FTuningParameter& Param : Params)
+		if (ParameterSearchText.IsEmpty())
 		{
-			ParameterItems.Add(MakeShared<FTuningParameterItem>(Param));
+			for (const FName& ParamId : TuningSubsystem->GetParameterIndex().GetByLayer(CurrentLayer))
+			{
+				ParameterItems.Add(MakeShared<FTuningParameterItem>(*TuningSubsystem->FindParameter(ParamId)));
+			}
+		}
+		else
+		{
+			// 検索結果から現在のレイヤーのものだけを表示
+			for (const FName& ParamId : TuningSubsystem->SearchParameterIds(ParameterSearchText))
+			{
+				const FTuningParameter* Param = TuningSubsystem->FindParameter(ParamId);
+				if (Param && Param->Layer == CurrentLayer)
+				{
+					ParameterItems.Add(MakeShared<FTuningParameterItem>(*Param));
+				}
+			}
 		}
 	}
 
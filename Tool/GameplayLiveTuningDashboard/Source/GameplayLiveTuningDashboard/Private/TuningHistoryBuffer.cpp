@@ -0,0 +1,176 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningHistoryBuffer.h"
+
+FTuningHistoryBuffer::FTuningHistoryBuffer(int32 InCapacity)
+	: Capacity(FMath::Max(1, InCapacity))
+{
+}
+
+void FTuningHistoryBuffer::SetCapacity(int32 NewCapacity)
+{
+	NewCapacity = FMath::Max(1, NewCapacity);
+	if (NewCapacity == Capacity)
+	{
+		return;
+	}
+
+	// 残す範囲のエントリを新しい容量の位置へ移す
+	const int64 NewFirstSequence = FMath::Max(FirstSequence, EndSequence - NewCapacity);
+
+	int32 RequiredSlots = 0;
+	for (int64 Sequence = NewFirstSequence; Sequence < EndSequence; ++Sequence)
+	{
+		RequiredSlots = FMath::Max(RequiredSlots, static_cast<int32>(Sequence % NewCapacity) + 1);
+	}
+
+	TArray<FSlot> NewSlots;
+	NewSlots.SetNum(RequiredSlots);
+	for (int64 Sequence = NewFirstSequence; Sequence < EndSequence; ++Sequence)
+	{
+		NewSlots[static_cast<int32>(Sequence % NewCapacity)] = MoveTemp(Slots[GetSlotIndex(Sequence)]);
+	}
+
+	Slots = MoveTemp(NewSlots);
+	Capacity = NewCapacity;
+	FirstSequence = NewFirstSequence;
+
+	// 破棄したエントリを指すパラメータを除外
+	for (auto It = LatestByParameter.CreateIterator(); It; ++It)
+	{
+		if (It.Value() < FirstSequence)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int64 FTuningHistoryBuffer::Push(const FTuningHistoryEntry& Entry)
+{
+	if (Num() >= Capacity)
+	{
+		EvictOldest();
+	}
+
+	const int64 Sequence = EndSequence++;
+	const int32 SlotIndex = GetSlotIndex(Sequence);
+	if (SlotIndex >= Slots.Num())
+	{
+		Slots.SetNum(SlotIndex + 1);
+	}
+
+	int64& Latest = LatestByParameter.FindOrAdd(Entry.ParameterId, INDEX_NONE);
+
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Entry = Entry;
+	Slot.PrevSameParameter = Latest;
+	Latest = Sequence;
+
+	return Sequence;
+}
+
+bool FTuningHistoryBuffer::Pop(FTuningHistoryEntry& OutEntry)
+{
+	if (IsEmpty())
+	{
+		return false;
+	}
+
+	const int64 Sequence = --EndSequence;
+	FSlot& Slot = Slots[GetSlotIndex(Sequence)];
+
+	// パラメータの最新を直前のエントリに戻す
+	if (Slot.PrevSameParameter >= FirstSequence)
+	{
+		LatestByParameter.Add(Slot.Entry.ParameterId, Slot.PrevSameParameter);
+	}
+	else
+	{
+		LatestByParameter.Remove(Slot.Entry.ParameterId);
+	}
+
+	OutEntry = MoveTemp(Slot.Entry);
+	Slot.Entry = FTuningHistoryEntry();
+	Slot.PrevSameParameter = INDEX_NONE;
+	return true;
+}
+
+const FTuningHistoryEntry* FTuningHistoryBuffer::Last() const
+{
+	return IsEmpty() ? nullptr : &Slots[GetSlotIndex(EndSequence - 1)].Entry;
+}
+
+const FTuningHistoryEntry* FTuningHistoryBuffer::Find(int64 Sequence) const
+{
+	if (Sequence < FirstSequence || Sequence >= EndSequence)
+	{
+		return nullptr;
+	}
+	return &Slots[GetSlotIndex(Sequence)].Entry;
+}
+
+void FTuningHistoryBuffer::GetLatest(int32 MaxEntries, TArray<FTuningHistoryEntry>& OutEntries) const
+{
+	const int32 Count = FMath::Clamp(MaxEntries, 0, Num());
+	OutEntries.Reserve(OutEntries.Num() + Count);
+
+	for (int64 Sequence = EndSequence - 1; Sequence >= EndSequence - Count; --Sequence)
+	{
+		OutEntries.Add(Slots[GetSlotIndex(Sequence)].Entry);
+	}
+}
+
+void FTuningHistoryBuffer::GetLatestForParameter(FName ParameterId, int32 MaxEntries, TArray<FTuningHistoryEntry>& OutEntries) const
+{
+	const int64* Latest = LatestByParameter.Find(ParameterId);
+	if (!Latest)
+	{
+		return;
+	}
+
+	// 同じパラメータの連結を辿る（破棄済みに達したら終了）
+	int32 Added = 0;
+	for (int64 Sequence = *Latest; Sequence >= FirstSequence && Added < MaxEntries; ++Added)
+	{
+		const FSlot& Slot = Slots[GetSlotIndex(Sequence)];
+		OutEntries.Add(Slot.Entry);
+		Sequence = Slot.PrevSameParameter;
+	}
+}
+
+void FTuningHistoryBuffer::GetRange(int64 First, int64 End, TArray<FTuningHistoryEntry>& OutEntries) const
+{
+	First = FMath::Max(First, FirstSequence);
+	End = FMath::Min(End, EndSequence);
+	if (First >= End)
+	{
+		return;
+	}
+
+	OutEntries.Reserve(OutEntries.Num() + static_cast<int32>(End - First));
+	for (int64 Sequence = First; Sequence < End; ++Sequence)
+	{
+		OutEntries.Add(Slots[GetSlotIndex(Sequence)].Entry);
+	}
+}
+
+void FTuningHistoryBuffer::Reset()
+{
+	Slots.Empty();
+	LatestByParameter.Empty();
+	FirstSequence = EndSequence;
+}
+
+void FTuningHistoryBuffer::EvictOldest()
+{
+	FSlot& Slot = Slots[GetSlotIndex(FirstSequence)];
+
+	// 最古のエントリがパラメータの唯一の履歴なら索引から外す
+	const int64* Latest = LatestByParameter.Find(Slot.Entry.ParameterId);
+	if (Latest && *Latest == FirstSequence)
+	{
+		LatestByParameter.Remove(Slot.Entry.ParameterId);
+	}
+
+	++FirstSequence;
+}
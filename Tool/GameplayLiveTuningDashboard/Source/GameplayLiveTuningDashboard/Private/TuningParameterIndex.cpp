@@ -0,0 +1,201 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningParameterIndex.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+	/** 該当なし用の空リスト */
+	const TArray<FName> EmptyIds;
+
+	/** 検索対象テキスト（小文字、区切りは改行でトライグラムが跨がないようにする） */
+	FString MakeSearchText(const FTuningParameter& Parameter)
+	{
+		return FString::Printf(TEXT("%s\n%s\n%s"), *Parameter.ParameterId.ToString(), *Parameter.DisplayName, *Parameter.Category).ToLower();
+	}
+
+	uint32 MakeTrigram(const TCHAR* Chars)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(Chars[0]), GetTypeHash(Chars[1])), GetTypeHash(Chars[2]));
+	}
+}
+
+void FTuningParameterIndex::Add(const FTuningParameter& Parameter)
+{
+	LayerIndex.FindOrAdd(Parameter.Layer).Add(Parameter.ParameterId);
+	CategoryIndex.FindOrAdd(Parameter.Category).Add(Parameter.ParameterId);
+
+	for (const FString& Tag : Parameter.Tags)
+	{
+		TagIndex.FindOrAdd(Tag).AddUnique(Parameter.ParameterId);
+	}
+
+	// 検索スロット（空きがあれば再利用）
+	int32 SlotIndex = INDEX_NONE;
+	if (FreeSearchSlots.Num() > 0)
+	{
+		SlotIndex = FreeSearchSlots.Pop();
+	}
+	else
+	{
+		SlotIndex = SearchSlots.AddDefaulted();
+	}
+
+	FSearchSlot& Slot = SearchSlots[SlotIndex];
+	Slot.Id = Parameter.ParameterId;
+	Slot.Text = MakeSearchText(Parameter);
+	SearchSlotById.Add(Parameter.ParameterId, SlotIndex);
+
+	TSet<uint32> Trigrams;
+	GatherTrigrams(Slot.Text, Trigrams);
+	for (const uint32 Trigram : Trigrams)
+	{
+		TArray<int32>& Slots = TrigramIndex.FindOrAdd(Trigram);
+		Slots.Insert(SlotIndex, Algo::LowerBound(Slots, SlotIndex));
+	}
+}
+
+void FTuningParameterIndex::Remove(const FTuningParameter& Parameter)
+{
+	if (TArray<FName>* Ids = LayerIndex.Find(Parameter.Layer))
+	{
+		Ids->Remove(Parameter.ParameterId);
+	}
+
+	if (TArray<FName>* Ids = CategoryIndex.Find(Parameter.Category))
+	{
+		Ids->Remove(Parameter.ParameterId);
+		if (Ids->Num() == 0)
+		{
+			CategoryIndex.Remove(Parameter.Category);
+		}
+	}
+
+	for (const FString& Tag : Parameter.Tags)
+	{
+		if (TArray<FName>* Ids = TagIndex.Find(Tag))
+		{
+			Ids->Remove(Parameter.ParameterId);
+			if (Ids->Num() == 0)
+			{
+				TagIndex.Remove(Tag);
+			}
+		}
+	}
+
+	int32 SlotIndex = INDEX_NONE;
+	if (!SearchSlotById.RemoveAndCopyValue(Parameter.ParameterId, SlotIndex))
+	{
+		return;
+	}
+
+	FSearchSlot& Slot = SearchSlots[SlotIndex];
+
+	TSet<uint32> Trigrams;
+	GatherTrigrams(Slot.Text, Trigrams);
+	for (const uint32 Trigram : Trigrams)
+	{
+		if (TArray<int32>* Slots = TrigramIndex.Find(Trigram))
+		{
+			const int32 Position = Algo::BinarySearch(*Slots, SlotIndex);
+			if (Position != INDEX_NONE)
+			{
+				Slots->RemoveAt(Position);
+			}
+		}
+	}
+
+	Slot.Id = NAME_None;
+	Slot.Text.Reset();
+	FreeSearchSlots.Add(SlotIndex);
+}
+
+void FTuningParameterIndex::Reset()
+{
+	LayerIndex.Reset();
+	CategoryIndex.Reset();
+	TagIndex.Reset();
+	SearchSlots.Reset();
+	FreeSearchSlots.Reset();
+	SearchSlotById.Reset();
+	TrigramIndex.Reset();
+}
+
+const TArray<FName>& FTuningParameterIndex::GetByLayer(ETuningLayer Layer) const
+{
+	const TArray<FName>* Ids = LayerIndex.Find(Layer);
+	return Ids ? *Ids : EmptyIds;
+}
+
+const TArray<FName>& FTuningParameterIndex::GetByCategory(const FString& Category) const
+{
+	const TArray<FName>* Ids = CategoryIndex.Find(Category);
+	return Ids ? *Ids : EmptyIds;
+}
+
+const TArray<FName>& FTuningParameterIndex::GetByTag(const FString& Tag) const
+{
+	const TArray<FName>* Ids = TagIndex.Find(Tag);
+	return Ids ? *Ids : EmptyIds;
+}
+
+void FTuningParameterIndex::Search(const FString& Query, TArray<FName>& OutIds) const
+{
+	OutIds.Reset();
+
+	const FString LowerQuery = Query.ToLower();
+
+	// 短いクエリはトライグラムが作れないので全スロットを照合
+	if (LowerQuery.Len() < 3)
+	{
+		for (const FSearchSlot& Slot : SearchSlots)
+		{
+			if (!Slot.Id.IsNone() && Slot.Text.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			{
+				OutIds.Add(Slot.Id);
+			}
+		}
+		return;
+	}
+
+	// 候補が最も少ないトライグラムから絞り込み、部分文字列で確認
+	TSet<uint32> QueryTrigrams;
+	GatherTrigrams(LowerQuery, QueryTrigrams);
+
+	const TArray<int32>* Candidates = nullptr;
+	for (const uint32 Trigram : QueryTrigrams)
+	{
+		const TArray<int32>* Slots = TrigramIndex.Find(Trigram);
+		if (!Slots || Slots->Num() == 0)
+		{
+			return;
+		}
+		if (!Candidates || Slots->Num() < Candidates->Num())
+		{
+			Candidates = Slots;
+		}
+	}
+
+	if (!Candidates)
+	{
+		return;
+	}
+
+	for (const int32 SlotIndex : *Candidates)
+	{
+		const FSearchSlot& Slot = SearchSlots[SlotIndex];
+		if (Slot.Text.Contains(LowerQuery, ESearchCase::CaseSensitive))
+		{
+			OutIds.Add(Slot.Id);
+		}
+	}
+}
+
+void FTuningParameterIndex::GatherTrigrams(const FString& Text, TSet<uint32>& OutTrigrams)
+{
+	const TCHAR* Chars = *Text;
+	for (int32 CharIndex = 0; CharIndex + 2 < Text.Len(); ++CharIndex)
+	{
+		OutTrigrams.Add(MakeTrigram(Chars + CharIndex));
+	}
+}
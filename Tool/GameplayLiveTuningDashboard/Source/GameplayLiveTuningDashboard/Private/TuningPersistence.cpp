@@ -0,0 +1,608 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningPersistence.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+namespace
+{
+	/** 状態ファイルの識別子 */
+	constexpr uint32 StateFileMagic = 0x53544C47; // "GLTS"
+
+	/** 状態ファイルのバージョン（パラメータ・プリセット構造を変更したら更新、2でFNameを文字列で保存） */
+	constexpr int32 StateFileVersion = 2;
+
+	/** セッションログの識別子 */
+	constexpr uint32 SessionLogMagic = 0x4C544C47; // "GLTL"
+
+	/** セッションログのバージョン（レコード構造を変更したら更新） */
+	constexpr int32 SessionLogVersion = 1;
+
+	/** セッションログのヘッダーサイズ */
+	constexpr int64 SessionLogHeaderSize = sizeof(uint32) + sizeof(int32);
+
+	/** レコード見出し（種別＋ペイロードサイズ）のサイズ */
+	constexpr int64 SessionRecordHeaderSize = sizeof(uint8) + sizeof(int32);
+
+	/**
+	 * USTRUCTをバイナリでシリアライズ（書き出し時はコピーを渡す）
+	 * ファイルアーカイブはFNameを読み書きしないため、FMemoryWriter/Readerか FNameAsStringProxyArchive を渡す
+	 */
+	template <typename StructType>
+	void SerializeStruct(FArchive& Ar, StructType& Value)
+	{
+		StructType::StaticStruct()->SerializeBin(Ar, &Value);
+	}
+
+	/** 読み戻したパラメータのIDが有効か（名前を保存できていないファイルを検出） */
+	bool IsValidLoadedParameter(const FTuningParameter& Parameter)
+	{
+		return !Parameter.ParameterId.IsNone();
+	}
+
+	/** 読み戻したプリセットのキーが有効か */
+	bool IsValidLoadedPreset(const FTuningPreset& Preset)
+	{
+		for (const TPair<FName, FTuningValue>& Pair : Preset.ParameterValues)
+		{
+			if (Pair.Key.IsNone())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// ========== FTuningStateFile ==========
+
+bool FTuningStateFile::IsStateFile(const FString& FilePath)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!Reader.IsValid() || Reader->TotalSize() < (int64)sizeof(uint32))
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	*Reader << Magic;
+	return Magic == StateFileMagic;
+}
+
+bool FTuningStateFile::Save(const FString& FilePath, const TMap<FName, FTuningParameter>& Parameters, const TArray<FTuningPreset>& Presets)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter.IsValid())
+	{
+		return false;
+	}
+
+	// ファイルアーカイブはFNameを書かないため、文字列として書くプロキシを通す
+	FNameAsStringProxyArchive Writer(*FileWriter);
+
+	uint32 Magic = StateFileMagic;
+	int32 Version = StateFileVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	// 1件ずつファイルへ直接書き出す
+	int32 NumParameters = Parameters.Num();
+	Writer << NumParameters;
+	for (const auto& Pair : Parameters)
+	{
+		FTuningParameter ParameterCopy = Pair.Value;
+		SerializeStruct(Writer, ParameterCopy);
+	}
+
+	int32 NumPresets = Presets.Num();
+	Writer << NumPresets;
+	for (const FTuningPreset& Preset : Presets)
+	{
+		FTuningPreset PresetCopy = Preset;
+		SerializeStruct(Writer, PresetCopy);
+	}
+
+	const bool bSucceeded = !Writer.IsError() && !FileWriter->IsError();
+	return FileWriter->Close() && bSucceeded;
+}
+
+bool FTuningStateFile::Load(const FString& FilePath, TArray<FTuningParameter>& OutParameters, TArray<FTuningPreset>& OutPresets)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!FileReader.IsValid())
+	{
+		return false;
+	}
+
+	// 保存時と同じく名前は文字列として読む
+	FNameAsStringProxyArchive Reader(*FileReader);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+	if (Magic != StateFileMagic || Version != StateFileVersion)
+	{
+		return false;
+	}
+
+	int32 NumParameters = 0;
+	Reader << NumParameters;
+	for (int32 Index = 0; Index < NumParameters && !Reader.IsError(); ++Index)
+	{
+		FTuningParameter Parameter;
+		SerializeStruct(Reader, Parameter);
+		if (Reader.IsError())
+		{
+			break;
+		}
+
+		// 名前が読み戻せない場合は全パラメータが1件にまとまってしまうため、ファイルごと拒否する
+		if (!IsValidLoadedParameter(Parameter))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningStateFile] Parameter without id in %s, file is corrupted"), *FilePath);
+			return false;
+		}
+		OutParameters.Add(MoveTemp(Parameter));
+	}
+
+	int32 NumPresets = 0;
+	Reader << NumPresets;
+	for (int32 Index = 0; Index < NumPresets && !Reader.IsError(); ++Index)
+	{
+		FTuningPreset& Preset = OutPresets.AddDefaulted_GetRef();
+		SerializeStruct(Reader, Preset);
+		if (!Reader.IsError() && !IsValidLoadedPreset(Preset))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningStateFile] Preset %s has values without parameter id in %s, skipped"), *Preset.PresetName, *FilePath);
+			OutPresets.Pop();
+		}
+	}
+
+	return !Reader.IsError() && !FileReader->IsError();
+}
+
+// ========== FTuningSessionLog ==========
+
+FTuningSessionLog::~FTuningSessionLog()
+{
+	Close();
+}
+
+FString FTuningSessionLog::GetDefaultLogPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("GameplayLiveTuningDashboard") / TEXT("SessionLog.bin");
+}
+
+bool FTuningSessionLog::Open(const FString& InFilePath)
+{
+	Close();
+	FilePath = InFilePath;
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (FileManager.FileExists(*FilePath))
+	{
+		int64 ValidSize = 0;
+		const EIndexResult IndexResult = BuildIndex(ValidSize);
+		if (IndexResult == EIndexResult::ReadFailed)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningSessionLog] Failed to read existing log: %s"), *FilePath);
+			return false;
+		}
+		if (IndexResult == EIndexResult::FormatMismatch)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningSessionLog] Unsupported log format, recreating: %s"), *FilePath);
+			FileManager.Delete(*FilePath);
+			Sessions.Empty();
+			SessionIndexById.Empty();
+		}
+		else if (ValidSize < FileManager.FileSize(*FilePath) && !TruncateFile(ValidSize))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningSessionLog] Failed to drop incomplete record: %s"), *FilePath);
+			return false;
+		}
+	}
+
+	const bool bNewFile = FileManager.FileSize(*FilePath) <= 0;
+	Writer.Reset(FileManager.CreateFileWriter(*FilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSessionLog] Failed to open: %s"), *FilePath);
+		return false;
+	}
+
+	if (bNewFile)
+	{
+		uint32 Magic = SessionLogMagic;
+		int32 Version = SessionLogVersion;
+		*Writer << Magic;
+		*Writer << Version;
+		Writer->Flush();
+	}
+
+	return true;
+}
+
+void FTuningSessionLog::Close()
+{
+	if (Writer.IsValid())
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+}
+
+void FTuningSessionLog::AppendSessionBegin(const FTuningSession& Session)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	FLoggedSession& Logged = Sessions.AddDefaulted_GetRef();
+	Logged.Session = Session;
+	Logged.BeginOffset = Writer->Tell();
+	SessionIndexById.Add(Session.SessionId, Sessions.Num() - 1);
+
+	PayloadBuffer.Reset();
+	FMemoryWriter Payload(PayloadBuffer);
+	FTuningSession SessionCopy = Session;
+	SerializeSessionBegin(Payload, SessionCopy);
+	AppendRecord(ERecordType::SessionBegin, PayloadBuffer);
+}
+
+void FTuningSessionLog::AppendChange(int64 Sequence, const FTuningHistoryEntry& Entry)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	if (const int32* Index = SessionIndexById.Find(Entry.SessionId))
+	{
+		Sessions[*Index].Session.EndHistorySequence = Sequence + 1;
+	}
+
+	PayloadBuffer.Reset();
+	FMemoryWriter Payload(PayloadBuffer);
+	FTuningHistoryEntry EntryCopy = Entry;
+	Payload << Sequence;
+	SerializeStruct(Payload, EntryCopy);
+	AppendRecord(ERecordType::Change, PayloadBuffer);
+}
+
+void FTuningSessionLog::AppendTruncate(int64 EndSequence)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	ApplyTruncate(EndSequence);
+
+	PayloadBuffer.Reset();
+	FMemoryWriter Payload(PayloadBuffer);
+	Payload << EndSequence;
+	AppendRecord(ERecordType::Truncate, PayloadBuffer);
+}
+
+void FTuningSessionLog::AppendSessionEnd(const FTuningSession& Session)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	if (const int32* Index = SessionIndexById.Find(Session.SessionId))
+	{
+		Sessions[*Index].Session = Session;
+	}
+
+	PayloadBuffer.Reset();
+	FMemoryWriter Payload(PayloadBuffer);
+	FTuningSession SessionCopy = Session;
+	SerializeSessionEnd(Payload, SessionCopy);
+	AppendRecord(ERecordType::SessionEnd, PayloadBuffer);
+}
+
+void FTuningSessionLog::Flush()
+{
+	if (IsOpen())
+	{
+		Writer->Flush();
+	}
+}
+
+bool FTuningSessionLog::LoadSessionChanges(const FGuid& SessionId, TArray<FTuningHistoryEntry>& OutChanges) const
+{
+	const int32* Index = SessionIndexById.Find(SessionId);
+	if (!Index)
+	{
+		return false;
+	}
+
+	// 書き込み中のレコードも読めるよう先に書き出す
+	if (Writer.IsValid())
+	{
+		Writer->Flush();
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent | FILEREAD_AllowWrite));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	// シーケンス付きで集め、Undoレコードで末尾を取り消す
+	TArray<TPair<int64, FTuningHistoryEntry>> Changes;
+	TArray<uint8> Payload;
+
+	Reader->Seek(Sessions[*Index].BeginOffset);
+	bool bFirstRecord = true;
+	while (!Reader->AtEnd() && !Reader->IsError())
+	{
+		if (Reader->TotalSize() - Reader->Tell() < SessionRecordHeaderSize)
+		{
+			break; // 見出しの途中で終わったレコード
+		}
+
+		uint8 RawType = 0;
+		int32 PayloadSize = 0;
+		*Reader << RawType;
+		*Reader << PayloadSize;
+
+		const int64 PayloadEnd = Reader->Tell() + PayloadSize;
+		if (PayloadSize < 0 || PayloadEnd > Reader->TotalSize())
+		{
+			break; // 書き込み途中で終わったレコード
+		}
+
+		const ERecordType Type = static_cast<ERecordType>(RawType);
+		if (Type == ERecordType::SessionBegin && !bFirstRecord)
+		{
+			break; // 終了レコードの無いまま次のセッションが始まった
+		}
+		if (Type == ERecordType::SessionEnd)
+		{
+			break;
+		}
+		bFirstRecord = false;
+
+		if (Type == ERecordType::Change)
+		{
+			// ペイロードはFMemoryWriterで書かれている（FNameは文字列）ため、同じくメモリ上で読む
+			Payload.SetNumUninitialized(PayloadSize);
+			Reader->Serialize(Payload.GetData(), PayloadSize);
+			FMemoryReader PayloadReader(Payload);
+
+			int64 Sequence = 0;
+			PayloadReader << Sequence;
+			FTuningHistoryEntry Entry;
+			SerializeStruct(PayloadReader, Entry);
+			if (!PayloadReader.IsError())
+			{
+				Changes.Emplace(Sequence, MoveTemp(Entry));
+			}
+		}
+		else if (Type == ERecordType::Truncate)
+		{
+			int64 EndSequence = 0;
+			*Reader << EndSequence;
+			while (Changes.Num() > 0 && Changes.Last().Key >= EndSequence)
+			{
+				Changes.Pop(false);
+			}
+		}
+
+		Reader->Seek(PayloadEnd);
+	}
+
+	// 後のセッションでのUndoは索引の終了位置に反映済み（シーケンスは全体で共通のため、終了位置以降を取り消す）
+	const int64 SessionEndSequence = Sessions[*Index].Session.EndHistorySequence;
+	while (Changes.Num() > 0 && Changes.Last().Key >= SessionEndSequence)
+	{
+		Changes.Pop(false);
+	}
+
+	OutChanges.Reserve(OutChanges.Num() + Changes.Num());
+	for (TPair<int64, FTuningHistoryEntry>& Change : Changes)
+	{
+		OutChanges.Add(MoveTemp(Change.Value));
+	}
+
+	return true;
+}
+
+void FTuningSessionLog::AppendRecord(ERecordType Type, const TArray<uint8>& Payload)
+{
+	uint8 RawType = static_cast<uint8>(Type);
+	int32 PayloadSize = Payload.Num();
+	*Writer << RawType;
+	*Writer << PayloadSize;
+	Writer->Serialize(const_cast<uint8*>(Payload.GetData()), PayloadSize);
+}
+
+bool FTuningSessionLog::TruncateFile(int64 Size)
+{
+	// 有効な先頭部分を一時ファイルへ分割コピーして置き換える
+	IFileManager& FileManager = IFileManager::Get();
+	const FString TempPath = FilePath + TEXT(".tmp");
+	{
+		TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*FilePath, FILEREAD_Silent));
+		TUniquePtr<FArchive> TempWriter(FileManager.CreateFileWriter(*TempPath));
+		if (!Reader.IsValid() || !TempWriter.IsValid())
+		{
+			return false;
+		}
+
+		TArray<uint8> Chunk;
+		Chunk.SetNumUninitialized(64 * 1024);
+		for (int64 Copied = 0; Copied < Size; )
+		{
+			const int32 ChunkSize = (int32)FMath::Min<int64>(Chunk.Num(), Size - Copied);
+			Reader->Serialize(Chunk.GetData(), ChunkSize);
+			TempWriter->Serialize(Chunk.GetData(), ChunkSize);
+			Copied += ChunkSize;
+		}
+
+		if (Reader->IsError() || !TempWriter->Close())
+		{
+			return false;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningSessionLog] Dropped incomplete trailing record: %s"), *FilePath);
+	return FileManager.Move(*FilePath, *TempPath, true);
+}
+
+FTuningSessionLog::EIndexResult FTuningSessionLog::BuildIndex(int64& OutValidSize)
+{
+	Sessions.Empty();
+	SessionIndexById.Empty();
+	OutValidSize = 0;
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!Reader.IsValid())
+	{
+		return EIndexResult::ReadFailed;
+	}
+
+	if (Reader->TotalSize() == 0)
+	{
+		return EIndexResult::Ok;
+	}
+	if (Reader->TotalSize() < SessionLogHeaderSize)
+	{
+		return EIndexResult::FormatMismatch; // ファイルヘッダーの書き込み途中（有効なレコードは無い）
+	}
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	*Reader << Magic;
+	*Reader << Version;
+	if (Magic != SessionLogMagic || Version != SessionLogVersion)
+	{
+		return EIndexResult::FormatMismatch;
+	}
+
+	// 見出しのみ読み、変更のペイロードは読み飛ばす
+	TArray<uint8> Payload;
+	while (!Reader->AtEnd() && !Reader->IsError())
+	{
+		const int64 RecordOffset = Reader->Tell();
+		if (Reader->TotalSize() - RecordOffset < SessionRecordHeaderSize)
+		{
+			break; // 見出しの途中で終わったレコード（Openで切り詰める）
+		}
+
+		uint8 RawType = 0;
+		int32 PayloadSize = 0;
+		*Reader << RawType;
+		*Reader << PayloadSize;
+
+		const int64 PayloadEnd = Reader->Tell() + PayloadSize;
+		if (PayloadSize < 0 || PayloadEnd > Reader->TotalSize())
+		{
+			break; // 書き込み途中で終わったレコード（Openで切り詰める）
+		}
+
+		switch (static_cast<ERecordType>(RawType))
+		{
+		case ERecordType::SessionBegin:
+		{
+			Payload.SetNumUninitialized(PayloadSize);
+			Reader->Serialize(Payload.GetData(), PayloadSize);
+			FMemoryReader PayloadReader(Payload);
+
+			FLoggedSession& Logged = Sessions.AddDefaulted_GetRef();
+			SerializeSessionBegin(PayloadReader, Logged.Session);
+			Logged.Session.EndHistorySequence = Logged.Session.FirstHistorySequence;
+			Logged.BeginOffset = RecordOffset;
+			SessionIndexById.Add(Logged.Session.SessionId, Sessions.Num() - 1);
+			break;
+		}
+
+		case ERecordType::Change:
+		{
+			int64 Sequence = 0;
+			*Reader << Sequence;
+			if (Sessions.Num() > 0)
+			{
+				Sessions.Last().Session.EndHistorySequence = Sequence + 1;
+			}
+			break;
+		}
+
+		case ERecordType::Truncate:
+		{
+			int64 EndSequence = 0;
+			*Reader << EndSequence;
+			ApplyTruncate(EndSequence);
+			break;
+		}
+
+		case ERecordType::SessionEnd:
+		{
+			Payload.SetNumUninitialized(PayloadSize);
+			Reader->Serialize(Payload.GetData(), PayloadSize);
+			FMemoryReader PayloadReader(Payload);
+
+			FTuningSession Ended;
+			SerializeSessionEnd(PayloadReader, Ended);
+			if (const int32* Index = SessionIndexById.Find(Ended.SessionId))
+			{
+				FTuningSession& Session = Sessions[*Index].Session;
+				Session.EndTime = Ended.EndTime;
+				Session.EndHistorySequence = Ended.EndHistorySequence;
+				Session.Notes = Ended.Notes;
+				Session.bIsActive = false;
+			}
+			break;
+		}
+
+		default:
+			break;
+		}
+
+		if (Reader->IsError())
+		{
+			break; // 読めなかったレコード以降は切り詰める
+		}
+		Reader->Seek(PayloadEnd);
+		OutValidSize = PayloadEnd;
+	}
+
+	// 途中で読めなくなっても、それまでの完全なレコードは残す
+	OutValidSize = FMath::Max(OutValidSize, SessionLogHeaderSize);
+	return EIndexResult::Ok;
+}
+
+void FTuningSessionLog::ApplyTruncate(int64 EndSequence)
+{
+	// Undoは終了済みのセッションの変更まで戻せるため、最後のセッションに限らず範囲を詰める
+	for (FLoggedSession& Logged : Sessions)
+	{
+		FTuningSession& Session = Logged.Session;
+		Session.EndHistorySequence = FMath::Min(Session.EndHistorySequence, EndSequence);
+		Session.FirstHistorySequence = FMath::Min(Session.FirstHistorySequence, Session.EndHistorySequence);
+	}
+}
+
+void FTuningSessionLog::SerializeSessionBegin(FArchive& Ar, FTuningSession& Session)
+{
+	Ar << Session.SessionId;
+	Ar << Session.SessionName;
+	Ar << Session.StartTime;
+	Ar << Session.FirstHistorySequence;
+}
+
+void FTuningSessionLog::SerializeSessionEnd(FArchive& Ar, FTuningSession& Session)
+{
+	Ar << Session.SessionId;
+	Ar << Session.EndTime;
+	Ar << Session.EndHistorySequence;
+	Ar << Session.Notes;
+}
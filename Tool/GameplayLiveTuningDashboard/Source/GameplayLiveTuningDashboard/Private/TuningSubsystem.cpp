@@ -1,26 +1,69 @@
 // Copyright DevTools. All Rights Reserved.
 
 #include "TuningSubsystem.h"
+#include "TuningTrace.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 #include "JsonObjectConverter.h"
+#include "Misc/CommandLine.h"
 #include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "UObject/PropertyAccessUtil.h"
+#include "UObject/UObjectGlobals.h"
 
 UTuningSubsystem* UTuningSubsystem::EditorInstance = nullptr;
 
+const FString& UTuningSubsystem::GetModifiedBy()
+{
+	// 起動中は変わらないため一度だけ取得
+	static const FString ModifiedBy = []() -> FString
+	{
+		const FString UserName = FPlatformProcess::UserName(false);
+		return UserName.IsEmpty() ? FString(FPlatformProcess::ComputerName()) : UserName;
+	}();
+	return ModifiedBy;
+}
+
 void UTuningSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	// エディタインスタンスを設定（セッションログは複数インスタンスで共有しない、スイープのワーカーは対象外）
+	if (!EditorInstance && !IsRunningCommandlet())
+	{
+		EditorInstance = this;
+		SessionLog.Open(FTuningSessionLog::GetDefaultLogPath());
+	}
+
 	// デフォルトセッション開始
 	CurrentSession = FTuningSession();
 	CurrentSession.SessionName = TEXT("Default Session");
+	SessionLog.AppendSessionBegin(CurrentSession);
+	SessionLog.Flush();
 
-	// エディタインスタンスを設定
-	if (!EditorInstance)
+	// クラスの再生成でプロパティが変わるため解決済みの適用先を破棄
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddWeakLambda(this, [this](EReloadCompleteReason)
 	{
-		EditorInstance = this;
+		InvalidatePropertyBindings();
+	});
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddUObject(this, &UTuningSubsystem::OnObjectsReplaced);
+
+	// ターゲット側の受信はランタイムモジュール、ここでは登録済みパラメータへの適用のみ担当
+	RemoteTarget = Cast<UTuningRemoteTargetSubsystem>(Collection.InitializeDependency(UTuningRemoteTargetSubsystem::StaticClass()));
+	if (RemoteTarget)
+	{
+		RemoteTarget->SetBatchApplier(FTuningRemoteBatchApplier::CreateUObject(this, &UTuningSubsystem::ApplyRemoteBatch));
 	}
 
+	RemoteTransport.OnAcknowledged.BindUObject(this, &UTuningSubsystem::OnRemoteAcknowledged);
+	StartRemoteFromCommandLine();
+
+	SweepRunner.OnCompleted.BindWeakLambda(this, [this](const FTuningSweepReport& Report)
+	{
+		OnParameterSweepCompleted.Broadcast(Report);
+	});
+
 	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Initialized"));
 }
 
@@ -37,6 +80,20 @@ void UTuningSubsystem::Deinitialize()
 		EditorInstance = nullptr;
 	}
 
+	SessionLog.Close();
+	StopRemote();
+	if (RemoteTarget)
+	{
+		RemoteTarget->ClearBatchApplier();
+		RemoteTarget = nullptr;
+	}
+	SweepRunner.OnCompleted.Unbind();
+	SweepRunner.Cancel();
+
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	PropertyBindings.Empty();
+
 	Super::Deinitialize();
 }
 
@@ -70,10 +127,26 @@ UTuningSubsystem* UTuningSubsystem::Get()
 
 void UTuningSubsystem::RegisterParameter(const FTuningParameter& Parameter)
 {
-	Parameters.Add(Parameter.ParameterId, Parameter);
+	AddParameterInternal(Parameter);
 	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Registered parameter: %s"), *Parameter.ParameterId.ToString());
 }
 
+void UTuningSubsystem::AddParameterInternal(const FTuningParameter& Parameter)
+{
+	// 再登録時はレイヤー・カテゴリ・タグが変わっている可能性があるため古い内容で削除
+	if (const FTuningParameter* Existing = Parameters.Find(Parameter.ParameterId))
+	{
+		ParameterIndex.Remove(*Existing);
+	}
+
+	Parameters.Add(Parameter.ParameterId, Parameter);
+	ParameterIndex.Add(Parameter);
+	ThresholdTable.Set(Parameter);
+
+	// 適用先が変わっている可能性がある
+	PropertyBindings.Remove(Parameter.ParameterId);
+}
+
 void UTuningSubsystem::RegisterParameters(const TArray<FTuningParameter>& InParameters)
 {
 	for (const FTuningParameter& Param : InParameters)
@@ -95,26 +168,26 @@ bool UTuningSubsystem::GetParameter(FName ParameterId, FTuningParameter& OutPara
 
 TArray<FTuningParameter> UTuningSubsystem::GetParametersByLayer(ETuningLayer Layer) const
 {
+	const TArray<FName>& Ids = ParameterIndex.GetByLayer(Layer);
+
 	TArray<FTuningParameter> Result;
-	for (const auto& Pair : Parameters)
+	Result.Reserve(Ids.Num());
+	for (const FName& Id : Ids)
 	{
-		if (Pair.Value.Layer == Layer)
-		{
-			Result.Add(Pair.Value);
-		}
+		Result.Add(Parameters.FindChecked(Id));
 	}
 	return Result;
 }
 
 TArray<FTuningParameter> UTuningSubsystem::GetParametersByCategory(const FString& Category) const
 {
+	const TArray<FName>& Ids = ParameterIndex.GetByCategory(Category);
+
 	TArray<FTuningParameter> Result;
-	for (const auto& Pair : Parameters)
+	Result.Reserve(Ids.Num());
+	for (const FName& Id : Ids)
 	{
-		if (Pair.Value.Category == Category)
-		{
-			Result.Add(Pair.Value);
-		}
+		Result.Add(Parameters.FindChecked(Id));
 	}
 	return Result;
 }
@@ -128,21 +201,30 @@ TArray<FTuningParameter> UTuningSubsystem::GetAllParameters() const
 
 TArray<FTuningParameter> UTuningSubsystem::SearchParametersByTag(const FString& Tag) const
 {
+	const TArray<FName>& Ids = ParameterIndex.GetByTag(Tag);
+
 	TArray<FTuningParameter> Result;
-	for (const auto& Pair : Parameters)
+	Result.Reserve(Ids.Num());
+	for (const FName& Id : Ids)
 	{
-		if (Pair.Value.Tags.Contains(Tag))
-		{
-			Result.Add(Pair.Value);
-		}
+		Result.Add(Parameters.FindChecked(Id));
 	}
 	return Result;
 }
 
+TArray<FName> UTuningSubsystem::SearchParameterIds(const FString& Query) const
+{
+	TArray<FName> Result;
+	ParameterIndex.Search(Query, Result);
+	return Result;
+}
+
 // ========== 値の変更 ==========
 
 bool UTuningSubsystem::SetParameterValue(FName ParameterId, const FTuningValue& NewValue, const FString& Comment)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::SetParameterValue);
+
 	FTuningParameter* Param = Parameters.Find(ParameterId);
 	if (!Param)
 	{
@@ -150,38 +232,39 @@ bool UTuningSubsystem::SetParameterValue(FName ParameterId, const FTuningValue&
 		return false;
 	}
 
-	FTuningValue OldValue = Param->CurrentValue;
-
-	// 警告チェック
-	CheckWarnings(*Param, OldValue, NewValue);
-
-	// 履歴に追加
-	FTuningHistoryEntry Entry;
-	Entry.ParameterId = ParameterId;
-	Entry.OldValue = OldValue;
-	Entry.NewValue = NewValue;
-	Entry.SessionId = CurrentSession.SessionId;
-	Entry.Comment = Comment;
-	Entry.ModifiedBy = TEXT("User"); // TODO: 実際のユーザー名
+	// トランザクション外の変更は単独のトランザクションとして記録
+	const bool bImplicitTransaction = !IsInTransaction();
+	if (bImplicitTransaction)
+	{
+		BeginTransaction(Comment);
+	}
 
-	AddHistoryEntry(Entry);
+	// 開始時の値は最初の変更でのみ記録
+	FPendingChange* Pending = TransactionChanges.Find(ParameterId);
+	if (!Pending)
+	{
+		Pending = &TransactionChanges.Add(ParameterId, { Param->CurrentValue, FString() });
+		TransactionChangeOrder.Add(ParameterId);
+	}
+	if (!Comment.IsEmpty())
+	{
+		Pending->Comment = Comment;
+	}
 
 	// 値を更新
+	TuningTrace::OutputParameterChanged(ParameterId, ETuningTraceSource::Set, Param->CurrentValue, NewValue);
 	Param->CurrentValue = NewValue;
+	ThresholdTable.UpdateValue(ParameterId, NewValue);
 	Param->LastModified = FDateTime::Now();
-	Param->ModifiedBy = Entry.ModifiedBy;
-
-	// Redoスタッククリア
-	RedoStack.Empty();
+	Param->ModifiedBy = GetModifiedBy();
 
-	// 実際のオブジェクトに適用
+	// 実際のオブジェクトに適用（スライダー操作中も即反映）
 	ApplyValueToTarget(ParameterId);
 
-	// イベント発火
-	OnParameterChanged.Broadcast(ParameterId, NewValue);
-
-	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Parameter changed: %s = %s"),
-		*ParameterId.ToString(), *NewValue.ToString());
+	if (bImplicitTransaction)
+	{
+		CommitTransaction();
+	}
 
 	return true;
 }
@@ -223,146 +306,306 @@ bool UTuningSubsystem::ResetToDefault(FName ParameterId)
 
 void UTuningSubsystem::ResetAllToDefault()
 {
+	BeginTransaction(TEXT("Reset all to default"));
 	for (auto& Pair : Parameters)
 	{
-		SetParameterValue(Pair.Key, Pair.Value.DefaultValue, TEXT("Reset all to default"));
+		SetParameterValue(Pair.Key, Pair.Value.DefaultValue);
 	}
+	CommitTransaction();
 }
 
-bool UTuningSubsystem::ApplyValueToTarget(FName ParameterId)
+// ========== トランザクション ==========
+
+void UTuningSubsystem::BeginTransaction(const FString& Description)
 {
-	FTuningParameter* Param = Parameters.Find(ParameterId);
-	if (!Param || Param->TargetObjectPath.IsEmpty())
+	if (TransactionDepth++ == 0)
 	{
-		return false;
+		TransactionDescription = Description;
 	}
+}
 
-	// オブジェクトを検索
-	UObject* TargetObject = FindObject<UObject>(nullptr, *Param->TargetObjectPath);
-	if (!TargetObject)
+int32 UTuningSubsystem::CommitTransaction()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::CommitTransaction);
+
+	if (TransactionDepth == 0)
 	{
-		// ロードを試行
-		TargetObject = LoadObject<UObject>(nullptr, *Param->TargetObjectPath);
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] CommitTransaction called without BeginTransaction"));
+		return 0;
 	}
 
-	if (!TargetObject)
+	if (--TransactionDepth > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Target object not found: %s"), *Param->TargetObjectPath);
-		return false;
+		return 0;
 	}
 
-	return ApplyValueToProperty(TargetObject, Param->TargetPropertyName, Param->CurrentValue);
-}
+	const int32 TransactionId = NextTransactionId++;
+	const FString ModifiedBy = GetModifiedBy();
 
-bool UTuningSubsystem::ApplyValueToProperty(UObject* Object, const FString& PropertyName, const FTuningValue& Value)
-{
-	if (!Object)
+	TArray<FName> ChangedIds;
+	ChangedIds.Reserve(TransactionChangeOrder.Num());
+
+	for (const FName& ParameterId : TransactionChangeOrder)
 	{
-		return false;
+		const FTuningParameter* Param = Parameters.Find(ParameterId);
+		const FPendingChange& Pending = TransactionChanges.FindChecked(ParameterId);
+
+		// 最終的に元の値へ戻った変更は記録しない
+		if (!Param || Param->CurrentValue.Equals(Pending.OriginalValue))
+		{
+			continue;
+		}
+
+		// 警告は開始時の値と最終値で一度だけ判定
+		CheckWarnings(*Param, Pending.OriginalValue, Param->CurrentValue);
+
+		FTuningHistoryEntry Entry;
+		Entry.ParameterId = ParameterId;
+		Entry.OldValue = Pending.OriginalValue;
+		Entry.NewValue = Param->CurrentValue;
+		Entry.SessionId = CurrentSession.SessionId;
+		Entry.Comment = Pending.Comment.IsEmpty() ? TransactionDescription : Pending.Comment;
+		Entry.ModifiedBy = ModifiedBy;
+		Entry.TransactionId = TransactionId;
+
+		AddHistoryEntry(Entry);
+		ChangedIds.Add(ParameterId);
 	}
 
-	FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-	if (!Property)
+	TransactionChangeOrder.Reset();
+	TransactionChanges.Reset();
+	TransactionDescription.Reset();
+
+	if (ChangedIds.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Property not found: %s"), *PropertyName);
-		return false;
+		return 0;
 	}
 
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+	TuningTrace::OutputTransactionCommitted(TransactionId, ChangedIds.Num());
+
+	// Redoスタッククリア
+	RedoStack.Empty();
+
+	// 確定した変更をログへ書き出す
+	SessionLog.Flush();
 
-	switch (Value.ValueType)
+	NotifyParametersChanged(ChangedIds);
+
+	if (ChangedIds.Num() == 1)
 	{
-	case ETuningValueType::Float:
-		if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-		{
-			FloatProp->SetPropertyValue(ValuePtr, Value.FloatValue);
-			return true;
-		}
-		else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
-		{
-			DoubleProp->SetPropertyValue(ValuePtr, static_cast<double>(Value.FloatValue));
-			return true;
-		}
-		break;
+		UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Parameter changed: %s = %s"),
+			*ChangedIds[0].ToString(), *Parameters[ChangedIds[0]].CurrentValue.ToString());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Transaction committed: %d parameters changed"), ChangedIds.Num());
+	}
+
+	return ChangedIds.Num();
+}
 
-	case ETuningValueType::Integer:
-		if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
+void UTuningSubsystem::CancelTransaction()
+{
+	if (TransactionDepth == 0)
+	{
+		return;
+	}
+
+	// 開始前の値に戻す（履歴・通知なし）
+	for (const FName& ParameterId : TransactionChangeOrder)
+	{
+		if (FTuningParameter* Param = Parameters.Find(ParameterId))
 		{
-			IntProp->SetPropertyValue(ValuePtr, Value.IntValue);
-			return true;
+			TuningTrace::OutputParameterChanged(ParameterId, ETuningTraceSource::Cancel, Param->CurrentValue, TransactionChanges.FindChecked(ParameterId).OriginalValue);
+			Param->CurrentValue = TransactionChanges.FindChecked(ParameterId).OriginalValue;
+			ThresholdTable.UpdateValue(ParameterId, Param->CurrentValue);
+			ApplyValueToTarget(ParameterId);
 		}
-		break;
+	}
+
+	TransactionDepth = 0;
+	TransactionChangeOrder.Reset();
+	TransactionChanges.Reset();
+	TransactionDescription.Reset();
+}
 
-	case ETuningValueType::Boolean:
-		if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+void UTuningSubsystem::NotifyParametersChanged(const TArray<FName>& ChangedIds)
+{
+	// 接続中のターゲットへは次のフレーム境界でまとめて送る
+	if (RemoteTransport.IsHosting())
+	{
+		for (const FName& ParameterId : ChangedIds)
 		{
-			BoolProp->SetPropertyValue(ValuePtr, Value.BoolValue);
-			return true;
+			if (const FTuningParameter* Param = Parameters.Find(ParameterId))
+			{
+				RemoteTransport.QueueUpdate(ParameterId, Param->CurrentValue);
+			}
 		}
-		break;
+	}
 
-	case ETuningValueType::Vector:
-		if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	// 既存のリスナー向けにパラメータごとに通知し、まとめた通知はその後に1回（購読が無ければ走査しない）
+	if (OnParameterChanged.IsBound())
+	{
+		for (const FName& ParameterId : ChangedIds)
 		{
-			if (StructProp->Struct == TBaseStructure<FVector>::Get())
+			if (const FTuningParameter* Param = Parameters.Find(ParameterId))
 			{
-				*static_cast<FVector*>(ValuePtr) = Value.VectorValue;
-				return true;
+				OnParameterChanged.Broadcast(ParameterId, Param->CurrentValue);
 			}
 		}
-		break;
 	}
 
-	return false;
+	OnParametersChanged.Broadcast(ChangedIds);
+	OnParametersChangedNative.Broadcast(ChangedIds);
 }
 
-// ========== 履歴管理 ==========
+bool UTuningSubsystem::ApplyValueToTarget(FName ParameterId)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::ApplyValueToTarget);
 
-TArray<FTuningHistoryEntry> UTuningSubsystem::GetHistory(int32 MaxEntries) const
+	const FTuningParameter* Param = Parameters.Find(ParameterId);
+	if (!Param || Param->TargetObjectPath.IsEmpty())
+	{
+		return false;
+	}
+
+	// 解決済みならリフレクションを経由せずに直接書き込む
+	const FTuningPropertyBinding* Binding = ResolvePropertyBinding(*Param);
+	if (!Binding)
+	{
+		return false;
+	}
+
+	Binding->Apply(Param->CurrentValue);
+	return true;
+}
+
+const FTuningPropertyBinding* UTuningSubsystem::ResolvePropertyBinding(const FTuningParameter& Parameter)
 {
-	int32 Count = FMath::Min(MaxEntries, History.Num());
-	TArray<FTuningHistoryEntry> Result;
+	if (const FTuningPropertyBinding* Existing = PropertyBindings.Find(Parameter.ParameterId))
+	{
+		if (Existing->IsValidFor(Parameter.CurrentValue.ValueType))
+		{
+			return Existing;
+		}
+	}
+
+	PropertyBindings.Remove(Parameter.ParameterId);
 
-	for (int32 i = History.Num() - 1; i >= 0 && Result.Num() < Count; --i)
+	// オブジェクトを検索
+	UObject* TargetObject = FindObject<UObject>(nullptr, *Parameter.TargetObjectPath);
+	if (!TargetObject)
 	{
-		Result.Add(History[i]);
+		// ロードを試行
+		TargetObject = LoadObject<UObject>(nullptr, *Parameter.TargetObjectPath);
 	}
 
-	return Result;
+	if (!TargetObject)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Target object not found: %s"), *Parameter.TargetObjectPath);
+		return nullptr;
+	}
+
+	FTuningPropertyBinding Binding = FTuningPropertyBinding::Bind(TargetObject, FName(*Parameter.TargetPropertyName), Parameter.CurrentValue.ValueType);
+	if (!Binding.IsValidFor(Parameter.CurrentValue.ValueType))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Property not found or type mismatch: %s"), *Parameter.TargetPropertyName);
+		return nullptr;
+	}
+
+	return &PropertyBindings.Add(Parameter.ParameterId, Binding);
 }
 
-TArray<FTuningHistoryEntry> UTuningSubsystem::GetParameterHistory(FName ParameterId, int32 MaxEntries) const
+void UTuningSubsystem::InvalidatePropertyBindings()
 {
-	TArray<FTuningHistoryEntry> Result;
+	PropertyBindings.Reset();
+}
 
-	for (int32 i = History.Num() - 1; i >= 0 && Result.Num() < MaxEntries; --i)
+void UTuningSubsystem::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	for (auto It = PropertyBindings.CreateIterator(); It; ++It)
 	{
-		if (History[i].ParameterId == ParameterId)
+		if (ReplacementMap.Contains(It.Value().Target.GetEvenIfUnreachable()))
 		{
-			Result.Add(History[i]);
+			It.RemoveCurrent();
 		}
 	}
+}
+
+bool UTuningSubsystem::ApplyValueToProperty(UObject* Object, const FString& PropertyName, const FTuningValue& Value)
+{
+	if (!Object)
+	{
+		return false;
+	}
+
+	const FTuningPropertyBinding Binding = FTuningPropertyBinding::Bind(Object, FName(*PropertyName), Value.ValueType);
+	if (!Binding.IsValidFor(Value.ValueType))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Property not found or type mismatch: %s"), *PropertyName);
+		return false;
+	}
+
+	Binding.Apply(Value);
+	return true;
+}
+
+// ========== 履歴管理 ==========
+
+TArray<FTuningHistoryEntry> UTuningSubsystem::GetHistory(int32 MaxEntries) const
+{
+	TArray<FTuningHistoryEntry> Result;
+	History.GetLatest(MaxEntries, Result);
+	return Result;
+}
 
+TArray<FTuningHistoryEntry> UTuningSubsystem::GetParameterHistory(FName ParameterId, int32 MaxEntries) const
+{
+	TArray<FTuningHistoryEntry> Result;
+	History.GetLatestForParameter(ParameterId, MaxEntries, Result);
 	return Result;
 }
 
 bool UTuningSubsystem::UndoLastChange()
 {
-	if (History.Num() == 0)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::UndoLastChange);
+
+	if (History.IsEmpty() || IsInTransaction())
 	{
 		return false;
 	}
 
-	FTuningHistoryEntry LastEntry = History.Pop();
-	RedoStack.Add(LastEntry);
+	// 同じトランザクションのエントリをまとめて戻す
+	const int32 TransactionId = History.Last()->TransactionId;
+	TArray<FName> ChangedIds;
 
-	// 値を戻す
-	FTuningParameter* Param = Parameters.Find(LastEntry.ParameterId);
-	if (Param)
+	while (!History.IsEmpty() && History.Last()->TransactionId == TransactionId)
 	{
-		Param->CurrentValue = LastEntry.OldValue;
-		ApplyValueToTarget(LastEntry.ParameterId);
-		OnParameterChanged.Broadcast(LastEntry.ParameterId, LastEntry.OldValue);
+		FTuningHistoryEntry LastEntry;
+		History.Pop(LastEntry);
+
+		// 値を戻す
+		if (FTuningParameter* Param = Parameters.Find(LastEntry.ParameterId))
+		{
+			TuningTrace::OutputParameterChanged(LastEntry.ParameterId, ETuningTraceSource::Undo, Param->CurrentValue, LastEntry.OldValue);
+			const FTuningValue PreviousValue = Param->CurrentValue;
+			Param->CurrentValue = LastEntry.OldValue;
+			CheckWarnings(*Param, PreviousValue, Param->CurrentValue);
+			ThresholdTable.UpdateValue(LastEntry.ParameterId, LastEntry.OldValue);
+			ApplyValueToTarget(LastEntry.ParameterId);
+			ChangedIds.AddUnique(LastEntry.ParameterId);
+		}
+
+		RedoStack.Add(MoveTemp(LastEntry));
+	}
+
+	SyncCurrentSessionRange();
+	SessionLog.AppendTruncate(History.GetEndSequence());
+	SessionLog.Flush();
+
+	if (ChangedIds.Num() > 0)
+	{
+		NotifyParametersChanged(ChangedIds);
 	}
 
 	return true;
@@ -370,21 +613,41 @@ bool UTuningSubsystem::UndoLastChange()
 
 bool UTuningSubsystem::RedoChange()
 {
-	if (RedoStack.Num() == 0)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::RedoChange);
+
+	if (RedoStack.Num() == 0 || IsInTransaction())
 	{
 		return false;
 	}
 
-	FTuningHistoryEntry Entry = RedoStack.Pop();
+	// Undo時と逆順に同じトランザクションのエントリを再適用
+	const int32 TransactionId = RedoStack.Last().TransactionId;
+	TArray<FName> ChangedIds;
+
+	while (RedoStack.Num() > 0 && RedoStack.Last().TransactionId == TransactionId)
+	{
+		FTuningHistoryEntry Entry = RedoStack.Pop();
+
+		// 値を再適用
+		if (FTuningParameter* Param = Parameters.Find(Entry.ParameterId))
+		{
+			TuningTrace::OutputParameterChanged(Entry.ParameterId, ETuningTraceSource::Redo, Param->CurrentValue, Entry.NewValue);
+			const FTuningValue PreviousValue = Param->CurrentValue;
+			Param->CurrentValue = Entry.NewValue;
+			CheckWarnings(*Param, PreviousValue, Param->CurrentValue);
+			ThresholdTable.UpdateValue(Entry.ParameterId, Entry.NewValue);
+			ApplyValueToTarget(Entry.ParameterId);
+			ChangedIds.AddUnique(Entry.ParameterId);
+			SessionLog.AppendChange(History.Push(Entry), Entry);
+		}
+	}
+
+	SyncCurrentSessionRange();
+	SessionLog.Flush();
 
-	// 値を再適用
-	FTuningParameter* Param = Parameters.Find(Entry.ParameterId);
-	if (Param)
+	if (ChangedIds.Num() > 0)
 	{
-		Param->CurrentValue = Entry.NewValue;
-		History.Add(Entry);
-		ApplyValueToTarget(Entry.ParameterId);
-		OnParameterChanged.Broadcast(Entry.ParameterId, Entry.NewValue);
+		NotifyParametersChanged(ChangedIds);
 	}
 
 	return true;
@@ -392,27 +655,56 @@ bool UTuningSubsystem::RedoChange()
 
 void UTuningSubsystem::ClearHistory()
 {
-	History.Empty();
+	History.Reset();
 	RedoStack.Empty();
 }
 
+void UTuningSubsystem::SetHistoryCapacity(int32 Capacity)
+{
+	History.SetCapacity(Capacity);
+}
+
 void UTuningSubsystem::AddHistoryEntry(const FTuningHistoryEntry& Entry)
 {
-	History.Add(Entry);
+	// 容量を超えた分はバッファが最古のエントリを上書き（ログには全て残る）
+	const int64 Sequence = History.Push(Entry);
+	SessionLog.AppendChange(Sequence, Entry);
+
+	// セッションは範囲のみ更新（エントリは複製しない）
+	SyncCurrentSessionRange();
+}
 
-	// セッションにも追加
+void UTuningSubsystem::SyncCurrentSessionRange()
+{
 	if (CurrentSession.bIsActive)
 	{
-		CurrentSession.Changes.Add(Entry);
+		// Undoでセッション開始前まで戻った場合は開始位置も詰める
+		CurrentSession.EndHistorySequence = History.GetEndSequence();
+		CurrentSession.FirstHistorySequence = FMath::Min(CurrentSession.FirstHistorySequence, CurrentSession.EndHistorySequence);
 	}
 
-	// 最大エントリ数を超えたら古いものを削除
-	while (History.Num() > MaxHistoryEntries)
+	// 終了済みのセッションの変更まで戻した場合は、そのセッションの範囲も詰める
+	const int64 EndSequence = History.GetEndSequence();
+	for (FTuningSession& Session : SessionHistory)
 	{
-		History.RemoveAt(0);
+		Session.EndHistorySequence = FMath::Min(Session.EndHistorySequence, EndSequence);
+		Session.FirstHistorySequence = FMath::Min(Session.FirstHistorySequence, Session.EndHistorySequence);
 	}
 }
 
+const FTuningSession* UTuningSubsystem::FindSession(const FGuid& SessionId) const
+{
+	if (CurrentSession.SessionId == SessionId)
+	{
+		return &CurrentSession;
+	}
+
+	return SessionHistory.FindByPredicate([&SessionId](const FTuningSession& Session)
+	{
+		return Session.SessionId == SessionId;
+	});
+}
+
 // ========== セッション管理 ==========
 
 FTuningSession UTuningSubsystem::StartSession(const FString& SessionName)
@@ -426,6 +718,10 @@ FTuningSession UTuningSubsystem::StartSession(const FString& SessionName)
 	// 新しいセッションを開始
 	CurrentSession = FTuningSession();
 	CurrentSession.SessionName = SessionName;
+	CurrentSession.FirstHistorySequence = History.GetEndSequence();
+	CurrentSession.EndHistorySequence = History.GetEndSequence();
+	SessionLog.AppendSessionBegin(CurrentSession);
+	SessionLog.Flush();
 
 	OnSessionChanged.Broadcast(CurrentSession);
 
@@ -443,6 +739,8 @@ void UTuningSubsystem::EndCurrentSession()
 
 	CurrentSession.Close();
 	SessionHistory.Add(CurrentSession);
+	SessionLog.AppendSessionEnd(CurrentSession);
+	SessionLog.Flush();
 
 	OnSessionChanged.Broadcast(CurrentSession);
 
@@ -465,6 +763,25 @@ TArray<FTuningSession> UTuningSubsystem::GetSessionHistory() const
 	return SessionHistory;
 }
 
+TArray<FTuningHistoryEntry> UTuningSubsystem::GetSessionChanges(const FGuid& SessionId) const
+{
+	TArray<FTuningHistoryEntry> Result;
+
+	// 範囲が全て履歴バッファに残っていればログを読まない
+	const FTuningSession* Session = FindSession(SessionId);
+	if (Session && Session->FirstHistorySequence >= History.GetFirstSequence())
+	{
+		History.GetRange(Session->FirstHistorySequence, Session->EndHistorySequence, Result);
+		return Result;
+	}
+
+	if (SessionLog.IsOpen())
+	{
+		SessionLog.LoadSessionChanges(SessionId, Result);
+	}
+	return Result;
+}
+
 // ========== 比較機能 ==========
 
 TArray<FTuningComparison> UTuningSubsystem::CompareWithDefault() const
@@ -497,33 +814,35 @@ TArray<FTuningComparison> UTuningSubsystem::CompareSessions(const FGuid& Session
 	TArray<FTuningComparison> Result;
 
 	// セッションを検索
-	const FTuningSession* SessionAPtr = nullptr;
-	const FTuningSession* SessionBPtr = nullptr;
-
-	for (const FTuningSession& Session : SessionHistory)
-	{
-		if (Session.SessionId == SessionA) SessionAPtr = &Session;
-		if (Session.SessionId == SessionB) SessionBPtr = &Session;
-	}
+	const FTuningSession* SessionAPtr = FindSession(SessionA);
+	const FTuningSession* SessionBPtr = FindSession(SessionB);
 
 	if (!SessionAPtr || !SessionBPtr)
 	{
 		return Result;
 	}
 
-	// 両セッションの最終値を比較
+	// 両セッションの最終値を比較（変更を古い順に上書き、履歴バッファから破棄済みの分はセッションログから読む）
 	TMap<FName, FTuningValue> ValuesA;
 	TMap<FName, FTuningValue> ValuesB;
 
-	for (const FTuningHistoryEntry& Entry : SessionAPtr->Changes)
+	auto CollectFinalValues = [this](const FTuningSession& Session, TMap<FName, FTuningValue>& OutValues)
 	{
-		ValuesA.Add(Entry.ParameterId, Entry.NewValue);
-	}
+		const TArray<FTuningHistoryEntry> Changes = GetSessionChanges(Session.SessionId);
+		for (const FTuningHistoryEntry& Entry : Changes)
+		{
+			OutValues.Add(Entry.ParameterId, Entry.NewValue);
+		}
 
-	for (const FTuningHistoryEntry& Entry : SessionBPtr->Changes)
-	{
-		ValuesB.Add(Entry.ParameterId, Entry.NewValue);
-	}
+		if (Changes.Num() < Session.GetChangeCount())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Session %s is incomplete for comparison (%d of %d changes available)"),
+				*Session.SessionName, Changes.Num(), Session.GetChangeCount());
+		}
+	};
+
+	CollectFinalValues(*SessionAPtr, ValuesA);
+	CollectFinalValues(*SessionBPtr, ValuesB);
 
 	// 比較
 	TSet<FName> AllParams;
@@ -609,10 +928,15 @@ FTuningPreset UTuningSubsystem::SaveAsPreset(const FString& PresetName, const FS
 
 bool UTuningSubsystem::ApplyPreset(const FTuningPreset& Preset)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::ApplyPreset);
+
+	// 1つのトランザクションとして適用（Undo・通知もまとめて1回）
+	BeginTransaction(FString::Printf(TEXT("Applied preset: %s"), *Preset.PresetName));
 	for (const auto& Pair : Preset.ParameterValues)
 	{
-		SetParameterValue(Pair.Key, Pair.Value, FString::Printf(TEXT("Applied preset: %s"), *Preset.PresetName));
+		SetParameterValue(Pair.Key, Pair.Value);
 	}
+	CommitTransaction();
 
 	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Preset applied: %s"), *Preset.PresetName);
 
@@ -641,46 +965,31 @@ bool UTuningSubsystem::DeletePreset(const FGuid& PresetId)
 
 FTuningBenchmarkResult UTuningSubsystem::RunSafetyBenchmark()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::RunSafetyBenchmark);
+
 	FTuningBenchmarkResult Result;
 	Result.BenchmarkName = TEXT("Safety Benchmark");
 	Result.bPassed = true;
+	Result.CheckedParameterCount = ThresholdTable.Num();
 
-	for (const auto& Pair : Parameters)
-	{
-		const FTuningParameter& Param = Pair.Value;
-		Result.CheckedParameterCount++;
-
-		// 値の閾値チェック
-		ETuningWarningLevel ValueWarning = Param.Threshold.CheckValue(Param.CurrentValue.GetAsFloat());
-
-		// デフォルトからの変化率チェック
-		float PercentChange = Param.CurrentValue.GetPercentChange(Param.DefaultValue);
-		ETuningWarningLevel ChangeWarning = Param.Threshold.CheckChange(PercentChange);
-
-		// より厳しい警告レベルを採用
-		ETuningWarningLevel FinalWarning = FMath::Max(ValueWarning, ChangeWarning);
-
-		if (FinalWarning != ETuningWarningLevel::None)
-		{
-			FTuningComparison Comp;
-			Comp.Parameter = Param;
-			Comp.BeforeValue = Param.DefaultValue;
-			Comp.AfterValue = Param.CurrentValue;
-			Comp.Difference = Param.CurrentValue.GetDifference(Param.DefaultValue);
-			Comp.PercentChange = PercentChange;
-			Comp.WarningLevel = FinalWarning;
+	// 全パラメータを一括判定し、警告のある行のみ比較結果を作る
+	ThresholdTable.Evaluate();
+	Result.Warnings.Reserve(ThresholdTable.GetWarningCount());
+	Result.CriticalWarnings.Reserve(ThresholdTable.GetCriticalCount());
 
-			if (FinalWarning == ETuningWarningLevel::Critical)
-			{
-				Result.CriticalWarnings.Add(Comp);
-				Result.bPassed = false;
-			}
-			else
-			{
-				Result.Warnings.Add(Comp);
-			}
-		}
-	}
+	ThresholdTable.ForEachFlagged([this, &Result](FName ParameterId, ETuningWarningLevel Level, float PercentChange)
+	{
+		const FTuningParameter& Param = Parameters.FindChecked(ParameterId);
+
+		FTuningComparison& Comp = Level == ETuningWarningLevel::Critical ? Result.CriticalWarnings.AddDefaulted_GetRef() : Result.Warnings.AddDefaulted_GetRef();
+		Comp.Parameter = Param;
+		Comp.BeforeValue = Param.DefaultValue;
+		Comp.AfterValue = Param.CurrentValue;
+		Comp.Difference = Param.CurrentValue.GetDifference(Param.DefaultValue);
+		Comp.PercentChange = PercentChange;
+		Comp.WarningLevel = Level;
+	});
+	Result.bPassed = Result.CriticalWarnings.Num() == 0;
 
 	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Benchmark completed: %s (%d warnings, %d critical)"),
 		Result.bPassed ? TEXT("PASSED") : TEXT("FAILED"),
@@ -690,47 +999,25 @@ FTuningBenchmarkResult UTuningSubsystem::RunSafetyBenchmark()
 	return Result;
 }
 
-TArray<FTuningLayerSummary> UTuningSubsystem::GetLayerSummaries() const
+bool UTuningSubsystem::RunSafetyGuardrail(int32& OutWarningCount, int32& OutCriticalCount)
 {
-	TMap<ETuningLayer, FTuningLayerSummary> SummaryMap;
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::RunSafetyGuardrail);
 
-	// 全レイヤーを初期化
-	for (int32 i = 0; i < static_cast<int32>(ETuningLayer::Custom) + 1; ++i)
-	{
-		ETuningLayer Layer = static_cast<ETuningLayer>(i);
-		FTuningLayerSummary Summary;
-		Summary.Layer = Layer;
-		SummaryMap.Add(Layer, Summary);
-	}
+	ThresholdTable.Evaluate();
+	OutWarningCount = ThresholdTable.GetWarningCount();
+	OutCriticalCount = ThresholdTable.GetCriticalCount();
+	return OutCriticalCount == 0;
+}
 
-	// パラメータを集計
-	for (const auto& Pair : Parameters)
+TArray<FTuningLayerSummary> UTuningSubsystem::GetLayerSummaries() const
+{
+	// 値の更新ごとに差分で集計済み
+	TArray<FTuningLayerSummary> Result;
+	Result.Reserve(FTuningThresholdTable::NumLayers);
+	for (int32 i = 0; i < FTuningThresholdTable::NumLayers; ++i)
 	{
-		const FTuningParameter& Param = Pair.Value;
-		FTuningLayerSummary& Summary = SummaryMap[Param.Layer];
-
-		Summary.ParameterCount++;
-
-		// デフォルトから変更されているか
-		if (!FMath::IsNearlyZero(Param.CurrentValue.GetDifference(Param.DefaultValue)))
-		{
-			Summary.ModifiedCount++;
-		}
-
-		// 警告チェック
-		ETuningWarningLevel Warning = Param.Threshold.CheckValue(Param.CurrentValue.GetAsFloat());
-		if (Warning == ETuningWarningLevel::Critical)
-		{
-			Summary.CriticalCount++;
-		}
-		else if (Warning == ETuningWarningLevel::Warning)
-		{
-			Summary.WarningCount++;
-		}
+		Result.Add(ThresholdTable.GetLayerSummary(static_cast<ETuningLayer>(i)));
 	}
-
-	TArray<FTuningLayerSummary> Result;
-	SummaryMap.GenerateValueArray(Result);
 	return Result;
 }
 
@@ -763,6 +1050,178 @@ void UTuningSubsystem::CheckWarnings(const FTuningParameter& Parameter, const FT
 	}
 }
 
+// ========== リモートチューニング ==========
+
+bool UTuningSubsystem::StartRemoteHost(int32 Port, const FString& SessionToken)
+{
+	// 指定が無ければ待ち受けごとに推測できないトークンを生成する
+	const FString Token = SessionToken.IsEmpty() ? FGuid::NewGuid().ToString(EGuidFormats::Digits) : SessionToken;
+	if (!RemoteTransport.StartHost(Port, Token))
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningSubsystem] Remote session token: %s (targets connect with -TuningToken=%s)"), *Token, *Token);
+
+	// 調整済みのパラメータは接続したターゲットへ最初に送る
+	for (const auto& Pair : Parameters)
+	{
+		if (!Pair.Value.CurrentValue.Equals(Pair.Value.DefaultValue))
+		{
+			RemoteTransport.QueueUpdate(Pair.Key, Pair.Value.CurrentValue);
+		}
+	}
+
+	RemoteAcks.Empty();
+	RegisterRemoteTick();
+	return true;
+}
+
+bool UTuningSubsystem::ConnectToRemoteHost(const FString& HostAddress, int32 Port, const FString& SessionToken, const FString& TargetName)
+{
+	return RemoteTarget && RemoteTarget->ConnectToHost(HostAddress, Port, SessionToken, TargetName);
+}
+
+void UTuningSubsystem::StopRemote()
+{
+	UnregisterRemoteTick();
+	RemoteTransport.Stop();
+
+	if (RemoteTarget)
+	{
+		RemoteTarget->Disconnect();
+	}
+}
+
+TArray<FTuningRemoteTargetStatus> UTuningSubsystem::GetRemoteTargets() const
+{
+	TArray<FTuningRemoteTargetStatus> Result;
+	RemoteTransport.GetTargetStatuses(Result);
+	return Result;
+}
+
+TArray<FTuningRemoteAck> UTuningSubsystem::GetRemoteAcks(FName ParameterId) const
+{
+	const TArray<FTuningRemoteAck>* Acks = RemoteAcks.Find(ParameterId);
+	return Acks ? *Acks : TArray<FTuningRemoteAck>();
+}
+
+void UTuningSubsystem::RegisterRemoteTick()
+{
+	if (!RemoteEndFrameHandle.IsValid())
+	{
+		RemoteEndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UTuningSubsystem::OnRemoteEndFrame);
+	}
+}
+
+void UTuningSubsystem::UnregisterRemoteTick()
+{
+	FCoreDelegates::OnEndFrame.Remove(RemoteEndFrameHandle);
+	RemoteEndFrameHandle.Reset();
+}
+
+void UTuningSubsystem::OnRemoteEndFrame()
+{
+	RemoteTransport.Tick();
+
+	if (!RemoteTransport.IsHosting())
+	{
+		UnregisterRemoteTick();
+	}
+}
+
+void UTuningSubsystem::ApplyRemoteBatch(TArray<FTuningRemoteTransport::FRemoteUpdate>& Updates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningSubsystem::ApplyRemoteBatch);
+
+	// 1フレーム分のバッチを1トランザクションとして適用（通知・履歴は1回）
+	// 未登録のパラメータはターゲットのサブシステムがローカルに登録されたプロパティにのみ書き込む
+	BeginTransaction(TEXT("Remote update"));
+	for (FTuningRemoteTransport::FRemoteUpdate& Update : Updates)
+	{
+		const FTuningParameter* Param = Parameters.Find(Update.ParameterId);
+		if (Param && Param->CurrentValue.ValueType == Update.Value.ValueType)
+		{
+			Update.bApplied = SetParameterValue(Update.ParameterId, Update.Value);
+		}
+	}
+	CommitTransaction();
+
+	// 反映後の値を返す
+	for (FTuningRemoteTransport::FRemoteUpdate& Update : Updates)
+	{
+		const FTuningParameter* Param = Parameters.Find(Update.ParameterId);
+		if (Update.bApplied && Param)
+		{
+			Update.Value = Param->CurrentValue;
+		}
+	}
+}
+
+void UTuningSubsystem::OnRemoteAcknowledged(const FTuningRemoteAck& Ack)
+{
+	TArray<FTuningRemoteAck>& Acks = RemoteAcks.FindOrAdd(Ack.ParameterId);
+	if (FTuningRemoteAck* Existing = Acks.FindByPredicate([&Ack](const FTuningRemoteAck& Other) { return Other.TargetName == Ack.TargetName; }))
+	{
+		*Existing = Ack;
+	}
+	else
+	{
+		Acks.Add(Ack);
+	}
+
+	if (!Ack.bApplied)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] %s was not applied on %s"), *Ack.ParameterId.ToString(), *Ack.TargetName);
+	}
+
+	OnRemoteParameterAcknowledged.Broadcast(Ack);
+}
+
+void UTuningSubsystem::StartRemoteFromCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	// ターゲットとして起動した場合はUTuningRemoteTargetSubsystemが接続する（待ち受けはしない）
+	FString HostSpec;
+	if (FParse::Value(CommandLine, TEXT("TuningHost="), HostSpec))
+	{
+		return;
+	}
+
+	// 待ち受けはエディタインスタンスのみ（同じプロセスの他のインスタンスと競合しない）
+	int32 ListenPort = FTuningRemoteTransport::DefaultPort;
+	if (EditorInstance == this && (FParse::Value(CommandLine, TEXT("TuningListen="), ListenPort) || FParse::Param(CommandLine, TEXT("TuningListen"))))
+	{
+		FString SessionToken;
+		FParse::Value(CommandLine, TEXT("TuningToken="), SessionToken);
+		StartRemoteHost(ListenPort, SessionToken);
+	}
+}
+
+// ========== パラメータスイープ ==========
+
+bool UTuningSubsystem::StartParameterSweep(const FTuningSweepConfig& Config)
+{
+	FString Error;
+	if (!SweepRunner.Start(Config, Parameters, Error))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Failed to start sweep %s: %s"), *Config.SweepName, *Error);
+		return false;
+	}
+	return true;
+}
+
+void UTuningSubsystem::CancelParameterSweep()
+{
+	SweepRunner.Cancel();
+}
+
+void UTuningSubsystem::ReportSweepMetric(FName MetricName, float Value)
+{
+	SweepMetrics.Add(MetricName, Value);
+}
+
 // ========== インポート/エクスポート ==========
 
 FString UTuningSubsystem::ExportToJson() const
@@ -825,7 +1284,7 @@ bool UTuningSubsystem::ImportFromJson(const FString& JsonString)
 		Param.CurrentValue.IntValue = ParamObj->GetIntegerField(TEXT("IntValue"));
 		Param.CurrentValue.BoolValue = ParamObj->GetBoolField(TEXT("BoolValue"));
 
-		Parameters.Add(Param.ParameterId, Param);
+		AddParameterInternal(Param);
 	}
 
 	return true;
@@ -833,12 +1292,50 @@ bool UTuningSubsystem::ImportFromJson(const FString& JsonString)
 
 bool UTuningSubsystem::SaveToFile(const FString& FilePath)
 {
-	FString JsonContent = ExportToJson();
-	return FFileHelper::SaveStringToFile(JsonContent, *FilePath);
+	// JSONはエクスポート用
+	if (FPaths::GetExtension(FilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		FString JsonContent = ExportToJson();
+		return FFileHelper::SaveStringToFile(JsonContent, *FilePath);
+	}
+
+	return FTuningStateFile::Save(FilePath, Parameters, Presets);
 }
 
 bool UTuningSubsystem::LoadFromFile(const FString& FilePath)
 {
+	if (FTuningStateFile::IsStateFile(FilePath))
+	{
+		// 一時配列へ読み込み、ファイルの最後まで読めた場合のみ反映する（途中で壊れたファイルで一部だけ置き換えない）
+		TArray<FTuningParameter> LoadedParameters;
+		TArray<FTuningPreset> LoadedPresets;
+		if (!FTuningStateFile::Load(FilePath, LoadedParameters, LoadedPresets))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningSubsystem] Failed to load state file, nothing applied: %s"), *FilePath);
+			return false;
+		}
+
+		for (const FTuningParameter& Parameter : LoadedParameters)
+		{
+			AddParameterInternal(Parameter);
+		}
+
+		// 同じIDのプリセットは置き換え
+		for (FTuningPreset& Preset : LoadedPresets)
+		{
+			if (FTuningPreset* Existing = Presets.FindByPredicate([&Preset](const FTuningPreset& P) { return P.PresetId == Preset.PresetId; }))
+			{
+				*Existing = MoveTemp(Preset);
+			}
+			else
+			{
+				Presets.Add(MoveTemp(Preset));
+			}
+		}
+
+		return true;
+	}
+
 	FString JsonContent;
 	if (!FFileHelper::LoadFileToString(JsonContent, *FilePath))
 	{
@@ -846,3 +1343,19 @@ bool UTuningSubsystem::LoadFromFile(const FString& FilePath)
 	}
 	return ImportFromJson(JsonContent);
 }
+
+TArray<FTuningSession> UTuningSubsystem::GetLoggedSessions() const
+{
+	TArray<FTuningSession> Result;
+	Result.Reserve(SessionLog.GetSessions().Num());
+	for (const FTuningSessionLog::FLoggedSession& Logged : SessionLog.GetSessions())
+	{
+		Result.Add(Logged.Session);
+	}
+	return Result;
+}
+
+FString UTuningSubsystem::GetSessionLogPath() const
+{
+	return SessionLog.IsOpen() ? SessionLog.GetFilePath() : FString();
+}
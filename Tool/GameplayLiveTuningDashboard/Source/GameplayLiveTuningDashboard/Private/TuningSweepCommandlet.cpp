@@ -0,0 +1,30 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningSweepCommandlet.h"
+#include "TuningSweepRunner.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTuningSweepCommandlet, Log, All);
+
+UTuningSweepCommandlet::UTuningSweepCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Runs parameter sweep configurations headlessly for the live tuning dashboard.");
+	HelpUsage = TEXT("-run=TuningSweep -Job=Job.json -Output=Result.json");
+}
+
+int32 UTuningSweepCommandlet::Main(const FString& Params)
+{
+	FString JobPath;
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Job="), JobPath) || !FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		UE_LOG(LogTuningSweepCommandlet, Error, TEXT("Usage: %s"), *HelpUsage);
+		return 1;
+	}
+
+	return FTuningSweepRunner::RunJob(JobPath, OutputPath) ? 0 : 1;
+}
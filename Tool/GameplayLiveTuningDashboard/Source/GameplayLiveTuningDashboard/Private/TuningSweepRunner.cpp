@@ -0,0 +1,538 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningSweepRunner.h"
+#include "TuningSubsystem.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace TuningSweep
+{
+	/** 軸の値をパラメータの型に変換 */
+	bool MakeValue(const FTuningParameter& Parameter, float AxisValue, FTuningValue& OutValue)
+	{
+		OutValue = FTuningValue();
+		OutValue.ValueType = Parameter.CurrentValue.ValueType;
+
+		switch (OutValue.ValueType)
+		{
+		case ETuningValueType::Float:
+			OutValue.FloatValue = AxisValue;
+			return true;
+		case ETuningValueType::Integer:
+			OutValue.IntValue = FMath::RoundToInt(AxisValue);
+			return true;
+		case ETuningValueType::Boolean:
+			OutValue.BoolValue = AxisValue >= 0.5f;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	template <typename StructType>
+	bool SaveJson(const StructType& Struct, const FString& FilePath)
+	{
+		FString Json;
+		return FJsonObjectConverter::UStructToJsonObjectString(Struct, Json) && FFileHelper::SaveStringToFile(Json, *FilePath);
+	}
+
+	template <typename StructType>
+	bool LoadJson(const FString& FilePath, StructType& OutStruct)
+	{
+		FString Json;
+		return FFileHelper::LoadFileToString(Json, *FilePath) && FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutStruct);
+	}
+
+	/** ワーカーの実行ファイル（コンソール版があればそちら） */
+	FString GetWorkerExecutable()
+	{
+		const FString Executable = FPlatformProcess::ExecutablePath();
+		const FString CmdExecutable = FPaths::Combine(FPaths::GetPath(Executable),
+			FPaths::GetBaseFilename(Executable) + TEXT("-Cmd") + FPaths::GetExtension(Executable, true));
+		return FPaths::FileExists(CmdExecutable) ? CmdExecutable : Executable;
+	}
+}
+
+FTuningSweepRunner::~FTuningSweepRunner()
+{
+	if (IsRunning())
+	{
+		Cancel();
+	}
+}
+
+// ========== 構成の展開 ==========
+
+bool FTuningSweepRunner::ExpandConfigurations(const FTuningSweepConfig& InConfig, const TMap<FName, FTuningParameter>& Parameters,
+	TArray<TMap<FName, FTuningValue>>& OutConfigurations, FString& OutError)
+{
+	OutConfigurations.Reset();
+
+	if (InConfig.Axes.Num() == 0)
+	{
+		OutError = TEXT("No sweep axes");
+		return false;
+	}
+
+	// 軸ごとの試行値
+	TArray<TArray<FTuningValue>> AxisValues;
+	int64 Total = 1;
+	for (const FTuningSweepAxis& Axis : InConfig.Axes)
+	{
+		const FTuningParameter* Param = Parameters.Find(Axis.ParameterId);
+		if (!Param)
+		{
+			OutError = FString::Printf(TEXT("Parameter not found: %s"), *Axis.ParameterId.ToString());
+			return false;
+		}
+
+		TArray<float> RawValues = Axis.Values;
+		if (RawValues.Num() == 0)
+		{
+			const int32 Steps = FMath::Max(1, Axis.Steps);
+			for (int32 Step = 0; Step < Steps; ++Step)
+			{
+				const float Alpha = Steps > 1 ? static_cast<float>(Step) / (Steps - 1) : 0.0f;
+				RawValues.Add(FMath::Lerp(Axis.MinValue, Axis.MaxValue, Alpha));
+			}
+		}
+
+		TArray<FTuningValue>& Values = AxisValues.AddDefaulted_GetRef();
+		for (float RawValue : RawValues)
+		{
+			FTuningValue Value;
+			if (!TuningSweep::MakeValue(*Param, RawValue, Value))
+			{
+				OutError = FString::Printf(TEXT("Unsupported value type: %s"), *Axis.ParameterId.ToString());
+				return false;
+			}
+
+			// 整数・真偽値への丸めで同じ値になった分は除く
+			if (!Values.ContainsByPredicate([&Value](const FTuningValue& Existing) { return Existing.Equals(Value); }))
+			{
+				Values.Add(Value);
+			}
+		}
+
+		Total *= Values.Num();
+		if (Total > InConfig.MaxConfigurations)
+		{
+			OutError = FString::Printf(TEXT("Too many configurations (limit %d)"), InConfig.MaxConfigurations);
+			return false;
+		}
+	}
+
+	// 全軸の組み合わせ（最初の軸が最も遅く変わる）
+	OutConfigurations.Reserve(static_cast<int32>(Total));
+	TArray<int32> Indices;
+	Indices.SetNumZeroed(AxisValues.Num());
+	for (int64 Count = 0; Count < Total; ++Count)
+	{
+		TMap<FName, FTuningValue>& Configuration = OutConfigurations.AddDefaulted_GetRef();
+		for (int32 AxisIndex = 0; AxisIndex < AxisValues.Num(); ++AxisIndex)
+		{
+			Configuration.Add(InConfig.Axes[AxisIndex].ParameterId, AxisValues[AxisIndex][Indices[AxisIndex]]);
+		}
+
+		for (int32 AxisIndex = AxisValues.Num() - 1; AxisIndex >= 0; --AxisIndex)
+		{
+			if (++Indices[AxisIndex] < AxisValues[AxisIndex].Num())
+			{
+				break;
+			}
+			Indices[AxisIndex] = 0;
+		}
+	}
+
+	return true;
+}
+
+// ========== 実行 ==========
+
+bool FTuningSweepRunner::Start(const FTuningSweepConfig& InConfig, const TMap<FName, FTuningParameter>& Parameters, FString& OutError)
+{
+	if (IsRunning())
+	{
+		OutError = TEXT("A sweep is already running");
+		return false;
+	}
+
+	TArray<TMap<FName, FTuningValue>> Configurations;
+	if (!ExpandConfigurations(InConfig, Parameters, Configurations, OutError))
+	{
+		return false;
+	}
+
+	Config = InConfig;
+
+	// マップ未指定の場合はエディタで開いているマップ（ワーカーは保存済みの内容を読み込む）
+	if (Config.MapPath.IsEmpty() && GEditor)
+	{
+		if (UWorld* EditorWorld = GEditor->GetEditorWorldContext().World())
+		{
+			Config.MapPath = EditorWorld->GetOutermost()->GetName();
+		}
+	}
+	if (Config.MapPath.IsEmpty())
+	{
+		OutError = TEXT("No map to simulate");
+		return false;
+	}
+
+	// 比較は開始時の値を基準にする
+	Results.Reset(Configurations.Num());
+	for (int32 Index = 0; Index < Configurations.Num(); ++Index)
+	{
+		FTuningSweepResult& Result = Results.AddDefaulted_GetRef();
+		Result.ConfigurationIndex = Index;
+		Result.ParameterValues = MoveTemp(Configurations[Index]);
+
+		for (const TPair<FName, FTuningValue>& Pair : Result.ParameterValues)
+		{
+			const FTuningParameter& Param = Parameters.FindChecked(Pair.Key);
+
+			FTuningComparison& Comp = Result.Comparisons.AddDefaulted_GetRef();
+			Comp.Parameter = Param;
+			Comp.BeforeValue = Param.CurrentValue;
+			Comp.AfterValue = Pair.Value;
+			Comp.Difference = Pair.Value.GetDifference(Param.CurrentValue);
+			Comp.PercentChange = Pair.Value.GetPercentChange(Param.CurrentValue);
+			Comp.WarningLevel = FMath::Max(Param.Threshold.CheckValue(Pair.Value.GetAsFloat()), Param.Threshold.CheckChange(Comp.PercentChange));
+
+			Result.WarningLevel = FMath::Max(Result.WarningLevel, Comp.WarningLevel);
+		}
+	}
+
+	Parameters.GenerateValueArray(JobParameters);
+
+	// ワーカーごとのバッチに分ける
+	const int32 BatchSize = FMath::Max(1, Config.ConfigurationsPerWorker);
+	Batches.Reset();
+	for (int32 Index = 0; Index < Results.Num(); Index += BatchSize)
+	{
+		TArray<int32>& Batch = Batches.AddDefaulted_GetRef();
+		for (int32 Offset = Index; Offset < FMath::Min(Index + BatchSize, Results.Num()); ++Offset)
+		{
+			Batch.Add(Offset);
+		}
+	}
+
+	// 各ワーカーはエディタ1プロセス分のメモリを使うため、既定は物理コア数の半分
+	MaxWorkers = Config.MaxParallelWorkers > 0 ? Config.MaxParallelWorkers : FMath::Max(1, FPlatformMisc::NumberOfCores() / 2);
+	MaxWorkers = FMath::Min(MaxWorkers, Batches.Num());
+
+	WorkingDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GameplayLiveTuningDashboard"), TEXT("Sweeps"), FGuid::NewGuid().ToString());
+	if (!IFileManager::Get().MakeDirectory(*WorkingDirectory, true))
+	{
+		OutError = FString::Printf(TEXT("Failed to create %s"), *WorkingDirectory);
+		return false;
+	}
+
+	NextBatch = 0;
+	FinishedCount = 0;
+	Workers.Reset();
+	StartTime = FDateTime::Now();
+	StartSeconds = FPlatformTime::Seconds();
+
+	while (Workers.Num() < MaxWorkers && NextBatch < Batches.Num())
+	{
+		LaunchWorker(NextBatch++);
+	}
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTuningSweepRunner::Tick), 0.5f);
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningSweep] Started %s: %d configurations, %d workers, map %s"),
+		*Config.SweepName, Results.Num(), MaxWorkers, *Config.MapPath);
+	return true;
+}
+
+bool FTuningSweepRunner::LaunchWorker(int32 BatchIndex)
+{
+	FTuningSweepJob Job;
+	Job.MapPath = Config.MapPath;
+	Job.SimulationSeconds = Config.SimulationSeconds;
+	Job.FixedDeltaSeconds = Config.FixedDeltaSeconds;
+	Job.Parameters = JobParameters;
+	for (int32 ConfigurationIndex : Batches[BatchIndex])
+	{
+		FTuningSweepJobConfiguration& JobConfiguration = Job.Configurations.AddDefaulted_GetRef();
+		JobConfiguration.ConfigurationIndex = ConfigurationIndex;
+		JobConfiguration.Values = Results[ConfigurationIndex].ParameterValues;
+	}
+
+	const FString JobPath = FPaths::Combine(WorkingDirectory, FString::Printf(TEXT("Job_%04d.json"), BatchIndex));
+	const FString OutputPath = FPaths::Combine(WorkingDirectory, FString::Printf(TEXT("Result_%04d.json"), BatchIndex));
+
+	FWorker Worker;
+	Worker.BatchIndex = BatchIndex;
+	Worker.OutputPath = OutputPath;
+
+	if (TuningSweep::SaveJson(Job, JobPath))
+	{
+		const FString Arguments = FString::Printf(TEXT("\"%s\" -run=TuningSweep -Job=\"%s\" -Output=\"%s\" -nullrhi -nosound -unattended -nosplash -nopause"),
+			*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()),
+			*FPaths::ConvertRelativePathToFull(JobPath),
+			*FPaths::ConvertRelativePathToFull(OutputPath));
+
+		Worker.Process = FPlatformProcess::CreateProc(*TuningSweep::GetWorkerExecutable(), *Arguments,
+			true /*bLaunchDetached*/, true /*bLaunchHidden*/, true /*bLaunchReallyHidden*/, nullptr, -1 /*PriorityModifier*/, nullptr, nullptr);
+	}
+
+	if (!Worker.Process.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[TuningSweep] Failed to launch worker for batch %d"), BatchIndex);
+		CollectWorker(Worker, -1);
+		return false;
+	}
+
+	Workers.Add(MoveTemp(Worker));
+	return true;
+}
+
+bool FTuningSweepRunner::Tick(float DeltaTime)
+{
+	for (int32 Index = Workers.Num() - 1; Index >= 0; --Index)
+	{
+		FWorker& Worker = Workers[Index];
+		if (FPlatformProcess::IsProcRunning(Worker.Process))
+		{
+			continue;
+		}
+
+		int32 ReturnCode = -1;
+		FPlatformProcess::GetProcReturnCode(Worker.Process, &ReturnCode);
+		FPlatformProcess::CloseProc(Worker.Process);
+		CollectWorker(Worker, ReturnCode);
+		Workers.RemoveAtSwap(Index);
+	}
+
+	while (Workers.Num() < MaxWorkers && NextBatch < Batches.Num())
+	{
+		LaunchWorker(NextBatch++);
+	}
+
+	if (Workers.Num() == 0 && NextBatch >= Batches.Num())
+	{
+		Complete(false);
+		return false;
+	}
+	return true;
+}
+
+void FTuningSweepRunner::CollectWorker(FWorker& Worker, int32 ReturnCode)
+{
+	// 途中で終了しても結果ファイルには完了した構成まで書かれている
+	FTuningSweepJobOutput Output;
+	TuningSweep::LoadJson(Worker.OutputPath, Output);
+
+	for (const FTuningSweepJobResult& JobResult : Output.Results)
+	{
+		if (Results.IsValidIndex(JobResult.ConfigurationIndex))
+		{
+			FTuningSweepResult& Result = Results[JobResult.ConfigurationIndex];
+			Result.bSucceeded = JobResult.bSucceeded;
+			Result.Metrics = JobResult.Metrics;
+			Result.Error = JobResult.Error;
+		}
+	}
+
+	for (int32 ConfigurationIndex : Batches[Worker.BatchIndex])
+	{
+		FTuningSweepResult& Result = Results[ConfigurationIndex];
+		if (!Result.bSucceeded && Result.Error.IsEmpty())
+		{
+			Result.Error = FString::Printf(TEXT("Worker exited before completion (code %d)"), ReturnCode);
+		}
+	}
+
+	FinishedCount += Batches[Worker.BatchIndex].Num();
+	UE_LOG(LogTemp, Log, TEXT("[TuningSweep] Batch %d finished (%d/%d)"), Worker.BatchIndex, FinishedCount, Results.Num());
+}
+
+void FTuningSweepRunner::Cancel()
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	for (FWorker& Worker : Workers)
+	{
+		FPlatformProcess::TerminateProc(Worker.Process, true);
+		FPlatformProcess::CloseProc(Worker.Process);
+		CollectWorker(Worker, -1);
+	}
+	Workers.Reset();
+
+	Complete(true);
+}
+
+float FTuningSweepRunner::GetProgress() const
+{
+	return Results.Num() > 0 ? static_cast<float>(FinishedCount) / Results.Num() : 0.0f;
+}
+
+void FTuningSweepRunner::Complete(bool bCancelled)
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	// 重み付きスコア（小さいほど良い指標は符号を反転）
+	for (FTuningSweepResult& Result : Results)
+	{
+		Result.Score = 0.0f;
+		for (const FTuningSweepMetric& Metric : Config.Metrics)
+		{
+			if (const float* Value = Result.Metrics.Find(Metric.MetricName))
+			{
+				Result.Score += Metric.Weight * (Metric.bHigherIsBetter ? *Value : -*Value);
+			}
+		}
+	}
+
+	Results.StableSort([](const FTuningSweepResult& A, const FTuningSweepResult& B)
+	{
+		if (A.bSucceeded != B.bSucceeded)
+		{
+			return A.bSucceeded;
+		}
+		return A.Score > B.Score;
+	});
+
+	LastReport = FTuningSweepReport();
+	LastReport.SweepName = Config.SweepName;
+	LastReport.StartTime = StartTime;
+	LastReport.ElapsedSeconds = static_cast<float>(FPlatformTime::Seconds() - StartSeconds);
+	LastReport.ConfigurationCount = Results.Num();
+	LastReport.bCancelled = bCancelled;
+
+	int32 Rank = 0;
+	for (FTuningSweepResult& Result : Results)
+	{
+		Result.Rank = Result.bSucceeded ? ++Rank : 0;
+		if (!Result.bSucceeded)
+		{
+			LastReport.FailedCount++;
+		}
+	}
+	LastReport.Results = MoveTemp(Results);
+
+	Results.Reset();
+	Batches.Reset();
+	JobParameters.Reset();
+	IFileManager::Get().DeleteDirectory(*WorkingDirectory, false, true);
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningSweep] %s %s: %d configurations, %d failed, %.1fs"),
+		*LastReport.SweepName,
+		bCancelled ? TEXT("cancelled") : TEXT("completed"),
+		LastReport.ConfigurationCount,
+		LastReport.FailedCount,
+		LastReport.ElapsedSeconds);
+
+	OnCompleted.ExecuteIfBound(LastReport);
+}
+
+// ========== ワーカー ==========
+
+bool FTuningSweepRunner::RunJob(const FString& JobPath, const FString& OutputPath)
+{
+	FTuningSweepJob Job;
+	if (!TuningSweep::LoadJson(JobPath, Job))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[TuningSweep] Failed to load job: %s"), *JobPath);
+		return false;
+	}
+
+	const float DeltaSeconds = FMath::Max(Job.FixedDeltaSeconds, UE_KINDA_SMALL_NUMBER);
+	const int32 FrameCount = FMath::CeilToInt(Job.SimulationSeconds / DeltaSeconds);
+
+	FTuningSweepJobOutput Output;
+	for (const FTuningSweepJobConfiguration& JobConfiguration : Job.Configurations)
+	{
+		FTuningSweepJobResult& JobResult = Output.Results.AddDefaulted_GetRef();
+		JobResult.ConfigurationIndex = JobConfiguration.ConfigurationIndex;
+
+		// 構成ごとに新しいゲームインスタンスとワールドで実行
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+
+		UTuningSubsystem* Tuning = GameInstance->GetSubsystem<UTuningSubsystem>();
+		Tuning->RegisterParameters(Job.Parameters);
+
+		// アクターのBeginPlay前に値を適用
+		const FDelegateHandle InitializedHandle = FWorldDelegates::OnWorldInitializedActors.AddLambda(
+			[GameInstance, Tuning, &JobConfiguration](const FActorsInitializedParams& Params)
+		{
+			if (Params.World != GameInstance->GetWorld())
+			{
+				return;
+			}
+
+			Tuning->BeginTransaction(TEXT("Sweep configuration"));
+			for (const FTuningParameter& Param : Tuning->GetAllParameters())
+			{
+				Tuning->ApplyValueToTarget(Param.ParameterId);
+			}
+			for (const TPair<FName, FTuningValue>& Pair : JobConfiguration.Values)
+			{
+				Tuning->SetParameterValue(Pair.Key, Pair.Value);
+			}
+			Tuning->CommitTransaction();
+		});
+
+		FString Error;
+		const FURL URL(nullptr, *Job.MapPath, TRAVEL_Absolute);
+		const bool bLoaded = GEngine->LoadMap(*GameInstance->GetWorldContext(), URL, nullptr, Error);
+		FWorldDelegates::OnWorldInitializedActors.Remove(InitializedHandle);
+
+		UWorld* World = GameInstance->GetWorld();
+		if (bLoaded && World)
+		{
+			for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+			{
+				World->Tick(LEVELTICK_All, DeltaSeconds);
+				FTSTicker::GetCoreTicker().Tick(DeltaSeconds);
+				++GFrameCounter;
+			}
+
+			// ゲーム側で最終的な指標を報告する機会
+			Tuning->OnSweepMetricsRequested.Broadcast();
+			JobResult.Metrics = Tuning->GetSweepMetrics();
+			JobResult.bSucceeded = true;
+		}
+		else
+		{
+			JobResult.Error = FString::Printf(TEXT("Failed to load map %s: %s"), *Job.MapPath, *Error);
+		}
+
+		if (World)
+		{
+			World->BeginTearingDown();
+		}
+		GameInstance->Shutdown();
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+		GameInstance->RemoveFromRoot();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogTemp, Log, TEXT("[TuningSweep] Configuration %d %s"),
+			JobResult.ConfigurationIndex, JobResult.bSucceeded ? TEXT("completed") : *JobResult.Error);
+
+		// ワーカーが途中で落ちても完了分は残す
+		TuningSweep::SaveJson(Output, OutputPath);
+	}
+
+	return true;
+}
@@ -0,0 +1,260 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningThresholdTable.h"
+#include <limits>
+
+namespace TuningThresholdTable
+{
+	constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+	constexpr uint8 LevelNone = static_cast<uint8>(ETuningWarningLevel::None);
+	constexpr uint8 LevelWarning = static_cast<uint8>(ETuningWarningLevel::Warning);
+	constexpr uint8 LevelCritical = static_cast<uint8>(ETuningWarningLevel::Critical);
+}
+
+void FTuningThresholdTable::Set(const FTuningParameter& Parameter)
+{
+	using namespace TuningThresholdTable;
+
+	int32 Row = INDEX_NONE;
+	if (const int32* Existing = RowById.Find(Parameter.ParameterId))
+	{
+		Row = *Existing;
+		ApplyLayerContribution(Row, -1);
+	}
+	else
+	{
+		Row = Ids.Add(Parameter.ParameterId);
+		Layers.AddZeroed();
+		CurrentValues.AddZeroed();
+		DefaultValues.AddZeroed();
+		MinValues.AddZeroed();
+		MaxValues.AddZeroed();
+		CriticalMinValues.AddZeroed();
+		CriticalMaxValues.AddZeroed();
+		MaxChangePercents.AddZeroed();
+		FinalLevels.AddZeroed();
+		PercentChanges.AddZeroed();
+		RowById.Add(Parameter.ParameterId, Row);
+	}
+
+	Layers[Row] = static_cast<uint8>(Parameter.Layer);
+	CurrentValues[Row] = Parameter.CurrentValue.GetAsFloat();
+	DefaultValues[Row] = Parameter.DefaultValue.GetAsFloat();
+
+	// 無効な閾値は到達しない値にしてカーネル内の分岐をなくす
+	const FTuningThreshold& Threshold = Parameter.Threshold;
+	MinValues[Row] = Threshold.bEnabled ? Threshold.MinValue : -Infinity;
+	MaxValues[Row] = Threshold.bEnabled ? Threshold.MaxValue : Infinity;
+	CriticalMinValues[Row] = Threshold.bEnabled ? Threshold.CriticalMinValue : -Infinity;
+	CriticalMaxValues[Row] = Threshold.bEnabled ? Threshold.CriticalMaxValue : Infinity;
+	MaxChangePercents[Row] = Threshold.bEnabled ? Threshold.MaxChangePercent : Infinity;
+
+	ApplyLayerContribution(Row, 1);
+	bResultsDirty = true;
+}
+
+void FTuningThresholdTable::UpdateValue(FName ParameterId, const FTuningValue& CurrentValue)
+{
+	const int32* Row = RowById.Find(ParameterId);
+	if (!Row)
+	{
+		return;
+	}
+
+	const float NewValue = CurrentValue.GetAsFloat();
+	if (CurrentValues[*Row] == NewValue)
+	{
+		return;
+	}
+
+	ApplyLayerContribution(*Row, -1);
+	CurrentValues[*Row] = NewValue;
+	ApplyLayerContribution(*Row, 1);
+	bResultsDirty = true;
+}
+
+void FTuningThresholdTable::Reset()
+{
+	RowById.Reset();
+	Ids.Reset();
+	Layers.Reset();
+	CurrentValues.Reset();
+	DefaultValues.Reset();
+	MinValues.Reset();
+	MaxValues.Reset();
+	CriticalMinValues.Reset();
+	CriticalMaxValues.Reset();
+	MaxChangePercents.Reset();
+	FinalLevels.Reset();
+	PercentChanges.Reset();
+	WarningCount = 0;
+	CriticalCount = 0;
+	bResultsDirty = true;
+
+	for (int32 i = 0; i < NumLayers; ++i)
+	{
+		LayerSummaries[i] = FTuningLayerSummary();
+		LayerSummaries[i].Layer = static_cast<ETuningLayer>(i);
+	}
+}
+
+void FTuningThresholdTable::Evaluate()
+{
+	if (!bResultsDirty)
+	{
+		return;
+	}
+
+	WarningCount = 0;
+	CriticalCount = 0;
+
+	const int32 NumRows = Ids.Num();
+	const int32 VectorEnd = NumRows & ~3;
+	EvaluateRange(0, VectorEnd);
+	for (int32 Row = VectorEnd; Row < NumRows; ++Row)
+	{
+		EvaluateRowScalar(Row);
+	}
+
+	bResultsDirty = false;
+}
+
+void FTuningThresholdTable::EvaluateRange(int32 BeginRow, int32 EndRow)
+{
+	using namespace TuningThresholdTable;
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+	const VectorRegister4Float Hundred = VectorSetFloat1(100.0f);
+	const VectorRegister4Float NearlyZero = VectorSetFloat1(UE_SMALL_NUMBER);
+
+	for (int32 Row = BeginRow; Row < EndRow; Row += 4)
+	{
+		const VectorRegister4Float Current = VectorLoad(&CurrentValues[Row]);
+		const VectorRegister4Float Default = VectorLoad(&DefaultValues[Row]);
+		const VectorRegister4Float MaxChange = VectorLoad(&MaxChangePercents[Row]);
+
+		// 値の判定（CheckValue）
+		const VectorRegister4Float CriticalValue = VectorBitwiseOr(
+			VectorCompareLE(Current, VectorLoad(&CriticalMinValues[Row])),
+			VectorCompareGE(Current, VectorLoad(&CriticalMaxValues[Row])));
+		const VectorRegister4Float WarningValue = VectorBitwiseOr(
+			VectorCompareLE(Current, VectorLoad(&MinValues[Row])),
+			VectorCompareGE(Current, VectorLoad(&MaxValues[Row])));
+
+		// デフォルトからの変化率（GetPercentChange、デフォルトがほぼ0なら0%）
+		const VectorRegister4Float AbsDefault = VectorAbs(Default);
+		const VectorRegister4Float HasDefault = VectorCompareGT(AbsDefault, NearlyZero);
+		const VectorRegister4Float Divisor = VectorSelect(HasDefault, AbsDefault, One);
+		const VectorRegister4Float Percent = VectorSelect(HasDefault,
+			VectorMultiply(VectorDivide(VectorSubtract(Current, Default), Divisor), Hundred), Zero);
+		VectorStore(Percent, &PercentChanges[Row]);
+
+		// 変化率の判定（CheckChange）
+		const VectorRegister4Float AbsPercent = VectorAbs(Percent);
+		const VectorRegister4Float CriticalChange = VectorCompareGE(AbsPercent, VectorMultiply(MaxChange, Two));
+		const VectorRegister4Float WarningChange = VectorCompareGE(AbsPercent, MaxChange);
+
+		const int32 CriticalMask = VectorMaskBits(VectorBitwiseOr(CriticalValue, CriticalChange));
+		const int32 WarningMask = VectorMaskBits(VectorBitwiseOr(WarningValue, WarningChange));
+
+		// より厳しいレベルを採用
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const int32 Bit = 1 << Lane;
+			uint8 Level = LevelNone;
+			if (CriticalMask & Bit)
+			{
+				Level = LevelCritical;
+				++CriticalCount;
+			}
+			else if (WarningMask & Bit)
+			{
+				Level = LevelWarning;
+				++WarningCount;
+			}
+			FinalLevels[Row + Lane] = Level;
+		}
+	}
+}
+
+void FTuningThresholdTable::EvaluateRowScalar(int32 Row)
+{
+	using namespace TuningThresholdTable;
+
+	const float Current = CurrentValues[Row];
+	const float Default = DefaultValues[Row];
+	const float MaxChange = MaxChangePercents[Row];
+
+	const float AbsDefault = FMath::Abs(Default);
+	const float Percent = AbsDefault > UE_SMALL_NUMBER ? ((Current - Default) / AbsDefault) * 100.0f : 0.0f;
+	PercentChanges[Row] = Percent;
+
+	const bool bCritical = Current <= CriticalMinValues[Row] || Current >= CriticalMaxValues[Row]
+		|| FMath::Abs(Percent) >= MaxChange * 2.0f;
+	const bool bWarning = Current <= MinValues[Row] || Current >= MaxValues[Row]
+		|| FMath::Abs(Percent) >= MaxChange;
+
+	uint8 Level = LevelNone;
+	if (bCritical)
+	{
+		Level = LevelCritical;
+		++CriticalCount;
+	}
+	else if (bWarning)
+	{
+		Level = LevelWarning;
+		++WarningCount;
+	}
+	FinalLevels[Row] = Level;
+}
+
+void FTuningThresholdTable::ForEachFlagged(TFunctionRef<void(FName, ETuningWarningLevel, float)> Visitor) const
+{
+	for (int32 Row = 0; Row < Ids.Num(); ++Row)
+	{
+		if (FinalLevels[Row] != TuningThresholdTable::LevelNone)
+		{
+			Visitor(Ids[Row], static_cast<ETuningWarningLevel>(FinalLevels[Row]), PercentChanges[Row]);
+		}
+	}
+}
+
+ETuningWarningLevel FTuningThresholdTable::ClassifyValue(int32 Row) const
+{
+	const float Current = CurrentValues[Row];
+	if (Current <= CriticalMinValues[Row] || Current >= CriticalMaxValues[Row])
+	{
+		return ETuningWarningLevel::Critical;
+	}
+	if (Current <= MinValues[Row] || Current >= MaxValues[Row])
+	{
+		return ETuningWarningLevel::Warning;
+	}
+	return ETuningWarningLevel::None;
+}
+
+void FTuningThresholdTable::ApplyLayerContribution(int32 Row, int32 Sign)
+{
+	FTuningLayerSummary& Summary = LayerSummaries[Layers[Row]];
+	Summary.Layer = static_cast<ETuningLayer>(Layers[Row]);
+	Summary.ParameterCount += Sign;
+
+	// サマリーは値の閾値のみ（変化率は含めない）
+	if (!FMath::IsNearlyZero(CurrentValues[Row] - DefaultValues[Row]))
+	{
+		Summary.ModifiedCount += Sign;
+	}
+
+	const ETuningWarningLevel Level = ClassifyValue(Row);
+	if (Level == ETuningWarningLevel::Critical)
+	{
+		Summary.CriticalCount += Sign;
+	}
+	else if (Level == ETuningWarningLevel::Warning)
+	{
+		Summary.WarningCount += Sign;
+	}
+}
@@ -0,0 +1,86 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningTrace.h"
+#include "TuningTypes.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+#if TUNING_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(TuningChannel)
+
+UE_TRACE_EVENT_BEGIN(Tuning, ParameterChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, Source)
+	UE_TRACE_EVENT_FIELD(uint8, ValueType)
+	UE_TRACE_EVENT_FIELD(float, OldValue)
+	UE_TRACE_EVENT_FIELD(float, NewValue)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ParameterId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Tuning, TransactionCommitted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, TransactionId)
+	UE_TRACE_EVENT_FIELD(int32, NumChanges)
+UE_TRACE_EVENT_END()
+
+namespace TuningTrace
+{
+	/** 変更元の表示名 */
+	static const TCHAR* GetSourceName(ETuningTraceSource Source)
+	{
+		switch (Source)
+		{
+		case ETuningTraceSource::Set:
+			return TEXT("Set");
+		case ETuningTraceSource::Cancel:
+			return TEXT("Cancel");
+		case ETuningTraceSource::Undo:
+			return TEXT("Undo");
+		case ETuningTraceSource::Redo:
+			return TEXT("Redo");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+}
+
+#endif
+
+namespace TuningTrace
+{
+	void OutputParameterChanged(FName ParameterId, ETuningTraceSource Source, const FTuningValue& OldValue, const FTuningValue& NewValue)
+	{
+#if TUNING_TRACE_ENABLED
+		if (!TUNING_TRACE_IS_ENABLED())
+		{
+			return;
+		}
+
+		const FString IdString = ParameterId.ToString();
+		UE_TRACE_LOG(Tuning, ParameterChanged, TuningChannel)
+			<< ParameterChanged.Cycle(FPlatformTime::Cycles64())
+			<< ParameterChanged.Source(static_cast<uint8>(Source))
+			<< ParameterChanged.ValueType(static_cast<uint8>(NewValue.ValueType))
+			<< ParameterChanged.OldValue(OldValue.GetAsFloat())
+			<< ParameterChanged.NewValue(NewValue.GetAsFloat())
+			<< ParameterChanged.ParameterId(*IdString, IdString.Len());
+
+		TRACE_BOOKMARK(TEXT("Tuning %s: %s %s -> %s"), GetSourceName(Source), *IdString, *OldValue.ToString(), *NewValue.ToString());
+#endif
+	}
+
+	void OutputTransactionCommitted(int32 TransactionId, int32 NumChanges)
+	{
+#if TUNING_TRACE_ENABLED
+		if (!TUNING_TRACE_IS_ENABLED())
+		{
+			return;
+		}
+
+		UE_TRACE_LOG(Tuning, TransactionCommitted, TuningChannel)
+			<< TransactionCommitted.Cycle(FPlatformTime::Cycles64())
+			<< TransactionCommitted.TransactionId(TransactionId)
+			<< TransactionCommitted.NumChanges(NumChanges);
+#endif
+	}
+}
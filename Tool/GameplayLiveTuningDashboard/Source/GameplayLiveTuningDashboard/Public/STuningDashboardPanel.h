@@ -78,6 +78,12 @@ private:
 	void OnLayerTabChanged(ETuningLayer NewLayer);
 	void OnParameterValueChanged(FName ParameterId, float NewValue);
 	void OnParameterValueCommitted(FName ParameterId, float NewValue, ETextCommit::Type CommitType);
+	void OnSliderMovementBegin();
+	ECheckBoxState GetRemoteHostCheckState() const;
+	void OnRemoteHostCheckStateChanged(ECheckBoxState NewState);
+	FText GetRemoteStatusText() const;
+	FText GetRemoteAckTooltip(FName ParameterId) const;
+	void OnSliderMovementEnd();
 	void OnResetClicked(FName ParameterId);
 	FReply OnUndoClicked();
 	FReply OnRedoClicked();
@@ -114,6 +120,9 @@ private:
 	/** 現在選択中のレイヤー */
 	ETuningLayer CurrentLayer = ETuningLayer::Character;
 
+	/** パラメータ検索文字列 */
+	FString ParameterSearchText;
+
 	/** パラメータリストアイテム */
 	TArray<TSharedPtr<FTuningParameterItem>> ParameterItems;
 
@@ -153,7 +162,10 @@ private:
 	/** 最新のベンチマーク結果 */
 	FTuningBenchmarkResult LastBenchmarkResult;
 
+	/** スピンボックスのドラッグでトランザクションを開いているか */
+	bool bSliderTransactionActive = false;
+
 	/** イベントハンドル */
-	FDelegateHandle OnParameterChangedHandle;
+	FDelegateHandle OnParametersChangedHandle;
 	FDelegateHandle OnWarningTriggeredHandle;
 };
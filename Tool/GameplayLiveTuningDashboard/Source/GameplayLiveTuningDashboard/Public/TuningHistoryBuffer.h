@@ -0,0 +1,96 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningTypes.h"
+
+/**
+ * 変更履歴のリングバッファ
+ * エントリは固定容量のスロットに一度だけ格納され、容量を超えると最古のエントリを上書きする
+ * - 各エントリには追加順の通し番号（シーケンス）が振られ、セッションはシーケンスの範囲で参照する
+ * - パラメータごとに直前の同じパラメータのエントリを連結し、パラメータ別の履歴を全件走査せずに取得する
+ * - 追加・末尾の取り出しはO(1)（容量の変更時のみ再配置）
+ */
+class GAMEPLAYELIVETUNINGDASHBOARD_API FTuningHistoryBuffer
+{
+public:
+	/** 既定の容量 */
+	static constexpr int32 DefaultCapacity = 10000;
+
+	explicit FTuningHistoryBuffer(int32 InCapacity = DefaultCapacity);
+
+	/** 容量を変更（縮小時は古いエントリから破棄、シーケンスは維持） */
+	void SetCapacity(int32 NewCapacity);
+
+	/** 容量 */
+	int32 GetCapacity() const { return Capacity; }
+
+	/** 保持しているエントリ数 */
+	int32 Num() const { return static_cast<int32>(EndSequence - FirstSequence); }
+
+	/** 空か */
+	bool IsEmpty() const { return EndSequence == FirstSequence; }
+
+	/** 保持している最古のエントリのシーケンス */
+	int64 GetFirstSequence() const { return FirstSequence; }
+
+	/** 次に追加されるエントリのシーケンス */
+	int64 GetEndSequence() const { return EndSequence; }
+
+	/**
+	 * エントリを追加（満杯の場合は最古のエントリを破棄）
+	 * @return 追加したエントリのシーケンス
+	 */
+	int64 Push(const FTuningHistoryEntry& Entry);
+
+	/** 最新のエントリを取り出す */
+	bool Pop(FTuningHistoryEntry& OutEntry);
+
+	/** 最新のエントリ（空の場合はnullptr） */
+	const FTuningHistoryEntry* Last() const;
+
+	/** シーケンスのエントリ（破棄済み・範囲外はnullptr） */
+	const FTuningHistoryEntry* Find(int64 Sequence) const;
+
+	/** 新しい順に最大MaxEntries件を取得 */
+	void GetLatest(int32 MaxEntries, TArray<FTuningHistoryEntry>& OutEntries) const;
+
+	/** パラメータの履歴を新しい順に最大MaxEntries件取得 */
+	void GetLatestForParameter(FName ParameterId, int32 MaxEntries, TArray<FTuningHistoryEntry>& OutEntries) const;
+
+	/** シーケンス範囲 [First, End) のうち保持しているエントリを古い順に取得 */
+	void GetRange(int64 First, int64 End, TArray<FTuningHistoryEntry>& OutEntries) const;
+
+	/** 全て破棄（シーケンスは継続） */
+	void Reset();
+
+private:
+	/** スロット */
+	struct FSlot
+	{
+		FTuningHistoryEntry Entry;
+
+		/** 同じパラメータの直前のエントリのシーケンス（無ければINDEX_NONE） */
+		int64 PrevSameParameter = INDEX_NONE;
+	};
+
+	/** シーケンスのスロット位置 */
+	int32 GetSlotIndex(int64 Sequence) const { return static_cast<int32>(Sequence % Capacity); }
+
+	/** 最古のエントリを破棄 */
+	void EvictOldest();
+
+	/** スロット（容量まで必要に応じて拡張） */
+	TArray<FSlot> Slots;
+
+	/** 容量 */
+	int32 Capacity = DefaultCapacity;
+
+	/** 保持範囲 [FirstSequence, EndSequence) */
+	int64 FirstSequence = 0;
+	int64 EndSequence = 0;
+
+	/** パラメータID → 最新のエントリのシーケンス */
+	TMap<FName, int64> LatestByParameter;
+};
@@ -0,0 +1,72 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningTypes.h"
+
+/**
+ * チューニングパラメータの二次インデックス
+ * レイヤー・カテゴリ・タグ → パラメータIDと、ID・表示名・カテゴリの部分文字列検索（トライグラム）を保持する
+ * - レイヤー・カテゴリ・タグのリストは登録順を保つ
+ * - カテゴリ・タグはFStringの比較と同じく大文字小文字を区別しない
+ */
+class GAMEPLAYELIVETUNINGDASHBOARD_API FTuningParameterIndex
+{
+public:
+	/** パラメータを追加（同じIDが登録済みの場合は先にRemoveすること） */
+	void Add(const FTuningParameter& Parameter);
+
+	/** パラメータを削除（登録時と同じ内容を渡す） */
+	void Remove(const FTuningParameter& Parameter);
+
+	/** 全て破棄 */
+	void Reset();
+
+	/** レイヤーのパラメータID */
+	const TArray<FName>& GetByLayer(ETuningLayer Layer) const;
+
+	/** カテゴリのパラメータID */
+	const TArray<FName>& GetByCategory(const FString& Category) const;
+
+	/** タグのパラメータID */
+	const TArray<FName>& GetByTag(const FString& Tag) const;
+
+	/**
+	 * ID・表示名・カテゴリに部分文字列を含むパラメータを検索（大文字小文字を区別しない）
+	 * @param OutIds 一致したID（順序は不定、空のクエリは全件）
+	 */
+	void Search(const FString& Query, TArray<FName>& OutIds) const;
+
+private:
+	/** 検索対象テキストのトライグラムを列挙（重複なし） */
+	static void GatherTrigrams(const FString& Text, TSet<uint32>& OutTrigrams);
+
+	/** 検索スロット（削除済みはIdがNAME_None） */
+	struct FSearchSlot
+	{
+		FName Id;
+		FString Text;
+	};
+
+	/** レイヤー → ID */
+	TMap<ETuningLayer, TArray<FName>> LayerIndex;
+
+	/** カテゴリ → ID */
+	TMap<FString, TArray<FName>> CategoryIndex;
+
+	/** タグ → ID */
+	TMap<FString, TArray<FName>> TagIndex;
+
+	/** 検索スロット（削除済みスロットは再利用） */
+	TArray<FSearchSlot> SearchSlots;
+
+	/** 空きスロット */
+	TArray<int32> FreeSearchSlots;
+
+	/** ID → 検索スロット */
+	TMap<FName, int32> SearchSlotById;
+
+	/** トライグラム → 検索スロット（昇順） */
+	TMap<uint32, TArray<int32>> TrigramIndex;
+};
@@ -0,0 +1,153 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningTypes.h"
+
+class FArchive;
+
+/**
+ * パラメータ・プリセットのバイナリ保存形式
+ * ファイルアーカイブへ1件ずつ直接書き出し・読み込みするため、全体を一度にメモリへ展開しない
+ * ファイルアーカイブはFNameを扱わないため、FNameAsStringProxyArchive経由で名前を文字列として保存する
+ * （JSONはエクスポート用としてUTuningSubsystem::ExportToJsonに残す）
+ */
+struct GAMEPLAYELIVETUNINGDASHBOARD_API FTuningStateFile
+{
+	/** バイナリ形式のファイルか（先頭の識別子で判定） */
+	static bool IsStateFile(const FString& FilePath);
+
+	/**
+	 * ファイルへ保存
+	 * @param Parameters 保存するパラメータ
+	 * @param Presets 保存するプリセット
+	 */
+	static bool Save(const FString& FilePath, const TMap<FName, FTuningParameter>& Parameters, const TArray<FTuningPreset>& Presets);
+
+	/**
+	 * ファイルから読み込み（falseの場合、出力は途中までの内容になるため使わない）
+	 * @param OutParameters 読み込んだパラメータ
+	 * @param OutPresets 読み込んだプリセット
+	 * @return 読み込めたか（形式が異なる場合・IDの無いパラメータがある場合・途中で終わっている場合はfalse）
+	 */
+	static bool Load(const FString& FilePath, TArray<FTuningParameter>& OutParameters, TArray<FTuningPreset>& OutPresets);
+};
+
+/**
+ * 追記専用のセッションログ
+ * セッションの開始・変更・Undo・終了をレコードとして逐次追記し、長いプレイテストでも変更を失わずに少しずつ書き出す
+ * - レコード: [種別 uint8][ペイロードサイズ int32][ペイロード]
+ * - Open時はレコードの見出しのみ走査してセッションの索引を作り、変更はLoadSessionChangesでセッションごとに遅延読み込みする
+ * - 終了レコードの無いセッション（クラッシュ等）は次のセッション開始またはファイル末尾までを読み込む
+ * ゲームスレッド専用
+ */
+class GAMEPLAYELIVETUNINGDASHBOARD_API FTuningSessionLog
+{
+public:
+	/** 索引内のセッション */
+	struct FLoggedSession
+	{
+		/** セッション情報（ログに記録された範囲） */
+		FTuningSession Session;
+
+		/** 開始レコードの位置 */
+		int64 BeginOffset = 0;
+	};
+
+	~FTuningSessionLog();
+
+	/** 既定のログファイルパス */
+	static FString GetDefaultLogPath();
+
+	/**
+	 * ログを開く（無ければ作成、形式が異なる場合は作り直す）
+	 * 既存のレコードからセッションの索引を作る
+	 */
+	bool Open(const FString& FilePath);
+
+	/** 書き出して閉じる */
+	void Close();
+
+	/** 開いているか */
+	bool IsOpen() const { return Writer.IsValid(); }
+
+	/** ログファイルパス */
+	const FString& GetFilePath() const { return FilePath; }
+
+	/** セッション開始を追記 */
+	void AppendSessionBegin(const FTuningSession& Session);
+
+	/** 変更を追記 */
+	void AppendChange(int64 Sequence, const FTuningHistoryEntry& Entry);
+
+	/** Undoを追記（シーケンスがEndSequence以降の変更を、どのセッションのものでも取り消す） */
+	void AppendTruncate(int64 EndSequence);
+
+	/** セッション終了を追記 */
+	void AppendSessionEnd(const FTuningSession& Session);
+
+	/** 追記済みのレコードをディスクへ書き出す */
+	void Flush();
+
+	/** ログに記録されたセッション（開始順） */
+	const TArray<FLoggedSession>& GetSessions() const { return Sessions; }
+
+	/**
+	 * セッションの変更をログから読み込み（古い順、Undoされた変更は除く）
+	 * @return セッションがログにあったか
+	 */
+	bool LoadSessionChanges(const FGuid& SessionId, TArray<FTuningHistoryEntry>& OutChanges) const;
+
+private:
+	/** レコード種別 */
+	enum class ERecordType : uint8
+	{
+		SessionBegin,
+		Change,
+		Truncate,
+		SessionEnd,
+	};
+
+	/** レコードを追記 */
+	void AppendRecord(ERecordType Type, const TArray<uint8>& Payload);
+
+	/** 索引作成の結果 */
+	enum class EIndexResult : uint8
+	{
+		Ok,
+		FormatMismatch,
+		ReadFailed,
+	};
+
+	/**
+	 * 既存のレコードを走査して索引を作る（識別子・バージョンが異なる場合のみFormatMismatch）
+	 * @param OutValidSize 末尾の完全なレコードまでのサイズ（途中で終わったレコードは含まない）
+	 */
+	EIndexResult BuildIndex(int64& OutValidSize);
+
+	/** 索引の全セッションの範囲をEndSequenceまでに詰める（シーケンスはセッション間で共通） */
+	void ApplyTruncate(int64 EndSequence);
+
+	/** 書き込み途中で終わった末尾のレコードを切り捨てる */
+	bool TruncateFile(int64 Size);
+
+	/** セッションの開始・終了レコードのペイロード */
+	static void SerializeSessionBegin(FArchive& Ar, FTuningSession& Session);
+	static void SerializeSessionEnd(FArchive& Ar, FTuningSession& Session);
+
+	/** ログファイルパス */
+	FString FilePath;
+
+	/** 追記用アーカイブ */
+	TUniquePtr<FArchive> Writer;
+
+	/** 索引 */
+	TArray<FLoggedSession> Sessions;
+
+	/** セッションID → 索引 */
+	TMap<FGuid, int32> SessionIndexById;
+
+	/** ペイロードの作業領域 */
+	TArray<uint8> PayloadBuffer;
+};
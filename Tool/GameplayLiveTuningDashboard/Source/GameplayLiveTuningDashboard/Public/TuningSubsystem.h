@@ -5,11 +5,23 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "TuningTypes.h"
+#include "TuningParameterIndex.h"
+#include "TuningHistoryBuffer.h"
+#include "TuningPersistence.h"
+#include "TuningRemoteTargetSubsystem.h"
+#include "TuningSweepRunner.h"
+#include "TuningThresholdTable.h"
+#include "TuningPropertyBinding.h"
 #include "TuningSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnParameterChanged, FName, ParameterId, const FTuningValue&, NewValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnParametersChanged, const TArray<FName>&, ParameterIds);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnParametersChangedNative, const TArray<FName>& /*ParameterIds*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSessionChanged, const FTuningSession&, Session);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWarningTriggered, const FTuningComparison&, Warning);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRemoteParameterAcknowledged, const FTuningRemoteAck&, Ack);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnParameterSweepCompleted, const FTuningSweepReport&, Report);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSweepMetricsRequested);
 
 /**
  * ゲームプレイチューニングサブシステム
@@ -72,6 +84,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	TArray<FTuningParameter> SearchParametersByTag(const FString& Tag) const;
 
+	/**
+	 * パラメータを参照（コピーしない、登録・削除までの間のみ有効）
+	 */
+	const FTuningParameter* FindParameter(FName ParameterId) const { return Parameters.Find(ParameterId); }
+
+	/**
+	 * レイヤーのパラメータIDを取得（登録順）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FName> GetParameterIdsByLayer(ETuningLayer Layer) const { return ParameterIndex.GetByLayer(Layer); }
+
+	/**
+	 * カテゴリのパラメータIDを取得（登録順）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FName> GetParameterIdsByCategory(const FString& Category) const { return ParameterIndex.GetByCategory(Category); }
+
+	/**
+	 * タグのパラメータIDを取得（登録順）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FName> GetParameterIdsByTag(const FString& Tag) const { return ParameterIndex.GetByTag(Tag); }
+
+	/**
+	 * ID・表示名・カテゴリに部分文字列を含むパラメータIDを検索（大文字小文字を区別しない）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FName> SearchParameterIds(const FString& Query) const;
+
+	/**
+	 * 二次インデックスを参照（ID配列をコピーせずに使う場合）
+	 */
+	const FTuningParameterIndex& GetParameterIndex() const { return ParameterIndex; }
+
 	// ========== 値の変更 ==========
 
 	/**
@@ -116,6 +162,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	bool ApplyValueToTarget(FName ParameterId);
 
+	/**
+	 * 解決済みの適用先バインディングを破棄（次回の適用時に再解決）
+	 * ホットリロード・オブジェクト差し替え時は自動で呼ばれる
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	void InvalidatePropertyBindings();
+
+	// ========== トランザクション ==========
+
+	/**
+	 * トランザクションを開始（ネスト可、最も外側のCommitで確定）
+	 * トランザクション内の変更は即座に適用されるが、履歴・警告・通知はCommit時にまとめて行う
+	 * 同じパラメータへの複数回の変更は1件（開始時の値 → 最終値）にまとめられる
+	 * @param Description 履歴のコメント（変更時にコメントが無い場合に使用）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	void BeginTransaction(const FString& Description = TEXT(""));
+
+	/**
+	 * トランザクションを確定
+	 * 最も外側の場合、変更を1つのトランザクションIDで履歴に記録し、OnParametersChangedを1回だけ発火する
+	 * @return 記録した変更数（内側のCommit、または値が元に戻っていた場合は0）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	int32 CommitTransaction();
+
+	/**
+	 * トランザクションを取り消し、開始前の値に戻す（ネスト中でも全体を取り消す）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	void CancelTransaction();
+
+	/** トランザクション中か */
+	UFUNCTION(BlueprintPure, Category = "Tuning")
+	bool IsInTransaction() const { return TransactionDepth > 0; }
+
 	// ========== 履歴管理 ==========
 
 	/**
@@ -131,13 +213,13 @@ public:
 	TArray<FTuningHistoryEntry> GetParameterHistory(FName ParameterId, int32 MaxEntries = 50) const;
 
 	/**
-	 * 変更を取り消し（Undo）
+	 * 変更を取り消し（Undo、トランザクション単位）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	bool UndoLastChange();
 
 	/**
-	 * 取り消しをやり直し（Redo）
+	 * 取り消しをやり直し（Redo、トランザクション単位）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	bool RedoChange();
@@ -148,6 +230,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	void ClearHistory();
 
+	/**
+	 * 履歴の保持件数を設定（縮小時は古いエントリから破棄）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	void SetHistoryCapacity(int32 Capacity);
+
+	/** 履歴の保持件数 */
+	UFUNCTION(BlueprintPure, Category = "Tuning")
+	int32 GetHistoryCapacity() const { return History.GetCapacity(); }
+
 	// ========== セッション管理 ==========
 
 	/**
@@ -174,6 +266,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	TArray<FTuningSession> GetSessionHistory() const;
 
+	/**
+	 * セッションの変更を古い順に取得
+	 * 履歴バッファに全て残っていればそこから、それ以外（過去の起動分・破棄済み）はセッションログから読み込む
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FTuningHistoryEntry> GetSessionChanges(const FGuid& SessionId) const;
+
 	// ========== 比較機能 ==========
 
 	/**
@@ -184,6 +283,7 @@ public:
 
 	/**
 	 * 2つのセッションを比較
+	 * 各セッションの最終値はGetSessionChangesから求める（変更が欠けているセッションは警告を出す）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	TArray<FTuningComparison> CompareSessions(const FGuid& SessionA, const FGuid& SessionB) const;
@@ -228,12 +328,95 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	FTuningBenchmarkResult RunSafetyBenchmark();
 
+	/**
+	 * 安全判定の件数のみを取得（比較結果を作らないため毎フレームの監視向け）
+	 * @return 危険警告が無いか
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	bool RunSafetyGuardrail(int32& OutWarningCount, int32& OutCriticalCount);
+
 	/**
 	 * レイヤーのサマリーを取得
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	TArray<FTuningLayerSummary> GetLayerSummaries() const;
 
+	// ========== リモートチューニング ==========
+
+	/**
+	 * ダッシュボード側として待ち受けを開始
+	 * 以降の変更はフレーム境界でまとめて、接続中の全ターゲットへ変わった分のみ送られる
+	 * 起動時に -TuningListen[=Port] [-TuningToken=Token] を指定しても開始できる
+	 * @param SessionToken ターゲットが接続時に送るトークン（空の場合は生成してログに出す）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	bool StartRemoteHost(int32 Port = 41580, const FString& SessionToken = TEXT(""));
+
+	/**
+	 * ターゲットとしてダッシュボードへ接続（UTuningRemoteTargetSubsystem::ConnectToHostへ転送）
+	 * 受信した変更はフレーム境界でまとめて登録済みパラメータへ適用し、反映結果を返す
+	 * 起動時に -TuningHost=Address[:Port] -TuningToken=Token を指定しても接続できる
+	 * @param SessionToken ダッシュボードのセッショントークン
+	 * @param TargetName ダッシュボードに表示される名前（空の場合はマシン名・プロセスID・ネットモードから生成）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	bool ConnectToRemoteHost(const FString& HostAddress, int32 Port, const FString& SessionToken, const FString& TargetName = TEXT(""));
+
+	/** リモート接続を全て閉じる */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	void StopRemote();
+
+	/** ダッシュボード側として待ち受け中か */
+	UFUNCTION(BlueprintPure, Category = "Tuning|Remote")
+	bool IsRemoteHosting() const { return RemoteTransport.IsHosting(); }
+
+	/** 待ち受け中のセッショントークン（ターゲットの -TuningToken に渡す） */
+	UFUNCTION(BlueprintPure, Category = "Tuning|Remote")
+	FString GetRemoteSessionToken() const { return RemoteTransport.GetSessionToken(); }
+
+	/** 接続中のターゲット */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	TArray<FTuningRemoteTargetStatus> GetRemoteTargets() const;
+
+	/** パラメータのターゲットごとの最新の反映確認 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	TArray<FTuningRemoteAck> GetRemoteAcks(FName ParameterId) const;
+
+	// ========== パラメータスイープ ==========
+
+	/**
+	 * パラメータスイープを開始
+	 * 軸の組み合わせごとにヘッドレスのワーカープロセスでマップをシミュレーションし、評価指標で順位付けする
+	 * ワーカーは保存済みのマップを読み込み、現在のパラメータ値に構成の値を上書きして適用する
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Sweep")
+	bool StartParameterSweep(const FTuningSweepConfig& Config);
+
+	/** スイープを中止（完了した構成までの結果でレポートを作る） */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Sweep")
+	void CancelParameterSweep();
+
+	/** スイープ実行中か */
+	UFUNCTION(BlueprintPure, Category = "Tuning|Sweep")
+	bool IsParameterSweepRunning() const { return SweepRunner.IsRunning(); }
+
+	/** 完了した構成の割合（0〜1） */
+	UFUNCTION(BlueprintPure, Category = "Tuning|Sweep")
+	float GetParameterSweepProgress() const { return SweepRunner.GetProgress(); }
+
+	/** 最後に完了したスイープのレポート */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Sweep")
+	FTuningSweepReport GetLastSweepReport() const { return SweepRunner.GetLastReport(); }
+
+	/**
+	 * スイープの評価指標を報告（ワーカーでのシミュレーション中にゲーム側から呼ぶ、同じ名前は上書き）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Sweep")
+	void ReportSweepMetric(FName MetricName, float Value);
+
+	/** 報告された評価指標 */
+	const TMap<FName, float>& GetSweepMetrics() const { return SweepMetrics; }
+
 	// ========== インポート/エクスポート ==========
 
 	/**
@@ -250,22 +433,40 @@ public:
 
 	/**
 	 * ファイルに保存
+	 * 拡張子が .json の場合はJSON（パラメータのみ）、それ以外はバイナリ（パラメータ・プリセット）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	bool SaveToFile(const FString& FilePath);
 
 	/**
-	 * ファイルから読み込み
+	 * ファイルから読み込み（形式は先頭の識別子で判定）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tuning")
 	bool LoadFromFile(const FString& FilePath);
 
+	/**
+	 * セッションログに記録された全セッション（過去のエディタ起動分を含む、変更は含まない）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning")
+	TArray<FTuningSession> GetLoggedSessions() const;
+
+	/** セッションログのパス（ログが開けなかった場合は空） */
+	UFUNCTION(BlueprintPure, Category = "Tuning")
+	FString GetSessionLogPath() const;
+
 	// ========== イベント ==========
 
-	/** パラメータ変更時 */
+	/** パラメータ変更時（変更されたパラメータごとに1回、トランザクション・プリセット適用・Undo/Redoを含む） */
 	UPROPERTY(BlueprintAssignable, Category = "Tuning")
 	FOnParameterChanged OnParameterChanged;
 
+	/** パラメータ変更時（トランザクション・Undo/Redo単位で1回、変更されたID） */
+	UPROPERTY(BlueprintAssignable, Category = "Tuning")
+	FOnParametersChanged OnParametersChanged;
+
+	/** OnParametersChangedのC++版（Slate等のラムダ購読用） */
+	FOnParametersChangedNative OnParametersChangedNative;
+
 	/** セッション変更時 */
 	UPROPERTY(BlueprintAssignable, Category = "Tuning")
 	FOnSessionChanged OnSessionChanged;
@@ -274,24 +475,107 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Tuning")
 	FOnWarningTriggered OnWarningTriggered;
 
+	/** リモートターゲットで変更が反映された時（ターゲットのOnParameterChangedの折り返し） */
+	UPROPERTY(BlueprintAssignable, Category = "Tuning|Remote")
+	FOnRemoteParameterAcknowledged OnRemoteParameterAcknowledged;
+
+	/** スイープの完了・中止時 */
+	UPROPERTY(BlueprintAssignable, Category = "Tuning|Sweep")
+	FOnParameterSweepCompleted OnParameterSweepCompleted;
+
+	/** ワーカーでのシミュレーション終了直前（最終的な評価指標をReportSweepMetricで報告する） */
+	UPROPERTY(BlueprintAssignable, Category = "Tuning|Sweep")
+	FOnSweepMetricsRequested OnSweepMetricsRequested;
+
 protected:
 	/** 履歴にエントリを追加 */
 	void AddHistoryEntry(const FTuningHistoryEntry& Entry);
 
+	/** アクティブなセッションの範囲を履歴の終端に合わせる（Undoで戻した終了済みセッションの範囲も詰める） */
+	void SyncCurrentSessionRange();
+
+	/** IDのセッション（現在のセッションを含む） */
+	const FTuningSession* FindSession(const FGuid& SessionId) const;
+
+	/** 変更されたパラメータを通知（OnParameterChangedはパラメータごと、その後OnParametersChangedをまとめて1回） */
+	void NotifyParametersChanged(const TArray<FName>& ChangedIds);
+
+	/** 履歴・パラメータに記録する変更者（OSのユーザー名、取得できなければマシン名） */
+	static const FString& GetModifiedBy();
+
 	/** 警告をチェック */
 	void CheckWarnings(const FTuningParameter& Parameter, const FTuningValue& OldValue, const FTuningValue& NewValue);
 
 	/** プロパティに値を適用 */
 	bool ApplyValueToProperty(UObject* Object, const FString& PropertyName, const FTuningValue& Value);
 
+	/** パラメータマップとインデックスに追加（同じIDは置き換え） */
+	void AddParameterInternal(const FTuningParameter& Parameter);
+
+	/** パラメータの適用先バインディングを取得（未解決・無効なら解決し直す、解決できなければnull） */
+	const FTuningPropertyBinding* ResolvePropertyBinding(const FTuningParameter& Parameter);
+
+	/** オブジェクト差し替え時（Blueprint再コンパイル等） */
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+
+	/** リモートのフレーム境界処理を登録・解除 */
+	void RegisterRemoteTick();
+	void UnregisterRemoteTick();
+
+	/** フレーム終了時にホストの送受信を行う */
+	void OnRemoteEndFrame();
+
+	/** ターゲット: 受信したバッチのうち登録済みパラメータを1トランザクションで適用 */
+	void ApplyRemoteBatch(TArray<FTuningRemoteTransport::FRemoteUpdate>& Updates);
+
+	/** ホスト: ターゲットからの反映確認 */
+	void OnRemoteAcknowledged(const FTuningRemoteAck& Ack);
+
+	/** 起動引数で待ち受けを開始 */
+	void StartRemoteFromCommandLine();
+
 private:
 	/** パラメータマップ */
 	UPROPERTY()
 	TMap<FName, FTuningParameter> Parameters;
 
-	/** 変更履歴 */
+	/** レイヤー・カテゴリ・タグ・検索のインデックス（Parametersと同期） */
+	FTuningParameterIndex ParameterIndex;
+
+	/** 安全判定用の数値ミラー（Parametersと同期、レイヤーサマリーも保持） */
+	FTuningThresholdTable ThresholdTable;
+
+	/** パラメータID → 解決済みの適用先（対象は弱参照） */
+	TMap<FName, FTuningPropertyBinding> PropertyBindings;
+
+	/** バインディング無効化用のイベントハンドル */
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+
+	/** 変更履歴（セッションはシーケンス範囲で参照） */
+	FTuningHistoryBuffer History;
+
+	/** セッションの追記ログ（エディタインスタンスのみ） */
+	FTuningSessionLog SessionLog;
+
+	/** リモートチューニングの待ち受け（ホスト側） */
+	FTuningRemoteTransport RemoteTransport;
+
+	/** リモートチューニングの受信（ターゲット側、同じゲームインスタンスのランタイムサブシステム） */
 	UPROPERTY()
-	TArray<FTuningHistoryEntry> History;
+	TObjectPtr<UTuningRemoteTargetSubsystem> RemoteTarget;
+
+	/** ホストのフレーム終了ハンドル */
+	FDelegateHandle RemoteEndFrameHandle;
+
+	/** パラメータID → ターゲットごとの最新の反映確認 */
+	TMap<FName, TArray<FTuningRemoteAck>> RemoteAcks;
+
+	/** パラメータスイープの実行 */
+	FTuningSweepRunner SweepRunner;
+
+	/** ワーカー: 報告された評価指標 */
+	TMap<FName, float> SweepMetrics;
 
 	/** Redo用スタック */
 	UPROPERTY()
@@ -309,8 +593,27 @@ private:
 	UPROPERTY()
 	TArray<FTuningPreset> Presets;
 
-	/** 履歴の最大エントリ数 */
-	static const int32 MaxHistoryEntries = 1000;
+	/** トランザクション中の変更（開始時の値） */
+	struct FPendingChange
+	{
+		FTuningValue OriginalValue;
+		FString Comment;
+	};
+
+	/** トランザクションのネスト数 */
+	int32 TransactionDepth = 0;
+
+	/** 最も外側のトランザクションの説明 */
+	FString TransactionDescription;
+
+	/** トランザクション中に変更されたパラメータ（最初の変更順） */
+	TArray<FName> TransactionChangeOrder;
+
+	/** パラメータID → トランザクション中の変更 */
+	TMap<FName, FPendingChange> TransactionChanges;
+
+	/** 次に割り当てるトランザクションID */
+	int32 NextTransactionId = 1;
 
 	/** シングルトンインスタンス（エディタ用） */
 	static UTuningSubsystem* EditorInstance;
@@ -0,0 +1,26 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TuningSweepCommandlet.generated.h"
+
+/**
+ * パラメータスイープのワーカーコマンドレット
+ * FTuningSweepRunnerがエディタから起動し、ジョブファイルの構成を順にヘッドレスでシミュレーションして結果ファイルに書き出す
+ *
+ *   UnrealEditor-Cmd.exe Project.uproject -run=TuningSweep -Job=Job.json -Output=Result.json -nullrhi
+ */
+UCLASS()
+class GAMEPLAYELIVETUNINGDASHBOARD_API UTuningSweepCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UTuningSweepCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
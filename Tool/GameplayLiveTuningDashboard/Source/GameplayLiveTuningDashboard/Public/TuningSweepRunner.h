@@ -0,0 +1,188 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformProcess.h"
+#include "TuningTypes.h"
+#include "TuningSweepRunner.generated.h"
+
+/**
+ * ワーカーへ渡す1構成
+ */
+USTRUCT()
+struct FTuningSweepJobConfiguration
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ConfigurationIndex = 0;
+
+	UPROPERTY()
+	TMap<FName, FTuningValue> Values;
+};
+
+/**
+ * ワーカーのジョブファイル
+ */
+USTRUCT()
+struct FTuningSweepJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString MapPath;
+
+	UPROPERTY()
+	float SimulationSeconds = 0.0f;
+
+	UPROPERTY()
+	float FixedDeltaSeconds = 0.0f;
+
+	/** 開始時のパラメータ（構成の値以外は現在値を適用） */
+	UPROPERTY()
+	TArray<FTuningParameter> Parameters;
+
+	UPROPERTY()
+	TArray<FTuningSweepJobConfiguration> Configurations;
+};
+
+/**
+ * ワーカーが返す1構成の結果
+ */
+USTRUCT()
+struct FTuningSweepJobResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ConfigurationIndex = 0;
+
+	UPROPERTY()
+	bool bSucceeded = false;
+
+	UPROPERTY()
+	TMap<FName, float> Metrics;
+
+	UPROPERTY()
+	FString Error;
+};
+
+/**
+ * ワーカーの結果ファイル（構成を終えるたびに書き直す）
+ */
+USTRUCT()
+struct FTuningSweepJobOutput
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FTuningSweepJobResult> Results;
+};
+
+/**
+ * パラメータスイープの実行
+ * 軸の組み合わせを構成に展開し、ヘッドレスのワーカープロセス（UTuningSweepCommandlet）へ分けて並列に実行する
+ * - ワーカーは構成ごとにマップを読み込み、UTuningSubsystem経由で値を適用して固定フレーム時間でシミュレーションする
+ * - ジョブと結果はSaved以下のJSONファイルで受け渡し、完了したワーカーの分から次のワーカーを起動する
+ * - 全構成の完了後に評価指標の重み付きスコアで順位付けする
+ * エディタのゲームスレッド専用
+ */
+class GAMEPLAYELIVETUNINGDASHBOARD_API FTuningSweepRunner
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnCompleted, const FTuningSweepReport& /*Report*/);
+
+	/** 全構成の完了・中止時 */
+	FOnCompleted OnCompleted;
+
+	~FTuningSweepRunner();
+
+	/**
+	 * スイープを開始
+	 * @param Parameters 開始時のパラメータ（比較の基準、ワーカーにも渡す）
+	 * @param OutError 開始できなかった理由
+	 */
+	bool Start(const FTuningSweepConfig& Config, const TMap<FName, FTuningParameter>& Parameters, FString& OutError);
+
+	/** 実行中のワーカーを終了して中止（それまでの結果でレポートを作る） */
+	void Cancel();
+
+	/** 実行中か */
+	bool IsRunning() const { return TickHandle.IsValid(); }
+
+	/** 完了した構成の割合（0〜1） */
+	float GetProgress() const;
+
+	/** 最後のレポート */
+	const FTuningSweepReport& GetLastReport() const { return LastReport; }
+
+	/**
+	 * 軸の組み合わせを構成に展開（値はパラメータの型に合わせ、軸内の重複は除く）
+	 * @return 展開できたか（パラメータが無い・型が非対応・上限超過の場合はfalse）
+	 */
+	static bool ExpandConfigurations(const FTuningSweepConfig& Config, const TMap<FName, FTuningParameter>& Parameters,
+		TArray<TMap<FName, FTuningValue>>& OutConfigurations, FString& OutError);
+
+	/** ワーカー1つ分の構成を実行する（UTuningSweepCommandletから呼ぶ） */
+	static bool RunJob(const FString& JobPath, const FString& OutputPath);
+
+private:
+	/** 起動中のワーカー */
+	struct FWorker
+	{
+		FProcHandle Process;
+		int32 BatchIndex = INDEX_NONE;
+		FString OutputPath;
+	};
+
+	/** ワーカーの監視 */
+	bool Tick(float DeltaTime);
+
+	/** 次のバッチのワーカーを起動 */
+	bool LaunchWorker(int32 BatchIndex);
+
+	/** 終了したワーカーの結果を取り込む */
+	void CollectWorker(FWorker& Worker, int32 ReturnCode);
+
+	/** 順位付けしてレポートを確定 */
+	void Complete(bool bCancelled);
+
+	/** スイープの設定 */
+	FTuningSweepConfig Config;
+
+	/** 作業ディレクトリ（ジョブ・結果ファイル） */
+	FString WorkingDirectory;
+
+	/** 構成の値と比較（構成番号順） */
+	TArray<FTuningSweepResult> Results;
+
+	/** ワーカーに渡すパラメータ */
+	TArray<FTuningParameter> JobParameters;
+
+	/** バッチ（構成番号） */
+	TArray<TArray<int32>> Batches;
+
+	/** 次に起動するバッチ */
+	int32 NextBatch = 0;
+
+	/** 同時に起動するワーカー数 */
+	int32 MaxWorkers = 1;
+
+	/** 結果を受け取った構成数 */
+	int32 FinishedCount = 0;
+
+	/** 起動中のワーカー */
+	TArray<FWorker> Workers;
+
+	/** 開始時刻 */
+	FDateTime StartTime;
+	double StartSeconds = 0.0;
+
+	/** 監視用のティッカー */
+	FTSTicker::FDelegateHandle TickHandle;
+
+	/** 最後のレポート */
+	FTuningSweepReport LastReport;
+};
@@ -0,0 +1,94 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningTypes.h"
+
+/**
+ * 安全閾値判定用の数値ミラー（Struct of Arrays）
+ * パラメータの現在値・デフォルト値・閾値を列ごとの連続配列に保持し、全パラメータの判定を4要素ずつのSIMDで一括実行する
+ * - 閾値が無効なパラメータは閾値を±無限大にして分岐なしで「なし」に判定させる
+ * - レイヤーサマリー（パラメータ数・変更数・値の警告数）は値の更新ごとに差分で更新する
+ * - 判定結果は内部の配列に書き込み、値が変わらない限り再計算しない（判定時のメモリ確保なし）
+ * 判定ロジックはFTuningThreshold::CheckValue / CheckChangeと同じ
+ */
+class GAMEPLAYELIVETUNINGDASHBOARD_API FTuningThresholdTable
+{
+public:
+	/** レイヤー数 */
+	static constexpr int32 NumLayers = static_cast<int32>(ETuningLayer::Custom) + 1;
+
+	FTuningThresholdTable() { Reset(); }
+
+	/** パラメータを追加・置き換え（値と閾値の両方を反映） */
+	void Set(const FTuningParameter& Parameter);
+
+	/** 現在値のみ更新 */
+	void UpdateValue(FName ParameterId, const FTuningValue& CurrentValue);
+
+	/** 全て破棄 */
+	void Reset();
+
+	/** パラメータ数 */
+	int32 Num() const { return Ids.Num(); }
+
+	/** 全パラメータを一括判定（値が変わっていなければ前回の結果を使う） */
+	void Evaluate();
+
+	/** 判定結果の件数（Evaluate後） */
+	int32 GetWarningCount() const { return WarningCount; }
+	int32 GetCriticalCount() const { return CriticalCount; }
+
+	/**
+	 * 警告以上の行を列挙（Evaluate後）
+	 * @param Visitor (パラメータID, 最終レベル, デフォルトからの変化率)
+	 */
+	void ForEachFlagged(TFunctionRef<void(FName, ETuningWarningLevel, float)> Visitor) const;
+
+	/** レイヤーサマリー（差分更新済み） */
+	const FTuningLayerSummary& GetLayerSummary(ETuningLayer Layer) const { return LayerSummaries[static_cast<int32>(Layer)]; }
+
+private:
+	/** 行の寄与をレイヤーサマリーへ加算・減算 */
+	void ApplyLayerContribution(int32 Row, int32 Sign);
+
+	/** 値の判定（単一行、サマリー用） */
+	ETuningWarningLevel ClassifyValue(int32 Row) const;
+
+	/** 4要素単位の判定カーネル */
+	void EvaluateRange(int32 BeginRow, int32 EndRow);
+
+	/** スカラー判定（端数） */
+	void EvaluateRowScalar(int32 Row);
+
+	/** パラメータID → 行 */
+	TMap<FName, int32> RowById;
+
+	/** 行ごとの列 */
+	TArray<FName> Ids;
+	TArray<uint8> Layers;
+	TArray<float> CurrentValues;
+	TArray<float> DefaultValues;
+	TArray<float> MinValues;
+	TArray<float> MaxValues;
+	TArray<float> CriticalMinValues;
+	TArray<float> CriticalMaxValues;
+	TArray<float> MaxChangePercents;
+
+	/** 判定結果（ETuningWarningLevel） */
+	TArray<uint8> FinalLevels;
+
+	/** 判定結果: デフォルトからの変化率 */
+	TArray<float> PercentChanges;
+
+	/** 判定結果の件数 */
+	int32 WarningCount = 0;
+	int32 CriticalCount = 0;
+
+	/** 前回の判定以降に値が変わったか */
+	bool bResultsDirty = true;
+
+	/** レイヤーサマリー */
+	FTuningLayerSummary LayerSummaries[NumLayers];
+};
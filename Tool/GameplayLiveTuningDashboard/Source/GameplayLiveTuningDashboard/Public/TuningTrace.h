@@ -0,0 +1,49 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+struct FTuningValue;
+
+/** トレース出力の有無（Shipping以外で有効） */
+#if !defined(TUNING_TRACE_ENABLED)
+#define TUNING_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if TUNING_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(TuningChannel, GAMEPLAYELIVETUNINGDASHBOARD_API);
+
+/** チャンネルが有効か */
+#define TUNING_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(TuningChannel)
+#else
+#define TUNING_TRACE_IS_ENABLED() false
+#endif
+
+/**
+ * 値の変更元
+ */
+enum class ETuningTraceSource : uint8
+{
+	Set,
+	Cancel,
+	Undo,
+	Redo
+};
+
+/**
+ * チューニングのトレース出力
+ * -trace=Tuning（または Trace.Enable Tuning）で有効化する
+ * - Tuning.ParameterChanged: サイクル・パラメータID・変更元・変更前後の値（GetAsFloat）
+ * - Tuning.TransactionCommitted: サイクル・トランザクションID・変更数
+ * 同じ内容をブックマークとしても出力するため、Timing Viewのフレームと並べて確認できる
+ */
+namespace TuningTrace
+{
+	/** パラメータの変更を出力 */
+	GAMEPLAYELIVETUNINGDASHBOARD_API void OutputParameterChanged(FName ParameterId, ETuningTraceSource Source, const FTuningValue& OldValue, const FTuningValue& NewValue);
+
+	/** トランザクションの確定を出力 */
+	GAMEPLAYELIVETUNINGDASHBOARD_API void OutputTransactionCommitted(int32 TransactionId, int32 NumChanges);
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TuningRemoteTypes.h"
 #include "TuningTypes.generated.h"
 
 /**
@@ -20,19 +21,6 @@ enum class ETuningLayer : uint8
 	Custom		UMETA(DisplayName = "カスタム")
 };
 
-/**
- * パラメータの値タイプ
- */
-UENUM(BlueprintType)
-enum class ETuningValueType : uint8
-{
-	Float		UMETA(DisplayName = "Float"),
-	Integer		UMETA(DisplayName = "Integer"),
-	Boolean		UMETA(DisplayName = "Boolean"),
-	Vector		UMETA(DisplayName = "Vector"),
-	Curve		UMETA(DisplayName = "Curve")
-};
-
 /**
  * 警告レベル
  */
@@ -45,81 +33,6 @@ enum class ETuningWarningLevel : uint8
 	Critical	UMETA(DisplayName = "危険")
 };
 
-/**
- * パラメータ値（多様な型に対応）
- */
-USTRUCT(BlueprintType)
-struct FTuningValue
-{
-	GENERATED_BODY()
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	ETuningValueType ValueType = ETuningValueType::Float;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	float FloatValue = 0.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	int32 IntValue = 0;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	bool BoolValue = false;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	FVector VectorValue = FVector::ZeroVector;
-
-	/** 値を文字列で取得 */
-	FString ToString() const
-	{
-		switch (ValueType)
-		{
-		case ETuningValueType::Float:
-			return FString::Printf(TEXT("%.3f"), FloatValue);
-		case ETuningValueType::Integer:
-			return FString::Printf(TEXT("%d"), IntValue);
-		case ETuningValueType::Boolean:
-			return BoolValue ? TEXT("true") : TEXT("false");
-		case ETuningValueType::Vector:
-			return FString::Printf(TEXT("(%.1f, %.1f, %.1f)"), VectorValue.X, VectorValue.Y, VectorValue.Z);
-		default:
-			return TEXT("N/A");
-		}
-	}
-
-	/** Float値として取得（正規化） */
-	float GetAsFloat() const
-	{
-		switch (ValueType)
-		{
-		case ETuningValueType::Float:
-			return FloatValue;
-		case ETuningValueType::Integer:
-			return static_cast<float>(IntValue);
-		case ETuningValueType::Boolean:
-			return BoolValue ? 1.0f : 0.0f;
-		default:
-			return 0.0f;
-		}
-	}
-
-	/** 差分を計算 */
-	float GetDifference(const FTuningValue& Other) const
-	{
-		return GetAsFloat() - Other.GetAsFloat();
-	}
-
-	/** パーセント変化を計算 */
-	float GetPercentChange(const FTuningValue& Original) const
-	{
-		float OriginalFloat = Original.GetAsFloat();
-		if (FMath::IsNearlyZero(OriginalFloat))
-		{
-			return 0.0f;
-		}
-		return ((GetAsFloat() - OriginalFloat) / FMath::Abs(OriginalFloat)) * 100.0f;
-	}
-};
-
 /**
  * パラメータの安全閾値
  */
@@ -287,6 +200,10 @@ struct FTuningHistoryEntry
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FString Comment;
 
+	/** トランザクションID（同じIDのエントリはまとめてUndo/Redoされる） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TransactionId = 0;
+
 	FTuningHistoryEntry()
 		: Timestamp(FDateTime::Now())
 		, SessionId(FGuid::NewGuid())
@@ -324,9 +241,13 @@ struct FTuningSession
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	FDateTime EndTime;
 
-	/** このセッションでの変更履歴 */
+	/** このセッションの最初の履歴シーケンス（変更はサブシステムの履歴バッファを参照） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int64 FirstHistorySequence = 0;
+
+	/** このセッションの履歴シーケンスの終端（含まない） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	TArray<FTuningHistoryEntry> Changes;
+	int64 EndHistorySequence = 0;
 
 	/** セッションメモ */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -343,8 +264,8 @@ struct FTuningSession
 	{
 	}
 
-	/** セッション内の変更数 */
-	int32 GetChangeCount() const { return Changes.Num(); }
+	/** セッション内の変更数（履歴バッファから破棄されたものを含む） */
+	int32 GetChangeCount() const { return static_cast<int32>(EndHistorySequence - FirstHistorySequence); }
 
 	/** セッションを閉じる */
 	void Close()
@@ -492,3 +413,180 @@ struct FTuningBenchmarkResult
 	{
 	}
 };
+
+/**
+ * パラメータスイープの軸（1パラメータの試行値）
+ */
+USTRUCT(BlueprintType)
+struct FTuningSweepAxis
+{
+	GENERATED_BODY()
+
+	/** パラメータID */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName ParameterId;
+
+	/** 範囲の最小値 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MinValue = 0.0f;
+
+	/** 範囲の最大値 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MaxValue = 1.0f;
+
+	/** 範囲の分割数（最小値・最大値を含む点数） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 Steps = 5;
+
+	/** 試行値の直接指定（空でない場合は範囲より優先） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<float> Values;
+};
+
+/**
+ * スイープで収集する評価指標
+ */
+USTRUCT(BlueprintType)
+struct FTuningSweepMetric
+{
+	GENERATED_BODY()
+
+	/** 指標名（ゲーム側でUTuningSubsystem::ReportSweepMetricに渡す名前） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName MetricName;
+
+	/** 大きいほど良いか */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bHigherIsBetter = true;
+
+	/** スコアへの重み */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Weight = 1.0f;
+};
+
+/**
+ * パラメータスイープの設定
+ */
+USTRUCT(BlueprintType)
+struct FTuningSweepConfig
+{
+	GENERATED_BODY()
+
+	/** スイープ名 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString SweepName;
+
+	/** 軸（全軸の組み合わせを試行） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FTuningSweepAxis> Axes;
+
+	/** 評価指標（順位付けに使用） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TArray<FTuningSweepMetric> Metrics;
+
+	/** シミュレーションするマップ（空の場合はエディタで開いているマップ） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString MapPath;
+
+	/** 1構成あたりのシミュレーション時間（秒、ゲーム内時間） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	float SimulationSeconds = 60.0f;
+
+	/** シミュレーションの固定フレーム時間（秒） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.001"))
+	float FixedDeltaSeconds = 1.0f / 30.0f;
+
+	/** 同時に起動するワーカープロセス数（0の場合はCPUコア数から決定） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 MaxParallelWorkers = 0;
+
+	/** 1ワーカーが続けて実行する構成数（起動コストの分散） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 ConfigurationsPerWorker = 8;
+
+	/** 構成数の上限（組み合わせが多すぎる場合は開始しない） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 MaxConfigurations = 4096;
+};
+
+/**
+ * スイープの1構成の結果
+ */
+USTRUCT(BlueprintType)
+struct FTuningSweepResult
+{
+	GENERATED_BODY()
+
+	/** 順位（1から、失敗した構成は0） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 Rank = 0;
+
+	/** 構成番号（展開順） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 ConfigurationIndex = 0;
+
+	/** 試行したパラメータ値 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TMap<FName, FTuningValue> ParameterValues;
+
+	/** 収集した指標 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TMap<FName, float> Metrics;
+
+	/** 重み付きスコア（大きいほど良い） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float Score = 0.0f;
+
+	/** 開始時の値との比較（試行したパラメータのみ） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FTuningComparison> Comparisons;
+
+	/** 比較のうち最も高い警告レベル */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	ETuningWarningLevel WarningLevel = ETuningWarningLevel::None;
+
+	/** シミュレーションが完了したか */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bSucceeded = false;
+
+	/** 失敗理由 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString Error;
+};
+
+/**
+ * スイープの結果レポート
+ */
+USTRUCT(BlueprintType)
+struct FTuningSweepReport
+{
+	GENERATED_BODY()
+
+	/** スイープ名 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString SweepName;
+
+	/** 開始時刻 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FDateTime StartTime;
+
+	/** 所要時間（秒） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float ElapsedSeconds = 0.0f;
+
+	/** 構成数 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 ConfigurationCount = 0;
+
+	/** 失敗した構成数 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 FailedCount = 0;
+
+	/** 途中で中止されたか */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bCancelled = false;
+
+	/** 結果（スコアの高い順、失敗した構成は末尾） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FTuningSweepResult> Results;
+};
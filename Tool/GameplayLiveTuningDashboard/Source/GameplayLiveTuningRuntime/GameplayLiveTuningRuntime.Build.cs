@@ -0,0 +1,38 @@
+// Copyright DevTools. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class GameplayLiveTuningRuntime : ModuleRules
+{
+	public GameplayLiveTuningRuntime(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+
+		PrivateIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Sockets",
+				"Networking"
+			}
+		);
+	}
+}
@@ -0,0 +1,19 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "GameplayLiveTuningRuntimeModule.h"
+
+#define LOCTEXT_NAMESPACE "FGameplayLiveTuningRuntimeModule"
+
+void FGameplayLiveTuningRuntimeModule::StartupModule()
+{
+	UE_LOG(LogTemp, Log, TEXT("[GameplayLiveTuningRuntime] Runtime module started"));
+}
+
+void FGameplayLiveTuningRuntimeModule::ShutdownModule()
+{
+	UE_LOG(LogTemp, Log, TEXT("[GameplayLiveTuningRuntime] Runtime module shutdown"));
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FGameplayLiveTuningRuntimeModule, GameplayLiveTuningRuntime)
@@ -0,0 +1,125 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningPropertyBinding.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	void SetFloat(const FProperty* Property, void* ValuePtr, const FTuningValue& Value)
+	{
+		*static_cast<float*>(ValuePtr) = Value.FloatValue;
+	}
+
+	void SetDoubleFromFloat(const FProperty* Property, void* ValuePtr, const FTuningValue& Value)
+	{
+		*static_cast<double*>(ValuePtr) = static_cast<double>(Value.FloatValue);
+	}
+
+	void SetInt(const FProperty* Property, void* ValuePtr, const FTuningValue& Value)
+	{
+		*static_cast<int32*>(ValuePtr) = Value.IntValue;
+	}
+
+	void SetBool(const FProperty* Property, void* ValuePtr, const FTuningValue& Value)
+	{
+		// ビットフィールドの可能性があるためプロパティ経由で書き込む
+		static_cast<const FBoolProperty*>(Property)->SetPropertyValue(ValuePtr, Value.BoolValue);
+	}
+
+	void SetVector(const FProperty* Property, void* ValuePtr, const FTuningValue& Value)
+	{
+		*static_cast<FVector*>(ValuePtr) = Value.VectorValue;
+	}
+
+	/** プロパティと値型の組み合わせに対応する書き込み関数 */
+	FTuningPropertyBinding::FSetter FindSetter(const FProperty* Property, ETuningValueType ValueType)
+	{
+		switch (ValueType)
+		{
+		case ETuningValueType::Float:
+			if (Property->IsA<FFloatProperty>())
+			{
+				return &SetFloat;
+			}
+			if (Property->IsA<FDoubleProperty>())
+			{
+				return &SetDoubleFromFloat;
+			}
+			break;
+
+		case ETuningValueType::Integer:
+			if (Property->IsA<FIntProperty>())
+			{
+				return &SetInt;
+			}
+			break;
+
+		case ETuningValueType::Boolean:
+			if (Property->IsA<FBoolProperty>())
+			{
+				return &SetBool;
+			}
+			break;
+
+		case ETuningValueType::Vector:
+			if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+			{
+				if (StructProp->Struct == TBaseStructure<FVector>::Get())
+				{
+					return &SetVector;
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		return nullptr;
+	}
+}
+
+FTuningPropertyBinding FTuningPropertyBinding::Bind(UObject* Object, FName PropertyName, ETuningValueType ValueType)
+{
+	FTuningPropertyBinding Binding;
+
+	if (!Object)
+	{
+		return Binding;
+	}
+
+	const FProperty* Property = Object->GetClass()->FindPropertyByName(PropertyName);
+	if (!Property)
+	{
+		return Binding;
+	}
+
+	Binding.Setter = FindSetter(Property, ValueType);
+	if (!Binding.Setter)
+	{
+		return Binding;
+	}
+
+	Binding.Target = Object;
+	Binding.BoundClass = Object->GetClass();
+	Binding.Property = Property;
+	Binding.ValueType = ValueType;
+	return Binding;
+}
+
+bool FTuningPropertyBinding::IsValidFor(ETuningValueType InValueType) const
+{
+	if (!Setter || ValueType != InValueType)
+	{
+		return false;
+	}
+
+	// 再コンパイルでクラスが差し替わるとプロパティのオフセットも変わる
+	const UObject* Object = Target.Get();
+	return Object && BoundClass.IsValid() && Object->GetClass() == BoundClass.Get();
+}
+
+void FTuningPropertyBinding::Apply(const FTuningValue& Value) const
+{
+	Setter(Property, Property->ContainerPtrToValuePtr<void>(Target.Get()), Value);
+}
@@ -0,0 +1,162 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningRemoteTargetSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void UTuningRemoteTargetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Transport.OnBatchReceived.BindUObject(this, &UTuningRemoteTargetSubsystem::ApplyRemoteBatch);
+	ConnectFromCommandLine();
+}
+
+void UTuningRemoteTargetSubsystem::Deinitialize()
+{
+	Disconnect();
+	Transport.OnBatchReceived.Unbind();
+	BatchApplier.Unbind();
+	PropertyBindings.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTuningRemoteTargetSubsystem::ConnectToHost(const FString& HostAddress, int32 Port, const FString& SessionToken, const FString& TargetName)
+{
+	const FString Name = TargetName.IsEmpty() ? MakeDefaultTargetName() : TargetName;
+	if (!Transport.Connect(HostAddress, Port, Name, SessionToken))
+	{
+		return false;
+	}
+
+	RegisterTick();
+	return true;
+}
+
+bool UTuningRemoteTargetSubsystem::RegisterParameter(FName ParameterId, UObject* Object, FName PropertyName, ETuningValueType ValueType)
+{
+	const FTuningPropertyBinding Binding = FTuningPropertyBinding::Bind(Object, PropertyName, ValueType);
+	if (!Binding.IsValidFor(ValueType))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemoteTarget] Property not found or type mismatch: %s.%s"), *GetNameSafe(Object), *PropertyName.ToString());
+		PropertyBindings.Remove(ParameterId);
+		return false;
+	}
+
+	PropertyBindings.Add(ParameterId, Binding);
+	return true;
+}
+
+void UTuningRemoteTargetSubsystem::Disconnect()
+{
+	UnregisterTick();
+	Transport.Stop();
+}
+
+void UTuningRemoteTargetSubsystem::ApplyRemoteBatch(uint32 BatchId, const TArray<FTuningRemoteTransport::FRemoteUpdate>& Updates)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTuningRemoteTargetSubsystem::ApplyRemoteBatch);
+
+	TArray<FTuningRemoteTransport::FRemoteUpdate> Applied = Updates;
+	for (FTuningRemoteTransport::FRemoteUpdate& Update : Applied)
+	{
+		Update.bApplied = false;
+	}
+
+	BatchApplier.ExecuteIfBound(Applied);
+
+	// 登録された適用処理が扱わなかった更新はローカルに登録したプロパティへ書き込む
+	for (FTuningRemoteTransport::FRemoteUpdate& Update : Applied)
+	{
+		if (!Update.bApplied)
+		{
+			Update.bApplied = ApplyToTargetProperty(Update);
+		}
+	}
+
+	Transport.AcknowledgeBatch(BatchId, Applied);
+}
+
+bool UTuningRemoteTargetSubsystem::ApplyToTargetProperty(const FTuningRemoteTransport::FRemoteUpdate& Update)
+{
+	// ホストから受け取るのはパラメータIDと値のみで、適用先はローカルの登録からしか解決しない
+	const FTuningPropertyBinding* Binding = PropertyBindings.Find(Update.ParameterId);
+	if (!Binding || !Binding->IsValidFor(Update.Value.ValueType))
+	{
+		return false;
+	}
+
+	Binding->Apply(Update.Value);
+	return true;
+}
+
+void UTuningRemoteTargetSubsystem::RegisterTick()
+{
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UTuningRemoteTargetSubsystem::OnEndFrame);
+	}
+}
+
+void UTuningRemoteTargetSubsystem::UnregisterTick()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+}
+
+void UTuningRemoteTargetSubsystem::OnEndFrame()
+{
+	Transport.Tick();
+
+	// 切断されたら送受信を止める
+	if (!Transport.IsConnectedToHost())
+	{
+		UnregisterTick();
+	}
+}
+
+void UTuningRemoteTargetSubsystem::ConnectFromCommandLine()
+{
+#if !UE_BUILD_SHIPPING
+	FString HostSpec;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("TuningHost="), HostSpec))
+	{
+		return;
+	}
+
+	FString SessionToken;
+	FParse::Value(FCommandLine::Get(), TEXT("TuningToken="), SessionToken);
+
+	FString Address = HostSpec;
+	FString PortString;
+	int32 Port = FTuningRemoteTransport::DefaultPort;
+	if (HostSpec.Split(TEXT(":"), &Address, &PortString, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
+	{
+		Port = FCString::Atoi(*PortString);
+	}
+	ConnectToHost(Address, Port, SessionToken);
+#endif
+}
+
+FString UTuningRemoteTargetSubsystem::MakeDefaultTargetName() const
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	const UWorld* World = GameInstance ? GameInstance->GetWorld() : nullptr;
+	const TCHAR* NetModeName = !World ? TEXT("Game")
+		: World->GetNetMode() == NM_DedicatedServer ? TEXT("Server")
+		: World->GetNetMode() == NM_ListenServer ? TEXT("ListenServer")
+		: World->GetNetMode() == NM_Client ? TEXT("Client")
+		: TEXT("Standalone");
+	FString Name = FString::Printf(TEXT("%s-%u-%s"), FPlatformProcess::ComputerName(), FPlatformProcess::GetCurrentProcessId(), NetModeName);
+
+	const FWorldContext* WorldContext = GameInstance ? GameInstance->GetWorldContext() : nullptr;
+	if (WorldContext && WorldContext->PIEInstance != INDEX_NONE)
+	{
+		Name += FString::Printf(TEXT("-PIE%d"), WorldContext->PIEInstance);
+	}
+	return Name;
+}
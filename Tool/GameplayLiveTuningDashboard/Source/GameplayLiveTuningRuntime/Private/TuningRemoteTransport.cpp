@@ -0,0 +1,715 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "TuningRemoteTransport.h"
+#include "Common/TcpSocketBuilder.h"
+#include "IPAddress.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+namespace
+{
+	/** プロトコルバージョン（メッセージ構造を変更したら更新） */
+	constexpr int32 RemoteProtocolVersion = 4;
+
+	/** ターゲットの接続完了・ホストがHelloを待つ上限（秒） */
+	constexpr double ConnectTimeoutSeconds = 5.0;
+
+	/** 1メッセージの上限（これを超える長さは不正として切断） */
+	constexpr uint32 MaxMessageSize = 4 * 1024 * 1024;
+
+	/** 1回のRecvで読む上限 */
+	constexpr uint32 ReceiveChunkSize = 64 * 1024;
+
+	/** 短縮IDの後に名前が続くことを示すビット */
+	constexpr uint16 WireIdHasNameBit = 0x8000;
+
+	ISocketSubsystem* GetSocketSubsystem()
+	{
+		return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	}
+}
+
+FTuningRemoteTransport::~FTuningRemoteTransport()
+{
+	Stop();
+}
+
+bool FTuningRemoteTransport::StartHost(int32 Port, const FString& InSessionToken)
+{
+	Stop();
+
+	if (InSessionToken.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Refusing to host without a session token"));
+		return false;
+	}
+
+	ListenSocket = FTcpSocketBuilder(TEXT("TuningRemoteHost"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToPort(Port)
+		.Listening(8)
+		.Build();
+
+	if (!ListenSocket)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Failed to listen on port %d"), Port);
+		return false;
+	}
+
+	SessionToken = InSessionToken;
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningRemote] Hosting on port %d"), Port);
+	return true;
+}
+
+bool FTuningRemoteTransport::Connect(const FString& HostAddress, int32 Port, const FString& TargetName, const FString& InSessionToken)
+{
+	Stop();
+
+	if (InSessionToken.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Refusing to connect to %s without a session token"), *HostAddress);
+		return false;
+	}
+
+	ISocketSubsystem* SocketSubsystem = GetSocketSubsystem();
+	TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+
+	bool bValidAddress = false;
+	Address->SetIp(*HostAddress, bValidAddress);
+	Address->SetPort(Port);
+	if (!bValidAddress)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Invalid host address: %s"), *HostAddress);
+		return false;
+	}
+
+	// 起動中に呼ばれるため接続完了は待たず、Tickで接続状態を確認する
+	FSocket* Socket = FTcpSocketBuilder(TEXT("TuningRemoteTarget")).AsNonBlocking().Build();
+	if (!Socket || !Socket->Connect(*Address))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Failed to connect to %s:%d"), *HostAddress, Port);
+		if (Socket)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+		return false;
+	}
+
+	Socket->SetNoDelay(true);
+
+	TUniquePtr<FConnection> Connection = MakeUnique<FConnection>();
+	Connection->Socket = Socket;
+	Connection->Address = Address->ToString(true);
+	Connection->TargetName = TargetName;
+	Connection->bConnecting = true;
+	Connection->ConnectStartTime = FPlatformTime::Seconds();
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(EMessageType::Hello);
+	int32 Version = RemoteProtocolVersion;
+	FString Name = TargetName;
+	FString Token = InSessionToken;
+	Writer << Type;
+	Writer << Version;
+	Writer << Name;
+	Writer << Token;
+	QueueMessage(*Connection, Payload);
+
+	Connections.Add(MoveTemp(Connection));
+
+	UE_LOG(LogTemp, Log, TEXT("[TuningRemote] Connecting to %s:%d as %s"), *HostAddress, Port, *TargetName);
+	return true;
+}
+
+void FTuningRemoteTransport::Stop()
+{
+	for (TUniquePtr<FConnection>& Connection : Connections)
+	{
+		CloseConnection(*Connection);
+	}
+	Connections.Empty();
+
+	if (ListenSocket)
+	{
+		ListenSocket->Close();
+		GetSocketSubsystem()->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+
+	LatestValues.Empty();
+	DirtyIds.Empty();
+	SessionToken.Reset();
+}
+
+void FTuningRemoteTransport::QueueUpdate(FName ParameterId, const FTuningValue& Value)
+{
+	LatestValues.Add(ParameterId, Value);
+	DirtyIds.Add(ParameterId);
+}
+
+void FTuningRemoteTransport::GetTargetStatuses(TArray<FTuningRemoteTargetStatus>& OutStatuses) const
+{
+	if (!IsHosting())
+	{
+		return;
+	}
+
+	for (const TUniquePtr<FConnection>& Connection : Connections)
+	{
+		if (!Connection->bAuthenticated)
+		{
+			continue;
+		}
+
+		FTuningRemoteTargetStatus& Status = OutStatuses.AddDefaulted_GetRef();
+		Status.TargetName = Connection->TargetName.IsEmpty() ? Connection->Address : Connection->TargetName;
+		Status.Address = Connection->Address;
+		Status.PendingBatchCount = Connection->PendingBatches.Num();
+		Status.LastLatencyMs = Connection->LastLatencyMs;
+		Status.LastAckTime = Connection->LastAckTime;
+	}
+}
+
+void FTuningRemoteTransport::AcknowledgeBatch(uint32 BatchId, const TArray<FRemoteUpdate>& AppliedUpdates)
+{
+	if (!IsConnectedToHost())
+	{
+		return;
+	}
+
+	FConnection& Connection = *Connections[0];
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(EMessageType::Ack);
+	Writer << Type;
+	Writer << BatchId;
+
+	const int64 CountOffset = Writer.Tell();
+	uint16 Count = 0;
+	Writer << Count;
+
+	for (const FRemoteUpdate& Update : AppliedUpdates)
+	{
+		// ホストが割り当てた短縮IDで返す
+		const uint16* WireId = Connection.WireIds.Find(Update.ParameterId);
+		if (!WireId || Count == MAX_uint16)
+		{
+			continue;
+		}
+
+		uint16 Id = *WireId;
+		uint8 bApplied = Update.bApplied ? 1 : 0;
+		FTuningValue Value = Update.Value;
+		Writer << Id;
+		Writer << bApplied;
+		SerializeValue(Writer, Value);
+		++Count;
+	}
+
+	Writer.Seek(CountOffset);
+	Writer << Count;
+
+	QueueMessage(Connection, Payload);
+}
+
+void FTuningRemoteTransport::Tick()
+{
+	// 新しいターゲットを受け付ける
+	if (ListenSocket)
+	{
+		bool bHasPendingConnection = false;
+		while (ListenSocket->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+		{
+			TSharedRef<FInternetAddr> RemoteAddress = GetSocketSubsystem()->CreateInternetAddr();
+			FSocket* Socket = ListenSocket->Accept(*RemoteAddress, TEXT("TuningRemoteConnection"));
+			if (!Socket)
+			{
+				break;
+			}
+
+			Socket->SetNonBlocking(true);
+			Socket->SetNoDelay(true);
+
+			TUniquePtr<FConnection> Connection = MakeUnique<FConnection>();
+			Connection->Socket = Socket;
+			Connection->Address = RemoteAddress->ToString(true);
+			Connection->ConnectStartTime = FPlatformTime::Seconds();
+			Connections.Add(MoveTemp(Connection));
+		}
+	}
+
+	for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
+	{
+		FConnection& Connection = *Connections[Index];
+
+		if (Connection.bConnecting && !PollConnecting(Connection))
+		{
+			CloseConnection(Connection);
+			Connections.RemoveAt(Index);
+			continue;
+		}
+
+		// 接続完了までは送受信しない（Helloは送信待ちに積んだまま）
+		if (Connection.bConnecting)
+		{
+			continue;
+		}
+
+		bool bAlive = Connection.Socket->GetConnectionState() != SCS_ConnectionError && ReceiveMessages(Connection) && !Connection.bRejected;
+
+		// 期限内に正しいHelloを送らない接続は切断する
+		if (bAlive && IsHosting() && !Connection.bAuthenticated && FPlatformTime::Seconds() - Connection.ConnectStartTime > ConnectTimeoutSeconds)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] No hello from %s, closing"), *Connection.Address);
+			bAlive = false;
+		}
+
+		// Helloを受け取るまではターゲットとして扱わない
+		if (bAlive && IsHosting() && Connection.bAuthenticated)
+		{
+			SendPendingUpdates(Connection);
+		}
+
+		bAlive = bAlive && FlushSendBuffer(Connection);
+
+		if (!bAlive)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[TuningRemote] Disconnected: %s"), *Connection.Address);
+			CloseConnection(Connection);
+			Connections.RemoveAt(Index);
+		}
+	}
+
+	DirtyIds.Reset();
+}
+
+bool FTuningRemoteTransport::PollConnecting(FConnection& Connection)
+{
+	switch (Connection.Socket->GetConnectionState())
+	{
+	case SCS_Connected:
+		Connection.bConnecting = false;
+		UE_LOG(LogTemp, Log, TEXT("[TuningRemote] Connected to %s as %s"), *Connection.Address, *Connection.TargetName);
+		return true;
+
+	case SCS_ConnectionError:
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Failed to connect to %s"), *Connection.Address);
+		return false;
+
+	default:
+		break;
+	}
+
+	if (FPlatformTime::Seconds() - Connection.ConnectStartTime > ConnectTimeoutSeconds)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Timed out connecting to %s"), *Connection.Address);
+		return false;
+	}
+
+	return true;
+}
+
+void FTuningRemoteTransport::CloseConnection(FConnection& Connection)
+{
+	if (Connection.Socket)
+	{
+		Connection.Socket->Close();
+		GetSocketSubsystem()->DestroySocket(Connection.Socket);
+		Connection.Socket = nullptr;
+	}
+}
+
+bool FTuningRemoteTransport::ReceiveMessages(FConnection& Connection)
+{
+	TArray<uint8>& Buffer = Connection.ReceiveBuffer;
+
+	uint32 PendingSize = 0;
+	while (Connection.Socket->HasPendingData(PendingSize) && PendingSize > 0)
+	{
+		const int32 Offset = Buffer.Num();
+		Buffer.AddUninitialized(FMath::Min(PendingSize, ReceiveChunkSize));
+
+		int32 BytesRead = 0;
+		if (!Connection.Socket->Recv(Buffer.GetData() + Offset, Buffer.Num() - Offset, BytesRead))
+		{
+			Buffer.SetNum(Offset, false);
+			return false;
+		}
+		Buffer.SetNum(Offset + BytesRead, false);
+	}
+
+	// [サイズ uint32][ペイロード] 単位で取り出す
+	int32 ReadOffset = 0;
+	while (Buffer.Num() - ReadOffset >= (int32)sizeof(uint32) && !Connection.bRejected)
+	{
+		uint32 MessageSize = 0;
+		FMemoryReader SizeReader(Buffer);
+		SizeReader.Seek(ReadOffset);
+		SizeReader << MessageSize;
+
+		if (MessageSize > MaxMessageSize)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Oversized message (%u bytes) from %s"), MessageSize, *Connection.Address);
+			return false;
+		}
+
+		if ((uint32)(Buffer.Num() - ReadOffset - (int32)sizeof(uint32)) < MessageSize)
+		{
+			break; // 続きは次のフレーム
+		}
+
+		const TArray<uint8> Payload(Buffer.GetData() + ReadOffset + sizeof(uint32), MessageSize);
+		ReadOffset += sizeof(uint32) + MessageSize;
+		HandleMessage(Connection, Payload);
+	}
+
+	if (ReadOffset > 0)
+	{
+		Buffer.RemoveAt(0, ReadOffset, false);
+	}
+
+	return true;
+}
+
+bool FTuningRemoteTransport::FlushSendBuffer(FConnection& Connection)
+{
+	while (Connection.SendBuffer.Num() > 0)
+	{
+		int32 BytesSent = 0;
+		if (!Connection.Socket->Send(Connection.SendBuffer.GetData(), Connection.SendBuffer.Num(), BytesSent))
+		{
+			// 送信バッファが埋まっている場合は次のフレームで再送
+			return GetSocketSubsystem()->GetLastErrorCode() == SE_EWOULDBLOCK;
+		}
+
+		if (BytesSent <= 0)
+		{
+			break;
+		}
+		Connection.SendBuffer.RemoveAt(0, BytesSent, false);
+	}
+
+	return true;
+}
+
+void FTuningRemoteTransport::QueueMessage(FConnection& Connection, const TArray<uint8>& Payload)
+{
+	// 既存の送信待ちの末尾へ追記
+	FMemoryWriter Writer(Connection.SendBuffer, false, true);
+
+	uint32 MessageSize = Payload.Num();
+	Writer << MessageSize;
+	Writer.Serialize(const_cast<uint8*>(Payload.GetData()), Payload.Num());
+}
+
+void FTuningRemoteTransport::HandleMessage(FConnection& Connection, const TArray<uint8>& Payload)
+{
+	FMemoryReader Reader(Payload);
+
+	uint8 RawType = 0;
+	Reader << RawType;
+
+	// ホストは認証前のHello以外のメッセージを受け付けない
+	if (IsHosting() && !Connection.bAuthenticated && static_cast<EMessageType>(RawType) != EMessageType::Hello)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Message %u before hello from %s, closing"), RawType, *Connection.Address);
+		Connection.bRejected = true;
+		return;
+	}
+
+	switch (static_cast<EMessageType>(RawType))
+	{
+	case EMessageType::Hello:
+	{
+		if (!IsHosting())
+		{
+			break;
+		}
+
+		int32 Version = 0;
+		FString Name;
+		FString Token;
+		Reader << Version;
+		Reader << Name;
+		if (Version == RemoteProtocolVersion)
+		{
+			Reader << Token;
+		}
+
+		if (Reader.IsError() || Version != RemoteProtocolVersion)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Protocol mismatch from %s (version %d), closing"), *Connection.Address, Version);
+			Connection.bRejected = true;
+			break;
+		}
+
+		if (Connection.bAuthenticated || !Token.Equals(SessionToken, ESearchCase::CaseSensitive))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Invalid session token from %s, closing"), *Connection.Address);
+			Connection.bRejected = true;
+			break;
+		}
+
+		Connection.bAuthenticated = true;
+		Connection.TargetName = Name.IsEmpty() ? Connection.Address : Name;
+		UE_LOG(LogTemp, Log, TEXT("[TuningRemote] Target connected: %s (%s)"), *Connection.TargetName, *Connection.Address);
+		break;
+	}
+
+	case EMessageType::Batch:
+	{
+		if (IsHosting())
+		{
+			break;
+		}
+
+		uint32 BatchId = 0;
+		uint16 Count = 0;
+		Reader << BatchId;
+		Reader << Count;
+
+		TArray<FRemoteUpdate> Updates;
+		Updates.Reserve(Count);
+		for (int32 Index = 0; Index < Count && !Reader.IsError(); ++Index)
+		{
+			FRemoteUpdate Update;
+			if (!ReadParameterRef(Reader, Connection, Update.ParameterId))
+			{
+				break;
+			}
+			SerializeValue(Reader, Update.Value);
+			Updates.Add(MoveTemp(Update));
+		}
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Malformed batch %u"), BatchId);
+			break;
+		}
+
+		// 適用先が無い場合は未反映として返す
+		if (!OnBatchReceived.ExecuteIfBound(BatchId, Updates))
+		{
+			AcknowledgeBatch(BatchId, Updates);
+		}
+		break;
+	}
+
+	case EMessageType::Ack:
+	{
+		if (!IsHosting())
+		{
+			break;
+		}
+
+		uint32 BatchId = 0;
+		uint16 Count = 0;
+		Reader << BatchId;
+		Reader << Count;
+
+		double SentTime = 0.0;
+		if (!Connection.PendingBatches.RemoveAndCopyValue(BatchId, SentTime))
+		{
+			break;
+		}
+
+		const FDateTime Now = FDateTime::Now();
+		const float LatencyMs = static_cast<float>((FPlatformTime::Seconds() - SentTime) * 1000.0);
+		Connection.LastLatencyMs = LatencyMs;
+		Connection.LastAckTime = Now;
+
+		for (int32 Index = 0; Index < Count && !Reader.IsError(); ++Index)
+		{
+			uint16 WireId = 0;
+			uint8 bApplied = 0;
+			FTuningRemoteAck Ack;
+			Reader << WireId;
+			Reader << bApplied;
+			SerializeValue(Reader, Ack.AppliedValue);
+
+			if (Reader.IsError() || !Connection.NamesByWireId.IsValidIndex(WireId))
+			{
+				break;
+			}
+
+			Ack.ParameterId = Connection.NamesByWireId[WireId];
+			Ack.TargetName = Connection.TargetName;
+			Ack.bApplied = bApplied != 0;
+			Ack.LatencyMs = LatencyMs;
+			Ack.AckTime = Now;
+			OnAcknowledged.ExecuteIfBound(Ack);
+		}
+		break;
+	}
+
+	default:
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Unknown message %u from %s"), RawType, *Connection.Address);
+		break;
+	}
+}
+
+void FTuningRemoteTransport::SendPendingUpdates(FConnection& Connection)
+{
+	// 接続直後はそれまでの全パラメータ、以降は変わったパラメータのみ
+	TArray<FName> CandidateIds;
+	if (Connection.bNeedsFullSync)
+	{
+		LatestValues.GetKeys(CandidateIds);
+		Connection.bNeedsFullSync = false;
+	}
+	else
+	{
+		CandidateIds = DirtyIds.Array();
+	}
+
+	if (CandidateIds.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(EMessageType::Batch);
+	uint32 BatchId = NextBatchId;
+	Writer << Type;
+	Writer << BatchId;
+
+	const int64 CountOffset = Writer.Tell();
+	uint16 Count = 0;
+	Writer << Count;
+
+	for (const FName& ParameterId : CandidateIds)
+	{
+		const FTuningValue& Value = LatestValues.FindChecked(ParameterId);
+
+		// 前回送った値と同じなら送らない
+		const FTuningValue* LastSent = Connection.LastSentValues.Find(ParameterId);
+		if ((LastSent && LastSent->Equals(Value)) || Count == MAX_uint16)
+		{
+			continue;
+		}
+
+		if (!WriteParameterRef(Writer, Connection, ParameterId))
+		{
+			continue;
+		}
+
+		FTuningValue ValueCopy = Value;
+		SerializeValue(Writer, ValueCopy);
+		Connection.LastSentValues.Add(ParameterId, Value);
+		++Count;
+	}
+
+	if (Count == 0)
+	{
+		return;
+	}
+
+	Writer.Seek(CountOffset);
+	Writer << Count;
+
+	++NextBatchId;
+	Connection.PendingBatches.Add(BatchId, FPlatformTime::Seconds());
+	QueueMessage(Connection, Payload);
+}
+
+void FTuningRemoteTransport::SerializeValue(FArchive& Ar, FTuningValue& Value)
+{
+	uint8 RawType = static_cast<uint8>(Value.ValueType);
+	Ar << RawType;
+	Value.ValueType = static_cast<ETuningValueType>(RawType);
+
+	switch (Value.ValueType)
+	{
+	case ETuningValueType::Float:
+		Ar << Value.FloatValue;
+		break;
+
+	case ETuningValueType::Integer:
+		Ar << Value.IntValue;
+		break;
+
+	case ETuningValueType::Boolean:
+	{
+		uint8 bValue = Value.BoolValue ? 1 : 0;
+		Ar << bValue;
+		Value.BoolValue = bValue != 0;
+		break;
+	}
+
+	case ETuningValueType::Vector:
+		// ワールド座標の調整もあるため倍精度のまま送る
+		Ar << Value.VectorValue;
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool FTuningRemoteTransport::WriteParameterRef(FArchive& Ar, FConnection& Connection, FName ParameterId) const
+{
+	if (const uint16* WireId = Connection.WireIds.Find(ParameterId))
+	{
+		uint16 Id = *WireId;
+		Ar << Id;
+		return true;
+	}
+
+	if (Connection.NamesByWireId.Num() >= WireIdHasNameBit)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TuningRemote] Too many parameters for %s, skipping %s"), *Connection.TargetName, *ParameterId.ToString());
+		return false;
+	}
+
+	// 初回は名前を付けて短縮IDを割り当てる
+	const uint16 NewId = static_cast<uint16>(Connection.NamesByWireId.Add(ParameterId));
+	Connection.WireIds.Add(ParameterId, NewId);
+
+	uint16 Id = NewId | WireIdHasNameBit;
+	FString Name = ParameterId.ToString();
+	Ar << Id;
+	Ar << Name;
+	return true;
+}
+
+bool FTuningRemoteTransport::ReadParameterRef(FArchive& Ar, FConnection& Connection, FName& OutParameterId)
+{
+	uint16 Id = 0;
+	Ar << Id;
+
+	if (Id & WireIdHasNameBit)
+	{
+		Id &= ~WireIdHasNameBit;
+
+		FString Name;
+		Ar << Name;
+		if (Ar.IsError())
+		{
+			return false;
+		}
+
+		if (Connection.NamesByWireId.Num() <= Id)
+		{
+			Connection.NamesByWireId.SetNum(Id + 1);
+		}
+		OutParameterId = FName(*Name);
+		Connection.NamesByWireId[Id] = OutParameterId;
+		Connection.WireIds.Add(OutParameterId, Id);
+		return true;
+	}
+
+	if (Ar.IsError() || !Connection.NamesByWireId.IsValidIndex(Id))
+	{
+		return false;
+	}
+
+	OutParameterId = Connection.NamesByWireId[Id];
+	return true;
+}
@@ -0,0 +1,34 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * Gameplay Live Tuning ランタイムモジュール
+ * パッケージビルドのターゲットでリモートチューニングを受信・適用する
+ */
+class FGameplayLiveTuningRuntimeModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+	/**
+	 * モジュールのシングルトンインスタンスを取得
+	 */
+	static FGameplayLiveTuningRuntimeModule& Get()
+	{
+		return FModuleManager::LoadModuleChecked<FGameplayLiveTuningRuntimeModule>("GameplayLiveTuningRuntime");
+	}
+
+	/**
+	 * モジュールがロードされているかチェック
+	 */
+	static bool IsAvailable()
+	{
+		return FModuleManager::Get().IsModuleLoaded("GameplayLiveTuningRuntime");
+	}
+};
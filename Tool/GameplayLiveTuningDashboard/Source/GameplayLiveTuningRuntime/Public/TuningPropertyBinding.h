@@ -0,0 +1,46 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "TuningRemoteTypes.h"
+
+/**
+ * パラメータ適用先プロパティの解決済みバインディング
+ * プロパティ検索と型判定を一度だけ行い、以降は型ごとの書き込み関数で直接書き込む
+ * - 対象オブジェクトとクラスは弱参照で保持し、GCやBlueprint再コンパイル（クラスの差し替え）で無効になる
+ * ゲームスレッド専用
+ */
+struct GAMEPLAYLIVETUNINGRUNTIME_API FTuningPropertyBinding
+{
+	/** 値の書き込み関数 */
+	using FSetter = void(*)(const FProperty* Property, void* ValuePtr, const FTuningValue& Value);
+
+	/**
+	 * オブジェクトのプロパティにバインド
+	 * @return プロパティが無い・値型に対応しない場合は無効なバインディング
+	 */
+	static FTuningPropertyBinding Bind(UObject* Object, FName PropertyName, ETuningValueType ValueType);
+
+	/** 対象が生きていて、解決時と同じクラス・値型か */
+	bool IsValidFor(ETuningValueType InValueType) const;
+
+	/** 値を書き込む（IsValidForを満たしていること） */
+	void Apply(const FTuningValue& Value) const;
+
+	/** 適用先オブジェクト */
+	TWeakObjectPtr<UObject> Target;
+
+	/** 解決時のクラス（Propertyの所有者） */
+	TWeakObjectPtr<UClass> BoundClass;
+
+	/** 適用先プロパティ */
+	const FProperty* Property = nullptr;
+
+	/** 型ごとの書き込み関数 */
+	FSetter Setter = nullptr;
+
+	/** 解決時の値型 */
+	ETuningValueType ValueType = ETuningValueType::Float;
+};
@@ -0,0 +1,97 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "TuningRemoteTransport.h"
+#include "TuningPropertyBinding.h"
+#include "TuningRemoteTargetSubsystem.generated.h"
+
+/** 受信したバッチの適用処理（反映した更新はbAppliedを立て、Valueを反映後の値にする） */
+DECLARE_DELEGATE_OneParam(FTuningRemoteBatchApplier, TArray<FTuningRemoteTransport::FRemoteUpdate>& /*Updates*/);
+
+/**
+ * リモートチューニングのターゲット側
+ * ダッシュボードへ接続し、受信したバッチをフレーム境界でまとめて適用して反映結果を返す
+ * - 起動時に -TuningHost=Address[:Port] -TuningToken=Token を指定すると自動で接続する
+ * - エディタではUTuningSubsystemが適用処理を登録し、登録済みパラメータを履歴・トランザクション付きで適用する
+ * - 適用されなかった更新は、RegisterParameterでローカルに登録したプロパティにのみ書き込む（ホストは適用先を指定できない）
+ * ランタイムモジュールのためパッケージビルドでも動作する（Shippingビルドにはモジュールごと含まれない）
+ */
+UCLASS()
+class GAMEPLAYLIVETUNINGRUNTIME_API UTuningRemoteTargetSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * ダッシュボードへ接続（接続の完了は待たない、失敗はログに出して以降の送受信を止める）
+	 * @param SessionToken ダッシュボードが待ち受け時に表示するセッショントークン
+	 * @param TargetName ダッシュボードに表示される名前（空の場合はマシン名・プロセスID・ネットモードから生成）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	bool ConnectToHost(const FString& HostAddress, int32 Port, const FString& SessionToken, const FString& TargetName = TEXT(""));
+
+	/** ダッシュボードとの接続を閉じる */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	void Disconnect();
+
+	/** ダッシュボードへ接続中か（接続処理中を含む） */
+	UFUNCTION(BlueprintPure, Category = "Tuning|Remote")
+	bool IsConnectedToHost() const { return Transport.IsConnectedToHost(); }
+
+	/**
+	 * リモートから変更できるパラメータを登録（同じIDは置き換え）
+	 * @return プロパティが無い・値型に対応しない場合はfalse
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	bool RegisterParameter(FName ParameterId, UObject* Object, FName PropertyName, ETuningValueType ValueType);
+
+	/** パラメータの登録を解除 */
+	UFUNCTION(BlueprintCallable, Category = "Tuning|Remote")
+	void UnregisterParameter(FName ParameterId) { PropertyBindings.Remove(ParameterId); }
+
+	/** 適用処理を登録（登録済みプロパティへの書き込みより先に呼ばれる） */
+	void SetBatchApplier(FTuningRemoteBatchApplier InApplier) { BatchApplier = MoveTemp(InApplier); }
+
+	/** 適用処理の登録を解除 */
+	void ClearBatchApplier() { BatchApplier.Unbind(); }
+
+protected:
+	/** 受信したバッチを適用して反映結果を返す */
+	void ApplyRemoteBatch(uint32 BatchId, const TArray<FTuningRemoteTransport::FRemoteUpdate>& Updates);
+
+	/** 登録済みのプロパティへ書き込む（未登録・対象が無効・型が合わない場合はfalse） */
+	bool ApplyToTargetProperty(const FTuningRemoteTransport::FRemoteUpdate& Update);
+
+	/** フレーム境界処理を登録・解除 */
+	void RegisterTick();
+	void UnregisterTick();
+
+	/** フレーム終了時に送受信を行う */
+	void OnEndFrame();
+
+	/** 起動引数で接続 */
+	void ConnectFromCommandLine();
+
+	/** 同じマシンの複数クライアント・サーバーを区別できる名前 */
+	FString MakeDefaultTargetName() const;
+
+private:
+	/** ダッシュボードへの接続 */
+	FTuningRemoteTransport Transport;
+
+	/** フレーム終了ハンドル */
+	FDelegateHandle EndFrameHandle;
+
+	/** 登録された適用処理 */
+	FTuningRemoteBatchApplier BatchApplier;
+
+	/** パラメータID → ローカルに登録された適用先（対象は弱参照） */
+	TMap<FName, FTuningPropertyBinding> PropertyBindings;
+};
@@ -0,0 +1,188 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningRemoteTypes.h"
+
+class FSocket;
+
+/**
+ * リモートチューニングのTCPトランスポート
+ * ダッシュボード側（ホスト）が待ち受け、各ゲームインスタンス（ターゲット）が接続する
+ * - ホストは変更をフレーム境界までまとめ、接続ごとに前回送信値から変わったパラメータのみをバッチで送る
+ * - パラメータ名は接続ごとに初回のみ送り、以降は16bitの短縮IDで参照する（適用先はターゲットがローカルに登録したものだけを使う）
+ * - ターゲットはHelloでセッショントークンを送り、ホストは一致しない・一定時間内にHelloが無い接続を切断する
+ * - ターゲットは受信したバッチをフレーム境界でまとめて適用し、反映後の値を確認として返す（ホストで遅延を計測）
+ * - 新しく接続したターゲットには、それまでに送った全パラメータの最新値を送る
+ * エディタ依存なし（Core・Sockets・Networkingのみ）、ゲームスレッド専用
+ */
+class GAMEPLAYLIVETUNINGRUNTIME_API FTuningRemoteTransport
+{
+public:
+	/** 既定の待ち受けポート */
+	static constexpr int32 DefaultPort = 41580;
+
+	/** 受信・適用したパラメータ値 */
+	struct FRemoteUpdate
+	{
+		FName ParameterId;
+		FTuningValue Value;
+
+		/** ターゲットで反映されたか（確認時のみ使用） */
+		bool bApplied = false;
+	};
+
+	DECLARE_DELEGATE_TwoParams(FOnBatchReceived, uint32 /*BatchId*/, const TArray<FRemoteUpdate>& /*Updates*/);
+	DECLARE_DELEGATE_OneParam(FOnAcknowledged, const FTuningRemoteAck& /*Ack*/);
+
+	/** ターゲット: バッチ受信時（Tick内で呼ばれる、適用後にAcknowledgeBatchを呼ぶこと） */
+	FOnBatchReceived OnBatchReceived;
+
+	/** ホスト: ターゲットからの反映確認時 */
+	FOnAcknowledged OnAcknowledged;
+
+	~FTuningRemoteTransport();
+
+	/**
+	 * ホストとして待ち受け開始
+	 * @param InSessionToken ターゲットがHelloで送る必要のあるトークン（空は不可）
+	 */
+	bool StartHost(int32 Port, const FString& InSessionToken);
+
+	/**
+	 * ターゲットとしてホストへ接続を開始（完了は待たず、Tickで確認する）
+	 * @param HostAddress ホストのIPアドレス
+	 * @param TargetName ホスト側に表示される名前
+	 * @param InSessionToken ホストのセッショントークン（空は不可）
+	 */
+	bool Connect(const FString& HostAddress, int32 Port, const FString& TargetName, const FString& InSessionToken);
+
+	/** 全ての接続を閉じる */
+	void Stop();
+
+	/** ホストとして待ち受け中か */
+	bool IsHosting() const { return ListenSocket != nullptr; }
+
+	/** ホスト: 待ち受け中のセッショントークン */
+	const FString& GetSessionToken() const { return SessionToken; }
+
+	/** ターゲットとして接続中か（接続処理中を含む） */
+	bool IsConnectedToHost() const { return !IsHosting() && Connections.Num() > 0; }
+
+	/** ホスト: 送信するパラメータ値を登録（次のTickで変わった分のみ送信） */
+	void QueueUpdate(FName ParameterId, const FTuningValue& Value);
+
+	/** ホスト: 接続中のターゲット */
+	void GetTargetStatuses(TArray<FTuningRemoteTargetStatus>& OutStatuses) const;
+
+	/** ターゲット: 受信したバッチの反映結果を返す */
+	void AcknowledgeBatch(uint32 BatchId, const TArray<FRemoteUpdate>& AppliedUpdates);
+
+	/** フレーム境界で呼ぶ（接続受付・受信・送信） */
+	void Tick();
+
+private:
+	/** メッセージ種別 */
+	enum class EMessageType : uint8
+	{
+		Hello = 1,
+		Batch = 2,
+		Ack = 3,
+	};
+
+	/** 接続 */
+	struct FConnection
+	{
+		FSocket* Socket = nullptr;
+
+		/** 接続先アドレス */
+		FString Address;
+
+		/** ターゲット名（ホスト側はHello受信後に設定） */
+		FString TargetName;
+
+		/** ターゲット: 接続完了待ちか */
+		bool bConnecting = false;
+
+		/** ホスト: 正しいトークンのHelloを受け取ったか（それまではHello以外を受け付けない） */
+		bool bAuthenticated = false;
+
+		/** ホスト: 不正なHello・未認証のメッセージを受け取り、切断するか */
+		bool bRejected = false;
+
+		/** 接続を開始・受け付けた時刻（ターゲットは接続完了、ホストはHelloの期限に使う） */
+		double ConnectStartTime = 0.0;
+
+		/** 受信途中のデータ */
+		TArray<uint8> ReceiveBuffer;
+
+		/** 送信待ちのデータ */
+		TArray<uint8> SendBuffer;
+
+		/** 短縮ID → パラメータ名（ホストは割り当て、ターゲットは受信） */
+		TArray<FName> NamesByWireId;
+
+		/** パラメータ名 → 短縮ID */
+		TMap<FName, uint16> WireIds;
+
+		/** ホスト: 最後に送った値 */
+		TMap<FName, FTuningValue> LastSentValues;
+
+		/** ホスト: 確認待ちのバッチ → 送信時刻 */
+		TMap<uint32, double> PendingBatches;
+
+		/** ホスト: 全パラメータの送信が必要か（接続直後） */
+		bool bNeedsFullSync = true;
+
+		/** ホスト: 最後の遅延と確認時刻 */
+		float LastLatencyMs = -1.0f;
+		FDateTime LastAckTime;
+	};
+
+	/** ターゲット: 接続完了を確認（失敗・タイムアウト時はfalse） */
+	bool PollConnecting(FConnection& Connection);
+
+	/** 接続を閉じて破棄 */
+	void CloseConnection(FConnection& Connection);
+
+	/** 受信したデータを取り込み、完全なメッセージを処理（切断時はfalse） */
+	bool ReceiveMessages(FConnection& Connection);
+
+	/** 送信待ちのデータを送る（切断時はfalse） */
+	bool FlushSendBuffer(FConnection& Connection);
+
+	/** メッセージを送信待ちに追加 */
+	static void QueueMessage(FConnection& Connection, const TArray<uint8>& Payload);
+
+	/** メッセージ処理 */
+	void HandleMessage(FConnection& Connection, const TArray<uint8>& Payload);
+
+	/** ホスト: 変わったパラメータをバッチで送る */
+	void SendPendingUpdates(FConnection& Connection);
+
+	/** 値のエンコード（型と、その型の値のみ） */
+	static void SerializeValue(FArchive& Ar, FTuningValue& Value);
+
+	/** パラメータ参照のエンコード（初回は名前付き、短縮IDが尽きた場合はfalse） */
+	bool WriteParameterRef(FArchive& Ar, FConnection& Connection, FName ParameterId) const;
+	bool ReadParameterRef(FArchive& Ar, FConnection& Connection, FName& OutParameterId);
+
+	/** ホストの待ち受けソケット */
+	FSocket* ListenSocket = nullptr;
+
+	/** 接続（ホストはターゲットごと、ターゲットはホストへの1本） */
+	TArray<TUniquePtr<FConnection>> Connections;
+
+	/** ホスト: パラメータの最新値 */
+	TMap<FName, FTuningValue> LatestValues;
+
+	/** セッショントークン（ホストは照合、ターゲットはHelloで送信） */
+	FString SessionToken;
+
+	/** ホスト: 前回のTick以降に変わったパラメータ */
+	TSet<FName> DirtyIds;
+
+	/** 次のバッチID */
+	uint32 NextBatchId = 1;
+};
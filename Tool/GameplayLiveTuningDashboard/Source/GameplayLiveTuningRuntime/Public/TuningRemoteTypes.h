@@ -0,0 +1,179 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TuningRemoteTypes.generated.h"
+
+/**
+ * パラメータの値タイプ
+ */
+UENUM(BlueprintType)
+enum class ETuningValueType : uint8
+{
+	Float		UMETA(DisplayName = "Float"),
+	Integer		UMETA(DisplayName = "Integer"),
+	Boolean		UMETA(DisplayName = "Boolean"),
+	Vector		UMETA(DisplayName = "Vector"),
+	Curve		UMETA(DisplayName = "Curve")
+};
+
+/**
+ * パラメータ値（多様な型に対応）
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYLIVETUNINGRUNTIME_API FTuningValue
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ETuningValueType ValueType = ETuningValueType::Float;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float FloatValue = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 IntValue = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool BoolValue = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FVector VectorValue = FVector::ZeroVector;
+
+	/** 値を文字列で取得 */
+	FString ToString() const
+	{
+		switch (ValueType)
+		{
+		case ETuningValueType::Float:
+			return FString::Printf(TEXT("%.3f"), FloatValue);
+		case ETuningValueType::Integer:
+			return FString::Printf(TEXT("%d"), IntValue);
+		case ETuningValueType::Boolean:
+			return BoolValue ? TEXT("true") : TEXT("false");
+		case ETuningValueType::Vector:
+			return FString::Printf(TEXT("(%.1f, %.1f, %.1f)"), VectorValue.X, VectorValue.Y, VectorValue.Z);
+		default:
+			return TEXT("N/A");
+		}
+	}
+
+	/** Float値として取得（正規化） */
+	float GetAsFloat() const
+	{
+		switch (ValueType)
+		{
+		case ETuningValueType::Float:
+			return FloatValue;
+		case ETuningValueType::Integer:
+			return static_cast<float>(IntValue);
+		case ETuningValueType::Boolean:
+			return BoolValue ? 1.0f : 0.0f;
+		default:
+			return 0.0f;
+		}
+	}
+
+	/** 差分を計算 */
+	float GetDifference(const FTuningValue& Other) const
+	{
+		return GetAsFloat() - Other.GetAsFloat();
+	}
+
+	/** 同じ型・同じ値か */
+	bool Equals(const FTuningValue& Other) const
+	{
+		if (ValueType != Other.ValueType)
+		{
+			return false;
+		}
+
+		switch (ValueType)
+		{
+		case ETuningValueType::Float:
+			return FloatValue == Other.FloatValue;
+		case ETuningValueType::Integer:
+			return IntValue == Other.IntValue;
+		case ETuningValueType::Boolean:
+			return BoolValue == Other.BoolValue;
+		case ETuningValueType::Vector:
+			return VectorValue == Other.VectorValue;
+		default:
+			return false;
+		}
+	}
+
+	/** パーセント変化を計算 */
+	float GetPercentChange(const FTuningValue& Original) const
+	{
+		float OriginalFloat = Original.GetAsFloat();
+		if (FMath::IsNearlyZero(OriginalFloat))
+		{
+			return 0.0f;
+		}
+		return ((GetAsFloat() - OriginalFloat) / FMath::Abs(OriginalFloat)) * 100.0f;
+	}
+};
+
+/**
+ * リモートターゲットでの変更の反映確認
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYLIVETUNINGRUNTIME_API FTuningRemoteAck
+{
+	GENERATED_BODY()
+
+	/** パラメータID */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FName ParameterId;
+
+	/** ターゲット名 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString TargetName;
+
+	/** ターゲットで反映された値 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FTuningValue AppliedValue;
+
+	/** ターゲットに該当パラメータがあり反映されたか */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bApplied = false;
+
+	/** 送信から反映確認までの時間（ms、ターゲットのフレーム境界での待ちを含む） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float LatencyMs = 0.0f;
+
+	/** 反映確認の受信時刻 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FDateTime AckTime;
+};
+
+/**
+ * リモートターゲットの接続状態
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYLIVETUNINGRUNTIME_API FTuningRemoteTargetStatus
+{
+	GENERATED_BODY()
+
+	/** ターゲット名 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString TargetName;
+
+	/** 接続元アドレス */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString Address;
+
+	/** 反映確認待ちのバッチ数 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 PendingBatchCount = 0;
+
+	/** 最後に確認されたバッチの遅延（ms、未確認は負） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float LastLatencyMs = -1.0f;
+
+	/** 最後の反映確認時刻 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FDateTime LastAckTime;
+};
@@ -1,6 +1,7 @@
 // Copyright DevTools. All Rights Reserved.
 
 #include "DebugDataCollectorSubsystem.h"
+#include "UnifiedDebugPanelTrace.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GameplayAbilitySpec.h"
@@ -12,9 +13,21 @@
 #include "BehaviorTree/BTNode.h"
 #include "BehaviorTree/BTTaskNode.h"
 #include "BehaviorTree/BTService.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Class.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Int.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Name.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Rotator.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_String.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+#include "AITypes.h"
 #include "AIController.h"
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
+#include "Abilities/GameplayAbility.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Pawn.h"
@@ -23,11 +36,87 @@
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "EngineUtils.h"
+#include "Tasks/Task.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Misc/Paths.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "HAL/FileManager.h"
+
+namespace DebugDataCollector
+{
+	/** 1タスクで整形する監視対象数 */
+	constexpr int32 FormatBatchSize = 16;
+
+	/** トレース対象のアクター（初回の収集でスナップショットに設定済み） */
+	const AActor* GetTraceActor(const TSharedPtr<FActorInsightData, ESPMode::ThreadSafe>& Snapshot)
+	{
+		return Snapshot.IsValid() ? Snapshot->Actor.Get() : nullptr;
+	}
+
+	/** 前回からの追加・削除をトレースへ出力して前回の状態を置き換える */
+	void TraceSetChanges(const AActor* Actor, TArray<TPair<uint32, FName>>& Previous, TArray<TPair<uint32, FName>>&& Current,
+		EInsightTraceEvent AddedEvent, EInsightTraceEvent RemovedEvent)
+	{
+		if (Actor)
+		{
+			for (const TPair<uint32, FName>& Entry : Previous)
+			{
+				if (!Current.ContainsByPredicate([&Entry](const TPair<uint32, FName>& Other) { return Other.Key == Entry.Key; }))
+				{
+					UnifiedDebugPanelTrace::OutputEvent(*Actor, RemovedEvent, *Entry.Value.ToString());
+				}
+			}
+			for (const TPair<uint32, FName>& Entry : Current)
+			{
+				if (!Previous.ContainsByPredicate([&Entry](const TPair<uint32, FName>& Other) { return Other.Key == Entry.Key; }))
+				{
+					UnifiedDebugPanelTrace::OutputEvent(*Actor, AddedEvent, *Entry.Value.ToString());
+				}
+			}
+		}
+		Previous = MoveTemp(Current);
+	}
+
+	/** TickGroupの表示名 */
+	const TCHAR* GetTickGroupName(ETickingGroup TickGroup)
+	{
+		switch (TickGroup)
+		{
+		case TG_PrePhysics:
+			return TEXT("PrePhysics");
+		case TG_DuringPhysics:
+			return TEXT("DuringPhysics");
+		case TG_PostPhysics:
+			return TEXT("PostPhysics");
+		case TG_PostUpdateWork:
+			return TEXT("PostUpdateWork");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	/** ティック関数の構成キーへ加算 */
+	uint32 HashTickFunction(uint32 Key, const void* Owner, const FTickFunction& TickFunction)
+	{
+		Key = HashCombineFast(Key, GetTypeHash(Owner));
+		Key = HashCombineFast(Key, TickFunction.IsTickFunctionEnabled() ? 1u : 0u);
+		return HashCombineFast(Key, static_cast<uint32>(TickFunction.TickGroup.GetValue()));
+	}
+
+	/** 名前の文字列化（Noneは空文字） */
+	FString NameToString(FName Name)
+	{
+		return Name.IsNone() ? FString() : Name.ToString();
+	}
+}
 
 void UDebugDataCollectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	bServerStreaming = FParse::Param(FCommandLine::Get(), TEXT("UnifiedDebugServerStreaming"));
+
 	// ワールドのティックにバインド
 	if (UWorld* World = GetWorld())
 	{
@@ -40,7 +129,7 @@ void UDebugDataCollectorSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 				}
 				return true;
 			}),
-			UpdateInterval
+			0.0f
 		);
 	}
 
@@ -56,7 +145,12 @@ void UDebugDataCollectorSubsystem::Deinitialize()
 		TickDelegateHandle.Reset();
 	}
 
+	DestroyServerReplicators();
+	ClientReplicator.Reset();
+	RemoteFocusActors.Empty();
+
 	ClearAllWatches();
+	HistoryRecorder.Reset();
 
 	UE_LOG(LogTemp, Log, TEXT("[DebugDataCollector] Subsystem deinitialized"));
 
@@ -71,29 +165,214 @@ bool UDebugDataCollectorSubsystem::DoesSupportWorldType(EWorldType::Type WorldTy
 
 void UDebugDataCollectorSubsystem::Tick(float DeltaTime)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::Tick);
+
+	// 無効なアクターのクリーンアップは更新間隔ごと
 	TimeSinceLastUpdate += DeltaTime;
+	if (TimeSinceLastUpdate >= UpdateInterval)
+	{
+		TimeSinceLastUpdate = 0.0f;
+		CleanupInvalidActors();
+
+		// サーバー: クライアントの接続・切断に合わせる／クライアント: 監視対象が変わっていればサーバーへ伝える
+		UpdateServerReplicators();
+		if (AInsightReplicator* Replicator = ClientReplicator.Get())
+		{
+			Replicator->UpdateInterest(GetWatchedActors(), FocusActor.Get());
+		}
+	}
+
+	// 収集フェーズ: ゲームスレッドで変わったセクションの値のみ読み取る（予算内で優先度の高い順）
+	PendingStates.Reset();
+	ScheduleCollection();
+
+	// サーバー: 前回のフレームまでに整形済みの内容から、クライアントごとに変わったセクションを送る
+	for (const TPair<TWeakObjectPtr<APlayerController>, TWeakObjectPtr<AInsightReplicator>>& Pair : ServerReplicators)
+	{
+		if (AInsightReplicator* Replicator = Pair.Value.Get())
+		{
+			Replicator->SendUpdates(DeltaTime, *this);
+		}
+	}
 
-	if (TimeSinceLastUpdate < UpdateInterval)
+	if (PendingStates.Num() == 0)
 	{
 		return;
 	}
 
-	TimeSinceLastUpdate = 0.0f;
+	// 整形フェーズ: 文字列化とサマリー生成をワーカースレッドへ分散（監視対象ごとに独立）
+	const int32 NumBatches = FMath::DivideAndRoundUp(PendingStates.Num(), DebugDataCollector::FormatBatchSize);
+	if (NumBatches == 1)
+	{
+		for (FWatchState* State : PendingStates)
+		{
+			FormatActorInsight(*State);
+		}
+	}
+	else
+	{
+		TArray<UE::Tasks::FTask> FormatTasks;
+		FormatTasks.Reserve(NumBatches);
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+		{
+			FormatTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, BatchIndex]()
+			{
+				const int32 Begin = BatchIndex * DebugDataCollector::FormatBatchSize;
+				const int32 End = FMath::Min(Begin + DebugDataCollector::FormatBatchSize, PendingStates.Num());
+				for (int32 i = Begin; i < End; ++i)
+				{
+					FormatActorInsight(*PendingStates[i]);
+				}
+			}));
+		}
+		UE::Tasks::Wait(FormatTasks);
+	}
+
+	// 内容が変わった場合のみイベント発火（ハンドラ内で監視対象が変わっても良いよう先に取り出す）
+	TArray<FActorInsightSnapshot, TInlineAllocator<16>> Updated;
+	Updated.Reserve(PendingStates.Num());
+	for (FWatchState* State : PendingStates)
+	{
+		Updated.Add(State->Snapshot);
+	}
+	PendingStates.Reset();
+
+	// 変わったアクターのみ履歴へ記録（変わらない間は直前のフレームが続いているとみなす）
+	if (bRecordHistory)
+	{
+		for (const FActorInsightSnapshot& Snapshot : Updated)
+		{
+			HistoryRecorder.Record(*Snapshot);
+		}
+	}
+
+	for (const FActorInsightSnapshot& Snapshot : Updated)
+	{
+		OnActorInsightUpdated.Broadcast(*Snapshot);
+	}
+}
 
-	// 無効なアクターをクリーンアップ
-	CleanupInvalidActors();
+void UDebugDataCollectorSubsystem::ScheduleCollection()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::ScheduleCollection);
+
+	const double Now = FPlatformTime::Seconds();
+	const double BudgetSeconds = CollectBudgetMicroseconds * 1.0e-6;
+	LastCollectedActorCount = 0;
+
+	// 視点（ローカルプレイヤーのカメラ）
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasView = false;
+	if (UWorld* World = GetWorld())
+	{
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			bHasView = true;
+		}
+	}
 
-	// 全監視対象のデータを更新
+	// 選択中のアクターは予算に関わらず更新間隔ごとに収集し、優先度の高い監視対象を抽出
+	DueHighPriority.Reset();
 	for (const TWeakObjectPtr<AActor>& WeakActor : WatchedActors)
 	{
-		if (AActor* Actor = WeakActor.Get())
+		AActor* Actor = WeakActor.Get();
+		FWatchState* State = WatchStates.Find(WeakActor);
+		if (!Actor || !State)
+		{
+			continue;
+		}
+
+		const bool bIsFocus = WeakActor == FocusActor || IsRemoteFocus(WeakActor);
+		State->bHighPriority = bIsFocus
+			|| Now - State->LastChangeTime < RecentChangeWindow
+			|| Actor->WasRecentlyRendered(0.2f)
+			|| (bHasView && FVector::DistSquared(Actor->GetActorLocation(), ViewLocation) < FMath::Square(NearCameraDistance));
+
+		if (Now - State->LastCollectTime < UpdateInterval)
+		{
+			continue;
+		}
+
+		if (bIsFocus)
+		{
+			CollectScheduled(Actor, *State, Now);
+		}
+		else if (State->bHighPriority)
+		{
+			DueHighPriority.Emplace(Actor, State);
+		}
+	}
+
+	// 優先度の高いものは前回の収集が古い順
+	DueHighPriority.Sort([](const TPair<AActor*, FWatchState*>& A, const TPair<AActor*, FWatchState*>& B)
+	{
+		return A.Value->LastCollectTime < B.Value->LastCollectTime;
+	});
+
+	for (const TPair<AActor*, FWatchState*>& Due : DueHighPriority)
+	{
+		if (FPlatformTime::Seconds() - Now >= BudgetSeconds)
+		{
+			break;
+		}
+		CollectScheduled(Due.Key, *Due.Value, Now);
+	}
+
+	// 残りの予算で優先度の低いものをラウンドロビン（予算が尽きていても1体は進めて取り残さない）
+	const int32 NumWatched = WatchedActors.Num();
+	bool bCollectedLowPriority = false;
+	for (int32 Step = 0; Step < NumWatched; ++Step)
+	{
+		if (bCollectedLowPriority && FPlatformTime::Seconds() - Now >= BudgetSeconds)
 		{
-			FActorInsightData InsightData = CollectActorInsight(Actor);
-			CachedInsightData.Add(WeakActor, InsightData);
+			break;
+		}
 
-			// イベント発火
-			OnActorInsightUpdated.Broadcast(InsightData);
+		const int32 Index = (RoundRobinCursor + Step) % NumWatched;
+		const TWeakObjectPtr<AActor>& WeakActor = WatchedActors[Index];
+		AActor* Actor = WeakActor.Get();
+		FWatchState* State = WatchStates.Find(WeakActor);
+		if (!Actor || !State || State->bHighPriority || Now - State->LastCollectTime < UpdateInterval)
+		{
+			continue;
 		}
+
+		CollectScheduled(Actor, *State, Now);
+		bCollectedLowPriority = true;
+		RoundRobinCursor = Index + 1;
+	}
+
+	LastCollectMicroseconds = static_cast<float>((FPlatformTime::Seconds() - Now) * 1.0e6);
+}
+
+void UDebugDataCollectorSubsystem::CollectScheduled(AActor* Actor, FWatchState& State, double Now)
+{
+	State.LastCollectTime = Now;
+	++LastCollectedActorCount;
+
+	if (CollectActorInsight(Actor, State))
+	{
+		State.LastChangeTime = Now;
+		PendingStates.Add(&State);
+	}
+}
+
+void UDebugDataCollectorSubsystem::SetFocusActor(AActor* Actor)
+{
+	FocusActor = Actor;
+
+	// 選択直後に最新の状態を表示できるよう次のティックで収集
+	if (FWatchState* State = WatchStates.Find(FocusActor))
+	{
+		State->LastCollectTime = 0.0;
+	}
+
+	// クライアント: サーバー側でも優先させる
+	if (AInsightReplicator* Replicator = ClientReplicator.Get())
+	{
+		Replicator->UpdateInterest(GetWatchedActors(), FocusActor.Get());
 	}
 }
 
@@ -104,16 +383,19 @@ void UDebugDataCollectorSubsystem::WatchActor(AActor* Actor)
 		return;
 	}
 
-	// 既に監視中かチェック
+	// 既に監視中かチェック（クライアントの監視のために追加していた場合はローカルの監視に切り替える）
 	for (const TWeakObjectPtr<AActor>& WeakActor : WatchedActors)
 	{
 		if (WeakActor.Get() == Actor)
 		{
+			RemoteOnlyWatches.Remove(WeakActor);
 			return;
 		}
 	}
 
 	WatchedActors.Add(Actor);
+	WatchStates.Add(Actor);
+	UnifiedDebugPanelTrace::OutputActor(*Actor);
 	OnWatchedActorAdded.Broadcast(Actor);
 
 	UE_LOG(LogTemp, Log, TEXT("[DebugDataCollector] Now watching: %s"), *Actor->GetName());
@@ -131,7 +413,14 @@ void UDebugDataCollectorSubsystem::UnwatchActor(AActor* Actor)
 		if (WatchedActors[i].Get() == Actor)
 		{
 			WatchedActors.RemoveAt(i);
-			CachedInsightData.Remove(Actor);
+			RemoteOnlyWatches.Remove(Actor);
+			if (FWatchState* State = WatchStates.Find(Actor))
+			{
+				StopObservingBlackboard(*State);
+				StopObservingEvents(*State);
+				WatchStates.Remove(Actor);
+			}
+			HistoryRecorder.StopRecording(Actor);
 			OnWatchedActorRemoved.Broadcast(Actor);
 
 			UE_LOG(LogTemp, Log, TEXT("[DebugDataCollector] Stopped watching: %s"), *Actor->GetName());
@@ -150,8 +439,17 @@ void UDebugDataCollectorSubsystem::ClearAllWatches()
 		}
 	}
 
+	for (TPair<TWeakObjectPtr<AActor>, FWatchState>& Pair : WatchStates)
+	{
+		StopObservingBlackboard(Pair.Value);
+		StopObservingEvents(Pair.Value);
+		HistoryRecorder.StopRecording(Pair.Key);
+	}
+
 	WatchedActors.Empty();
-	CachedInsightData.Empty();
+	WatchStates.Empty();
+	RemoteOnlyWatches.Empty();
+	RemoteInterestCounts.Empty();
 
 	UE_LOG(LogTemp, Log, TEXT("[DebugDataCollector] All watches cleared"));
 }
@@ -189,10 +487,9 @@ bool UDebugDataCollectorSubsystem::GetActorInsight(AActor* Actor, FActorInsightD
 		return false;
 	}
 
-	const FActorInsightData* CachedData = CachedInsightData.Find(Actor);
-	if (CachedData)
+	if (FActorInsightSnapshot Snapshot = GetInsightSnapshot(Actor))
 	{
-		OutData = *CachedData;
+		OutData = *Snapshot;
 		return true;
 	}
 
@@ -201,11 +498,70 @@ bool UDebugDataCollectorSubsystem::GetActorInsight(AActor* Actor, FActorInsightD
 
 TArray<FActorInsightData> UDebugDataCollectorSubsystem::GetAllInsightData() const
 {
+	TArray<FActorInsightSnapshot> Snapshots;
+	GetAllInsightSnapshots(Snapshots);
+
 	TArray<FActorInsightData> Result;
-	CachedInsightData.GenerateValueArray(Result);
+	Result.Reserve(Snapshots.Num());
+	for (const FActorInsightSnapshot& Snapshot : Snapshots)
+	{
+		Result.Add(*Snapshot);
+	}
 	return Result;
 }
 
+FActorInsightSnapshot UDebugDataCollectorSubsystem::GetInsightSnapshot(AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	const FWatchState* State = WatchStates.Find(Actor);
+	return State ? FActorInsightSnapshot(State->Snapshot) : nullptr;
+}
+
+void UDebugDataCollectorSubsystem::GetAllInsightSnapshots(TArray<FActorInsightSnapshot>& OutSnapshots) const
+{
+	OutSnapshots.Reset(WatchedActors.Num());
+	for (const TWeakObjectPtr<AActor>& WeakActor : WatchedActors)
+	{
+		const FWatchState* State = WatchStates.Find(WeakActor);
+		if (State && State->Snapshot.IsValid())
+		{
+			OutSnapshots.Add(State->Snapshot);
+		}
+	}
+}
+
+bool UDebugDataCollectorSubsystem::GetHistoryTimeRange(float& OutOldest, float& OutNewest) const
+{
+	return HistoryRecorder.GetTimeRange(OutOldest, OutNewest);
+}
+
+bool UDebugDataCollectorSubsystem::GetActorInsightAtTime(AActor* Actor, float Time, FActorInsightData& OutData) const
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	return HistoryRecorder.Reconstruct(Actor, Time, OutData);
+}
+
+bool UDebugDataCollectorSubsystem::DumpHistoryToFile(const FString& FilePath)
+{
+	FString OutputPath = FilePath;
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("UnifiedDebugPanel")
+			/ FString::Printf(TEXT("InsightHistory_%s.udph"), *FDateTime::Now().ToString());
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), true);
+	return HistoryRecorder.SaveToFile(OutputPath);
+}
+
 TArray<AActor*> UDebugDataCollectorSubsystem::GetWatchedActors() const
 {
 	TArray<AActor*> Result;
@@ -219,332 +575,1089 @@ TArray<AActor*> UDebugDataCollectorSubsystem::GetWatchedActors() const
 	return Result;
 }
 
-FActorInsightData UDebugDataCollectorSubsystem::CollectActorInsight(AActor* Actor)
+void UDebugDataCollectorSubsystem::FPendingFormat::Reset()
+{
+	bNames = false;
+	bAbilities = false;
+	bActiveAbilities = false;
+	bEffects = false;
+	bMontage = false;
+	bMontageSection = false;
+	bTree = false;
+	bBlackboardFull = false;
+	bBlackboardChanged = false;
+	bTick = false;
+	AbilityNames.Reset();
+	EffectNames.Reset();
+	BlackboardValues.Reset();
+	TickFunctions.Reset();
+}
+
+FActorInsightData& UDebugDataCollectorSubsystem::GetMutableSnapshot(FWatchState& State)
+{
+	if (!State.Snapshot.IsValid())
+	{
+		State.Snapshot = MakeShared<FActorInsightData, ESPMode::ThreadSafe>();
+	}
+	else if (!State.Snapshot.IsUnique())
+	{
+		// 利用側が前回のスナップショットを保持しているので複製して差し替える
+		State.Snapshot = MakeShared<FActorInsightData, ESPMode::ThreadSafe>(*State.Snapshot);
+	}
+	return *State.Snapshot;
+}
+
+bool UDebugDataCollectorSubsystem::CollectActorInsight(AActor* Actor, FWatchState& State)
 {
-	FActorInsightData Data;
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectActorInsight);
+
 	if (!Actor)
 	{
-		return Data;
+		return false;
 	}
 
-	Data.Actor = Actor;
-	Data.LastUpdateTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	bool bChanged = !State.bCollected;
+	if (!State.bCollected)
+	{
+		GetMutableSnapshot(State).Actor = Actor;
+	}
 
 	// 基本状態
-	Data.BasicState = CollectBasicState(Actor);
+	bChanged |= CollectBasicState(Actor, State);
+
+	// 変更通知の登録（イベント駆動の収集時）
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
+	const ACharacter* Character = Cast<ACharacter>(Actor);
+	USkeletalMeshComponent* SkelMesh = Character ? Character->GetMesh() : nullptr;
+	UpdateEventBindings(Actor, ASC, SkelMesh ? SkelMesh->GetAnimInstance() : nullptr, State);
 
 	// Ability System
-	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
-	{
-		CollectAbilitySystemData(ASC, Data);
-	}
+	bChanged |= CollectAbilitySystemData(ASC, State);
 
 	// Animation (Character の場合)
-	if (ACharacter* Character = Cast<ACharacter>(Actor))
-	{
-		if (USkeletalMeshComponent* SkelMesh = Character->GetMesh())
-		{
-			CollectAnimationData(SkelMesh, Data);
-		}
-	}
+	bChanged |= CollectAnimationData(SkelMesh, State);
 
 	// AI (Pawn with AI Controller)
+	UBehaviorTreeComponent* BTC = nullptr;
+	UBlackboardComponent* BBC = nullptr;
 	if (APawn* Pawn = Cast<APawn>(Actor))
 	{
 		if (AAIController* AIC = Cast<AAIController>(Pawn->GetController()))
 		{
-			if (UBehaviorTreeComponent* BTC = Cast<UBehaviorTreeComponent>(AIC->GetBrainComponent()))
-			{
-				CollectBehaviorTreeData(BTC, Data);
-			}
-
-			if (UBlackboardComponent* BBC = AIC->GetBlackboardComponent())
-			{
-				CollectBlackboardData(BBC, Data);
-			}
+			BTC = Cast<UBehaviorTreeComponent>(AIC->GetBrainComponent());
+			BBC = AIC->GetBlackboardComponent();
 		}
 	}
+	bChanged |= CollectBehaviorTreeData(BTC, State);
+	bChanged |= CollectBlackboardData(BBC, State);
 
 	// Tick情報
-	CollectTickData(Actor, Data);
+	bChanged |= CollectTickData(Actor, State);
 
-	// 人間向けサマリー生成
-	Data.HumanReadableSummary = GenerateHumanReadableSummary(Data);
-
-	return Data;
-}
-
-FActorDebugState UDebugDataCollectorSubsystem::CollectBasicState(AActor* Actor)
-{
-	FActorDebugState State;
-
-	if (!Actor)
-	{
-		return State;
-	}
-
-	State.ActorName = Actor->GetName();
-	State.ClassName = Actor->GetClass()->GetName();
-	State.Location = Actor->GetActorLocation();
-	State.Rotation = Actor->GetActorRotation();
-	State.bIsActive = !Actor->IsHidden();
-	State.bIsTickEnabled = Actor->PrimaryActorTick.bCanEverTick && Actor->PrimaryActorTick.IsTickFunctionEnabled();
+	State.bCollected = true;
 
-	// 速度取得（MovementComponent がある場合）
-	if (APawn* Pawn = Cast<APawn>(Actor))
+	if (bChanged)
 	{
-		State.Velocity = Pawn->GetVelocity();
+		// 整形フェーズで書き込むため、ここで参照中のスナップショットから切り離しておく
+		GetMutableSnapshot(State);
+		State.Pending.WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 	}
 
-	return State;
+	return bChanged;
 }
 
-void UDebugDataCollectorSubsystem::CollectAbilitySystemData(UAbilitySystemComponent* ASC, FActorInsightData& OutData)
+void UDebugDataCollectorSubsystem::FormatActorInsight(FWatchState& State)
 {
-	if (!ASC)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::FormatActorInsight);
+
+	FActorInsightData& Data = *State.Snapshot;
+	FPendingFormat& Pending = State.Pending;
+
+	if (Pending.bNames)
 	{
-		return;
+		Data.BasicState.ActorName = Pending.ActorName.ToString();
+		Data.BasicState.ClassName = Pending.ClassName.ToString();
 	}
 
-	// 所有しているGameplayTags
-	ASC->GetOwnedGameplayTags(OutData.OwnedGameplayTags);
-
-	// 付与されているアビリティ
-	const TArray<FGameplayAbilitySpec>& ActivatableAbilities = ASC->GetActivatableAbilities();
-	for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
+	if (Pending.bAbilities)
 	{
-		if (!Spec.Ability)
+		for (int32 i = 0; i < Pending.AbilityNames.Num(); ++i)
 		{
-			continue;
+			Data.GrantedAbilities[i].AbilityName = Pending.AbilityNames[i].Key.ToString();
+			Data.GrantedAbilities[i].ClassName = Pending.AbilityNames[i].Value.ToString();
 		}
+	}
 
-		FAbilityDebugInfo AbilityInfo;
-		AbilityInfo.AbilityName = Spec.Ability->GetName();
-		AbilityInfo.ClassName = Spec.Ability->GetClass()->GetName();
-		AbilityInfo.Level = Spec.Level;
-		AbilityInfo.bIsActive = Spec.IsActive();
-		AbilityInfo.bInputBound = Spec.InputID != INDEX_NONE;
-
-		// アビリティタグ取得
-		if (const UGameplayAbility* AbilityCDO = Spec.Ability->GetClass()->GetDefaultObject<UGameplayAbility>())
+	if (Pending.bAbilities || Pending.bActiveAbilities)
+	{
+		// 実行中アビリティは付与済みアビリティから抽出
+		Data.ActiveAbilities.Reset();
+		for (const FAbilityDebugInfo& AbilityInfo : Data.GrantedAbilities)
 		{
-			AbilityInfo.AbilityTags = AbilityCDO->AbilityTags;
+			if (AbilityInfo.bIsActive)
+			{
+				Data.ActiveAbilities.Add(AbilityInfo);
+			}
 		}
+	}
 
-		// クールダウン確認
-		const UGameplayAbility* AbilityInstance = Spec.GetPrimaryInstance();
-		if (AbilityInstance)
+	if (Pending.bEffects)
+	{
+		for (int32 i = 0; i < Pending.EffectNames.Num(); ++i)
 		{
-			float RemainingCooldown = 0.0f;
-			float CooldownDuration = 0.0f;
-			AbilityInstance->GetCooldownTimeRemainingAndDuration(Spec.Handle, ASC->AbilityActorInfo.Get(), RemainingCooldown, CooldownDuration);
-			AbilityInfo.bIsOnCooldown = RemainingCooldown > 0.0f;
-			AbilityInfo.CooldownRemaining = RemainingCooldown;
+			Data.ActiveEffects[i].EffectName = Pending.EffectNames[i].Key.ToString();
+			Data.ActiveEffects[i].InstigatorName = DebugDataCollector::NameToString(Pending.EffectNames[i].Value);
 		}
+	}
 
-		if (AbilityInfo.bIsActive)
-		{
-			OutData.ActiveAbilities.Add(AbilityInfo);
-		}
-		OutData.GrantedAbilities.Add(AbilityInfo);
+	if (Pending.bMontage)
+	{
+		Data.ActiveMontages[0].MontageName = Pending.MontageName.ToString();
+	}
+	if (Pending.bMontageSection)
+	{
+		Data.ActiveMontages[0].CurrentSectionName = Pending.MontageSection.ToString();
 	}
 
-	// アクティブなGameplayEffects
-	FGameplayEffectQuery Query;
-	TArray<FActiveGameplayEffectHandle> ActiveEffects = ASC->GetActiveEffects(Query);
+	if (Pending.bTree)
+	{
+		Data.BehaviorTree.TreeName = DebugDataCollector::NameToString(Pending.TreeName);
+	}
 
-	for (const FActiveGameplayEffectHandle& Handle : ActiveEffects)
+	// ブラックボードの値の文字列化
+	if (Pending.bBlackboardFull || Pending.bBlackboardChanged)
 	{
-		const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(Handle);
-		if (!ActiveEffect || !ActiveEffect->Spec.Def)
+		if (Pending.bBlackboardFull)
 		{
-			continue;
+			Data.Blackboard.KeyValues.Reset();
 		}
+		Data.Blackboard.RecentlyChangedKeys.Reset();
 
-		FEffectDebugInfo EffectInfo;
-		EffectInfo.EffectName = ActiveEffect->Spec.Def->GetName();
-		EffectInfo.StackCount = ActiveEffect->Spec.GetStackCount();
-
-		// エフェクトタグ
-		ActiveEffect->Spec.Def->GetAssetTags(EffectInfo.EffectTags);
-
-		// 残り時間
-		float Duration = ActiveEffect->GetDuration();
-		float StartTime = ActiveEffect->StartWorldTime;
-		if (Duration > 0.0f && GetWorld())
+		for (const FGatheredBlackboardValue& Value : Pending.BlackboardValues)
 		{
-			float ElapsedTime = GetWorld()->GetTimeSeconds() - StartTime;
-			EffectInfo.RemainingTime = FMath::Max(0.0f, Duration - ElapsedTime);
+			FString KeyName = Value.KeyName.ToString();
+			Data.Blackboard.KeyValues.Add(KeyName, FormatBlackboardValue(Value));
+			if (!Pending.bBlackboardFull)
+			{
+				Data.Blackboard.RecentlyChangedKeys.Add(MoveTemp(KeyName));
+			}
 		}
+	}
 
-		// ソース情報
-		if (ActiveEffect->Spec.GetContext().GetInstigator())
+	if (Pending.bTick)
+	{
+		Data.TickInfo.Reset(Pending.TickFunctions.Num());
+		for (const FGatheredTickFunction& TickFunction : Pending.TickFunctions)
 		{
-			EffectInfo.InstigatorName = ActiveEffect->Spec.GetContext().GetInstigator()->GetName();
+			FTickDebugInfo& TickInfo = Data.TickInfo.AddDefaulted_GetRef();
+			TickInfo.Name = TickFunction.Name.ToString();
+			TickInfo.bIsEnabled = TickFunction.bIsEnabled;
+			TickInfo.TickGroup = DebugDataCollector::GetTickGroupName(TickFunction.TickGroup);
 		}
-
-		OutData.ActiveEffects.Add(EffectInfo);
 	}
+
+	// 人間向けサマリー生成（いずれかのセクションが変わった時のみ）
+	Data.HumanReadableSummary = GenerateHumanReadableSummary(Data);
+	Data.LastUpdateTime = Pending.WorldTime;
+	++Data.Revision;
+
+	Pending.Reset();
 }
 
-void UDebugDataCollectorSubsystem::CollectAnimationData(USkeletalMeshComponent* SkelMesh, FActorInsightData& OutData)
+FString UDebugDataCollectorSubsystem::FormatBlackboardValue(const FGatheredBlackboardValue& Value)
 {
-	if (!SkelMesh)
-	{
-		return;
-	}
+	using EType = FGatheredBlackboardValue::EType;
 
-	UAnimInstance* AnimInstance = SkelMesh->GetAnimInstance();
-	if (!AnimInstance)
+	switch (Value.Type)
 	{
-		return;
+	case EType::Bool:
+		return Value.BoolValue ? TEXT("true") : TEXT("false");
+	case EType::Int:
+		return FString::FromInt(Value.IntValue);
+	case EType::Float:
+		return FString::SanitizeFloat(Value.FloatValue);
+	case EType::Name:
+		return Value.NameValue.ToString();
+	case EType::Vector:
+		return FAISystem::IsValidLocation(Value.VectorValue) ? Value.VectorValue.ToString() : TEXT("(invalid)");
+	case EType::Rotator:
+		return FAISystem::IsValidRotation(Value.RotatorValue) ? Value.RotatorValue.ToString() : TEXT("(invalid)");
+	case EType::Object:
+		return Value.NameValue.IsNone() ? TEXT("None") : Value.NameValue.ToString();
+	case EType::String:
+	case EType::Described:
+	default:
+		return Value.StringValue;
 	}
+}
 
-	// アクティブなモンタージュ
-	if (UAnimMontage* CurrentMontage = AnimInstance->GetCurrentActiveMontage())
-	{
-		FMontageDebugInfo MontageInfo;
-		MontageInfo.MontageName = CurrentMontage->GetName();
-		MontageInfo.Position = AnimInstance->Montage_GetPosition(CurrentMontage);
-		MontageInfo.PlayRate = AnimInstance->Montage_GetPlayRate(CurrentMontage);
-		MontageInfo.bIsBlendingOut = AnimInstance->Montage_GetIsStopped(CurrentMontage);
-
-		// 現在のセクション
-		FName CurrentSection = AnimInstance->Montage_GetCurrentSection(CurrentMontage);
-		MontageInfo.CurrentSectionName = CurrentSection.ToString();
+void UDebugDataCollectorSubsystem::GatherBlackboardValue(const UBlackboardComponent& BBC, FBlackboard::FKey KeyID, FGatheredBlackboardValue& OutValue)
+{
+	using EType = FGatheredBlackboardValue::EType;
 
-		// 残り時間計算
-		float MontageLength = CurrentMontage->GetPlayLength();
-		MontageInfo.RemainingTime = FMath::Max(0.0f, MontageLength - MontageInfo.Position);
+	const UBlackboardData* BBData = BBC.GetBlackboardAsset();
+	const FBlackboardEntry* Entry = BBData ? BBData->GetKey(KeyID) : nullptr;
+	const UBlackboardKeyType* KeyType = Entry ? Entry->KeyType.Get() : nullptr;
+	OutValue.KeyName = Entry ? Entry->EntryName : BBC.GetKeyName(KeyID);
 
-		OutData.ActiveMontages.Add(MontageInfo);
+	// よく使う型は生の値のみ読み取り、文字列化は整形フェーズで行う
+	if (Cast<UBlackboardKeyType_Bool>(KeyType))
+	{
+		OutValue.Type = EType::Bool;
+		OutValue.BoolValue = BBC.GetValue<UBlackboardKeyType_Bool>(KeyID);
 	}
-
-	// ステートマシン情報
-	// Note: UE5ではステートマシン情報の取得が複雑なため、簡略化実装
-	// より詳細な情報が必要な場合はAnimInstance内部のステートマシンを直接参照
-}
-
-void UDebugDataCollectorSubsystem::CollectBehaviorTreeData(UBehaviorTreeComponent* BTC, FActorInsightData& OutData)
-{
-	if (!BTC)
+	else if (Cast<UBlackboardKeyType_Int>(KeyType))
 	{
-		return;
+		OutValue.Type = EType::Int;
+		OutValue.IntValue = BBC.GetValue<UBlackboardKeyType_Int>(KeyID);
+	}
+	else if (Cast<UBlackboardKeyType_Float>(KeyType))
+	{
+		OutValue.Type = EType::Float;
+		OutValue.FloatValue = BBC.GetValue<UBlackboardKeyType_Float>(KeyID);
+	}
+	else if (Cast<UBlackboardKeyType_Name>(KeyType))
+	{
+		OutValue.Type = EType::Name;
+		OutValue.NameValue = BBC.GetValue<UBlackboardKeyType_Name>(KeyID);
+	}
+	else if (Cast<UBlackboardKeyType_String>(KeyType))
+	{
+		OutValue.Type = EType::String;
+		OutValue.StringValue = BBC.GetValue<UBlackboardKeyType_String>(KeyID);
+	}
+	else if (Cast<UBlackboardKeyType_Vector>(KeyType))
+	{
+		OutValue.Type = EType::Vector;
+		OutValue.VectorValue = BBC.GetValue<UBlackboardKeyType_Vector>(KeyID);
+	}
+	else if (Cast<UBlackboardKeyType_Rotator>(KeyType))
+	{
+		OutValue.Type = EType::Rotator;
+		OutValue.RotatorValue = BBC.GetValue<UBlackboardKeyType_Rotator>(KeyID);
+	}
+	else if (const UBlackboardKeyType_Enum* EnumKey = Cast<UBlackboardKeyType_Enum>(KeyType))
+	{
+		const uint8 EnumValue = BBC.GetValue<UBlackboardKeyType_Enum>(KeyID);
+		if (EnumKey->EnumType)
+		{
+			OutValue.Type = EType::Name;
+			OutValue.NameValue = EnumKey->EnumType->GetNameByValue(EnumValue);
+		}
+		else
+		{
+			OutValue.Type = EType::Int;
+			OutValue.IntValue = EnumValue;
+		}
+	}
+	else if (Cast<UBlackboardKeyType_Object>(KeyType))
+	{
+		const UObject* Object = BBC.GetValue<UBlackboardKeyType_Object>(KeyID);
+		OutValue.Type = EType::Object;
+		OutValue.NameValue = Object ? Object->GetFName() : NAME_None;
+	}
+	else if (Cast<UBlackboardKeyType_Class>(KeyType))
+	{
+		const UClass* Class = BBC.GetValue<UBlackboardKeyType_Class>(KeyID);
+		OutValue.Type = EType::Object;
+		OutValue.NameValue = Class ? Class->GetFName() : NAME_None;
+	}
+	else
+	{
+		// 未対応の型はキー型の説明に任せる
+		OutValue.Type = EType::Described;
+		OutValue.StringValue = BBC.DescribeKeyValue(KeyID, EBlackboardDescription::Detailed);
+	}
+}
+
+bool UDebugDataCollectorSubsystem::CollectBasicState(AActor* Actor, FWatchState& State)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectBasicState);
+
+	if (!Actor)
+	{
+		return false;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	const FRotator Rotation = Actor->GetActorRotation();
+	const bool bIsActive = !Actor->IsHidden();
+	const bool bIsTickEnabled = Actor->PrimaryActorTick.bCanEverTick && Actor->PrimaryActorTick.IsTickFunctionEnabled();
+
+	// 速度取得（MovementComponent がある場合）
+	FVector Velocity = FVector::ZeroVector;
+	if (APawn* Pawn = Cast<APawn>(Actor))
+	{
+		Velocity = Pawn->GetVelocity();
+	}
+
+	if (State.bCollected)
+	{
+		const FActorDebugState& Previous = State.Snapshot->BasicState;
+		if (Previous.Location == Location && Previous.Rotation == Rotation && Previous.Velocity == Velocity
+			&& Previous.bIsActive == bIsActive && Previous.bIsTickEnabled == bIsTickEnabled)
+		{
+			return false;
+		}
+	}
+
+	FActorDebugState& BasicState = GetMutableSnapshot(State).BasicState;
+	if (!State.bCollected)
+	{
+		// 名前は監視開始時のみ
+		State.Pending.bNames = true;
+		State.Pending.ActorName = Actor->GetFName();
+		State.Pending.ClassName = Actor->GetClass()->GetFName();
+	}
+	BasicState.Location = Location;
+	BasicState.Rotation = Rotation;
+	BasicState.Velocity = Velocity;
+	BasicState.bIsActive = bIsActive;
+	BasicState.bIsTickEnabled = bIsTickEnabled;
+
+	return true;
+}
+
+bool UDebugDataCollectorSubsystem::CollectAbilitySystemData(UAbilitySystemComponent* ASC, FWatchState& State)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectAbilitySystemData);
+
+	if (!ASC)
+	{
+		// ASCが無くなった場合は前回の内容を消す
+		const bool bHadData = State.AbilityKey != 0 || State.EffectKey != 0
+			|| (State.Snapshot.IsValid() && !State.Snapshot->OwnedGameplayTags.IsEmpty());
+		if (bHadData)
+		{
+			FActorInsightData& Data = GetMutableSnapshot(State);
+			Data.GrantedAbilities.Reset();
+			Data.ActiveAbilities.Reset();
+			Data.ActiveEffects.Reset();
+			Data.OwnedGameplayTags.Reset();
+			State.AbilityKey = 0;
+			State.EffectKey = 0;
+		}
+		State.NumAbilitySpecs = INDEX_NONE;
+		State.bHasCooldowns = false;
+		State.bHasTimedEffects = false;
+		return bHadData;
+	}
+
+	bool bChanged = false;
+
+	// イベント駆動の場合は通知のあったセクションのみ読み直す（一定間隔で全て読み直して取りこぼしを補う）
+	const bool bEventDriven = bEventDrivenCollection && State.BoundAbilitySystem.Get() == ASC;
+	if (bEventDriven)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - State.LastFullResyncTime >= EventResyncInterval)
+		{
+			State.DirtySections |= EDebugInsightSection::Abilities | EDebugInsightSection::Effects | EDebugInsightSection::Tags;
+			State.LastFullResyncTime = Now;
+		}
+	}
+
+	const TArray<FGameplayAbilitySpec>& ActivatableAbilities = ASC->GetActivatableAbilities();
+	const bool bTagsDirty = !bEventDriven || EnumHasAnyFlags(State.DirtySections, EDebugInsightSection::Tags);
+	const bool bAbilitiesDirty = !bEventDriven || EnumHasAnyFlags(State.DirtySections, EDebugInsightSection::Abilities)
+		|| ActivatableAbilities.Num() != State.NumAbilitySpecs;
+	const bool bEffectsDirty = !bEventDriven || EnumHasAnyFlags(State.DirtySections, EDebugInsightSection::Effects);
+	EnumRemoveFlags(State.DirtySections, EDebugInsightSection::Abilities | EDebugInsightSection::Effects | EDebugInsightSection::Tags);
+
+	// 所有しているGameplayTags
+	if (bTagsDirty)
+	{
+		FGameplayTagContainer OwnedTags;
+		ASC->GetOwnedGameplayTags(OwnedTags);
+		if (!State.Snapshot.IsValid() || State.Snapshot->OwnedGameplayTags != OwnedTags)
+		{
+			GetMutableSnapshot(State).OwnedGameplayTags = MoveTemp(OwnedTags);
+			bChanged = true;
+		}
+	}
+
+	// 付与されているアビリティ（構成キー: ハンドル・アビリティ・レベル・実行数・入力）
+	uint32 AbilityKey = State.AbilityKey;
+	if (bAbilitiesDirty)
+	{
+		AbilityKey = HashCombineFast(1u, static_cast<uint32>(ActivatableAbilities.Num()));
+		for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
+		{
+			AbilityKey = HashCombineFast(AbilityKey, GetTypeHash(Spec.Handle));
+			AbilityKey = HashCombineFast(AbilityKey, GetTypeHash(Spec.Ability.Get()));
+			AbilityKey = HashCombineFast(AbilityKey, static_cast<uint32>(Spec.Level));
+			AbilityKey = HashCombineFast(AbilityKey, static_cast<uint32>(Spec.ActiveCount));
+			AbilityKey = HashCombineFast(AbilityKey, static_cast<uint32>(Spec.InputID));
+		}
+	}
+
+	auto GetCooldownRemaining = [ASC](const FGameplayAbilitySpec& Spec) -> float
+	{
+		// クールダウンGEを持つインスタンスのみ問い合わせる
+		const UGameplayAbility* AbilityInstance = Spec.GetPrimaryInstance();
+		if (!AbilityInstance || !AbilityInstance->GetCooldownGameplayEffect())
+		{
+			return 0.0f;
+		}
+
+		float RemainingCooldown = 0.0f;
+		float CooldownDuration = 0.0f;
+		AbilityInstance->GetCooldownTimeRemainingAndDuration(Spec.Handle, ASC->AbilityActorInfo.Get(), RemainingCooldown, CooldownDuration);
+		return RemainingCooldown;
+	};
+
+	if (AbilityKey != State.AbilityKey)
+	{
+		// 構成が変わった場合のみ作り直す（名前の文字列化は整形フェーズ）
+		FActorInsightData& Data = GetMutableSnapshot(State);
+		FPendingFormat& Pending = State.Pending;
+		Data.GrantedAbilities.Reset(ActivatableAbilities.Num());
+		Pending.AbilityNames.Reset(ActivatableAbilities.Num());
+		for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
+		{
+			if (!Spec.Ability)
+			{
+				continue;
+			}
+
+			FAbilityDebugInfo& AbilityInfo = Data.GrantedAbilities.AddDefaulted_GetRef();
+			Pending.AbilityNames.Emplace(Spec.Ability->GetFName(), Spec.Ability->GetClass()->GetFName());
+			AbilityInfo.Level = Spec.Level;
+			AbilityInfo.bIsActive = Spec.IsActive();
+			AbilityInfo.bInputBound = Spec.InputID != INDEX_NONE;
+
+			// アビリティタグ取得
+			if (const UGameplayAbility* AbilityCDO = Spec.Ability->GetClass()->GetDefaultObject<UGameplayAbility>())
+			{
+				AbilityInfo.AbilityTags = AbilityCDO->AbilityTags;
+			}
+
+			AbilityInfo.CooldownRemaining = GetCooldownRemaining(Spec);
+			AbilityInfo.bIsOnCooldown = AbilityInfo.CooldownRemaining > 0.0f;
+		}
+
+		// 実行中のアビリティの開始・終了（実行数は構成キーに含まれる）
+		if (UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED())
+		{
+			TArray<TPair<uint32, FName>> ActiveAbilities;
+			for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
+			{
+				if (Spec.Ability && Spec.IsActive())
+				{
+					ActiveAbilities.Emplace(GetTypeHash(Spec.Handle), Spec.Ability->GetClass()->GetFName());
+				}
+			}
+			DebugDataCollector::TraceSetChanges(DebugDataCollector::GetTraceActor(State.Snapshot), State.TracedAbilities, MoveTemp(ActiveAbilities),
+				EInsightTraceEvent::AbilityActivated, EInsightTraceEvent::AbilityEnded);
+		}
+
+		State.AbilityKey = AbilityKey;
+		Pending.bAbilities = true;
+		bChanged = true;
+	}
+	else if (bAbilitiesDirty || State.bHasCooldowns)
+	{
+		// 構成が同じならクールダウンのみ更新（GrantedAbilitiesはスペックと同じ順序）
+		int32 AbilityIndex = 0;
+		for (const FGameplayAbilitySpec& Spec : ActivatableAbilities)
+		{
+			if (!Spec.Ability)
+			{
+				continue;
+			}
+
+			const int32 Index = AbilityIndex++;
+			if (!State.Snapshot->GrantedAbilities.IsValidIndex(Index))
+			{
+				State.DirtySections |= EDebugInsightSection::Abilities;
+				break;
+			}
+
+			const float CooldownRemaining = GetCooldownRemaining(Spec);
+			if (State.Snapshot->GrantedAbilities[Index].CooldownRemaining == CooldownRemaining)
+			{
+				continue;
+			}
+
+			FAbilityDebugInfo& AbilityInfo = GetMutableSnapshot(State).GrantedAbilities[Index];
+			AbilityInfo.CooldownRemaining = CooldownRemaining;
+			AbilityInfo.bIsOnCooldown = CooldownRemaining > 0.0f;
+
+			// 実行中アビリティは整形フェーズで付与済みアビリティから抽出し直す
+			State.Pending.bActiveAbilities |= AbilityInfo.bIsActive;
+			bChanged = true;
+		}
+	}
+
+	// 次回クールダウンを読み取るか（クールダウン中のものが無ければ通知まで読まない）
+	if (bAbilitiesDirty || State.bHasCooldowns)
+	{
+		State.bHasCooldowns = State.Snapshot->GrantedAbilities.ContainsByPredicate([](const FAbilityDebugInfo& Ability) { return Ability.bIsOnCooldown; });
+	}
+	State.NumAbilitySpecs = ActivatableAbilities.Num();
+
+	// アクティブなGameplayEffects（構成キー: ハンドル・定義・スタック数）
+	const FActiveGameplayEffectsContainer& ActiveEffects = ASC->GetActiveGameplayEffects();
+	uint32 EffectKey = State.EffectKey;
+	if (bEffectsDirty)
+	{
+		EffectKey = 1u;
+		for (const FActiveGameplayEffect& ActiveEffect : &ActiveEffects)
+		{
+			if (ActiveEffect.IsPendingRemove || !ActiveEffect.Spec.Def)
+			{
+				continue;
+			}
+			EffectKey = HashCombineFast(EffectKey, GetTypeHash(ActiveEffect.Handle));
+			EffectKey = HashCombineFast(EffectKey, GetTypeHash(ActiveEffect.Spec.Def.Get()));
+			EffectKey = HashCombineFast(EffectKey, static_cast<uint32>(ActiveEffect.Spec.GetStackCount()));
+		}
+	}
+
+	const UWorld* World = GetWorld();
+	auto GetRemainingTime = [World](const FActiveGameplayEffect& ActiveEffect) -> float
+	{
+		// 残り時間
+		const float Duration = ActiveEffect.GetDuration();
+		if (Duration > 0.0f && World)
+		{
+			return FMath::Max(0.0f, Duration - (World->GetTimeSeconds() - ActiveEffect.StartWorldTime));
+		}
+		return 0.0f;
+	};
+
+	if (EffectKey != State.EffectKey)
+	{
+		FActorInsightData& Data = GetMutableSnapshot(State);
+		FPendingFormat& Pending = State.Pending;
+		Data.ActiveEffects.Reset();
+		Pending.EffectNames.Reset();
+		for (const FActiveGameplayEffect& ActiveEffect : &ActiveEffects)
+		{
+			if (ActiveEffect.IsPendingRemove || !ActiveEffect.Spec.Def)
+			{
+				continue;
+			}
+
+			FEffectDebugInfo& EffectInfo = Data.ActiveEffects.AddDefaulted_GetRef();
+			EffectInfo.StackCount = ActiveEffect.Spec.GetStackCount();
+
+			// エフェクトタグ
+			ActiveEffect.Spec.Def->GetAssetTags(EffectInfo.EffectTags);
+
+			EffectInfo.RemainingTime = GetRemainingTime(ActiveEffect);
+
+			// 名前とソース情報
+			const AActor* Instigator = ActiveEffect.Spec.GetContext().GetInstigator();
+			Pending.EffectNames.Emplace(ActiveEffect.Spec.Def->GetFName(), Instigator ? Instigator->GetFName() : NAME_None);
+		}
+
+		// エフェクトの適用・解除
+		if (UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED())
+		{
+			TArray<TPair<uint32, FName>> AppliedEffects;
+			for (const FActiveGameplayEffect& ActiveEffect : &ActiveEffects)
+			{
+				if (!ActiveEffect.IsPendingRemove && ActiveEffect.Spec.Def)
+				{
+					AppliedEffects.Emplace(GetTypeHash(ActiveEffect.Handle), ActiveEffect.Spec.Def->GetFName());
+				}
+			}
+			DebugDataCollector::TraceSetChanges(DebugDataCollector::GetTraceActor(State.Snapshot), State.TracedEffects, MoveTemp(AppliedEffects),
+				EInsightTraceEvent::EffectApplied, EInsightTraceEvent::EffectRemoved);
+		}
+
+		State.EffectKey = EffectKey;
+		Pending.bEffects = true;
+		bChanged = true;
+	}
+	else if (bEffectsDirty || State.bHasTimedEffects)
+	{
+		// 構成が同じなら残り時間のみ更新
+		int32 EffectIndex = 0;
+		for (const FActiveGameplayEffect& ActiveEffect : &ActiveEffects)
+		{
+			if (ActiveEffect.IsPendingRemove || !ActiveEffect.Spec.Def)
+			{
+				continue;
+			}
+
+			// 通知より先に構成が変わっていた場合は次回作り直す
+			const int32 Index = EffectIndex++;
+			if (!State.Snapshot->ActiveEffects.IsValidIndex(Index))
+			{
+				State.DirtySections |= EDebugInsightSection::Effects;
+				break;
+			}
+
+			const float RemainingTime = GetRemainingTime(ActiveEffect);
+			if (State.Snapshot->ActiveEffects[Index].RemainingTime != RemainingTime)
+			{
+				GetMutableSnapshot(State).ActiveEffects[Index].RemainingTime = RemainingTime;
+				bChanged = true;
+			}
+		}
+	}
+
+	// 次回残り時間を読み取るか（期限付きのエフェクトが無ければ通知まで読まない）
+	if (bEffectsDirty || State.bHasTimedEffects)
+	{
+		State.bHasTimedEffects = State.Snapshot->ActiveEffects.ContainsByPredicate([](const FEffectDebugInfo& Effect) { return Effect.RemainingTime > 0.0f; });
+	}
+
+	return bChanged;
+}
+
+bool UDebugDataCollectorSubsystem::CollectAnimationData(USkeletalMeshComponent* SkelMesh, FWatchState& State)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectAnimationData);
+
+	UAnimInstance* AnimInstance = SkelMesh ? SkelMesh->GetAnimInstance() : nullptr;
+
+	// イベント駆動の場合、再生中でなく開始・終了の通知も無ければ読み取らない（再生中は位置を毎回読む）
+	const bool bEventDriven = bEventDrivenCollection && AnimInstance && State.MontageListener.IsValid()
+		&& State.MontageListener->GetAnimInstance() == AnimInstance;
+	if (bEventDriven && State.MontageInstanceId == INDEX_NONE && !EnumHasAnyFlags(State.DirtySections, EDebugInsightSection::Montage))
+	{
+		return false;
+	}
+	EnumRemoveFlags(State.DirtySections, EDebugInsightSection::Montage);
+
+	// アクティブなモンタージュ（インスタンスIDで同一性を判定）
+	const FAnimMontageInstance* MontageInstance = AnimInstance ? AnimInstance->GetActiveMontageInstance() : nullptr;
+	if (!MontageInstance || !MontageInstance->Montage)
+	{
+		if (State.MontageInstanceId == INDEX_NONE)
+		{
+			return false;
+		}
+
+		if (UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED() && !State.TracedMontage.IsNone())
+		{
+			if (const AActor* TraceActor = DebugDataCollector::GetTraceActor(State.Snapshot))
+			{
+				UnifiedDebugPanelTrace::OutputEvent(*TraceActor, EInsightTraceEvent::MontageStopped, *State.TracedMontage.ToString());
+			}
+		}
+		State.TracedMontage = NAME_None;
+
+		GetMutableSnapshot(State).ActiveMontages.Reset();
+		State.MontageInstanceId = INDEX_NONE;
+		State.MontageSection = NAME_None;
+		return true;
+	}
+
+	const float Position = MontageInstance->GetPosition();
+	const float PlayRate = MontageInstance->GetPlayRate();
+	const bool bIsBlendingOut = MontageInstance->IsStopped();
+	const FName CurrentSection = MontageInstance->GetCurrentSection();
+
+	const bool bNewInstance = MontageInstance->GetInstanceID() != State.MontageInstanceId;
+	if (!bNewInstance)
+	{
+		const FMontageDebugInfo& Previous = State.Snapshot->ActiveMontages[0];
+		if (Previous.Position == Position && Previous.PlayRate == PlayRate
+			&& Previous.bIsBlendingOut == bIsBlendingOut && State.MontageSection == CurrentSection)
+		{
+			return false;
+		}
+	}
+
+	FActorInsightData& Data = GetMutableSnapshot(State);
+	if (bNewInstance)
+	{
+		Data.ActiveMontages.Reset();
+		Data.ActiveMontages.AddDefaulted();
+		State.MontageInstanceId = MontageInstance->GetInstanceID();
+		State.Pending.bMontage = true;
+		State.Pending.MontageName = MontageInstance->Montage->GetFName();
+
+		if (UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED())
+		{
+			if (const AActor* TraceActor = DebugDataCollector::GetTraceActor(State.Snapshot))
+			{
+				if (!State.TracedMontage.IsNone())
+				{
+					UnifiedDebugPanelTrace::OutputEvent(*TraceActor, EInsightTraceEvent::MontageStopped, *State.TracedMontage.ToString());
+				}
+				UnifiedDebugPanelTrace::OutputEvent(*TraceActor, EInsightTraceEvent::MontageStarted, *State.Pending.MontageName.ToString());
+			}
+		}
+		State.TracedMontage = State.Pending.MontageName;
+	}
+
+	FMontageDebugInfo& MontageInfo = Data.ActiveMontages[0];
+	MontageInfo.Position = Position;
+	MontageInfo.PlayRate = PlayRate;
+	MontageInfo.bIsBlendingOut = bIsBlendingOut;
+
+	// 現在のセクション（変わった時のみ文字列化）
+	if (bNewInstance || State.MontageSection != CurrentSection)
+	{
+		State.Pending.bMontageSection = true;
+		State.Pending.MontageSection = CurrentSection;
+		State.MontageSection = CurrentSection;
 	}
 
-	OutData.BehaviorTree.bIsRunning = BTC->IsRunning();
+	// 残り時間計算
+	MontageInfo.RemainingTime = FMath::Max(0.0f, MontageInstance->Montage->GetPlayLength() - Position);
+
+	// ステートマシン情報
+	// Note: UE5ではステートマシン情報の取得が複雑なため、簡略化実装
+	// より詳細な情報が必要な場合はAnimInstance内部のステートマシンを直接参照
+
+	return true;
+}
+
+bool UDebugDataCollectorSubsystem::CollectBehaviorTreeData(UBehaviorTreeComponent* BTC, FWatchState& State)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectBehaviorTreeData);
+
+	UBehaviorTree* Tree = BTC ? BTC->GetCurrentTree() : nullptr;
+	const UBTNode* ActiveNode = BTC ? BTC->GetActiveNode() : nullptr;
+	const bool bIsRunning = BTC && BTC->IsRunning();
+
+	// ツリー・実行中ノード・実行状態のいずれかが変わった時のみ更新
+	if (State.bCollected && State.Tree.Get() == Tree && State.ActiveNode == ActiveNode && State.bTreeRunning == bIsRunning)
+	{
+		return false;
+	}
+
+	FBehaviorTreeDebugInfo& BehaviorTree = GetMutableSnapshot(State).BehaviorTree;
+	BehaviorTree.bIsRunning = bIsRunning;
 
 	// ビヘイビアツリー名
-	if (UBehaviorTree* Tree = BTC->GetCurrentTree())
+	if (!State.bCollected || State.Tree.Get() != Tree)
 	{
-		OutData.BehaviorTree.TreeName = Tree->GetName();
+		State.Pending.bTree = true;
+		State.Pending.TreeName = Tree ? Tree->GetFName() : NAME_None;
 	}
 
 	// 現在実行中のノード（デバッグ情報から取得）
 	// Note: ビヘイビアツリーの内部状態へのアクセスは制限されているため
-	// エディタビルドでのみ詳細情報を取得
+	// エディタビルドでのみ詳細情報を取得（ノードのUObjectを辿るためゲームスレッドで取得）
+	BehaviorTree.CurrentNodeName.Reset();
 #if WITH_EDITOR
-	// エディタでの詳細なデバッグ情報取得
-	TArray<FString> ExecutionDesc;
-	BTC->DescribeRuntimeValues(ExecutionDesc);
-
-	if (ExecutionDesc.Num() > 0)
+	if (BTC)
 	{
-		OutData.BehaviorTree.CurrentNodeName = ExecutionDesc[0];
+		// エディタでの詳細なデバッグ情報取得
+		TArray<FString> ExecutionDesc;
+		BTC->DescribeRuntimeValues(ExecutionDesc);
+
+		if (ExecutionDesc.Num() > 0)
+		{
+			BehaviorTree.CurrentNodeName = MoveTemp(ExecutionDesc[0]);
+		}
 	}
 #endif
+
+	// 実行中のタスクの切り替え
+	if (UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED() && ActiveNode && ActiveNode != State.ActiveNode)
+	{
+		if (const AActor* TraceActor = DebugDataCollector::GetTraceActor(State.Snapshot))
+		{
+			UnifiedDebugPanelTrace::OutputEvent(*TraceActor, EInsightTraceEvent::BehaviorTreeTaskChanged, *ActiveNode->GetNodeName());
+		}
+	}
+
+	State.Tree = Tree;
+	State.ActiveNode = ActiveNode;
+	State.bTreeRunning = bIsRunning;
+
+	return true;
 }
 
-void UDebugDataCollectorSubsystem::CollectBlackboardData(UBlackboardComponent* BBC, FActorInsightData& OutData)
+bool UDebugDataCollectorSubsystem::CollectBlackboardData(UBlackboardComponent* BBC, FWatchState& State)
 {
-	if (!BBC)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectBlackboardData);
+
+	UBlackboardData* BBData = BBC ? BBC->GetBlackboardAsset() : nullptr;
+
+	// コンポーネントかアセットが変わった場合は変更通知を登録し直して全体を再収集
+	if (State.ObservedBlackboard.Get() != BBC || State.ObservedBlackboardAsset.Get() != BBData)
 	{
-		return;
+		StopObservingBlackboard(State);
+
+		if (BBC && BBData)
+		{
+			for (const FBlackboardEntry& Key : BBData->Keys)
+			{
+				BBC->RegisterObserver(BBC->GetKeyID(Key.EntryName), this,
+					FOnBlackboardChangeNotification::CreateUObject(this, &UDebugDataCollectorSubsystem::OnBlackboardKeyChanged));
+			}
+			State.ObservedBlackboard = BBC;
+			State.ObservedBlackboardAsset = BBData;
+		}
+		State.bBlackboardFullRefresh = true;
+	}
+
+	FPendingFormat& Pending = State.Pending;
+
+	if (State.bBlackboardFullRefresh)
+	{
+		State.bBlackboardFullRefresh = false;
+		State.ChangedBlackboardKeys.Reset();
+
+		const bool bHadData = State.Snapshot.IsValid() && !State.Snapshot->Blackboard.KeyValues.IsEmpty();
+		if (!BBData && !bHadData)
+		{
+			return false;
+		}
+
+		// Blackboardの全キーを読み取る（文字列化は整形フェーズ）
+		Pending.bBlackboardFull = true;
+		Pending.BlackboardValues.Reset();
+		if (BBData)
+		{
+			for (const FBlackboardEntry& Key : BBData->Keys)
+			{
+				GatherBlackboardValue(*BBC, BBC->GetKeyID(Key.EntryName), Pending.BlackboardValues.AddDefaulted_GetRef());
+			}
+		}
+		return true;
 	}
 
-	// Blackboardの全キーを取得
-	if (UBlackboardData* BBData = BBC->GetBlackboardAsset())
+	if (State.ChangedBlackboardKeys.Num() == 0)
 	{
-		for (const FBlackboardEntry& Key : BBData->Keys)
+		// 変更が無ければ前回の「最近変更されたキー」だけ消す
+		if (State.Snapshot.IsValid() && State.Snapshot->Blackboard.RecentlyChangedKeys.Num() > 0)
 		{
-			FString KeyName = Key.EntryName.ToString();
-			FString ValueStr = BBC->DescribeKeyValue(BBC->GetKeyID(Key.EntryName), EBlackboardDescription::Detailed);
-			OutData.Blackboard.KeyValues.Add(KeyName, ValueStr);
+			GetMutableSnapshot(State).Blackboard.RecentlyChangedKeys.Reset();
+			return true;
 		}
+		return false;
+	}
+
+	// 変更通知のあったキーのみ読み取る
+	Pending.bBlackboardChanged = true;
+	Pending.BlackboardValues.Reset(State.ChangedBlackboardKeys.Num());
+	for (const FBlackboard::FKey KeyID : State.ChangedBlackboardKeys)
+	{
+		GatherBlackboardValue(*BBC, KeyID, Pending.BlackboardValues.AddDefaulted_GetRef());
 	}
+	State.ChangedBlackboardKeys.Reset();
+
+	return true;
 }
 
-void UDebugDataCollectorSubsystem::CollectTickData(AActor* Actor, FActorInsightData& OutData)
+EBlackboardNotificationResult UDebugDataCollectorSubsystem::OnBlackboardKeyChanged(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID)
 {
-	if (!Actor)
+	for (TPair<TWeakObjectPtr<AActor>, FWatchState>& Pair : WatchStates)
 	{
-		return;
+		if (Pair.Value.ObservedBlackboard.Get() == &Blackboard)
+		{
+			Pair.Value.ChangedBlackboardKeys.AddUnique(ChangedKeyID);
+		}
 	}
+	return EBlackboardNotificationResult::ContinueObserving;
+}
 
-	// アクター自身のティック情報
-	if (Actor->PrimaryActorTick.bCanEverTick)
+void UDebugDataCollectorSubsystem::SetEventDrivenCollection(bool bEnable)
+{
+	if (bEventDrivenCollection == bEnable)
 	{
-		FTickDebugInfo ActorTickInfo;
-		ActorTickInfo.Name = Actor->GetName();
-		ActorTickInfo.bIsEnabled = Actor->PrimaryActorTick.IsTickFunctionEnabled();
+		return;
+	}
 
-		// TickGroup を文字列に変換
-		switch (Actor->PrimaryActorTick.TickGroup)
+	bEventDrivenCollection = bEnable;
+
+	// 切り替え後の最初の収集で全て読み直す（登録は次の収集時）
+	for (TPair<TWeakObjectPtr<AActor>, FWatchState>& Pair : WatchStates)
+	{
+		if (!bEnable)
 		{
-		case TG_PrePhysics:
-			ActorTickInfo.TickGroup = TEXT("PrePhysics");
-			break;
-		case TG_DuringPhysics:
-			ActorTickInfo.TickGroup = TEXT("DuringPhysics");
-			break;
-		case TG_PostPhysics:
-			ActorTickInfo.TickGroup = TEXT("PostPhysics");
-			break;
-		case TG_PostUpdateWork:
-			ActorTickInfo.TickGroup = TEXT("PostUpdateWork");
-			break;
-		default:
-			ActorTickInfo.TickGroup = TEXT("Unknown");
-			break;
+			StopObservingEvents(Pair.Value);
 		}
+		Pair.Value.DirtySections = EDebugInsightSection::All;
+	}
+}
+
+void UDebugDataCollectorSubsystem::NotifyInsightSectionChanged(const TWeakObjectPtr<AActor>& Actor, EDebugInsightSection Sections)
+{
+	if (FWatchState* State = WatchStates.Find(Actor))
+	{
+		State->DirtySections |= Sections;
 
-		OutData.TickInfo.Add(ActorTickInfo);
+		// 変化のあったアクターとして優先度を上げる
+		State->LastChangeTime = FPlatformTime::Seconds();
 	}
+}
 
-	// コンポーネントのティック情報
-	TArray<UActorComponent*> Components;
-	Actor->GetComponents(Components);
+void UDebugDataCollectorSubsystem::UpdateEventBindings(AActor* Actor, UAbilitySystemComponent* ASC, UAnimInstance* AnimInstance, FWatchState& State)
+{
+	if (!bEventDrivenCollection)
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<AActor> WeakActor(Actor);
 
-	for (UActorComponent* Component : Components)
+	// ASC（付与・実行・エフェクト・タグ）
+	if (State.BoundAbilitySystem.Get() != ASC)
 	{
-		if (Component && Component->PrimaryComponentTick.bCanEverTick)
+		if (UAbilitySystemComponent* OldASC = State.BoundAbilitySystem.Get())
+		{
+			OldASC->AbilityActivatedCallbacks.Remove(State.AbilityActivatedHandle);
+			OldASC->OnAbilityEnded.Remove(State.AbilityEndedHandle);
+			OldASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(State.EffectAddedHandle);
+			OldASC->OnAnyGameplayEffectRemovedDelegate().Remove(State.EffectRemovedHandle);
+			OldASC->RegisterGenericGameplayTagEvent().Remove(State.TagChangedHandle);
+		}
+
+		State.BoundAbilitySystem = ASC;
+		if (ASC)
 		{
-			FTickDebugInfo CompTickInfo;
-			CompTickInfo.Name = Component->GetName();
-			CompTickInfo.bIsEnabled = Component->PrimaryComponentTick.IsTickFunctionEnabled();
+			State.AbilityActivatedHandle = ASC->AbilityActivatedCallbacks.AddUObject(this, &UDebugDataCollectorSubsystem::OnAbilityActivated, WeakActor);
+			State.AbilityEndedHandle = ASC->OnAbilityEnded.AddUObject(this, &UDebugDataCollectorSubsystem::OnAbilityEnded, WeakActor);
+			State.EffectAddedHandle = ASC->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UDebugDataCollectorSubsystem::OnGameplayEffectAdded, WeakActor);
+			State.EffectRemovedHandle = ASC->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UDebugDataCollectorSubsystem::OnGameplayEffectRemoved, WeakActor);
+			State.TagChangedHandle = ASC->RegisterGenericGameplayTagEvent().AddUObject(this, &UDebugDataCollectorSubsystem::OnGameplayTagChanged, WeakActor);
+		}
+		State.DirtySections |= EDebugInsightSection::Abilities | EDebugInsightSection::Effects | EDebugInsightSection::Tags;
+	}
 
-			switch (Component->PrimaryComponentTick.TickGroup)
+	// AnimInstance（モンタージュの開始・終了）
+	const UAnimInstance* BoundAnimInstance = State.MontageListener.IsValid() ? State.MontageListener->GetAnimInstance() : nullptr;
+	if (BoundAnimInstance != AnimInstance)
+	{
+		if (AnimInstance)
+		{
+			if (!State.MontageListener.IsValid())
 			{
-			case TG_PrePhysics:
-				CompTickInfo.TickGroup = TEXT("PrePhysics");
-				break;
-			case TG_DuringPhysics:
-				CompTickInfo.TickGroup = TEXT("DuringPhysics");
-				break;
-			case TG_PostPhysics:
-				CompTickInfo.TickGroup = TEXT("PostPhysics");
-				break;
-			case TG_PostUpdateWork:
-				CompTickInfo.TickGroup = TEXT("PostUpdateWork");
-				break;
-			default:
-				CompTickInfo.TickGroup = TEXT("Unknown");
-				break;
+				State.MontageListener.Reset(NewObject<UDebugMontageEventListener>(this));
 			}
+			State.MontageListener->Bind(this, Actor, AnimInstance);
+		}
+		else if (State.MontageListener.IsValid())
+		{
+			State.MontageListener->Unbind();
+		}
+		State.DirtySections |= EDebugInsightSection::Montage;
+	}
+}
+
+void UDebugDataCollectorSubsystem::StopObservingEvents(FWatchState& State)
+{
+	if (UAbilitySystemComponent* ASC = State.BoundAbilitySystem.Get())
+	{
+		ASC->AbilityActivatedCallbacks.Remove(State.AbilityActivatedHandle);
+		ASC->OnAbilityEnded.Remove(State.AbilityEndedHandle);
+		ASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(State.EffectAddedHandle);
+		ASC->OnAnyGameplayEffectRemovedDelegate().Remove(State.EffectRemovedHandle);
+		ASC->RegisterGenericGameplayTagEvent().Remove(State.TagChangedHandle);
+	}
+	State.BoundAbilitySystem.Reset();
+
+	if (State.MontageListener.IsValid())
+	{
+		State.MontageListener->Unbind();
+		State.MontageListener.Reset();
+	}
+}
 
-			OutData.TickInfo.Add(CompTickInfo);
+void UDebugDataCollectorSubsystem::OnAbilityActivated(UGameplayAbility* Ability, TWeakObjectPtr<AActor> Actor)
+{
+	NotifyInsightSectionChanged(Actor, EDebugInsightSection::Abilities);
+}
+
+void UDebugDataCollectorSubsystem::OnAbilityEnded(const FAbilityEndedData& EndedData, TWeakObjectPtr<AActor> Actor)
+{
+	NotifyInsightSectionChanged(Actor, EDebugInsightSection::Abilities);
+}
+
+void UDebugDataCollectorSubsystem::OnGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle, TWeakObjectPtr<AActor> Actor)
+{
+	// クールダウンもエフェクトのためアビリティも読み直す
+	NotifyInsightSectionChanged(Actor, EDebugInsightSection::Effects | EDebugInsightSection::Abilities);
+}
+
+void UDebugDataCollectorSubsystem::OnGameplayEffectRemoved(const FActiveGameplayEffect& Effect, TWeakObjectPtr<AActor> Actor)
+{
+	NotifyInsightSectionChanged(Actor, EDebugInsightSection::Effects | EDebugInsightSection::Abilities);
+}
+
+void UDebugDataCollectorSubsystem::OnGameplayTagChanged(const FGameplayTag Tag, int32 NewCount, TWeakObjectPtr<AActor> Actor)
+{
+	NotifyInsightSectionChanged(Actor, EDebugInsightSection::Tags);
+}
+
+void UDebugDataCollectorSubsystem::StopObservingBlackboard(FWatchState& State)
+{
+	if (UBlackboardComponent* BBC = State.ObservedBlackboard.Get())
+	{
+		// 同じブラックボードを他の監視対象が共有している場合は解除しない
+		bool bShared = false;
+		for (const TPair<TWeakObjectPtr<AActor>, FWatchState>& Pair : WatchStates)
+		{
+			bShared |= &Pair.Value != &State && Pair.Value.ObservedBlackboard.Get() == BBC;
+		}
+		if (!bShared)
+		{
+			BBC->UnregisterObserversFrom(this);
+		}
+	}
+
+	State.ObservedBlackboard.Reset();
+	State.ObservedBlackboardAsset.Reset();
+	State.ChangedBlackboardKeys.Reset();
+}
+
+bool UDebugDataCollectorSubsystem::CollectTickData(AActor* Actor, FWatchState& State)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UDebugDataCollectorSubsystem::CollectTickData);
+
+	if (!Actor)
+	{
+		return false;
+	}
+
+	// 構成キー: ティック可能なアクター・コンポーネントと有効状態・TickGroup
+	uint32 TickKey = 1u;
+	if (Actor->PrimaryActorTick.bCanEverTick)
+	{
+		TickKey = DebugDataCollector::HashTickFunction(TickKey, Actor, Actor->PrimaryActorTick);
+	}
+	Actor->ForEachComponent<UActorComponent>(false, [&TickKey](UActorComponent* Component)
+	{
+		if (Component->PrimaryComponentTick.bCanEverTick)
+		{
+			TickKey = DebugDataCollector::HashTickFunction(TickKey, Component, Component->PrimaryComponentTick);
 		}
+	});
+
+	if (TickKey == State.TickKey)
+	{
+		return false;
 	}
+	State.TickKey = TickKey;
+
+	// ティック関数を読み取る（TickGroupの文字列化は整形フェーズ）
+	FPendingFormat& Pending = State.Pending;
+	Pending.bTick = true;
+	Pending.TickFunctions.Reset();
+
+	// アクター自身のティック情報
+	if (Actor->PrimaryActorTick.bCanEverTick)
+	{
+		FGatheredTickFunction& ActorTick = Pending.TickFunctions.AddDefaulted_GetRef();
+		ActorTick.Name = Actor->GetFName();
+		ActorTick.TickGroup = Actor->PrimaryActorTick.TickGroup;
+		ActorTick.bIsEnabled = Actor->PrimaryActorTick.IsTickFunctionEnabled();
+	}
+
+	// コンポーネントのティック情報
+	Actor->ForEachComponent<UActorComponent>(false, [&Pending](UActorComponent* Component)
+	{
+		if (Component->PrimaryComponentTick.bCanEverTick)
+		{
+			FGatheredTickFunction& CompTick = Pending.TickFunctions.AddDefaulted_GetRef();
+			CompTick.Name = Component->GetFName();
+			CompTick.TickGroup = Component->PrimaryComponentTick.TickGroup;
+			CompTick.bIsEnabled = Component->PrimaryComponentTick.IsTickFunctionEnabled();
+		}
+	});
+
+	return true;
 }
 
 FString UDebugDataCollectorSubsystem::GenerateHumanReadableSummary(const FActorInsightData& Data)
@@ -624,17 +1737,197 @@ void UDebugDataCollectorSubsystem::CleanupInvalidActors()
 		}
 	}
 
-	// キャッシュからも削除
-	TArray<TWeakObjectPtr<AActor>> KeysToRemove;
-	for (auto& Pair : CachedInsightData)
+	// 収集状態からも削除
+	for (auto It = WatchStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			StopObservingBlackboard(It.Value());
+			StopObservingEvents(It.Value());
+			HistoryRecorder.StopRecording(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	// クライアントの監視の参照からも削除
+	for (auto It = RemoteInterestCounts.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = RemoteOnlyWatches.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// ========== サーバーとの比較（ネットワーク） ==========
+
+void UDebugDataCollectorSubsystem::SetServerStreamingEnabled(bool bEnable)
+{
+	bServerStreaming = bEnable;
+	UpdateServerReplicators();
+}
+
+void UDebugDataCollectorSubsystem::SetServerStreamBandwidth(int32 BytesPerSecond)
+{
+	ReplicationSettings.MaxBytesPerSecond = FMath::Max(1024, BytesPerSecond);
+	for (const TPair<TWeakObjectPtr<APlayerController>, TWeakObjectPtr<AInsightReplicator>>& Pair : ServerReplicators)
+	{
+		if (AInsightReplicator* Replicator = Pair.Value.Get())
+		{
+			Replicator->Settings = ReplicationSettings;
+		}
+	}
+}
+
+void UDebugDataCollectorSubsystem::UpdateServerReplicators()
+{
+	UWorld* World = GetWorld();
+	const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+	if (!bServerStreaming || NetMode == NM_Client || NetMode == NM_Standalone)
+	{
+		DestroyServerReplicators();
+		return;
+	}
+
+	// 切断したクライアントの分を破棄
+	for (auto It = ServerReplicators.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || !It.Value().IsValid())
+		{
+			if (AInsightReplicator* Replicator = It.Value().Get())
+			{
+				Replicator->Destroy();
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	// 接続中のリモートクライアントごとに生成（ローカルのプレイヤーはこのワールドを直接参照できる）
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (!PC || PC->IsLocalController() || ServerReplicators.Contains(PC))
+		{
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = PC;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		if (AInsightReplicator* Replicator = World->SpawnActor<AInsightReplicator>(SpawnParams))
+		{
+			Replicator->Settings = ReplicationSettings;
+			ServerReplicators.Add(PC, Replicator);
+
+			UE_LOG(LogTemp, Log, TEXT("[DebugDataCollector] Streaming insight to %s"), *PC->GetName());
+		}
+	}
+}
+
+void UDebugDataCollectorSubsystem::DestroyServerReplicators()
+{
+	for (const TPair<TWeakObjectPtr<APlayerController>, TWeakObjectPtr<AInsightReplicator>>& Pair : ServerReplicators)
 	{
-		if (!Pair.Key.IsValid())
+		AInsightReplicator* Replicator = Pair.Value.Get();
+		if (Replicator && !Replicator->IsActorBeingDestroyed())
 		{
-			KeysToRemove.Add(Pair.Key);
+			Replicator->Destroy();
 		}
 	}
-	for (const TWeakObjectPtr<AActor>& Key : KeysToRemove)
+	ServerReplicators.Empty();
+}
+
+void UDebugDataCollectorSubsystem::AddRemoteInterest(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	int32& Count = RemoteInterestCounts.FindOrAdd(Actor);
+	if (Count++ == 0 && !WatchStates.Contains(Actor))
+	{
+		WatchActor(Actor);
+		RemoteOnlyWatches.Add(Actor);
+	}
+}
+
+void UDebugDataCollectorSubsystem::RemoveRemoteInterest(const TWeakObjectPtr<AActor>& Actor)
+{
+	int32* Count = RemoteInterestCounts.Find(Actor);
+	if (!Count || --(*Count) > 0)
+	{
+		return;
+	}
+
+	RemoteInterestCounts.Remove(Actor);
+	if (RemoteOnlyWatches.Remove(Actor) > 0)
 	{
-		CachedInsightData.Remove(Key);
+		UnwatchActor(Actor.Get());
 	}
 }
+
+void UDebugDataCollectorSubsystem::SetRemoteFocus(const AInsightReplicator* Replicator, AActor* Actor)
+{
+	if (Actor)
+	{
+		RemoteFocusActors.Add(Replicator, Actor);
+	}
+	else
+	{
+		RemoteFocusActors.Remove(Replicator);
+	}
+}
+
+bool UDebugDataCollectorSubsystem::IsRemoteFocus(const TWeakObjectPtr<AActor>& Actor) const
+{
+	for (const TPair<TWeakObjectPtr<const AInsightReplicator>, TWeakObjectPtr<AActor>>& Pair : RemoteFocusActors)
+	{
+		if (Pair.Value == Actor)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UDebugDataCollectorSubsystem::RegisterInsightReplicator(AInsightReplicator* Replicator)
+{
+	ClientReplicator = Replicator;
+	if (Replicator)
+	{
+		Replicator->UpdateInterest(GetWatchedActors(), FocusActor.Get());
+	}
+}
+
+void UDebugDataCollectorSubsystem::UnregisterInsightReplicator(AInsightReplicator* Replicator)
+{
+	if (ClientReplicator.Get() == Replicator)
+	{
+		ClientReplicator.Reset();
+	}
+}
+
+FActorInsightSnapshot UDebugDataCollectorSubsystem::GetServerInsightSnapshot(AActor* Actor) const
+{
+	const AInsightReplicator* Replicator = ClientReplicator.Get();
+	return Replicator ? Replicator->GetServerSnapshot(Actor) : FActorInsightSnapshot();
+}
+
+bool UDebugDataCollectorSubsystem::GetServerActorInsight(AActor* Actor, FActorInsightData& OutData) const
+{
+	if (FActorInsightSnapshot Snapshot = GetServerInsightSnapshot(Actor))
+	{
+		OutData = *Snapshot;
+		return true;
+	}
+	return false;
+}
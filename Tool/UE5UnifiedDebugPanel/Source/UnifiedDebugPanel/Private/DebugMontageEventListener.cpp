@@ -0,0 +1,46 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "DebugMontageEventListener.h"
+#include "DebugDataCollectorSubsystem.h"
+#include "Animation/AnimInstance.h"
+
+void UDebugMontageEventListener::Bind(UDebugDataCollectorSubsystem* InSubsystem, AActor* InActor, UAnimInstance* InAnimInstance)
+{
+	Unbind();
+
+	Subsystem = InSubsystem;
+	Actor = InActor;
+	AnimInstance = InAnimInstance;
+
+	if (InAnimInstance)
+	{
+		InAnimInstance->OnMontageStarted.AddDynamic(this, &UDebugMontageEventListener::HandleMontageStarted);
+		InAnimInstance->OnMontageEnded.AddDynamic(this, &UDebugMontageEventListener::HandleMontageEnded);
+	}
+}
+
+void UDebugMontageEventListener::Unbind()
+{
+	if (UAnimInstance* Instance = AnimInstance.Get())
+	{
+		Instance->OnMontageStarted.RemoveDynamic(this, &UDebugMontageEventListener::HandleMontageStarted);
+		Instance->OnMontageEnded.RemoveDynamic(this, &UDebugMontageEventListener::HandleMontageEnded);
+	}
+	AnimInstance.Reset();
+}
+
+void UDebugMontageEventListener::HandleMontageStarted(UAnimMontage* Montage)
+{
+	if (UDebugDataCollectorSubsystem* Owner = Subsystem.Get())
+	{
+		Owner->NotifyInsightSectionChanged(Actor, EDebugInsightSection::Montage);
+	}
+}
+
+void UDebugMontageEventListener::HandleMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+{
+	if (UDebugDataCollectorSubsystem* Owner = Subsystem.Get())
+	{
+		Owner->NotifyInsightSectionChanged(Actor, EDebugInsightSection::Montage);
+	}
+}
@@ -0,0 +1,816 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "InsightHistoryRecorder.h"
+#include "DebugDataCollectorSubsystem.h"
+#include "HAL/FileManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace InsightHistory
+{
+	/** 書き出しファイルの識別子 */
+	constexpr uint32 FileMagic = 0x48504455; // "UDPH"
+
+	/** 書き出しファイルのバージョン（2でタグ名を文字列で保存、3でブラックボードの値をチャンクへ直接保存） */
+	constexpr int32 FileVersion = 3;
+
+	/** 基本状態のフラグ */
+	constexpr uint8 StateActive = 1 << 0;
+	constexpr uint8 StateTickEnabled = 1 << 1;
+
+	/** アビリティのフラグ */
+	constexpr uint8 AbilityActive = 1 << 0;
+	constexpr uint8 AbilityOnCooldown = 1 << 1;
+	constexpr uint8 AbilityInputBound = 1 << 2;
+
+	/** インデックスの書き込み（INDEX_NONEを0にして可変長で書く） */
+	void SerializeId(FArchive& Ar, int32& Id)
+	{
+		uint32 Packed = static_cast<uint32>(Id + 1);
+		Ar.SerializeIntPacked(Packed);
+		Id = static_cast<int32>(Packed) - 1;
+	}
+
+	/** 0以上の整数の書き込み（可変長） */
+	void SerializeCount(FArchive& Ar, int32& Value)
+	{
+		uint32 Packed = static_cast<uint32>(FMath::Max(Value, 0));
+		Ar.SerializeIntPacked(Packed);
+		Value = static_cast<int32>(Packed);
+	}
+
+	/** 空文字 */
+	const FString EmptyString;
+}
+
+int32 FInsightHistorySettings::GetChunksPerActor() const
+{
+	const int64 PerActor = MemoryBudgetBytes / FMath::Max(MaxActors, 1);
+	return FMath::Max(2, static_cast<int32>(PerActor / FMath::Max(ChunkSizeBytes, 1)));
+}
+
+FInsightHistoryRecorder::FInsightHistoryRecorder(const FInsightHistorySettings& InSettings)
+	: Settings(InSettings)
+{
+}
+
+void FInsightHistoryRecorder::Configure(const FInsightHistorySettings& InSettings)
+{
+	Settings = InSettings;
+	Reset();
+}
+
+void FInsightHistoryRecorder::Reset()
+{
+	HistoryIndices.Reset();
+	Histories.Reset();
+	StringIds.Reset();
+	Strings.Reset();
+	StringTableBytes = 0;
+	TagIds.Reset();
+	Tags.Reset();
+	bWarnedActorLimit = false;
+	bWarnedStringBudget = false;
+}
+
+void FInsightHistoryRecorder::Record(const FActorInsightData& Data)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInsightHistoryRecorder::Record);
+
+	if (!Data.Actor.IsValid())
+	{
+		return;
+	}
+
+	int32 HistoryIndex = INDEX_NONE;
+	if (const int32* Existing = HistoryIndices.Find(Data.Actor))
+	{
+		HistoryIndex = *Existing;
+	}
+	else
+	{
+		HistoryIndex = AllocateHistory(Data);
+		if (HistoryIndex == INDEX_NONE)
+		{
+			if (!bWarnedActorLimit)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[InsightHistory] Actor limit reached (%d), %s is not recorded"),
+					Settings.MaxActors, *Data.BasicState.ActorName);
+				bWarnedActorLimit = true;
+			}
+			return;
+		}
+	}
+
+	// 再び監視された場合は同じ履歴へ続けて記録
+	FActorHistory& History = Histories[HistoryIndex];
+	History.bStopped = false;
+
+	FFrame Frame;
+	BuildFrame(Data, Frame);
+
+	// 現在のチャンクへ差分として追記（入らなければ次のチャンクをキーフレームから始める）
+	FChunk* Chunk = nullptr;
+	if (History.NumChunks > 0 && History.bHasLastFrame)
+	{
+		Chunk = &History.Chunks[(History.OldestChunk + History.NumChunks - 1) % History.Chunks.Num()];
+
+		ScratchBuffer.Reset();
+		FMemoryWriter Writer(ScratchBuffer);
+		EncodeFrame(Writer, Frame, GetChangedSections(Frame, History.LastFrame), Chunk->StartTime);
+
+		if (Chunk->UsedBytes + ScratchBuffer.Num() > Chunk->Bytes.Num())
+		{
+			Chunk = nullptr;
+		}
+	}
+
+	if (!Chunk)
+	{
+		Chunk = &AdvanceChunk(History);
+		Chunk->StartTime = Frame.Time;
+
+		ScratchBuffer.Reset();
+		FMemoryWriter Writer(ScratchBuffer);
+		EncodeFrame(Writer, Frame, Section_All, Chunk->StartTime);
+
+		if (ScratchBuffer.Num() > Chunk->Bytes.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[InsightHistory] Keyframe of %s (%d bytes) exceeds chunk size, frame dropped"),
+				*History.ActorName, ScratchBuffer.Num());
+			History.bHasLastFrame = false;
+			return;
+		}
+	}
+
+	FMemory::Memcpy(Chunk->Bytes.GetData() + Chunk->UsedBytes, ScratchBuffer.GetData(), ScratchBuffer.Num());
+	Chunk->UsedBytes += ScratchBuffer.Num();
+	Chunk->EndTime = Frame.Time;
+	++Chunk->NumFrames;
+
+	History.LastFrame = MoveTemp(Frame);
+	History.bHasLastFrame = true;
+}
+
+void FInsightHistoryRecorder::StopRecording(const TWeakObjectPtr<AActor>& Actor)
+{
+	if (const int32* HistoryIndex = HistoryIndices.Find(Actor))
+	{
+		Histories[*HistoryIndex].bStopped = true;
+	}
+}
+
+int32 FInsightHistoryRecorder::AllocateHistory(const FActorInsightData& Data)
+{
+	int32 HistoryIndex = INDEX_NONE;
+	if (Histories.Num() < Settings.MaxActors)
+	{
+		HistoryIndex = Histories.AddDefaulted();
+		Histories[HistoryIndex].Chunks.SetNum(Settings.GetChunksPerActor());
+	}
+	else
+	{
+		// 記録を終えたアクターのうち、最後の記録が最も古い枠を再利用（チャンクの確保はそのまま使う）
+		float OldestEndTime = TNumericLimits<float>::Max();
+		for (int32 Index = 0; Index < Histories.Num(); ++Index)
+		{
+			const FActorHistory& Candidate = Histories[Index];
+			if (!Candidate.bStopped)
+			{
+				continue;
+			}
+
+			const float EndTime = Candidate.NumChunks > 0 ? Candidate.GetChunk(Candidate.NumChunks - 1).EndTime : TNumericLimits<float>::Lowest();
+			if (HistoryIndex == INDEX_NONE || EndTime < OldestEndTime)
+			{
+				HistoryIndex = Index;
+				OldestEndTime = EndTime;
+			}
+		}
+
+		if (HistoryIndex == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		FActorHistory& Reused = Histories[HistoryIndex];
+		HistoryIndices.Remove(Reused.Actor);
+		Reused.OldestChunk = 0;
+		Reused.NumChunks = 0;
+		Reused.LastFrame = FFrame();
+		Reused.bHasLastFrame = false;
+	}
+
+	FActorHistory& History = Histories[HistoryIndex];
+	History.Actor = Data.Actor;
+	History.bStopped = false;
+	History.ActorName = Data.BasicState.ActorName;
+	History.ClassName = Data.BasicState.ClassName;
+	HistoryIndices.Add(Data.Actor, HistoryIndex);
+	return HistoryIndex;
+}
+
+FInsightHistoryRecorder::FChunk& FInsightHistoryRecorder::AdvanceChunk(FActorHistory& History)
+{
+	int32 ChunkIndex = INDEX_NONE;
+	if (History.NumChunks < History.Chunks.Num())
+	{
+		ChunkIndex = (History.OldestChunk + History.NumChunks) % History.Chunks.Num();
+		++History.NumChunks;
+	}
+	else
+	{
+		// 最古のチャンクを上書き
+		ChunkIndex = History.OldestChunk;
+		History.OldestChunk = (History.OldestChunk + 1) % History.Chunks.Num();
+	}
+
+	FChunk& Chunk = History.Chunks[ChunkIndex];
+	if (Chunk.Bytes.Num() != Settings.ChunkSizeBytes)
+	{
+		Chunk.Bytes.SetNumUninitialized(Settings.ChunkSizeBytes);
+	}
+	Chunk.UsedBytes = 0;
+	Chunk.NumFrames = 0;
+	return Chunk;
+}
+
+bool FInsightHistoryRecorder::GetTimeRange(float& OutOldest, float& OutNewest) const
+{
+	bool bFound = false;
+	OutOldest = 0.0f;
+	OutNewest = 0.0f;
+
+	for (const FActorHistory& History : Histories)
+	{
+		if (History.NumChunks == 0)
+		{
+			continue;
+		}
+
+		const float Oldest = History.GetChunk(0).StartTime;
+		const float Newest = History.GetChunk(History.NumChunks - 1).EndTime;
+		OutOldest = bFound ? FMath::Min(OutOldest, Oldest) : Oldest;
+		OutNewest = bFound ? FMath::Max(OutNewest, Newest) : Newest;
+		bFound = true;
+	}
+
+	return bFound;
+}
+
+bool FInsightHistoryRecorder::Reconstruct(const TWeakObjectPtr<AActor>& Actor, float Time, FActorInsightData& OutData) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInsightHistoryRecorder::Reconstruct);
+
+	const int32* HistoryIndex = HistoryIndices.Find(Actor);
+	if (!HistoryIndex)
+	{
+		return false;
+	}
+
+	const FActorHistory& History = Histories[*HistoryIndex];
+	if (History.NumChunks == 0 || Time < History.GetChunk(0).StartTime)
+	{
+		return false;
+	}
+
+	// 指定時刻を含むチャンク（開始時刻が指定時刻以前の最後のチャンク）
+	int32 ChunkIndex = History.NumChunks - 1;
+	while (ChunkIndex > 0 && History.GetChunk(ChunkIndex).StartTime > Time)
+	{
+		--ChunkIndex;
+	}
+
+	// キーフレームから順に差分を適用
+	const FChunk& Chunk = History.GetChunk(ChunkIndex);
+	if (Chunk.NumFrames == 0)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Chunk.Bytes);
+	FFrame Frame;
+	for (int32 FrameIndex = 0; FrameIndex < Chunk.NumFrames; ++FrameIndex)
+	{
+		if (!DecodeFrame(Reader, Frame, Chunk.StartTime, Time))
+		{
+			break;
+		}
+	}
+
+	ToInsightData(History, Frame, OutData);
+	OutData.Actor = Actor;
+	return true;
+}
+
+int64 FInsightHistoryRecorder::GetAllocatedBytes() const
+{
+	int64 Bytes = StringTableBytes + Tags.GetAllocatedSize() + TagIds.GetAllocatedSize();
+	for (const FActorHistory& History : Histories)
+	{
+		for (const FChunk& Chunk : History.Chunks)
+		{
+			Bytes += Chunk.Bytes.GetAllocatedSize();
+		}
+	}
+	return Bytes;
+}
+
+int32 FInsightHistoryRecorder::GetNumFrames() const
+{
+	int32 NumFrames = 0;
+	for (const FActorHistory& History : Histories)
+	{
+		for (int32 i = 0; i < History.NumChunks; ++i)
+		{
+			NumFrames += History.GetChunk(i).NumFrames;
+		}
+	}
+	return NumFrames;
+}
+
+bool FInsightHistoryRecorder::SaveToFile(const FString& FilePath) const
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[InsightHistory] Failed to open history file: %s"), *FilePath);
+		return false;
+	}
+
+	uint32 Magic = InsightHistory::FileMagic;
+	int32 Version = InsightHistory::FileVersion;
+	*Writer << Magic;
+	*Writer << Version;
+
+	// 文字列テーブル・タグテーブル
+	int32 NumStrings = Strings.Num();
+	*Writer << NumStrings;
+	for (const FString& String : Strings)
+	{
+		FString Value = String;
+		*Writer << Value;
+	}
+
+	int32 NumTags = Tags.Num();
+	*Writer << NumTags;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		// ファイルアーカイブはFNameを書かないため、タグ名は文字列で保存
+		FString TagName = Tag.GetTagName().ToString();
+		*Writer << TagName;
+	}
+
+	// アクターごとのチャンク（古い順、使用済みの範囲のみ）
+	int32 NumHistories = Histories.Num();
+	*Writer << NumHistories;
+	for (const FActorHistory& History : Histories)
+	{
+		FString ActorName = History.ActorName;
+		FString ClassName = History.ClassName;
+		int32 NumChunks = History.NumChunks;
+		*Writer << ActorName;
+		*Writer << ClassName;
+		*Writer << NumChunks;
+
+		for (int32 i = 0; i < History.NumChunks; ++i)
+		{
+			const FChunk& Chunk = History.GetChunk(i);
+			float StartTime = Chunk.StartTime;
+			float EndTime = Chunk.EndTime;
+			int32 NumFrames = Chunk.NumFrames;
+			int32 UsedBytes = Chunk.UsedBytes;
+			*Writer << StartTime;
+			*Writer << EndTime;
+			*Writer << NumFrames;
+			*Writer << UsedBytes;
+			Writer->Serialize(const_cast<uint8*>(Chunk.Bytes.GetData()), UsedBytes);
+		}
+	}
+
+	const bool bSucceeded = Writer->Close() && !Writer->IsError();
+	UE_LOG(LogTemp, Log, TEXT("[InsightHistory] Saved %d actors (%d frames) to %s"), Histories.Num(), GetNumFrames(), *FilePath);
+	return bSucceeded;
+}
+
+void FInsightHistoryRecorder::BuildFrame(const FActorInsightData& Data, FFrame& OutFrame)
+{
+	using namespace InsightHistory;
+
+	OutFrame.Time = Data.LastUpdateTime;
+	OutFrame.Revision = Data.Revision;
+
+	const FActorDebugState& BasicState = Data.BasicState;
+	OutFrame.Location = FVector3f(BasicState.Location);
+	OutFrame.Rotation = FRotator3f(BasicState.Rotation);
+	OutFrame.Velocity = FVector3f(BasicState.Velocity);
+	OutFrame.StateFlags = (BasicState.bIsActive ? StateActive : 0) | (BasicState.bIsTickEnabled ? StateTickEnabled : 0);
+
+	OutFrame.Abilities.Reset(Data.GrantedAbilities.Num());
+	for (const FAbilityDebugInfo& Ability : Data.GrantedAbilities)
+	{
+		FFrame::FAbility& Entry = OutFrame.Abilities.AddDefaulted_GetRef();
+		Entry.NameId = InternString(Ability.AbilityName);
+		Entry.Level = Ability.Level;
+		Entry.CooldownRemaining = Ability.CooldownRemaining;
+		Entry.Flags = (Ability.bIsActive ? AbilityActive : 0) | (Ability.bIsOnCooldown ? AbilityOnCooldown : 0)
+			| (Ability.bInputBound ? AbilityInputBound : 0);
+	}
+
+	OutFrame.Effects.Reset(Data.ActiveEffects.Num());
+	for (const FEffectDebugInfo& Effect : Data.ActiveEffects)
+	{
+		FFrame::FEffect& Entry = OutFrame.Effects.AddDefaulted_GetRef();
+		Entry.NameId = InternString(Effect.EffectName);
+		Entry.InstigatorId = InternString(Effect.InstigatorName);
+		Entry.StackCount = Effect.StackCount;
+		Entry.RemainingTime = Effect.RemainingTime;
+	}
+
+	OutFrame.Montage = FFrame::FMontage();
+	if (Data.ActiveMontages.Num() > 0)
+	{
+		const FMontageDebugInfo& Montage = Data.ActiveMontages[0];
+		OutFrame.Montage.NameId = InternString(Montage.MontageName);
+		OutFrame.Montage.SectionId = InternString(Montage.CurrentSectionName);
+		OutFrame.Montage.Position = Montage.Position;
+		OutFrame.Montage.PlayRate = Montage.PlayRate;
+		OutFrame.Montage.RemainingTime = Montage.RemainingTime;
+		OutFrame.Montage.bIsBlendingOut = Montage.bIsBlendingOut;
+	}
+
+	OutFrame.Tree.TreeNameId = InternString(Data.BehaviorTree.TreeName);
+	OutFrame.Tree.NodeNameId = InternString(Data.BehaviorTree.CurrentNodeName);
+	OutFrame.Tree.bIsRunning = Data.BehaviorTree.bIsRunning;
+
+	// キー名のみ登録し、値（ベクター・数値など変わり続けるもの）はフレームへそのまま持つ
+	// 比較が順序に左右されないようキーのインデックス順に並べる
+	OutFrame.Blackboard.Reset(Data.Blackboard.KeyValues.Num());
+	for (const TPair<FString, FString>& Pair : Data.Blackboard.KeyValues)
+	{
+		OutFrame.Blackboard.Emplace(InternString(Pair.Key), Pair.Value);
+	}
+	OutFrame.Blackboard.Sort([](const TPair<int32, FString>& A, const TPair<int32, FString>& B) { return A.Key < B.Key; });
+
+	OutFrame.Tags.Reset(Data.OwnedGameplayTags.Num());
+	for (const FGameplayTag& Tag : Data.OwnedGameplayTags)
+	{
+		OutFrame.Tags.Add(InternTag(Tag));
+	}
+	OutFrame.Tags.Sort();
+}
+
+void FInsightHistoryRecorder::ToInsightData(const FActorHistory& History, const FFrame& Frame, FActorInsightData& OutData) const
+{
+	using namespace InsightHistory;
+
+	OutData = FActorInsightData();
+	OutData.LastUpdateTime = Frame.Time;
+	OutData.Revision = Frame.Revision;
+
+	FActorDebugState& BasicState = OutData.BasicState;
+	BasicState.ActorName = History.ActorName;
+	BasicState.ClassName = History.ClassName;
+	BasicState.Location = FVector(Frame.Location);
+	BasicState.Rotation = FRotator(Frame.Rotation);
+	BasicState.Velocity = FVector(Frame.Velocity);
+	BasicState.bIsActive = (Frame.StateFlags & StateActive) != 0;
+	BasicState.bIsTickEnabled = (Frame.StateFlags & StateTickEnabled) != 0;
+
+	for (const FFrame::FAbility& Entry : Frame.Abilities)
+	{
+		FAbilityDebugInfo& Ability = OutData.GrantedAbilities.AddDefaulted_GetRef();
+		Ability.AbilityName = GetString(Entry.NameId);
+		Ability.Level = Entry.Level;
+		Ability.CooldownRemaining = Entry.CooldownRemaining;
+		Ability.bIsActive = (Entry.Flags & AbilityActive) != 0;
+		Ability.bIsOnCooldown = (Entry.Flags & AbilityOnCooldown) != 0;
+		Ability.bInputBound = (Entry.Flags & AbilityInputBound) != 0;
+		if (Ability.bIsActive)
+		{
+			OutData.ActiveAbilities.Add(Ability);
+		}
+	}
+
+	for (const FFrame::FEffect& Entry : Frame.Effects)
+	{
+		FEffectDebugInfo& Effect = OutData.ActiveEffects.AddDefaulted_GetRef();
+		Effect.EffectName = GetString(Entry.NameId);
+		Effect.InstigatorName = GetString(Entry.InstigatorId);
+		Effect.StackCount = Entry.StackCount;
+		Effect.RemainingTime = Entry.RemainingTime;
+	}
+
+	if (Frame.Montage.NameId != INDEX_NONE)
+	{
+		FMontageDebugInfo& Montage = OutData.ActiveMontages.AddDefaulted_GetRef();
+		Montage.MontageName = GetString(Frame.Montage.NameId);
+		Montage.CurrentSectionName = GetString(Frame.Montage.SectionId);
+		Montage.Position = Frame.Montage.Position;
+		Montage.PlayRate = Frame.Montage.PlayRate;
+		Montage.RemainingTime = Frame.Montage.RemainingTime;
+		Montage.bIsBlendingOut = Frame.Montage.bIsBlendingOut;
+	}
+
+	OutData.BehaviorTree.TreeName = GetString(Frame.Tree.TreeNameId);
+	OutData.BehaviorTree.CurrentNodeName = GetString(Frame.Tree.NodeNameId);
+	OutData.BehaviorTree.bIsRunning = Frame.Tree.bIsRunning;
+
+	for (const TPair<int32, FString>& Pair : Frame.Blackboard)
+	{
+		OutData.Blackboard.KeyValues.Add(GetString(Pair.Key), Pair.Value);
+	}
+
+	for (const int32 TagId : Frame.Tags)
+	{
+		OutData.OwnedGameplayTags.AddTagFast(Tags[TagId]);
+	}
+
+	OutData.HumanReadableSummary = UDebugDataCollectorSubsystem::GenerateHumanReadableSummary(OutData);
+}
+
+uint8 FInsightHistoryRecorder::GetChangedSections(const FFrame& Frame, const FFrame& Previous)
+{
+	uint8 Sections = 0;
+	if (Frame.Location != Previous.Location || Frame.Rotation != Previous.Rotation
+		|| Frame.Velocity != Previous.Velocity || Frame.StateFlags != Previous.StateFlags)
+	{
+		Sections |= Section_Basic;
+	}
+	if (Frame.Abilities != Previous.Abilities)
+	{
+		Sections |= Section_Abilities;
+	}
+	if (Frame.Effects != Previous.Effects)
+	{
+		Sections |= Section_Effects;
+	}
+	if (!(Frame.Montage == Previous.Montage))
+	{
+		Sections |= Section_Montage;
+	}
+	if (!(Frame.Tree == Previous.Tree))
+	{
+		Sections |= Section_Tree;
+	}
+	if (Frame.Blackboard != Previous.Blackboard)
+	{
+		Sections |= Section_Blackboard;
+	}
+	if (Frame.Tags != Previous.Tags)
+	{
+		Sections |= Section_Tags;
+	}
+	return Sections;
+}
+
+void FInsightHistoryRecorder::EncodeFrame(FArchive& Ar, const FFrame& Frame, uint8 Sections, float ChunkStartTime)
+{
+	using namespace InsightHistory;
+
+	// ヘッダ: セクション・チャンク先頭からの経過ミリ秒・リビジョン
+	Ar << Sections;
+	int32 TimeOffsetMs = FMath::RoundToInt((Frame.Time - ChunkStartTime) * 1000.0f);
+	SerializeCount(Ar, TimeOffsetMs);
+	int32 Revision = Frame.Revision;
+	SerializeCount(Ar, Revision);
+
+	FFrame& Mutable = const_cast<FFrame&>(Frame);
+
+	if (Sections & Section_Basic)
+	{
+		Ar << Mutable.Location;
+		Ar << Mutable.Rotation;
+		Ar << Mutable.Velocity;
+		Ar << Mutable.StateFlags;
+	}
+
+	if (Sections & Section_Abilities)
+	{
+		int32 Num = Frame.Abilities.Num();
+		SerializeCount(Ar, Num);
+		for (FFrame::FAbility& Ability : Mutable.Abilities)
+		{
+			SerializeId(Ar, Ability.NameId);
+			SerializeCount(Ar, Ability.Level);
+			Ar << Ability.Flags;
+			if (Ability.Flags & AbilityOnCooldown)
+			{
+				Ar << Ability.CooldownRemaining;
+			}
+		}
+	}
+
+	if (Sections & Section_Effects)
+	{
+		int32 Num = Frame.Effects.Num();
+		SerializeCount(Ar, Num);
+		for (FFrame::FEffect& Effect : Mutable.Effects)
+		{
+			SerializeId(Ar, Effect.NameId);
+			SerializeId(Ar, Effect.InstigatorId);
+			SerializeCount(Ar, Effect.StackCount);
+			Ar << Effect.RemainingTime;
+		}
+	}
+
+	if (Sections & Section_Montage)
+	{
+		FFrame::FMontage& Montage = Mutable.Montage;
+		SerializeId(Ar, Montage.NameId);
+		if (Montage.NameId != INDEX_NONE)
+		{
+			SerializeId(Ar, Montage.SectionId);
+			Ar << Montage.Position;
+			Ar << Montage.PlayRate;
+			Ar << Montage.RemainingTime;
+			Ar << Montage.bIsBlendingOut;
+		}
+	}
+
+	if (Sections & Section_Tree)
+	{
+		SerializeId(Ar, Mutable.Tree.TreeNameId);
+		SerializeId(Ar, Mutable.Tree.NodeNameId);
+		Ar << Mutable.Tree.bIsRunning;
+	}
+
+	if (Sections & Section_Blackboard)
+	{
+		int32 Num = Frame.Blackboard.Num();
+		SerializeCount(Ar, Num);
+		for (TPair<int32, FString>& Pair : Mutable.Blackboard)
+		{
+			SerializeId(Ar, Pair.Key);
+			Ar << Pair.Value;
+		}
+	}
+
+	if (Sections & Section_Tags)
+	{
+		int32 Num = Frame.Tags.Num();
+		SerializeCount(Ar, Num);
+		for (int32& TagId : Mutable.Tags)
+		{
+			SerializeCount(Ar, TagId);
+		}
+	}
+}
+
+bool FInsightHistoryRecorder::DecodeFrame(FArchive& Ar, FFrame& InOutFrame, float ChunkStartTime, float MaxTime)
+{
+	using namespace InsightHistory;
+
+	const int64 FrameStart = Ar.Tell();
+
+	uint8 Sections = 0;
+	Ar << Sections;
+	int32 TimeOffsetMs = 0;
+	SerializeCount(Ar, TimeOffsetMs);
+
+	const float FrameTime = ChunkStartTime + TimeOffsetMs / 1000.0f;
+	if (FrameTime > MaxTime)
+	{
+		Ar.Seek(FrameStart);
+		return false;
+	}
+
+	InOutFrame.Time = FrameTime;
+	SerializeCount(Ar, InOutFrame.Revision);
+
+	if (Sections & Section_Basic)
+	{
+		Ar << InOutFrame.Location;
+		Ar << InOutFrame.Rotation;
+		Ar << InOutFrame.Velocity;
+		Ar << InOutFrame.StateFlags;
+	}
+
+	if (Sections & Section_Abilities)
+	{
+		int32 Num = 0;
+		SerializeCount(Ar, Num);
+		InOutFrame.Abilities.SetNum(Num);
+		for (FFrame::FAbility& Ability : InOutFrame.Abilities)
+		{
+			SerializeId(Ar, Ability.NameId);
+			SerializeCount(Ar, Ability.Level);
+			Ar << Ability.Flags;
+			Ability.CooldownRemaining = 0.0f;
+			if (Ability.Flags & AbilityOnCooldown)
+			{
+				Ar << Ability.CooldownRemaining;
+			}
+		}
+	}
+
+	if (Sections & Section_Effects)
+	{
+		int32 Num = 0;
+		SerializeCount(Ar, Num);
+		InOutFrame.Effects.SetNum(Num);
+		for (FFrame::FEffect& Effect : InOutFrame.Effects)
+		{
+			SerializeId(Ar, Effect.NameId);
+			SerializeId(Ar, Effect.InstigatorId);
+			SerializeCount(Ar, Effect.StackCount);
+			Ar << Effect.RemainingTime;
+		}
+	}
+
+	if (Sections & Section_Montage)
+	{
+		FFrame::FMontage& Montage = InOutFrame.Montage;
+		Montage = FFrame::FMontage();
+		SerializeId(Ar, Montage.NameId);
+		if (Montage.NameId != INDEX_NONE)
+		{
+			SerializeId(Ar, Montage.SectionId);
+			Ar << Montage.Position;
+			Ar << Montage.PlayRate;
+			Ar << Montage.RemainingTime;
+			Ar << Montage.bIsBlendingOut;
+		}
+	}
+
+	if (Sections & Section_Tree)
+	{
+		SerializeId(Ar, InOutFrame.Tree.TreeNameId);
+		SerializeId(Ar, InOutFrame.Tree.NodeNameId);
+		Ar << InOutFrame.Tree.bIsRunning;
+	}
+
+	if (Sections & Section_Blackboard)
+	{
+		int32 Num = 0;
+		SerializeCount(Ar, Num);
+		InOutFrame.Blackboard.SetNum(Num);
+		for (TPair<int32, FString>& Pair : InOutFrame.Blackboard)
+		{
+			SerializeId(Ar, Pair.Key);
+			Ar << Pair.Value;
+		}
+	}
+
+	if (Sections & Section_Tags)
+	{
+		int32 Num = 0;
+		SerializeCount(Ar, Num);
+		InOutFrame.Tags.SetNum(Num);
+		for (int32& TagId : InOutFrame.Tags)
+		{
+			SerializeCount(Ar, TagId);
+		}
+	}
+
+	return true;
+}
+
+int32 FInsightHistoryRecorder::InternString(const FString& Value)
+{
+	if (Value.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = StringIds.Find(Value))
+	{
+		return *Existing;
+	}
+
+	// テーブルとマップのキーで2回保持する分を見積もる
+	const int64 EntryBytes = 2 * (sizeof(FString) + (Value.Len() + 1) * sizeof(TCHAR)) + sizeof(int32);
+	if (StringTableBytes + EntryBytes > Settings.StringTableBudgetBytes)
+	{
+		if (!bWarnedStringBudget)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[InsightHistory] String table budget reached (%lld bytes), new strings are recorded as empty"),
+				Settings.StringTableBudgetBytes);
+			bWarnedStringBudget = true;
+		}
+		return INDEX_NONE;
+	}
+
+	const int32 Id = Strings.Add(Value);
+	StringIds.Add(Value, Id);
+	StringTableBytes += EntryBytes;
+	return Id;
+}
+
+int32 FInsightHistoryRecorder::InternTag(const FGameplayTag& Tag)
+{
+	if (const int32* Existing = TagIds.Find(Tag))
+	{
+		return *Existing;
+	}
+
+	const int32 Id = Tags.Add(Tag);
+	TagIds.Add(Tag, Id);
+	return Id;
+}
+
+const FString& FInsightHistoryRecorder::GetString(int32 Id) const
+{
+	return Strings.IsValidIndex(Id) ? Strings[Id] : InsightHistory::EmptyString;
+}
@@ -0,0 +1,602 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "InsightReplicator.h"
+#include "DebugDataCollectorSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/Compression.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace InsightReplication
+{
+	/** パケットのフラグ */
+	constexpr uint8 FlagCompressed = 1 << 0;
+	constexpr uint8 FlagFullSync = 1 << 1;
+
+	/** 受信時に受け付ける上限（壊れたパケットで大きな確保をしないため） */
+	constexpr int32 MaxRawPacketBytes = 1024 * 1024;
+	constexpr int32 MaxArrayElements = 4096;
+	constexpr int32 MaxInterestActors = 256;
+
+	/** アクター参照1つ分の送信量の見積もり（NetGUID） */
+	constexpr int32 ActorReferenceBytes = 4;
+
+	/** 構造体のバイナリ読み書き（プロパティ名を含めない） */
+	template<typename StructType>
+	static void SerializeStruct(FArchive& Ar, StructType& Value)
+	{
+		StructType::StaticStruct()->SerializeItem(Ar, &Value, nullptr);
+	}
+
+	template<typename StructType>
+	static void SerializeStructArray(FArchive& Ar, TArray<StructType>& Values)
+	{
+		int32 Num = Values.Num();
+		Ar << Num;
+		if (Ar.IsLoading())
+		{
+			if (Num < 0 || Num > MaxArrayElements)
+			{
+				Ar.SetError();
+				return;
+			}
+			Values.SetNum(Num);
+		}
+
+		for (StructType& Value : Values)
+		{
+			SerializeStruct(Ar, Value);
+		}
+	}
+}
+
+// ========== FInsightSyncTracker ==========
+
+bool FInsightSyncTracker::ReceivePacket(uint32 Sequence, bool bFullSync)
+{
+	if (Sequence <= LastReceivedSequence)
+	{
+		return false;
+	}
+
+	const bool bGap = LastReceivedSequence != 0 && Sequence != LastReceivedSequence + 1;
+	LastReceivedSequence = Sequence;
+
+	// 再送の開始より前に欠落したパケットの内容は再送に含まれる
+	if (bFullSync)
+	{
+		bNeedsFullSync = false;
+		LastRequestTime = -1.0;
+	}
+	else if (bGap)
+	{
+		bNeedsFullSync = true;
+	}
+	return true;
+}
+
+bool FInsightSyncTracker::ConsumeFullSyncRequest(double Now)
+{
+	if (!bNeedsFullSync)
+	{
+		return false;
+	}
+
+	// 要求済みなら、再送の開始が欠落したとみなせるまで待つ
+	if (LastRequestTime >= 0.0 && Now - LastRequestTime < FullSyncRetrySeconds)
+	{
+		return false;
+	}
+
+	LastRequestTime = Now;
+	return true;
+}
+
+// ========== AInsightReplicator ==========
+
+AInsightReplicator::AInsightReplicator()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// 所有するクライアントにのみ関連させ、ゲームのアクターより後回しにする
+	bReplicates = true;
+	bOnlyRelevantToOwner = true;
+	bAlwaysRelevant = false;
+	bNetLoadOnClient = false;
+	NetPriority = 0.5f;
+	SetReplicatingMovement(false);
+}
+
+void AInsightReplicator::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!HasAuthority())
+	{
+		if (UDebugDataCollectorSubsystem* Collector = GetCollector())
+		{
+			Collector->RegisterInsightReplicator(this);
+		}
+	}
+}
+
+void AInsightReplicator::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HasAuthority())
+	{
+		ReleaseInterest();
+	}
+	else if (UDebugDataCollectorSubsystem* Collector = GetCollector())
+	{
+		Collector->UnregisterInsightReplicator(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+UDebugDataCollectorSubsystem* AInsightReplicator::GetCollector() const
+{
+	UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UDebugDataCollectorSubsystem>() : nullptr;
+}
+
+// ========== サーバー ==========
+
+void AInsightReplicator::ServerSetInterest_Implementation(const TArray<AActor*>& Actors, AActor* FocusActor)
+{
+	UDebugDataCollectorSubsystem* Collector = GetCollector();
+	if (!Collector)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<AActor>> NewInterest;
+	NewInterest.Reserve(FMath::Min(Actors.Num(), InsightReplication::MaxInterestActors));
+	for (AActor* Actor : Actors)
+	{
+		// クライアントから参照できない（レプリケートされない）アクターはnullptrで届く
+		if (Actor && NewInterest.Num() < InsightReplication::MaxInterestActors)
+		{
+			NewInterest.AddUnique(Actor);
+		}
+	}
+
+	// 差分のみサブシステムへ伝える（同じアクターを複数のクライアントが監視できるよう参照数で管理）
+	for (const TWeakObjectPtr<AActor>& Old : Interest)
+	{
+		if (!NewInterest.Contains(Old))
+		{
+			Collector->RemoveRemoteInterest(Old);
+			SentStates.Remove(Old);
+		}
+	}
+	for (const TWeakObjectPtr<AActor>& New : NewInterest)
+	{
+		if (!Interest.Contains(New))
+		{
+			Collector->AddRemoteInterest(New.Get());
+			SentStates.FindOrAdd(New);
+		}
+	}
+
+	Interest = MoveTemp(NewInterest);
+	InterestFocus = Interest.Contains(FocusActor) ? FocusActor : nullptr;
+	Collector->SetRemoteFocus(this, InterestFocus.Get());
+}
+
+void AInsightReplicator::ServerRequestFullSync_Implementation()
+{
+	// 送信済みの内容を忘れて全セクションを送り直す（送信量の上限は通常どおり守る）
+	for (TPair<TWeakObjectPtr<AActor>, FSentActorState>& Pair : SentStates)
+	{
+		Pair.Value = FSentActorState();
+	}
+	bFullSyncPending = true;
+}
+
+void AInsightReplicator::ReleaseInterest()
+{
+	if (UDebugDataCollectorSubsystem* Collector = GetCollector())
+	{
+		for (const TWeakObjectPtr<AActor>& Actor : Interest)
+		{
+			Collector->RemoveRemoteInterest(Actor);
+		}
+		Collector->SetRemoteFocus(this, nullptr);
+	}
+
+	Interest.Reset();
+	InterestFocus.Reset();
+	SentStates.Reset();
+}
+
+bool AInsightReplicator::IsRelevantToOwner(const AActor& Actor) const
+{
+	const APlayerController* PC = Cast<APlayerController>(GetOwner());
+	if (!PC || !Actor.GetIsReplicated())
+	{
+		return false;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const AActor* ViewTarget = PC->GetViewTarget();
+	return Actor.IsNetRelevantFor(PC, ViewTarget ? ViewTarget : PC, ViewLocation);
+}
+
+void AInsightReplicator::SendUpdates(float DeltaTime, const UDebugDataCollectorSubsystem& Collector)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AInsightReplicator::SendUpdates);
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - BytesWindowStart >= 1.0)
+	{
+		BytesSentLastSecond = BytesSentInWindow;
+		BytesSentInWindow = 0;
+		BytesWindowStart = Now;
+	}
+
+	// トークンバケット（最大1秒分まで貯める、超過した分は次に持ち越す）
+	const float MaxTokens = static_cast<float>(Settings.MaxBytesPerSecond);
+	SendTokens = FMath::Min(SendTokens + MaxTokens * DeltaTime, MaxTokens);
+	if (SendTokens <= 0.0f || Interest.Num() == 0)
+	{
+		return;
+	}
+
+	// 前回送ってから内容が変わり、クライアントから見えるアクター
+	struct FCandidate
+	{
+		AActor* Actor = nullptr;
+		FActorInsightSnapshot Snapshot;
+		FSentActorState* Sent = nullptr;
+		bool bFocus = false;
+	};
+	TArray<FCandidate, TInlineAllocator<32>> Candidates;
+	for (const TWeakObjectPtr<AActor>& WeakActor : Interest)
+	{
+		AActor* Actor = WeakActor.Get();
+		FSentActorState* Sent = SentStates.Find(WeakActor);
+		if (!Actor || !Sent || !IsRelevantToOwner(*Actor))
+		{
+			continue;
+		}
+
+		FActorInsightSnapshot Snapshot = Collector.GetInsightSnapshot(Actor);
+		if (!Snapshot.IsValid() || Snapshot->Revision == Sent->Revision)
+		{
+			continue;
+		}
+
+		Candidates.Add({ Actor, MoveTemp(Snapshot), Sent, WeakActor == InterestFocus });
+	}
+
+	// 選択中のアクター → 送信が古い順
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.bFocus != B.bFocus)
+		{
+			return A.bFocus;
+		}
+		return A.Sent->LastSentTime < B.Sent->LastSentTime;
+	});
+
+	TArray<AActor*> PacketActors;
+	PacketBody.Reset();
+	for (const FCandidate& Candidate : Candidates)
+	{
+		// 送信量の上限に達したら残りは次の機会に回す
+		if (SendTokens - PacketBody.Num() <= 0.0f)
+		{
+			break;
+		}
+
+		if (!WriteActorEntry(*Candidate.Snapshot, *Candidate.Sent))
+		{
+			continue;
+		}
+
+		if (PacketActors.Num() > 0 && PacketBody.Num() + EntryBuffer.Num() > Settings.MaxPacketBytes)
+		{
+			SendPacket(PacketActors, PacketActors.Num(), PacketBody);
+			PacketActors.Reset();
+			PacketBody.Reset();
+		}
+
+		PacketActors.Add(Candidate.Actor);
+		PacketBody.Append(EntryBuffer);
+	}
+
+	if (PacketActors.Num() > 0)
+	{
+		SendPacket(PacketActors, PacketActors.Num(), PacketBody);
+	}
+}
+
+bool AInsightReplicator::WriteActorEntry(const FActorInsightData& Data, FSentActorState& Sent)
+{
+	const bool bForceAll = Sent.Revision == INDEX_NONE;
+	Sent.Revision = Data.Revision;
+
+	// 書き込み時は値を変更しない
+	FActorInsightData& Source = const_cast<FActorInsightData&>(Data);
+
+	EntryBuffer.Reset();
+	FMemoryWriter EntryWriter(EntryBuffer);
+	EntryWriter.SetWantBinaryPropertySerialization(true);
+
+	int32 Revision = Data.Revision;
+	float LastUpdateTime = Data.LastUpdateTime;
+	uint16 SectionMask = 0;
+	EntryWriter << Revision;
+	EntryWriter << LastUpdateTime;
+	const int64 MaskOffset = EntryWriter.Tell();
+	EntryWriter << SectionMask;
+
+	// セクションごとに書き出してハッシュを比べ、前回送った内容と違うものだけ載せる
+	for (int32 Section = 0; Section < Section_Num; ++Section)
+	{
+		SectionBuffer.Reset();
+		FMemoryWriter SectionWriter(SectionBuffer);
+		SectionWriter.SetWantBinaryPropertySerialization(true);
+		SerializeSection(SectionWriter, Source, Section);
+
+		const uint32 Hash = FCrc::MemCrc32(SectionBuffer.GetData(), SectionBuffer.Num());
+		if (!bForceAll && Hash == Sent.SectionHashes[Section])
+		{
+			continue;
+		}
+
+		Sent.SectionHashes[Section] = Hash;
+		SectionMask |= static_cast<uint16>(1 << Section);
+		EntryWriter.Serialize(SectionBuffer.GetData(), SectionBuffer.Num());
+	}
+
+	if (SectionMask == 0)
+	{
+		return false;
+	}
+
+	EntryWriter.Seek(MaskOffset);
+	EntryWriter << SectionMask;
+	Sent.LastSentTime = FPlatformTime::Seconds();
+	return true;
+}
+
+void AInsightReplicator::SendPacket(const TArray<AActor*>& Actors, int32 NumEntries, const TArray<uint8>& Body)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AInsightReplicator::SendPacket);
+
+	TArray<uint8> Raw;
+	FMemoryWriter RawWriter(Raw);
+	uint32 PackedEntries = static_cast<uint32>(NumEntries);
+	RawWriter.SerializeIntPacked(PackedEntries);
+	RawWriter.Serialize(const_cast<uint8*>(Body.GetData()), Body.Num());
+
+	uint8 Flags = bFullSyncPending ? InsightReplication::FlagFullSync : 0;
+	bFullSyncPending = false;
+
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+
+	// 文字列の多いセクション（サマリー・ブラックボード）は圧縮が効くため、小さくなる場合のみ圧縮する
+	if (Raw.Num() > Settings.CompressionThresholdBytes)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Raw.Num());
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Raw.GetData(), Raw.Num())
+			&& CompressedSize + static_cast<int32>(sizeof(int32)) < Raw.Num())
+		{
+			Flags |= InsightReplication::FlagCompressed;
+			int32 RawSize = Raw.Num();
+			PayloadWriter << Flags;
+			PayloadWriter << RawSize;
+			PayloadWriter.Serialize(Compressed.GetData(), CompressedSize);
+		}
+	}
+
+	if (Payload.Num() == 0)
+	{
+		PayloadWriter << Flags;
+		PayloadWriter.Serialize(Raw.GetData(), Raw.Num());
+	}
+
+	ClientReceivePacket(NextSequence++, Actors, Payload);
+
+	const int32 Bytes = Payload.Num() + Actors.Num() * InsightReplication::ActorReferenceBytes;
+	SendTokens -= static_cast<float>(Bytes);
+	BytesSentInWindow += Bytes;
+}
+
+void AInsightReplicator::SerializeSection(FArchive& Ar, FActorInsightData& Data, int32 Section)
+{
+	using namespace InsightReplication;
+
+	switch (Section)
+	{
+	case Section_Basic:
+		SerializeStruct(Ar, Data.BasicState);
+		break;
+	case Section_Abilities:
+		SerializeStructArray(Ar, Data.ActiveAbilities);
+		SerializeStructArray(Ar, Data.GrantedAbilities);
+		break;
+	case Section_Effects:
+		SerializeStructArray(Ar, Data.ActiveEffects);
+		break;
+	case Section_Animation:
+		SerializeStructArray(Ar, Data.ActiveMontages);
+		SerializeStructArray(Ar, Data.AnimStateMachines);
+		break;
+	case Section_BehaviorTree:
+		SerializeStruct(Ar, Data.BehaviorTree);
+		break;
+	case Section_Blackboard:
+		SerializeStruct(Ar, Data.Blackboard);
+		break;
+	case Section_Tick:
+		SerializeStructArray(Ar, Data.TickInfo);
+		break;
+	case Section_Tasks:
+		SerializeStructArray(Ar, Data.ActiveTasks);
+		break;
+	case Section_Tags:
+		SerializeStruct(Ar, Data.OwnedGameplayTags);
+		break;
+	case Section_Summary:
+		Ar << Data.HumanReadableSummary;
+		break;
+	default:
+		break;
+	}
+}
+
+// ========== クライアント ==========
+
+void AInsightReplicator::UpdateInterest(const TArray<AActor*>& Actors, AActor* FocusActor)
+{
+	uint32 Hash = GetTypeHash(FocusActor);
+	for (AActor* Actor : Actors)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Actor));
+	}
+
+	// パケットが届かない間も、欠落した再送の開始を要求し直す
+	RequestFullSyncIfNeeded();
+
+	// 監視が外れたアクターの受信済みの状態を破棄
+	for (auto It = ServerSnapshots.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || !Actors.Contains(It.Key().Get()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Hash == LastInterestHash)
+	{
+		return;
+	}
+	LastInterestHash = Hash;
+
+	ServerSetInterest(Actors, FocusActor);
+}
+
+void AInsightReplicator::ClientReceivePacket_Implementation(uint32 Sequence, const TArray<AActor*>& Actors, const TArray<uint8>& Payload)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AInsightReplicator::ClientReceivePacket);
+
+	if (Payload.Num() < 1)
+	{
+		return;
+	}
+
+	FMemoryReader HeaderReader(Payload);
+	uint8 Flags = 0;
+	HeaderReader << Flags;
+
+	// 順序が入れ替わった古いパケットは捨てる
+	if (!SyncTracker.ReceivePacket(Sequence, (Flags & InsightReplication::FlagFullSync) != 0))
+	{
+		return;
+	}
+
+	// 欠落したパケットの差分は二度と届かないため、全体の再送を要求する
+	RequestFullSyncIfNeeded();
+
+	TArray<uint8> Raw;
+	if (Flags & InsightReplication::FlagCompressed)
+	{
+		int32 RawSize = 0;
+		HeaderReader << RawSize;
+		if (HeaderReader.IsError() || RawSize <= 0 || RawSize > InsightReplication::MaxRawPacketBytes)
+		{
+			return;
+		}
+
+		const int64 Offset = HeaderReader.Tell();
+		Raw.SetNumUninitialized(RawSize);
+		if (!FCompression::UncompressMemory(NAME_Zlib, Raw.GetData(), RawSize, Payload.GetData() + Offset, Payload.Num() - static_cast<int32>(Offset)))
+		{
+			return;
+		}
+	}
+
+	const bool bCompressed = (Flags & InsightReplication::FlagCompressed) != 0;
+	FMemoryReader Reader(bCompressed ? Raw : Payload);
+	Reader.SetWantBinaryPropertySerialization(true);
+	if (!bCompressed)
+	{
+		Reader.Seek(HeaderReader.Tell());
+	}
+
+	uint32 NumEntries = 0;
+	Reader.SerializeIntPacked(NumEntries);
+
+	for (uint32 EntryIndex = 0; EntryIndex < NumEntries && !Reader.IsError(); ++EntryIndex)
+	{
+		int32 Revision = 0;
+		float LastUpdateTime = 0.0f;
+		uint16 SectionMask = 0;
+		Reader << Revision;
+		Reader << LastUpdateTime;
+		Reader << SectionMask;
+
+		// 受信済みの状態に変わったセクションを重ねる（見えないアクターの分も読み進める）
+		AActor* Actor = Actors.IsValidIndex(EntryIndex) ? Actors[EntryIndex] : nullptr;
+		const FActorInsightSnapshot* Existing = Actor ? ServerSnapshots.Find(Actor) : nullptr;
+		TSharedPtr<FActorInsightData, ESPMode::ThreadSafe> Data = (Existing && Existing->IsValid())
+			? MakeShared<FActorInsightData, ESPMode::ThreadSafe>(**Existing)
+			: MakeShared<FActorInsightData, ESPMode::ThreadSafe>();
+
+		for (int32 Section = 0; Section < Section_Num; ++Section)
+		{
+			if (SectionMask & (1 << Section))
+			{
+				SerializeSection(Reader, *Data, Section);
+			}
+		}
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[InsightReplicator] Malformed packet %u"), Sequence);
+			break;
+		}
+
+		if (Actor)
+		{
+			Data->Actor = Actor;
+			Data->Revision = Revision;
+			Data->LastUpdateTime = LastUpdateTime;
+			ServerSnapshots.Add(Actor, Data);
+		}
+	}
+}
+
+void AInsightReplicator::RequestFullSyncIfNeeded()
+{
+	if (SyncTracker.ConsumeFullSyncRequest(FPlatformTime::Seconds()))
+	{
+		ServerRequestFullSync();
+	}
+}
+
+FActorInsightSnapshot AInsightReplicator::GetServerSnapshot(AActor* Actor) const
+{
+	const FActorInsightSnapshot* Found = ServerSnapshots.Find(Actor);
+	return Found ? *Found : FActorInsightSnapshot();
+}
+
+void AInsightReplicator::GetAllServerSnapshots(TArray<FActorInsightSnapshot>& OutSnapshots) const
+{
+	OutSnapshots.Reset(ServerSnapshots.Num());
+	for (const TPair<TWeakObjectPtr<AActor>, FActorInsightSnapshot>& Pair : ServerSnapshots)
+	{
+		OutSnapshots.Add(Pair.Value);
+	}
+}
@@ -0,0 +1,49 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "InsightReplicator.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInsightSyncTrackerDroppedFullSyncTest, "DevTools.UnifiedDebugPanel.InsightReplicator.DroppedFullSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FInsightSyncTrackerDroppedFullSyncTest::RunTest(const FString& Parameters)
+{
+	FInsightSyncTracker Tracker;
+	Tracker.FullSyncRetrySeconds = 1.0;
+
+	// 1, 2 を受信し 3 が欠落 → 全体の再送を要求
+	TestTrue(TEXT("Packet 1 accepted"), Tracker.ReceivePacket(1, false));
+	TestTrue(TEXT("Packet 2 accepted"), Tracker.ReceivePacket(2, false));
+	TestFalse(TEXT("No request without gap"), Tracker.ConsumeFullSyncRequest(0.0));
+	TestTrue(TEXT("Packet 4 accepted"), Tracker.ReceivePacket(4, false));
+	TestTrue(TEXT("Gap requests full sync"), Tracker.ConsumeFullSyncRequest(0.0));
+
+	// 要求直後は重ねて要求しない
+	TestTrue(TEXT("Packet 5 accepted"), Tracker.ReceivePacket(5, false));
+	TestFalse(TEXT("No duplicate request while awaiting"), Tracker.ConsumeFullSyncRequest(0.1));
+
+	// 再送の開始（6）が欠落し、7 が届く → 待ち時間が過ぎたら要求し直す
+	TestTrue(TEXT("Packet 7 accepted"), Tracker.ReceivePacket(7, false));
+	TestTrue(TEXT("Still needs full sync after dropped full-sync packet"), Tracker.NeedsFullSync());
+	TestFalse(TEXT("Waits for retry interval"), Tracker.ConsumeFullSyncRequest(0.5));
+	TestTrue(TEXT("Retries after dropped full-sync packet"), Tracker.ConsumeFullSyncRequest(1.2));
+
+	// パケットが届かない間も待ち時間ごとに要求し直す
+	TestFalse(TEXT("Waits again after retry"), Tracker.ConsumeFullSyncRequest(1.5));
+	TestTrue(TEXT("Retries without further packets"), Tracker.ConsumeFullSyncRequest(2.3));
+
+	// 再送の開始を受信したら要求をやめる（その前の欠落は再送に含まれる）
+	TestTrue(TEXT("Full-sync packet accepted"), Tracker.ReceivePacket(9, true));
+	TestFalse(TEXT("Synced after full-sync packet"), Tracker.NeedsFullSync());
+	TestFalse(TEXT("No request after full sync"), Tracker.ConsumeFullSyncRequest(10.0));
+
+	// 順序が入れ替わった古いパケットは捨てる
+	TestFalse(TEXT("Stale packet rejected"), Tracker.ReceivePacket(8, false));
+	TestFalse(TEXT("Stale packet does not trigger a request"), Tracker.ConsumeFullSyncRequest(20.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
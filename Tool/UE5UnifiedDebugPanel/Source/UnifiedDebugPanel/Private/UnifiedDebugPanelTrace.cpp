@@ -0,0 +1,82 @@
+// Copyright DevTools. All Rights Reserved.
+
+#include "UnifiedDebugPanelTrace.h"
+#include "GameFramework/Actor.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+#if UNIFIED_DEBUG_PANEL_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(UnifiedDebugPanelChannel)
+
+UE_TRACE_EVENT_BEGIN(UnifiedDebugPanel, ActorInfo)
+	UE_TRACE_EVENT_FIELD(uint32, ActorId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UnifiedDebugPanel, InsightEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ActorId)
+	UE_TRACE_EVENT_FIELD(uint8, Type)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+#endif
+
+namespace UnifiedDebugPanelTrace
+{
+	void OutputActor(const AActor& Actor)
+	{
+#if UNIFIED_DEBUG_PANEL_TRACE_ENABLED
+		if (!UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED())
+		{
+			return;
+		}
+
+		const FString ActorName = Actor.GetName();
+		UE_TRACE_LOG(UnifiedDebugPanel, ActorInfo, UnifiedDebugPanelChannel)
+			<< ActorInfo.ActorId(Actor.GetUniqueID())
+			<< ActorInfo.Name(*ActorName, ActorName.Len());
+#endif
+	}
+
+	void OutputEvent(const AActor& Actor, EInsightTraceEvent Type, const TCHAR* Name)
+	{
+#if UNIFIED_DEBUG_PANEL_TRACE_ENABLED
+		if (!UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED())
+		{
+			return;
+		}
+
+		UE_TRACE_LOG(UnifiedDebugPanel, InsightEvent, UnifiedDebugPanelChannel)
+			<< InsightEvent.Cycle(FPlatformTime::Cycles64())
+			<< InsightEvent.ActorId(Actor.GetUniqueID())
+			<< InsightEvent.Type(static_cast<uint8>(Type))
+			<< InsightEvent.Name(Name);
+
+		TRACE_BOOKMARK(TEXT("%s %s: %s"), *Actor.GetName(), GetEventName(Type), Name);
+#endif
+	}
+
+	const TCHAR* GetEventName(EInsightTraceEvent Type)
+	{
+		switch (Type)
+		{
+		case EInsightTraceEvent::AbilityActivated:
+			return TEXT("AbilityActivated");
+		case EInsightTraceEvent::AbilityEnded:
+			return TEXT("AbilityEnded");
+		case EInsightTraceEvent::EffectApplied:
+			return TEXT("EffectApplied");
+		case EInsightTraceEvent::EffectRemoved:
+			return TEXT("EffectRemoved");
+		case EInsightTraceEvent::MontageStarted:
+			return TEXT("MontageStarted");
+		case EInsightTraceEvent::MontageStopped:
+			return TEXT("MontageStopped");
+		case EInsightTraceEvent::BehaviorTreeTaskChanged:
+			return TEXT("BehaviorTreeTaskChanged");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+}
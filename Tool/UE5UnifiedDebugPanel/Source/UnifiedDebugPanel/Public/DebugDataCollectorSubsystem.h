@@ -5,18 +5,45 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "DebugDataTypes.h"
+#include "InsightHistoryRecorder.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "UObject/StrongObjectPtr.h"
+#include "DebugMontageEventListener.h"
+#include "InsightReplicator.h"
 #include "DebugDataCollectorSubsystem.generated.h"
 
 class UAbilitySystemComponent;
 class UBehaviorTreeComponent;
-class UBlackboardComponent;
 class USkeletalMeshComponent;
 class UAnimInstance;
+class UBehaviorTree;
+class UBlackboardData;
+class UBTNode;
+class UGameplayAbility;
+class APlayerController;
+struct FAbilityEndedData;
+struct FGameplayEffectSpec;
+struct FActiveGameplayEffect;
+struct FActiveGameplayEffectHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActorInsightUpdated, const FActorInsightData&, InsightData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWatchedActorAdded, AActor*, Actor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWatchedActorRemoved, AActor*, Actor);
 
+/**
+ * 変更通知で作り直すセクション（イベント駆動の収集用）
+ */
+enum class EDebugInsightSection : uint8
+{
+	None = 0,
+	Abilities = 1 << 0,
+	Effects = 1 << 1,
+	Tags = 1 << 2,
+	Montage = 1 << 3,
+	All = Abilities | Effects | Tags | Montage
+};
+ENUM_CLASS_FLAGS(EDebugInsightSection);
+
 /**
  * デバッグデータ収集サブシステム
  * ワールド内のアクターからデバッグ情報を収集し、統合表示用のデータを提供
@@ -76,17 +103,27 @@ public:
 	// ========== データ取得 ==========
 
 	/**
-	 * 指定アクターのInsightデータを取得
+	 * 指定アクターのInsightデータを取得（コピー）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
 	bool GetActorInsight(AActor* Actor, FActorInsightData& OutData) const;
 
 	/**
-	 * 全ての監視対象のInsightデータを取得
+	 * 全ての監視対象のInsightデータを取得（コピー、C++からはGetAllInsightSnapshotsを使用）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
 	TArray<FActorInsightData> GetAllInsightData() const;
 
+	/**
+	 * 指定アクターのInsightスナップショットを取得（未収集の場合はnullptr）
+	 */
+	FActorInsightSnapshot GetInsightSnapshot(AActor* Actor) const;
+
+	/**
+	 * 全ての監視対象のInsightスナップショットを取得（監視開始順、データはコピーしない）
+	 */
+	void GetAllInsightSnapshots(TArray<FActorInsightSnapshot>& OutSnapshots) const;
+
 	/**
 	 * 監視対象アクター一覧を取得
 	 */
@@ -102,11 +139,48 @@ public:
 	// ========== 設定 ==========
 
 	/**
-	 * 更新間隔を設定（秒）
+	 * 更新間隔を設定（秒、各アクターを収集する最短の間隔）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
 	void SetUpdateInterval(float Interval) { UpdateInterval = FMath::Max(0.016f, Interval); }
 
+	/**
+	 * 1フレームの収集に使う時間の予算を設定（マイクロ秒）
+	 * 予算を超えた分の監視対象は次のフレーム以降に回す（選択中のアクターは予算に関わらず収集）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	void SetCollectBudget(float Microseconds) { CollectBudgetMicroseconds = FMath::Max(0.0f, Microseconds); }
+
+	/**
+	 * 1フレームの収集に使う時間の予算を取得（マイクロ秒）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	float GetCollectBudget() const { return CollectBudgetMicroseconds; }
+
+	/**
+	 * 優先して収集するアクターを設定（パネルで選択中のアクターなど、nullptrで解除）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	void SetFocusActor(AActor* Actor);
+
+	/**
+	 * 優先して収集するアクターを取得
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	AActor* GetFocusActor() const { return FocusActor.Get(); }
+
+	/**
+	 * 直前のフレームで収集したアクター数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	int32 GetLastCollectedActorCount() const { return LastCollectedActorCount; }
+
+	/**
+	 * 直前のフレームの収集にかかった時間（マイクロ秒）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	float GetLastCollectMicroseconds() const { return LastCollectMicroseconds; }
+
 	/**
 	 * デバッグ情報収集を有効/無効化
 	 */
@@ -119,9 +193,128 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
 	bool IsEnabled() const { return bIsEnabled; }
 
+	// ========== イベント駆動の収集 ==========
+
+	/**
+	 * イベント駆動の収集を有効/無効化
+	 * 有効な場合、GAS・モンタージュは変更通知のあったセクションのみ作り直し、変化し続ける値（クールダウン・残り時間・再生位置）のみ毎回読み取る
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	void SetEventDrivenCollection(bool bEnable);
+
+	/**
+	 * イベント駆動の収集が有効か
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel")
+	bool IsEventDrivenCollection() const { return bEventDrivenCollection; }
+
+	/**
+	 * 指定セクションを次の収集で作り直す（通知の無い変更をゲーム側から伝える場合にも使用）
+	 */
+	void NotifyInsightSectionChanged(const TWeakObjectPtr<AActor>& Actor, EDebugInsightSection Sections);
+
+	// ========== 履歴 ==========
+
+	/**
+	 * 履歴の記録を有効/無効化
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	void SetHistoryRecordingEnabled(bool bEnable) { bRecordHistory = bEnable; }
+
+	/**
+	 * 履歴を記録中か
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	bool IsHistoryRecordingEnabled() const { return bRecordHistory; }
+
+	/**
+	 * 履歴の保持範囲を取得（ワールド時刻、記録が無ければfalse）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	bool GetHistoryTimeRange(float& OutOldest, float& OutNewest) const;
+
+	/**
+	 * 指定時刻のInsightデータを履歴から復元
+	 * （サマリーは再生成、アビリティ・エフェクトのタグ・ティック情報・アニメーションステート・タスクは含まない）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	bool GetActorInsightAtTime(AActor* Actor, float Time, FActorInsightData& OutData) const;
+
+	/**
+	 * 履歴をバイナリファイルへ書き出し
+	 * @param FilePath 出力先（空の場合は Saved/UnifiedDebugPanel/InsightHistory_<日時>.udph）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	bool DumpHistoryToFile(const FString& FilePath = TEXT(""));
+
+	/**
+	 * 履歴を破棄
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|History")
+	void ClearHistory() { HistoryRecorder.Reset(); }
+
+	/** 履歴の記録先（設定の変更・メモリ使用量の確認用） */
+	FInsightHistoryRecorder& GetHistoryRecorder() { return HistoryRecorder; }
+	const FInsightHistoryRecorder& GetHistoryRecorder() const { return HistoryRecorder; }
+
+	// ========== サーバーとの比較（ネットワーク） ==========
+
+	/**
+	 * サーバーからクライアントへのInsightデータの配信を有効/無効化（サーバーのワールドで呼ぶ）
+	 * 有効な場合、接続中のクライアントごとにレプリケーターを生成し、クライアントが監視中のアクターをサーバーでも収集して差分を送る
+	 * 起動時は -UnifiedDebugServerStreaming で有効
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|Network")
+	void SetServerStreamingEnabled(bool bEnable);
+
+	/**
+	 * サーバーからの配信が有効か
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|Network")
+	bool IsServerStreamingEnabled() const { return bServerStreaming; }
+
+	/**
+	 * クライアントごとの配信量の上限を設定（バイト/秒、サーバーのワールドで呼ぶ）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|Network")
+	void SetServerStreamBandwidth(int32 BytesPerSecond);
+
+	/**
+	 * サーバーから受信した指定アクターのInsightデータを取得（クライアントのワールドで呼ぶ、コピー）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|Network")
+	bool GetServerActorInsight(AActor* Actor, FActorInsightData& OutData) const;
+
+	/**
+	 * サーバーからの配信を受信中か（クライアントのワールドで呼ぶ）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UnifiedDebugPanel|Network")
+	bool IsReceivingServerInsight() const { return ClientReplicator.IsValid(); }
+
+	/**
+	 * サーバーから受信した指定アクターのInsightスナップショットを取得（未受信の場合はnullptr）
+	 */
+	FActorInsightSnapshot GetServerInsightSnapshot(AActor* Actor) const;
+
+	/** クライアント: 受信用のレプリケーターの登録・解除（レプリケーターから呼ばれる） */
+	void RegisterInsightReplicator(AInsightReplicator* Replicator);
+	void UnregisterInsightReplicator(AInsightReplicator* Replicator);
+
+	/** サーバー: クライアントが監視中のアクター（参照数で管理し、ローカルで監視していなければ監視を追加・解除） */
+	void AddRemoteInterest(AActor* Actor);
+	void RemoveRemoteInterest(const TWeakObjectPtr<AActor>& Actor);
+
+	/** サーバー: クライアントで選択中のアクター（選択中のアクターと同様に予算に関わらず収集） */
+	void SetRemoteFocus(const AInsightReplicator* Replicator, AActor* Actor);
+
+	/**
+	 * 人間向けサマリーを生成（任意のスレッド）
+	 */
+	static FString GenerateHumanReadableSummary(const FActorInsightData& Data);
+
 	// ========== イベント ==========
 
-	/** Insightデータ更新時のイベント */
+	/** Insightデータ更新時のイベント（内容が変わったアクターのみ） */
 	UPROPERTY(BlueprintAssignable, Category = "UnifiedDebugPanel")
 	FOnActorInsightUpdated OnActorInsightUpdated;
 
@@ -134,6 +327,171 @@ public:
 	FOnWatchedActorRemoved OnWatchedActorRemoved;
 
 protected:
+	/**
+	 * ゲームスレッドで読み取ったブラックボードの値（文字列化は整形フェーズで行う）
+	 */
+	struct FGatheredBlackboardValue
+	{
+		enum class EType : uint8
+		{
+			Bool,
+			Int,
+			Float,
+			Name,
+			String,
+			Vector,
+			Rotator,
+			Object,
+			/** 未対応の型（ゲームスレッドで説明文を取得済み） */
+			Described
+		};
+
+		FName KeyName;
+		EType Type = EType::Described;
+		bool BoolValue = false;
+		int32 IntValue = 0;
+		float FloatValue = 0.0f;
+		FVector VectorValue = FVector::ZeroVector;
+		FRotator RotatorValue = FRotator::ZeroRotator;
+		/** Name型の値・Enum型の列挙子名・Object/Class型のオブジェクト名 */
+		FName NameValue;
+		FString StringValue;
+	};
+
+	/**
+	 * ゲームスレッドで読み取ったティック関数
+	 */
+	struct FGatheredTickFunction
+	{
+		FName Name;
+		TEnumAsByte<ETickingGroup> TickGroup = TG_PrePhysics;
+		bool bIsEnabled = false;
+	};
+
+	/**
+	 * 整形フェーズへの受け渡し
+	 * 収集フェーズは数値をスナップショットへ直接書き込み、文字列化が必要な値は名前（FName）や生の値のままここへ積む
+	 */
+	struct FPendingFormat
+	{
+		/** 整形が必要なセクション */
+		bool bNames = false;
+		bool bAbilities = false;
+		bool bActiveAbilities = false;
+		bool bEffects = false;
+		bool bMontage = false;
+		bool bMontageSection = false;
+		bool bTree = false;
+		bool bBlackboardFull = false;
+		bool bBlackboardChanged = false;
+		bool bTick = false;
+
+		/** アクター名・クラス名 */
+		FName ActorName;
+		FName ClassName;
+
+		/** アビリティ・エフェクトの名前（スナップショットの配列と同じ順序） */
+		TArray<TPair<FName, FName>> AbilityNames;
+		TArray<TPair<FName, FName>> EffectNames;
+
+		/** モンタージュ名・セクション名 */
+		FName MontageName;
+		FName MontageSection;
+
+		/** ビヘイビアツリー名 */
+		FName TreeName;
+
+		/** ブラックボードの値（全体または変わったキー） */
+		TArray<FGatheredBlackboardValue> BlackboardValues;
+
+		/** ティック関数 */
+		TArray<FGatheredTickFunction> TickFunctions;
+
+		/** 整形後に記録する時刻 */
+		float WorldTime = 0.0f;
+
+		/** 受け渡し済みの内容を破棄（配列の確保は残す） */
+		void Reset();
+	};
+
+	/**
+	 * 監視対象ごとの収集状態
+	 * セクションごとに前回の構成を表すキー（エンジン側のID・ポインタ・数値から作るハッシュ）を持ち、
+	 * キーが変わったセクションのみ文字列を含めて作り直す
+	 */
+	struct FWatchState
+	{
+		/** 最新のスナップショット（他で参照されていなければそのまま更新、参照中なら複製してから更新） */
+		TSharedPtr<FActorInsightData, ESPMode::ThreadSafe> Snapshot;
+
+		/** アビリティ・エフェクト・ティックの構成キー */
+		uint32 AbilityKey = 0;
+		uint32 EffectKey = 0;
+		uint32 TickKey = 0;
+
+		/** 再生中のモンタージュインスタンスID（INDEX_NONEは無し）と現在のセクション */
+		int32 MontageInstanceId = INDEX_NONE;
+		FName MontageSection;
+
+		/** ビヘイビアツリーの状態 */
+		TWeakObjectPtr<UBehaviorTree> Tree;
+		const UBTNode* ActiveNode = nullptr;
+		bool bTreeRunning = false;
+
+		/** 変更を監視中のブラックボード */
+		TWeakObjectPtr<UBlackboardComponent> ObservedBlackboard;
+		TWeakObjectPtr<UBlackboardData> ObservedBlackboardAsset;
+
+		/** ブラックボードで前回の収集以降に変わったキー（変更通知で積む） */
+		TArray<FBlackboard::FKey> ChangedBlackboardKeys;
+
+		/** ブラックボード全体の再収集が必要か（監視開始・アセット変更時） */
+		bool bBlackboardFullRefresh = true;
+
+		/** 初回の収集が済んだか */
+		bool bCollected = false;
+
+		/** 最後に収集した時刻・内容が変わった時刻（FPlatformTime::Seconds） */
+		double LastCollectTime = 0.0;
+		double LastChangeTime = 0.0;
+
+		/** 今回のフレームで優先度が高いと判定されたか */
+		bool bHighPriority = false;
+
+		/** 変更通知を登録中のASC・モンタージュ通知の受け口 */
+		TWeakObjectPtr<UAbilitySystemComponent> BoundAbilitySystem;
+		FDelegateHandle AbilityActivatedHandle;
+		FDelegateHandle AbilityEndedHandle;
+		FDelegateHandle EffectAddedHandle;
+		FDelegateHandle EffectRemovedHandle;
+		FDelegateHandle TagChangedHandle;
+		TStrongObjectPtr<UDebugMontageEventListener> MontageListener;
+
+		/** 変更通知を受けて作り直しが必要なセクション（監視開始時は全て） */
+		EDebugInsightSection DirtySections = EDebugInsightSection::All;
+
+		/** 前回の収集時点でクールダウン中のアビリティ・残り時間のあるエフェクトがあったか（あれば値のみ毎回読み取る） */
+		bool bHasCooldowns = false;
+		bool bHasTimedEffects = false;
+
+		/** 前回の収集時点のアビリティスペック数（付与・削除の検出用） */
+		int32 NumAbilitySpecs = INDEX_NONE;
+
+		/** 最後に全て読み直した時刻（通知の無い変更の取りこぼし対策、FPlatformTime::Seconds） */
+		double LastFullResyncTime = 0.0;
+
+		/** トレース出力用の前回の状態（実行中のアビリティ・適用中のエフェクトの（ハンドルのハッシュ, 名前）、再生中のモンタージュ名） */
+		TArray<TPair<uint32, FName>> TracedAbilities;
+		TArray<TPair<uint32, FName>> TracedEffects;
+		FName TracedMontage;
+
+		/** 整形フェーズへの受け渡し */
+		FPendingFormat Pending;
+	};
+
+	/** 書き込み用のスナップショット（参照中なら複製） */
+	static FActorInsightData& GetMutableSnapshot(FWatchState& State);
+
 	/** ティック登録用のデリゲートハンドル */
 	FDelegateHandle TickDelegateHandle;
 
@@ -141,63 +499,165 @@ protected:
 	UPROPERTY()
 	TArray<TWeakObjectPtr<AActor>> WatchedActors;
 
-	/** キャッシュされたInsightデータ */
-	UPROPERTY()
-	TMap<TWeakObjectPtr<AActor>, FActorInsightData> CachedInsightData;
+	/** 監視対象ごとの収集状態 */
+	TMap<TWeakObjectPtr<AActor>, FWatchState> WatchStates;
+
+	/** 今回の更新で整形が必要な収集状態（フレームをまたいで確保を使い回す） */
+	TArray<FWatchState*> PendingStates;
 
 	/** 更新間隔 */
 	float UpdateInterval = 0.1f;
 
+	/** 1フレームの収集の予算（マイクロ秒） */
+	float CollectBudgetMicroseconds = 1000.0f;
+
+	/** この距離（cm）以内のアクターはカメラの近くとして優先 */
+	float NearCameraDistance = 3000.0f;
+
+	/** 内容が変わってからこの秒数の間は優先 */
+	float RecentChangeWindow = 1.0f;
+
+	/** 優先して収集するアクター */
+	TWeakObjectPtr<AActor> FocusActor;
+
+	/** 優先度の低い監視対象のラウンドロビン位置（WatchedActorsのインデックス） */
+	int32 RoundRobinCursor = 0;
+
+	/** 今回のフレームで期限の来た優先度の高い監視対象（確保を使い回す） */
+	TArray<TPair<AActor*, FWatchState*>> DueHighPriority;
+
+	/** 直前のフレームの収集の統計 */
+	int32 LastCollectedActorCount = 0;
+	float LastCollectMicroseconds = 0.0f;
+
 	/** 前回更新からの経過時間 */
 	float TimeSinceLastUpdate = 0.0f;
 
 	/** 有効フラグ */
 	bool bIsEnabled = true;
 
+	/** イベント駆動の収集フラグ */
+	bool bEventDrivenCollection = true;
+
+	/** イベント駆動の収集で全て読み直す間隔（秒、レベル・入力など通知の無い変更の取りこぼし対策） */
+	float EventResyncInterval = 5.0f;
+
+	/** 履歴 */
+	FInsightHistoryRecorder HistoryRecorder;
+
+	/** 履歴の記録フラグ */
+	bool bRecordHistory = true;
+
+	/** サーバーからの配信フラグ */
+	bool bServerStreaming = false;
+
+	/** 配信の設定（生成するレプリケーターへ適用） */
+	FInsightReplicationSettings ReplicationSettings;
+
+	/** サーバー: クライアントごとのレプリケーター */
+	TMap<TWeakObjectPtr<APlayerController>, TWeakObjectPtr<AInsightReplicator>> ServerReplicators;
+
+	/** サーバー: クライアントが監視中のアクターの参照数 */
+	TMap<TWeakObjectPtr<AActor>, int32> RemoteInterestCounts;
+
+	/** サーバー: クライアントの監視のためだけに追加した監視対象（参照が無くなれば解除） */
+	TSet<TWeakObjectPtr<AActor>> RemoteOnlyWatches;
+
+	/** サーバー: クライアントごとの選択中のアクター */
+	TMap<TWeakObjectPtr<const AInsightReplicator>, TWeakObjectPtr<AActor>> RemoteFocusActors;
+
+	/** クライアント: 受信用のレプリケーター */
+	TWeakObjectPtr<AInsightReplicator> ClientReplicator;
+
 	// ========== データ収集メソッド ==========
+	// 収集はゲームスレッドでエンジン側の値を読み取るだけに留め、文字列化は FormatActorInsight でワーカースレッドに分散する
+
+	/**
+	 * 今回のフレームで収集する監視対象を選んで収集
+	 * 選択中のアクター → 画面内・カメラの近く・最近変化したアクター（前回の収集が古い順）→ 残りをラウンドロビン、の順に予算まで
+	 */
+	void ScheduleCollection();
+
+	/** 1体を収集し、変わった場合は整形待ちに積む */
+	void CollectScheduled(AActor* Actor, FWatchState& State, double Now);
 
 	/**
-	 * アクターの全デバッグ情報を収集
+	 * アクターのデバッグ情報を収集（変わったセクションのみ、ゲームスレッド）
+	 * @return 内容が変わったか（trueの場合はFormatActorInsightが必要）
 	 */
-	FActorInsightData CollectActorInsight(AActor* Actor);
+	bool CollectActorInsight(AActor* Actor, FWatchState& State);
+
+	/**
+	 * 収集した値を文字列化してサマリーを生成（任意のスレッド、UObjectには触れない）
+	 */
+	static void FormatActorInsight(FWatchState& State);
+
+	/** ブラックボードの値を文字列化 */
+	static FString FormatBlackboardValue(const FGatheredBlackboardValue& Value);
+
+	/** ブラックボードの値を読み取る */
+	static void GatherBlackboardValue(const UBlackboardComponent& BBC, FBlackboard::FKey KeyID, FGatheredBlackboardValue& OutValue);
 
 	/**
 	 * 基本状態を収集
 	 */
-	FActorDebugState CollectBasicState(AActor* Actor);
+	bool CollectBasicState(AActor* Actor, FWatchState& State);
 
 	/**
 	 * Gameplay Ability System 情報を収集
 	 */
-	void CollectAbilitySystemData(UAbilitySystemComponent* ASC, FActorInsightData& OutData);
+	bool CollectAbilitySystemData(UAbilitySystemComponent* ASC, FWatchState& State);
 
 	/**
 	 * Animation 情報を収集
 	 */
-	void CollectAnimationData(USkeletalMeshComponent* SkelMesh, FActorInsightData& OutData);
+	bool CollectAnimationData(USkeletalMeshComponent* SkelMesh, FWatchState& State);
 
 	/**
 	 * AI (Behavior Tree) 情報を収集
 	 */
-	void CollectBehaviorTreeData(UBehaviorTreeComponent* BTC, FActorInsightData& OutData);
+	bool CollectBehaviorTreeData(UBehaviorTreeComponent* BTC, FWatchState& State);
 
 	/**
-	 * Blackboard 情報を収集
+	 * Blackboard 情報を収集（変更通知のあったキーのみ）
 	 */
-	void CollectBlackboardData(UBlackboardComponent* BBC, FActorInsightData& OutData);
+	bool CollectBlackboardData(UBlackboardComponent* BBC, FWatchState& State);
 
 	/**
 	 * Tick 統計情報を収集
 	 */
-	void CollectTickData(AActor* Actor, FActorInsightData& OutData);
+	bool CollectTickData(AActor* Actor, FWatchState& State);
 
-	/**
-	 * 人間向けサマリーを生成
-	 */
-	FString GenerateHumanReadableSummary(const FActorInsightData& Data);
+	/** ASC・AnimInstanceの変更通知を登録（対象が変わった場合のみ登録し直す） */
+	void UpdateEventBindings(AActor* Actor, UAbilitySystemComponent* ASC, UAnimInstance* AnimInstance, FWatchState& State);
+
+	/** ASC・AnimInstanceの変更通知を解除 */
+	void StopObservingEvents(FWatchState& State);
+
+	/** ASCの変更通知 */
+	void OnAbilityActivated(UGameplayAbility* Ability, TWeakObjectPtr<AActor> Actor);
+	void OnAbilityEnded(const FAbilityEndedData& EndedData, TWeakObjectPtr<AActor> Actor);
+	void OnGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle, TWeakObjectPtr<AActor> Actor);
+	void OnGameplayEffectRemoved(const FActiveGameplayEffect& Effect, TWeakObjectPtr<AActor> Actor);
+	void OnGameplayTagChanged(const FGameplayTag Tag, int32 NewCount, TWeakObjectPtr<AActor> Actor);
+
+	/** ブラックボードの変更通知 */
+	EBlackboardNotificationResult OnBlackboardKeyChanged(const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID);
+
+	/** ブラックボードの変更通知を解除 */
+	void StopObservingBlackboard(FWatchState& State);
 
 	/**
 	 * 無効になったアクターをクリーンアップ
 	 */
 	void CleanupInvalidActors();
+
+	/** サーバー: 接続中のクライアントに合わせてレプリケーターを生成・破棄 */
+	void UpdateServerReplicators();
+
+	/** サーバー: 全てのレプリケーターを破棄 */
+	void DestroyServerReplicators();
+
+	/** クライアントで選択中のアクターか */
+	bool IsRemoteFocus(const TWeakObjectPtr<AActor>& Actor) const;
 };
@@ -363,7 +363,17 @@ struct UNIFIEDEBUGPANEL_API FActorInsightData
 	UPROPERTY(BlueprintReadOnly, Category = "Debug")
 	FString HumanReadableSummary;
 
-	/** 最終更新時間 */
+	/** 最終更新時間（内容が変わった時刻） */
 	UPROPERTY(BlueprintReadOnly, Category = "Debug")
 	float LastUpdateTime = 0.0f;
+
+	/** 内容が変わるたびに増える番号（同じアクターで値が同じなら内容も同じ） */
+	UPROPERTY(BlueprintReadOnly, Category = "Debug")
+	int32 Revision = 0;
 };
+
+/**
+ * 共有される不変のInsightデータ
+ * 内容が変わった時のみ新しいスナップショットに置き換わるため、参照を保持したまま読み続けられる
+ */
+using FActorInsightSnapshot = TSharedPtr<const FActorInsightData, ESPMode::ThreadSafe>;
@@ -0,0 +1,42 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "DebugMontageEventListener.generated.h"
+
+class UAnimInstance;
+class UAnimMontage;
+class UDebugDataCollectorSubsystem;
+
+/**
+ * モンタージュの開始・終了通知の受け口
+ * AnimInstanceの通知は動的デリゲートのため、監視対象ごとにこのオブジェクトを作ってアクターを結び付ける
+ */
+UCLASS(Transient)
+class UNIFIEDEBUGPANEL_API UDebugMontageEventListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** 通知の登録 */
+	void Bind(UDebugDataCollectorSubsystem* InSubsystem, AActor* InActor, UAnimInstance* InAnimInstance);
+
+	/** 通知の解除 */
+	void Unbind();
+
+	/** 登録先のAnimInstance */
+	UAnimInstance* GetAnimInstance() const { return AnimInstance.Get(); }
+
+private:
+	UFUNCTION()
+	void HandleMontageStarted(UAnimMontage* Montage);
+
+	UFUNCTION()
+	void HandleMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	TWeakObjectPtr<UDebugDataCollectorSubsystem> Subsystem;
+	TWeakObjectPtr<AActor> Actor;
+	TWeakObjectPtr<UAnimInstance> AnimInstance;
+};
@@ -0,0 +1,263 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugDataTypes.h"
+
+/**
+ * 履歴記録の設定
+ * 既定値は100アクターを10Hzで5分間記録できる量（1フレーム平均200バイト程度）
+ */
+struct UNIFIEDEBUGPANEL_API FInsightHistorySettings
+{
+	/** フレームに使う最大メモリ（全アクター合計） */
+	int64 MemoryBudgetBytes = 64 * 1024 * 1024;
+
+	/** 記録する最大アクター数（超えた分は記録を終えたアクターの枠を再利用し、空きが無ければ記録しない） */
+	int32 MaxActors = 100;
+
+	/** チャンクの大きさ（各チャンクはキーフレームから始まる） */
+	int32 ChunkSizeBytes = 16 * 1024;
+
+	/** 文字列テーブルの最大メモリ（名前のみ登録、超えた後の新しい名前は空文字として記録） */
+	int64 StringTableBudgetBytes = 4 * 1024 * 1024;
+
+	/** アクターあたりのチャンク数 */
+	int32 GetChunksPerActor() const;
+};
+
+/**
+ * 監視対象アクターのInsight履歴
+ * アクターごとに固定数のチャンクを持つリングバッファへ、差分エンコードしたフレームを記録する
+ * - チャンクの先頭は全セクションを含むキーフレーム、以降は直前のフレームから変わったセクションのみ書き込む
+ * - 名前（アビリティ・エフェクト・モンタージュ・BTノード・ブラックボードのキー）は文字列テーブル、GameplayTagはタグテーブルへ登録してインデックスで保持する
+ * - 変わり続けるブラックボードの値はテーブルへ登録せずチャンクへそのまま書く（アクターごとのチャンクの上限に収まる）
+ * - 監視を外れた・破棄されたアクターの履歴は残し、枠が足りなくなったら最も古い記録から再利用する
+ * - チャンクが埋まると次のチャンクへ移り、全て使い切ると最古のチャンクを上書きする（確保はチャンク数まで）
+ * - 記録するのは保持タグ・名前・数値のみ（アビリティ・エフェクトのタグ、ティック情報は記録しない）
+ * ゲームスレッド専用
+ */
+class UNIFIEDEBUGPANEL_API FInsightHistoryRecorder
+{
+public:
+	explicit FInsightHistoryRecorder(const FInsightHistorySettings& InSettings = FInsightHistorySettings());
+
+	/** 設定を変更（記録済みの履歴は破棄） */
+	void Configure(const FInsightHistorySettings& InSettings);
+
+	/** 設定 */
+	const FInsightHistorySettings& GetSettings() const { return Settings; }
+
+	/** スナップショットを1フレームとして記録（時刻はLastUpdateTime） */
+	void Record(const FActorInsightData& Data);
+
+	/** アクターの記録を終える（監視を外した・破棄された時、履歴は枠が再利用されるまで残る） */
+	void StopRecording(const TWeakObjectPtr<AActor>& Actor);
+
+	/** 全アクターの保持範囲（記録が無ければfalse） */
+	bool GetTimeRange(float& OutOldest, float& OutNewest) const;
+
+	/**
+	 * 指定時刻の状態を復元（その時刻以前の最後のフレーム）
+	 * @return 指定時刻の時点で記録があったか
+	 */
+	bool Reconstruct(const TWeakObjectPtr<AActor>& Actor, float Time, FActorInsightData& OutData) const;
+
+	/** 全て破棄 */
+	void Reset();
+
+	/** 確保済みメモリ（チャンクと文字列テーブル） */
+	int64 GetAllocatedBytes() const;
+
+	/** 記録済みのフレーム数（上書きされた分を除く） */
+	int32 GetNumFrames() const;
+
+	/** バイナリファイルへ書き出し（チャンクはそのまま、古い順） */
+	bool SaveToFile(const FString& FilePath) const;
+
+private:
+	/** 記録するセクション */
+	enum ESection : uint8
+	{
+		Section_Basic = 1 << 0,
+		Section_Abilities = 1 << 1,
+		Section_Effects = 1 << 2,
+		Section_Montage = 1 << 3,
+		Section_Tree = 1 << 4,
+		Section_Blackboard = 1 << 5,
+		Section_Tags = 1 << 6,
+		Section_All = 0x7F
+	};
+
+	/** フレーム（文字列・タグはテーブルのインデックス、INDEX_NONEは空） */
+	struct FFrame
+	{
+		struct FAbility
+		{
+			int32 NameId = INDEX_NONE;
+			int32 Level = 0;
+			float CooldownRemaining = 0.0f;
+			uint8 Flags = 0;
+
+			bool operator==(const FAbility& Other) const
+			{
+				return NameId == Other.NameId && Level == Other.Level && CooldownRemaining == Other.CooldownRemaining && Flags == Other.Flags;
+			}
+		};
+
+		struct FEffect
+		{
+			int32 NameId = INDEX_NONE;
+			int32 InstigatorId = INDEX_NONE;
+			int32 StackCount = 0;
+			float RemainingTime = 0.0f;
+
+			bool operator==(const FEffect& Other) const
+			{
+				return NameId == Other.NameId && InstigatorId == Other.InstigatorId && StackCount == Other.StackCount && RemainingTime == Other.RemainingTime;
+			}
+		};
+
+		struct FMontage
+		{
+			int32 NameId = INDEX_NONE;
+			int32 SectionId = INDEX_NONE;
+			float Position = 0.0f;
+			float PlayRate = 0.0f;
+			float RemainingTime = 0.0f;
+			bool bIsBlendingOut = false;
+
+			bool operator==(const FMontage& Other) const
+			{
+				return NameId == Other.NameId && SectionId == Other.SectionId && Position == Other.Position
+					&& PlayRate == Other.PlayRate && RemainingTime == Other.RemainingTime && bIsBlendingOut == Other.bIsBlendingOut;
+			}
+		};
+
+		struct FTree
+		{
+			int32 TreeNameId = INDEX_NONE;
+			int32 NodeNameId = INDEX_NONE;
+			bool bIsRunning = false;
+
+			bool operator==(const FTree& Other) const
+			{
+				return TreeNameId == Other.TreeNameId && NodeNameId == Other.NodeNameId && bIsRunning == Other.bIsRunning;
+			}
+		};
+
+		float Time = 0.0f;
+		int32 Revision = 0;
+
+		/** 基本状態 */
+		FVector3f Location = FVector3f::ZeroVector;
+		FRotator3f Rotation = FRotator3f::ZeroRotator;
+		FVector3f Velocity = FVector3f::ZeroVector;
+		uint8 StateFlags = 0;
+
+		TArray<FAbility> Abilities;
+		TArray<FEffect> Effects;
+		FMontage Montage;
+		FTree Tree;
+
+		/** ブラックボード（キー名のインデックス, 値） */
+		TArray<TPair<int32, FString>> Blackboard;
+
+		/** 保持タグのインデックス */
+		TArray<int32> Tags;
+	};
+
+	/** チャンク（固定サイズのバッファ） */
+	struct FChunk
+	{
+		TArray<uint8> Bytes;
+		int32 UsedBytes = 0;
+		int32 NumFrames = 0;
+		float StartTime = 0.0f;
+		float EndTime = 0.0f;
+	};
+
+	/** アクターごとの履歴 */
+	struct FActorHistory
+	{
+		/** 記録中のアクター（枠を再利用する時に索引から外す） */
+		TWeakObjectPtr<AActor> Actor;
+
+		/** 記録を終えたか（枠の再利用の対象） */
+		bool bStopped = false;
+
+		FString ActorName;
+		FString ClassName;
+
+		/** チャンクのリング（確保は設定のチャンク数まで） */
+		TArray<FChunk> Chunks;
+		int32 OldestChunk = 0;
+		int32 NumChunks = 0;
+
+		/** 最後に記録したフレーム（差分の基準） */
+		FFrame LastFrame;
+		bool bHasLastFrame = false;
+
+		/** リング内のチャンク（0が最古） */
+		const FChunk& GetChunk(int32 Index) const { return Chunks[(OldestChunk + Index) % Chunks.Num()]; }
+	};
+
+	/** スナップショットからフレームを作る（文字列・タグを登録） */
+	void BuildFrame(const FActorInsightData& Data, FFrame& OutFrame);
+
+	/** フレームを復元 */
+	void ToInsightData(const FActorHistory& History, const FFrame& Frame, FActorInsightData& OutData) const;
+
+	/** 前のフレームから変わったセクション */
+	static uint8 GetChangedSections(const FFrame& Frame, const FFrame& Previous);
+
+	/** フレームを書き込む（指定セクションのみ） */
+	static void EncodeFrame(FArchive& Ar, const FFrame& Frame, uint8 Sections, float ChunkStartTime);
+
+	/**
+	 * フレームを読み込む（含まれないセクションは直前の値のまま）
+	 * @return MaxTimeより後のフレームの場合はfalse（本体は読まない）
+	 */
+	static bool DecodeFrame(FArchive& Ar, FFrame& InOutFrame, float ChunkStartTime, float MaxTime);
+
+	/** 新しいアクターの枠を確保（上限に達していれば記録を終えたアクターのうち最も古い枠を再利用、無ければINDEX_NONE） */
+	int32 AllocateHistory(const FActorInsightData& Data);
+
+	/** 新しいチャンクへ移る（全て使用中なら最古を上書き） */
+	FChunk& AdvanceChunk(FActorHistory& History);
+
+	/** 文字列を登録 */
+	int32 InternString(const FString& Value);
+
+	/** タグを登録 */
+	int32 InternTag(const FGameplayTag& Tag);
+
+	/** 登録済みの文字列（INDEX_NONEは空） */
+	const FString& GetString(int32 Id) const;
+
+	/** 設定 */
+	FInsightHistorySettings Settings;
+
+	/** アクター → 履歴のインデックス */
+	TMap<TWeakObjectPtr<AActor>, int32> HistoryIndices;
+
+	/** アクターごとの履歴 */
+	TArray<FActorHistory> Histories;
+
+	/** 文字列テーブル */
+	TMap<FString, int32> StringIds;
+	TArray<FString> Strings;
+	int64 StringTableBytes = 0;
+
+	/** タグテーブル */
+	TMap<FGameplayTag, int32> TagIds;
+	TArray<FGameplayTag> Tags;
+
+	/** エンコード用の作業バッファ */
+	TArray<uint8> ScratchBuffer;
+
+	/** 上限超過を一度だけ警告するためのフラグ */
+	bool bWarnedActorLimit = false;
+	bool bWarnedStringBudget = false;
+};
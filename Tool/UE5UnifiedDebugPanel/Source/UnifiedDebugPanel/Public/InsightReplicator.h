@@ -0,0 +1,199 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "DebugDataTypes.h"
+#include "InsightReplicator.generated.h"
+
+class APlayerController;
+class UDebugDataCollectorSubsystem;
+
+/**
+ * サーバーで収集したInsightデータのクライアントへの配信設定
+ */
+struct UNIFIEDEBUGPANEL_API FInsightReplicationSettings
+{
+	/** クライアントごとの送信量の上限（バイト/秒） */
+	int32 MaxBytesPerSecond = 16 * 1024;
+
+	/** 1パケットの最大サイズ（超える1体分は単独で送る） */
+	int32 MaxPacketBytes = 1024;
+
+	/** この大きさを超えるパケットは圧縮する */
+	int32 CompressionThresholdBytes = 256;
+};
+
+/**
+ * クライアント側のパケット番号と全体の再送要求の状態
+ * 欠落を検出したら全体の再送が必要になり、再送の開始を示すパケットを受信するまで続く
+ * 再送の開始を示すパケット自体も欠落しうるため、一定時間届かなければ要求し直す
+ */
+struct UNIFIEDEBUGPANEL_API FInsightSyncTracker
+{
+	/** 再送の開始が届かない場合に要求し直すまでの時間（秒） */
+	double FullSyncRetrySeconds = 1.0;
+
+	/**
+	 * 受信したパケットを記録
+	 * @return 順序が入れ替わった古いパケットならfalse（捨てる）
+	 */
+	bool ReceivePacket(uint32 Sequence, bool bFullSync);
+
+	/** 全体の再送を要求すべきか（trueを返したら要求したものとして記録する） */
+	bool ConsumeFullSyncRequest(double Now);
+
+	/** 全体の再送が必要か */
+	bool NeedsFullSync() const { return bNeedsFullSync; }
+
+private:
+	/** 最後に受信したパケット番号 */
+	uint32 LastReceivedSequence = 0;
+
+	/** 欠落を検出してから再送の開始を受信していないか */
+	bool bNeedsFullSync = false;
+
+	/** 最後に再送を要求した時刻（未要求は負） */
+	double LastRequestTime = -1.0;
+};
+
+/**
+ * Insightデータのレプリケーター
+ * サーバーが接続中のプレイヤーコントローラーごとに生成し、そのクライアントにのみ関連させる（ゲームの通信より低い優先度）
+ * - クライアントは監視中のアクターと選択中のアクターをサーバーへ伝え、サーバーはそれらを収集対象に加える
+ * - サーバーはアクターごと・セクションごとに前回送った内容のハッシュを持ち、変わったセクションのみ信頼性なしのRPCで送る
+ * - クライアントへ関連しない（ネットワーク上で見えない）アクターは送らない
+ * - 送信量はトークンバケットで上限を守り、入りきらないアクターは次の機会に回す（選択中 → 送信が古い順）
+ * - パケットの欠落を検出したクライアントは全体の再送を要求する（再送の開始が届かなければ要求し直す）
+ */
+UCLASS(NotPlaceable, Transient)
+class UNIFIEDEBUGPANEL_API AInsightReplicator : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AInsightReplicator();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// ========== サーバー ==========
+
+	/** 変わったセクションを送信（サーバーのティックから呼ぶ） */
+	void SendUpdates(float DeltaTime, const UDebugDataCollectorSubsystem& Collector);
+
+	/** 配信設定 */
+	FInsightReplicationSettings Settings;
+
+	/** 直近1秒の送信量（バイト） */
+	int32 GetBytesSentLastSecond() const { return BytesSentLastSecond; }
+
+	// ========== クライアント ==========
+
+	/** 監視対象をサーバーへ伝える（変わった場合のみ送信） */
+	void UpdateInterest(const TArray<AActor*>& Actors, AActor* FocusActor);
+
+	/** サーバーの状態（受信していなければnullptr） */
+	FActorInsightSnapshot GetServerSnapshot(AActor* Actor) const;
+
+	/** 受信済みのサーバーの状態（アクターはクライアント側の参照） */
+	void GetAllServerSnapshots(TArray<FActorInsightSnapshot>& OutSnapshots) const;
+
+	/** サーバーの状態を受信済みのアクター数 */
+	int32 GetNumServerSnapshots() const { return ServerSnapshots.Num(); }
+
+protected:
+	/** クライアント → サーバー: 監視対象と選択中のアクター */
+	UFUNCTION(Server, Reliable)
+	void ServerSetInterest(const TArray<AActor*>& Actors, AActor* FocusActor);
+
+	/** クライアント → サーバー: 全セクションの再送要求（パケットの欠落時） */
+	UFUNCTION(Server, Reliable)
+	void ServerRequestFullSync();
+
+	/** サーバー → クライアント: 差分パケット（Actorsはパケット内の各エントリのアクター、同じ順序） */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceivePacket(uint32 Sequence, const TArray<AActor*>& Actors, const TArray<uint8>& Payload);
+
+private:
+	/** 送信するセクション */
+	enum ESection : uint8
+	{
+		Section_Basic,
+		Section_Abilities,
+		Section_Effects,
+		Section_Animation,
+		Section_BehaviorTree,
+		Section_Blackboard,
+		Section_Tick,
+		Section_Tasks,
+		Section_Tags,
+		Section_Summary,
+		Section_Num
+	};
+
+	/** サーバー: クライアントへ送った内容 */
+	struct FSentActorState
+	{
+		uint32 SectionHashes[Section_Num] = {};
+		int32 Revision = INDEX_NONE;
+		double LastSentTime = 0.0;
+	};
+
+	/** セクションの読み書き */
+	static void SerializeSection(FArchive& Ar, FActorInsightData& Data, int32 Section);
+
+	/** 1体分の変わったセクションをEntryBufferへ書き込み、送信済みの内容を更新（送るセクションが無ければfalse） */
+	bool WriteActorEntry(const FActorInsightData& Data, FSentActorState& Sent);
+
+	/** パケットを送信（圧縮・送信量の計上を含む） */
+	void SendPacket(const TArray<AActor*>& Actors, int32 NumEntries, const TArray<uint8>& Body);
+
+	/** 所有するクライアントに関連するアクターか（ネットワーク上で見えるか） */
+	bool IsRelevantToOwner(const AActor& Actor) const;
+
+	/** 対象の収集サブシステム */
+	UDebugDataCollectorSubsystem* GetCollector() const;
+
+	/** サーバー: このクライアントの監視対象をサブシステムから外す */
+	void ReleaseInterest();
+
+	/** サーバー: クライアントの監視対象・選択中のアクター */
+	TArray<TWeakObjectPtr<AActor>> Interest;
+	TWeakObjectPtr<AActor> InterestFocus;
+
+	/** サーバー: アクターごとの送信済みの内容 */
+	TMap<TWeakObjectPtr<AActor>, FSentActorState> SentStates;
+
+	/** サーバー: 送信可能なバイト数（トークンバケット） */
+	float SendTokens = 0.0f;
+
+	/** サーバー: 次のパケット番号 */
+	uint32 NextSequence = 1;
+
+	/** サーバー: 全セクションの再送中か（次のパケットに再送の開始を示す） */
+	bool bFullSyncPending = false;
+
+	/** サーバー: 送信量の計測 */
+	double BytesWindowStart = 0.0;
+	int32 BytesSentInWindow = 0;
+	int32 BytesSentLastSecond = 0;
+
+	/** クライアント: 最後に送った監視対象のハッシュ */
+	uint32 LastInterestHash = 0;
+
+	/** クライアント: 受信したパケット番号と再送要求の状態 */
+	FInsightSyncTracker SyncTracker;
+
+	/** クライアント: 必要なら全体の再送を要求 */
+	void RequestFullSyncIfNeeded();
+
+	/** クライアント: 受信したサーバーの状態 */
+	TMap<TWeakObjectPtr<AActor>, FActorInsightSnapshot> ServerSnapshots;
+
+	/** エンコード用の作業バッファ */
+	TArray<uint8> PacketBody;
+	TArray<uint8> EntryBuffer;
+	TArray<uint8> SectionBuffer;
+};
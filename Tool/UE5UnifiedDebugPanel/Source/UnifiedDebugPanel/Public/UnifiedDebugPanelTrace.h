@@ -0,0 +1,53 @@
+// Copyright DevTools. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+/** トレース出力の有無（Shipping以外で有効） */
+#if !defined(UNIFIED_DEBUG_PANEL_TRACE_ENABLED)
+#define UNIFIED_DEBUG_PANEL_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if UNIFIED_DEBUG_PANEL_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(UnifiedDebugPanelChannel, UNIFIEDEBUGPANEL_API);
+
+/** チャンネルが有効か（無効な間は差分の検出も含めて何もしない） */
+#define UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(UnifiedDebugPanelChannel)
+#else
+#define UNIFIED_DEBUG_PANEL_TRACE_IS_ENABLED() false
+#endif
+
+/**
+ * Insightsへ出力する監視対象のイベント
+ */
+enum class EInsightTraceEvent : uint8
+{
+	AbilityActivated,
+	AbilityEnded,
+	EffectApplied,
+	EffectRemoved,
+	MontageStarted,
+	MontageStopped,
+	BehaviorTreeTaskChanged
+};
+
+/**
+ * 統合デバッグパネルのトレース出力
+ * -trace=UnifiedDebugPanel（または Trace.Enable UnifiedDebugPanel）で有効化する
+ * - UnifiedDebugPanel.ActorInfo: アクターID（GetUniqueID）と名前の対応（監視開始時に1回）
+ * - UnifiedDebugPanel.InsightEvent: サイクル・アクターID・種類・名前
+ * 同じ内容をブックマークとしても出力するため、Timing Viewのフレームと並べて確認できる
+ */
+namespace UnifiedDebugPanelTrace
+{
+	/** アクターIDと名前の対応を出力 */
+	UNIFIEDEBUGPANEL_API void OutputActor(const AActor& Actor);
+
+	/** イベントを出力 */
+	UNIFIEDEBUGPANEL_API void OutputEvent(const AActor& Actor, EInsightTraceEvent Type, const TCHAR* Name);
+
+	/** イベントの表示名 */
+	UNIFIEDEBUGPANEL_API const TCHAR* GetEventName(EInsightTraceEvent Type);
+}
@@ -11,7 +11,11 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSlider.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/SOverlay.h"
 #include "Widgets/SBoxPanel.h"
 #include "Styling/SlateTypes.h"
 #include "Styling/CoreStyle.h"
@@ -22,6 +26,34 @@
 
 #define LOCTEXT_NAMESPACE "UnifiedDebugPanel"
 
+namespace UnifiedDebugPanelEditor
+{
+	/** PIEのサーバーのワールドでクライアントへの配信を有効/無効化 */
+	static void SetPIEServerStreaming(bool bEnable)
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType != EWorldType::PIE || !World)
+			{
+				continue;
+			}
+
+			const ENetMode NetMode = World->GetNetMode();
+			if (NetMode != NM_ListenServer && NetMode != NM_DedicatedServer)
+			{
+				continue;
+			}
+
+			UDebugDataCollectorSubsystem* Subsystem = World->GetSubsystem<UDebugDataCollectorSubsystem>();
+			if (Subsystem && Subsystem->IsServerStreamingEnabled() != bEnable)
+			{
+				Subsystem->SetServerStreamingEnabled(bEnable);
+			}
+		}
+	}
+}
+
 void SUnifiedDebugPanel::Construct(const FArguments& InArgs)
 {
 	ChildSlot
@@ -49,40 +81,112 @@ void SUnifiedDebugPanel::Tick(const FGeometry& AllottedGeometry, const double In
 	// データ更新
 	if (UDebugDataCollectorSubsystem* Subsystem = GetDebugSubsystem())
 	{
-		CachedInsightData = Subsystem->GetAllInsightData();
+		Subsystem->GetAllInsightSnapshots(CachedInsightData);
+		RefreshActorItems();
 
-		// UIを再構築
-		if (ActorListContainer.IsValid())
+		if (!Subsystem->GetHistoryTimeRange(TimelineOldest, TimelineNewest))
 		{
-			ActorListContainer->ClearChildren();
+			TimelineOldest = TimelineNewest = 0.0f;
+		}
 
-			if (CachedInsightData.Num() == 0)
-			{
-				ActorListContainer->AddSlot()
-				.AutoHeight()
-				.Padding(10.0f)
-				[
-					SNew(STextBlock)
-					.Text(LOCTEXT("NoWatchedActors", "監視対象がありません。\n「Watch Player」ボタンでプレイヤーを追加するか、\nBlueprintからWatchActorを呼び出してください。"))
-					.ColorAndOpacity(FLinearColor::Gray)
-				];
-			}
-			else
+		// サーバー比較中はPIEを開始し直しても配信を続け、選択中のアクターの新しい状態を受信したら作り直す
+		if (bCompareWithServer && bTimelineLive)
+		{
+			UnifiedDebugPanelEditor::SetPIEServerStreaming(true);
+
+			const FActorInsightSnapshot ServerSnapshot = Subsystem->GetServerInsightSnapshot(SelectedActor.Get());
+			if ((ServerSnapshot.IsValid() ? ServerSnapshot->Revision : INDEX_NONE) != DisplayedServerRevision)
 			{
-				for (const FActorInsightData& Data : CachedInsightData)
-				{
-					ActorListContainer->AddSlot()
-					.AutoHeight()
-					.Padding(2.0f)
-					[
-						CreateActorInsightWidget(Data)
-					];
-				}
+				RefreshDetailPanel();
 			}
 		}
 	}
 }
 
+void FUnifiedDebugActorItem::Update(const FActorInsightData& Data)
+{
+	if (Data.Revision == Revision)
+	{
+		return;
+	}
+	Revision = Data.Revision;
+
+	// テキストは元の文字列が変わった時のみ作り直す（バインド先の比較で変化なしと判定させる）
+	const FString NewName = Data.Actor.IsValid() ? Data.BasicState.ActorName : FString(TEXT("Invalid"));
+	if (!ActorNameSource.Equals(NewName, ESearchCase::CaseSensitive))
+	{
+		ActorNameSource = NewName;
+		ActorName = FText::FromString(ActorNameSource);
+	}
+
+	if (!SummarySource.Equals(Data.HumanReadableSummary, ESearchCase::CaseSensitive))
+	{
+		SummarySource = Data.HumanReadableSummary;
+		Summary = FText::FromString(SummarySource);
+	}
+
+	bIsActive = Data.BasicState.bIsActive;
+
+	if (AbilityCount != Data.ActiveAbilities.Num())
+	{
+		AbilityCount = Data.ActiveAbilities.Num();
+		AbilityText = FText::FromString(FString::Printf(TEXT("Abilities: %d"), AbilityCount));
+	}
+
+	if (EffectCount != Data.ActiveEffects.Num())
+	{
+		EffectCount = Data.ActiveEffects.Num();
+		EffectText = FText::FromString(FString::Printf(TEXT("Effects: %d"), EffectCount));
+	}
+
+	if (MontageCount != Data.ActiveMontages.Num())
+	{
+		MontageCount = Data.ActiveMontages.Num();
+		MontageText = FText::FromString(FString::Printf(TEXT("Montages: %d"), MontageCount));
+	}
+}
+
+void SUnifiedDebugPanel::RefreshActorItems()
+{
+	bool bMembershipChanged = false;
+
+	// 既存の行データを更新し、新しいアクターの分を末尾に追加
+	TSet<TWeakObjectPtr<AActor>> CurrentActors;
+	CurrentActors.Reserve(CachedInsightData.Num());
+	for (const FActorInsightSnapshot& Snapshot : CachedInsightData)
+	{
+		const FActorInsightData& Data = *Snapshot;
+		CurrentActors.Add(Data.Actor);
+
+		TSharedPtr<FUnifiedDebugActorItem>& Item = ActorItemsByActor.FindOrAdd(Data.Actor);
+		if (!Item.IsValid())
+		{
+			Item = MakeShared<FUnifiedDebugActorItem>();
+			Item->Actor = Data.Actor;
+			ActorItems.Add(Item);
+			bMembershipChanged = true;
+		}
+		Item->Update(Data);
+	}
+
+	// 監視が外れたアクターの行を削除
+	for (int32 i = ActorItems.Num() - 1; i >= 0; --i)
+	{
+		if (!CurrentActors.Contains(ActorItems[i]->Actor))
+		{
+			ActorItemsByActor.Remove(ActorItems[i]->Actor);
+			ActorItems.RemoveAt(i);
+			bMembershipChanged = true;
+		}
+	}
+
+	// 行の追加・削除がある場合のみリストを再生成（値の変化は行の属性バインディングで反映）
+	if (bMembershipChanged && ActorListView.IsValid())
+	{
+		ActorListView->RequestListRefresh();
+	}
+}
+
 TSharedRef<SWidget> SUnifiedDebugPanel::BuildMainLayout()
 {
 	return SNew(SVerticalBox)
@@ -128,10 +232,22 @@ TSharedRef<SWidget> SUnifiedDebugPanel::BuildMainLayout()
 					+ SVerticalBox::Slot()
 					.FillHeight(1.0f)
 					[
-						SNew(SScrollBox)
-						+ SScrollBox::Slot()
+						SNew(SOverlay)
+						+ SOverlay::Slot()
+						[
+							SAssignNew(ActorListView, SListView<TSharedPtr<FUnifiedDebugActorItem>>)
+							.ListItemsSource(&ActorItems)
+							.SelectionMode(ESelectionMode::Single)
+							.OnGenerateRow(this, &SUnifiedDebugPanel::OnGenerateActorRow)
+							.OnSelectionChanged(this, &SUnifiedDebugPanel::OnActorListSelectionChanged)
+						]
+						+ SOverlay::Slot()
+						.Padding(10.0f)
 						[
-							SAssignNew(ActorListContainer, SVerticalBox)
+							SNew(STextBlock)
+							.Text(LOCTEXT("NoWatchedActors", "監視対象がありません。\n「Watch Player」ボタンでプレイヤーを追加するか、\nBlueprintからWatchActorを呼び出してください。"))
+							.ColorAndOpacity(FLinearColor::Gray)
+							.Visibility_Lambda([this]() { return ActorItems.Num() == 0 ? EVisibility::HitTestInvisible : EVisibility::Collapsed; })
 						]
 					]
 				]
@@ -155,6 +271,13 @@ TSharedRef<SWidget> SUnifiedDebugPanel::BuildMainLayout()
 						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 					]
 
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(4.0f)
+					[
+						BuildTimeline()
+					]
+
 					+ SVerticalBox::Slot()
 					.AutoHeight()
 					.Padding(4.0f)
@@ -179,6 +302,59 @@ TSharedRef<SWidget> SUnifiedDebugPanel::BuildMainLayout()
 		];
 }
 
+TSharedRef<SWidget> SUnifiedDebugPanel::BuildTimeline()
+{
+	return SNew(SHorizontalBox)
+		// ライブ表示
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(0.0f, 0.0f, 8.0f, 0.0f)
+		[
+			SNew(SCheckBox)
+			.IsChecked_Lambda([this]() { return bTimelineLive ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged(this, &SUnifiedDebugPanel::OnTimelineLiveChanged)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("TimelineLive", "Live"))
+			]
+		]
+
+		// 履歴のスクラブ
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.VAlign(VAlign_Center)
+		[
+			// 保持範囲は記録とともに動くため、スライダーは0-1で扱い時刻へ換算する
+			SNew(SSlider)
+			.Value_Lambda([this]()
+			{
+				const float Range = TimelineNewest - TimelineOldest;
+				return (bTimelineLive || Range <= 0.0f) ? 1.0f : FMath::Clamp((TimelineTime - TimelineOldest) / Range, 0.0f, 1.0f);
+			})
+			.IsEnabled_Lambda([this]() { return TimelineNewest > TimelineOldest; })
+			.OnValueChanged_Lambda([this](float NewValue)
+			{
+				OnTimelineScrubbed(FMath::Lerp(TimelineOldest, TimelineNewest, NewValue));
+			})
+		]
+
+		// 表示中の時刻
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(8.0f, 0.0f, 0.0f, 0.0f)
+		[
+			SNew(STextBlock)
+			.Text_Lambda([this]()
+			{
+				const float Time = bTimelineLive ? TimelineNewest : TimelineTime;
+				return FText::FromString(FString::Printf(TEXT("%.2fs / %.2fs"), Time, TimelineNewest));
+			})
+			.ColorAndOpacity_Lambda([this]() { return bTimelineLive ? FSlateColor(FLinearColor::Gray) : FSlateColor(FLinearColor::Yellow); })
+		];
+}
+
 TSharedRef<SWidget> SUnifiedDebugPanel::BuildToolbar()
 {
 	return SNew(SHorizontalBox)
@@ -211,6 +387,22 @@ TSharedRef<SWidget> SUnifiedDebugPanel::BuildToolbar()
 			SNullWidget::NullWidget
 		]
 
+		// サーバー比較チェックボックス
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(4.0f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(SCheckBox)
+			.IsChecked_Lambda([this]() { return bCompareWithServer ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged(this, &SUnifiedDebugPanel::OnCompareWithServerChanged)
+			.ToolTipText(LOCTEXT("CompareWithServerTooltip", "PIEのクライアントのワールドを表示し、サーバーで収集した状態を並べて表示"))
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("CompareWithServer", "サーバー比較"))
+			]
+		]
+
 		// 自動更新チェックボックス
 		+ SHorizontalBox::Slot()
 		.AutoWidth()
@@ -237,23 +429,11 @@ TSharedRef<SWidget> SUnifiedDebugPanel::BuildToolbar()
 		];
 }
 
-TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorInsightData& Data)
+TSharedRef<ITableRow> SUnifiedDebugPanel::OnGenerateActorRow(TSharedPtr<FUnifiedDebugActorItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	AActor* Actor = Data.Actor.Get();
-	FString ActorName = Actor ? Actor->GetName() : TEXT("Invalid");
-	bool bIsSelected = (SelectedActor.Get() == Actor);
-
-	// クリック時の選択変更用ラムダ
-	TWeakObjectPtr<AActor> WeakActor = Data.Actor;
-
-	return SNew(SBorder)
-		.BorderImage(bIsSelected ? FAppStyle::GetBrush("DetailsView.CategoryTop") : FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+	// 行は生成時に一度だけ組み立て、表示内容は行データへの属性バインディングで更新する
+	return SNew(STableRow<TSharedPtr<FUnifiedDebugActorItem>>, OwnerTable)
 		.Padding(8.0f)
-		.OnMouseButtonDown_Lambda([this, WeakActor](const FGeometry&, const FPointerEvent&) -> FReply
-		{
-			OnActorSelectionChanged(WeakActor);
-			return FReply::Handled();
-		})
 		[
 			SNew(SVerticalBox)
 			// アクター名とステータス
@@ -265,7 +445,7 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 				.AutoWidth()
 				[
 					SNew(STextBlock)
-					.Text(FText::FromString(ActorName))
+					.Text_Lambda([Item]() { return Item->ActorName; })
 					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 11))
 				]
 
@@ -274,8 +454,8 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 				.Padding(8.0f, 0.0f, 0.0f, 0.0f)
 				[
 					CreateStatusBadge(
-						Data.BasicState.bIsActive ? TEXT("Active") : TEXT("Hidden"),
-						Data.BasicState.bIsActive ? FLinearColor::Green : FLinearColor::Gray
+						TAttribute<FText>::CreateLambda([Item]() { return Item->bIsActive ? LOCTEXT("Active", "Active") : LOCTEXT("Hidden", "Hidden"); }),
+						TAttribute<FLinearColor>::CreateLambda([Item]() { return Item->bIsActive ? FLinearColor::Green : FLinearColor::Gray; })
 					)
 				]
 			]
@@ -286,7 +466,7 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 			.Padding(0.0f, 4.0f, 0.0f, 0.0f)
 			[
 				SNew(STextBlock)
-				.Text(FText::FromString(Data.HumanReadableSummary))
+				.Text_Lambda([Item]() { return Item->Summary; })
 				.AutoWrapText(true)
 				.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f))
 				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 9))
@@ -303,8 +483,8 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 				.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 				[
 					CreateStatusBadge(
-						FString::Printf(TEXT("Abilities: %d"), Data.ActiveAbilities.Num()),
-						Data.ActiveAbilities.Num() > 0 ? FLinearColor(0.2f, 0.6f, 1.0f) : FLinearColor::Gray
+						TAttribute<FText>::CreateLambda([Item]() { return Item->AbilityText; }),
+						TAttribute<FLinearColor>::CreateLambda([Item]() { return Item->AbilityCount > 0 ? FLinearColor(0.2f, 0.6f, 1.0f) : FLinearColor::Gray; })
 					)
 				]
 
@@ -313,8 +493,8 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 				.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 				[
 					CreateStatusBadge(
-						FString::Printf(TEXT("Effects: %d"), Data.ActiveEffects.Num()),
-						Data.ActiveEffects.Num() > 0 ? FLinearColor(0.8f, 0.4f, 1.0f) : FLinearColor::Gray
+						TAttribute<FText>::CreateLambda([Item]() { return Item->EffectText; }),
+						TAttribute<FLinearColor>::CreateLambda([Item]() { return Item->EffectCount > 0 ? FLinearColor(0.8f, 0.4f, 1.0f) : FLinearColor::Gray; })
 					)
 				]
 
@@ -322,8 +502,8 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateActorInsightWidget(const FActorIns
 				.AutoWidth()
 				[
 					CreateStatusBadge(
-						FString::Printf(TEXT("Montages: %d"), Data.ActiveMontages.Num()),
-						Data.ActiveMontages.Num() > 0 ? FLinearColor(1.0f, 0.6f, 0.2f) : FLinearColor::Gray
+						TAttribute<FText>::CreateLambda([Item]() { return Item->MontageText; }),
+						TAttribute<FLinearColor>::CreateLambda([Item]() { return Item->MontageCount > 0 ? FLinearColor(1.0f, 0.6f, 0.2f) : FLinearColor::Gray; })
 					)
 				]
 			]
@@ -688,6 +868,48 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateExpandableSection(const FText& Tit
 		];
 }
 
+TSharedRef<SWidget> SUnifiedDebugPanel::CreateComparisonRow(TSharedRef<SWidget> ClientContent, TSharedRef<SWidget> ServerContent)
+{
+	auto MakeColumn = [](const FText& Label, TSharedRef<SWidget> Content)
+	{
+		return SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+			[
+				SNew(STextBlock)
+				.Text(Label)
+				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 9))
+				.ColorAndOpacity(FLinearColor::Gray)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				Content
+			];
+	};
+
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(0.5f)
+		.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+		[
+			MakeColumn(LOCTEXT("ClientColumn", "クライアント"), ClientContent)
+		]
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		[
+			SNew(SSeparator)
+			.Orientation(Orient_Vertical)
+		]
+		+ SHorizontalBox::Slot()
+		.FillWidth(0.5f)
+		.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+		[
+			MakeColumn(LOCTEXT("ServerColumn", "サーバー"), ServerContent)
+		];
+}
+
 TSharedRef<SWidget> SUnifiedDebugPanel::CreateKeyValueRow(const FString& Key, const FString& Value, FLinearColor ValueColor)
 {
 	return SNew(SHorizontalBox)
@@ -722,6 +944,20 @@ TSharedRef<SWidget> SUnifiedDebugPanel::CreateStatusBadge(const FString& Text, F
 		];
 }
 
+TSharedRef<SWidget> SUnifiedDebugPanel::CreateStatusBadge(TAttribute<FText> Text, TAttribute<FLinearColor> Color)
+{
+	return SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+		.Padding(FMargin(6.0f, 2.0f))
+		.BorderBackgroundColor_Lambda([Color]() { return FSlateColor(Color.Get() * 0.3f); })
+		[
+			SNew(STextBlock)
+			.Text(Text)
+			.ColorAndOpacity_Lambda([Color]() { return FSlateColor(Color.Get()); })
+			.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+		];
+}
+
 TSharedRef<SWidget> SUnifiedDebugPanel::CreateProgressBar(float Progress, const FString& Label)
 {
 	return SNew(SHorizontalBox)
@@ -790,89 +1026,164 @@ void SUnifiedDebugPanel::OnActorSelectionChanged(TWeakObjectPtr<AActor> NewSelec
 {
 	SelectedActor = NewSelection;
 
+	// 選択中のアクターを優先して収集させる
+	if (UDebugDataCollectorSubsystem* Subsystem = GetDebugSubsystem())
+	{
+		Subsystem->SetFocusActor(SelectedActor.Get());
+	}
+
+	RefreshDetailPanel();
+}
+
+void SUnifiedDebugPanel::RefreshDetailPanel()
+{
 	// 詳細パネルを更新
 	if (DetailPanelContainer.IsValid())
 	{
 		DetailPanelContainer->ClearChildren();
 
-		// 選択されたアクターのInsightデータを検索
+		// 選択されたアクターのInsightデータを検索（履歴表示中は指定時刻の状態を復元）
 		const FActorInsightData* SelectedData = nullptr;
-		for (const FActorInsightData& Data : CachedInsightData)
+		FActorInsightData HistoryData;
+		if (bTimelineLive)
 		{
-			if (Data.Actor == SelectedActor)
+			for (const FActorInsightSnapshot& Snapshot : CachedInsightData)
 			{
-				SelectedData = &Data;
-				break;
+				if (Snapshot->Actor == SelectedActor)
+				{
+					SelectedData = Snapshot.Get();
+					break;
+				}
+			}
+		}
+		else if (UDebugDataCollectorSubsystem* Subsystem = GetDebugSubsystem())
+		{
+			if (Subsystem->GetActorInsightAtTime(SelectedActor.Get(), TimelineTime, HistoryData))
+			{
+				SelectedData = &HistoryData;
+			}
+		}
+
+		if (!SelectedData && !bTimelineLive && SelectedActor.IsValid() && SummaryText.IsValid())
+		{
+			SummaryText->SetText(LOCTEXT("NoHistoryAtTime", "この時刻の記録がありません"));
+			SummaryText->SetColorAndOpacity(FLinearColor::Gray);
+		}
+
+		// サーバー比較中はサーバーから受信した状態を右に並べる（ライブ表示のみ）
+		FActorInsightSnapshot ServerSnapshot;
+		if (SelectedData && bTimelineLive && bCompareWithServer)
+		{
+			if (UDebugDataCollectorSubsystem* Subsystem = GetDebugSubsystem())
+			{
+				ServerSnapshot = Subsystem->GetServerInsightSnapshot(SelectedActor.Get());
 			}
 		}
+		const FActorInsightData* ServerData = ServerSnapshot.Get();
+		DisplayedServerRevision = ServerData ? ServerData->Revision : INDEX_NONE;
 
 		if (SelectedData)
 		{
 			// サマリー更新
 			if (SummaryText.IsValid())
 			{
-				SummaryText->SetText(FText::FromString(SelectedData->HumanReadableSummary));
+				const FString Summary = ServerData
+					? FString::Printf(TEXT("Client: %s\nServer: %s"), *SelectedData->HumanReadableSummary, *ServerData->HumanReadableSummary)
+					: SelectedData->HumanReadableSummary;
+				SummaryText->SetText(FText::FromString(Summary));
 				SummaryText->SetColorAndOpacity(FLinearColor::White);
 			}
 
 			// 各セクションを追加
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("BasicInfo", "基本情報"), CreateBasicInfoSection(*SelectedData))
-			];
-
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("Abilities", "アビリティ"), CreateAbilitySection(*SelectedData))
-			];
+			using FSectionBuilder = TSharedRef<SWidget> (SUnifiedDebugPanel::*)(const FActorInsightData&);
+			auto AddSection = [this, SelectedData, ServerData](const FText& Title, FSectionBuilder Builder, bool bInitiallyExpanded)
+			{
+				TSharedRef<SWidget> Content = ServerData
+					? CreateComparisonRow((this->*Builder)(*SelectedData), (this->*Builder)(*ServerData))
+					: (this->*Builder)(*SelectedData);
 
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("Effects", "エフェクト"), CreateEffectSection(*SelectedData))
-			];
+				DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
+				[
+					CreateExpandableSection(Title, Content, bInitiallyExpanded)
+				];
+			};
+
+			AddSection(LOCTEXT("BasicInfo", "基本情報"), &SUnifiedDebugPanel::CreateBasicInfoSection, true);
+			AddSection(LOCTEXT("Abilities", "アビリティ"), &SUnifiedDebugPanel::CreateAbilitySection, true);
+			AddSection(LOCTEXT("Effects", "エフェクト"), &SUnifiedDebugPanel::CreateEffectSection, true);
+			AddSection(LOCTEXT("Animation", "アニメーション"), &SUnifiedDebugPanel::CreateAnimationSection, true);
+			AddSection(LOCTEXT("AI", "AI / Behavior Tree"), &SUnifiedDebugPanel::CreateAISection, true);
+			AddSection(LOCTEXT("Tick", "ティック情報"), &SUnifiedDebugPanel::CreateTickSection, false);
+			AddSection(LOCTEXT("Tags", "GameplayTags"), &SUnifiedDebugPanel::CreateGameplayTagsSection, true);
+		}
+	}
+}
 
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("Animation", "アニメーション"), CreateAnimationSection(*SelectedData))
-			];
+void SUnifiedDebugPanel::OnCompareWithServerChanged(ECheckBoxState NewState)
+{
+	bCompareWithServer = (NewState == ECheckBoxState::Checked);
+	UnifiedDebugPanelEditor::SetPIEServerStreaming(bCompareWithServer);
 
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("AI", "AI / Behavior Tree"), CreateAISection(*SelectedData))
-			];
+	// 表示するワールドが変わるため選択を解除
+	if (ActorListView.IsValid())
+	{
+		ActorListView->ClearSelection();
+	}
+	OnActorSelectionChanged(TWeakObjectPtr<AActor>());
+}
 
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("Tick", "ティック情報"), CreateTickSection(*SelectedData), false)
-			];
+void SUnifiedDebugPanel::OnTimelineLiveChanged(ECheckBoxState NewState)
+{
+	bTimelineLive = (NewState == ECheckBoxState::Checked);
+	TimelineTime = TimelineNewest;
+	RefreshDetailPanel();
+}
 
-			DetailPanelContainer->AddSlot().AutoHeight().Padding(4.0f)
-			[
-				CreateExpandableSection(LOCTEXT("Tags", "GameplayTags"), CreateGameplayTagsSection(*SelectedData))
-			];
-		}
-	}
+void SUnifiedDebugPanel::OnTimelineScrubbed(float NewTime)
+{
+	bTimelineLive = false;
+	TimelineTime = NewTime;
+	RefreshDetailPanel();
+}
 
-	// リストを再描画して選択状態を反映
-	TimeSinceLastRefresh = RefreshInterval;
+void SUnifiedDebugPanel::OnActorListSelectionChanged(TSharedPtr<FUnifiedDebugActorItem> Item, ESelectInfo::Type SelectInfo)
+{
+	OnActorSelectionChanged(Item.IsValid() ? Item->Actor : TWeakObjectPtr<AActor>());
 }
 
 UDebugDataCollectorSubsystem* SUnifiedDebugPanel::GetDebugSubsystem() const
 {
 	if (GEditor)
 	{
-		if (UWorld* World = GEditor->GetEditorWorldContext().World())
-		{
-			return World->GetSubsystem<UDebugDataCollectorSubsystem>();
-		}
-
-		// PIE ワールドを取得
+		// PIE ワールドを取得（サーバー比較中はクライアントのワールドを優先）
+		UWorld* PIEWorld = nullptr;
 		for (const FWorldContext& Context : GEngine->GetWorldContexts())
 		{
-			if (Context.WorldType == EWorldType::PIE && Context.World())
+			UWorld* World = Context.World();
+			if (Context.WorldType != EWorldType::PIE || !World)
 			{
-				return Context.World()->GetSubsystem<UDebugDataCollectorSubsystem>();
+				continue;
 			}
+
+			if (!PIEWorld)
+			{
+				PIEWorld = World;
+			}
+			if (bCompareWithServer && World->GetNetMode() == NM_Client)
+			{
+				PIEWorld = World;
+				break;
+			}
+		}
+
+		if (PIEWorld)
+		{
+			return PIEWorld->GetSubsystem<UDebugDataCollectorSubsystem>();
+		}
+
+		if (UWorld* World = GEditor->GetEditorWorldContext().World())
+		{
+			return World->GetSubsystem<UDebugDataCollectorSubsystem>();
 		}
 	}
 	return nullptr;
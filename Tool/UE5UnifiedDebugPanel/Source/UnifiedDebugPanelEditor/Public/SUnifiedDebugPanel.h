@@ -12,6 +12,44 @@ class SScrollBox;
 class SVerticalBox;
 class STextBlock;
 class SExpandableArea;
+class ITableRow;
+class STableViewBase;
+template <typename ItemType> class SListView;
+
+/**
+ * アクターリストの行データ
+ * アクターごとに保持し続け、行ウィジェットは属性バインディングでこの値を参照する
+ * 値が変わった項目のみテキストを作り直すため、変化の無い行は再描画されない
+ */
+struct FUnifiedDebugActorItem
+{
+	/** 監視対象アクター */
+	TWeakObjectPtr<AActor> Actor;
+
+	/** 表示用テキスト */
+	FText ActorName;
+	FText Summary;
+	FText AbilityText;
+	FText EffectText;
+	FText MontageText;
+
+	/** 表示状態 */
+	bool bIsActive = false;
+	int32 AbilityCount = INDEX_NONE;
+	int32 EffectCount = INDEX_NONE;
+	int32 MontageCount = INDEX_NONE;
+
+	/** 反映済みのスナップショットのリビジョン */
+	int32 Revision = INDEX_NONE;
+
+	/** Insightデータを反映（リビジョンが同じなら何もしない） */
+	void Update(const FActorInsightData& Data);
+
+private:
+	/** テキストの元の文字列（比較用） */
+	FString ActorNameSource;
+	FString SummarySource;
+};
 
 /**
  * 統合デバッグパネル Slate ウィジェット
@@ -44,10 +82,16 @@ private:
 	/** 詳細パネル構築 */
 	TSharedRef<SWidget> BuildDetailPanel();
 
+	/** タイムライン（履歴のスクラブ）構築 */
+	TSharedRef<SWidget> BuildTimeline();
+
 	// ========== アクターInsight表示 ==========
 
-	/** アクターInsightウィジェット生成 */
-	TSharedRef<SWidget> CreateActorInsightWidget(const FActorInsightData& Data);
+	/** アクターリストの行を生成（行はスクロールで表示される間のみ存在する） */
+	TSharedRef<ITableRow> OnGenerateActorRow(TSharedPtr<FUnifiedDebugActorItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** 行データをInsightデータに合わせる（追加・削除があった場合のみリストを更新） */
+	void RefreshActorItems();
 
 	/** 基本情報セクション */
 	TSharedRef<SWidget> CreateBasicInfoSection(const FActorInsightData& Data);
@@ -72,6 +116,9 @@ private:
 
 	// ========== ヘルパーメソッド ==========
 
+	/** クライアントとサーバーの内容を左右に並べる */
+	TSharedRef<SWidget> CreateComparisonRow(TSharedRef<SWidget> ClientContent, TSharedRef<SWidget> ServerContent);
+
 	/** 展開可能エリア作成 */
 	TSharedRef<SWidget> CreateExpandableSection(
 		const FText& Title,
@@ -85,6 +132,9 @@ private:
 	/** ステータスバッジ作成 */
 	TSharedRef<SWidget> CreateStatusBadge(const FString& Text, FLinearColor Color);
 
+	/** ステータスバッジ作成（属性バインディング） */
+	TSharedRef<SWidget> CreateStatusBadge(TAttribute<FText> Text, TAttribute<FLinearColor> Color);
+
 	/** プログレスバー作成 */
 	TSharedRef<SWidget> CreateProgressBar(float Progress, const FString& Label);
 
@@ -105,13 +155,34 @@ private:
 	/** アクター選択変更 */
 	void OnActorSelectionChanged(TWeakObjectPtr<AActor> NewSelection);
 
+	/** 詳細パネルを選択中のアクターで作り直す（ライブ表示でなければ履歴から復元） */
+	void RefreshDetailPanel();
+
+	/** サーバー比較トグル */
+	void OnCompareWithServerChanged(ECheckBoxState NewState);
+
+	/** ライブ表示トグル */
+	void OnTimelineLiveChanged(ECheckBoxState NewState);
+
+	/** タイムラインのスクラブ */
+	void OnTimelineScrubbed(float NewTime);
+
+	/** アクターリストの選択変更 */
+	void OnActorListSelectionChanged(TSharedPtr<FUnifiedDebugActorItem> Item, ESelectInfo::Type SelectInfo);
+
 	// ========== データ ==========
 
-	/** 現在のワールドからサブシステムを取得 */
+	/** 現在のワールドからサブシステムを取得（サーバー比較中はPIEのクライアントのワールド） */
 	UDebugDataCollectorSubsystem* GetDebugSubsystem() const;
 
-	/** キャッシュされたInsightデータ */
-	TArray<FActorInsightData> CachedInsightData;
+	/** サブシステムから受け取ったInsightスナップショット（共有、コピーしない） */
+	TArray<FActorInsightSnapshot> CachedInsightData;
+
+	/** アクターリストの行データ（監視開始順） */
+	TArray<TSharedPtr<FUnifiedDebugActorItem>> ActorItems;
+
+	/** アクター → 行データ */
+	TMap<TWeakObjectPtr<AActor>, TSharedPtr<FUnifiedDebugActorItem>> ActorItemsByActor;
 
 	/** 選択中のアクター */
 	TWeakObjectPtr<AActor> SelectedActor;
@@ -125,10 +196,26 @@ private:
 	/** 最後の更新からの経過時間 */
 	float TimeSinceLastRefresh = 0.0f;
 
+	/** ライブ表示か（falseの場合はTimelineTimeの時点を履歴から表示） */
+	bool bTimelineLive = true;
+
+	/** サーバーの状態と並べて表示するか（PIEのサーバーからの配信を有効化） */
+	bool bCompareWithServer = false;
+
+	/** 詳細パネルに表示中のサーバーの状態の番号（受信で変わったら作り直す） */
+	int32 DisplayedServerRevision = INDEX_NONE;
+
+	/** 表示中の履歴の時刻 */
+	float TimelineTime = 0.0f;
+
+	/** 履歴の保持範囲 */
+	float TimelineOldest = 0.0f;
+	float TimelineNewest = 0.0f;
+
 	// ========== UIウィジェット参照 ==========
 
-	/** アクターリストコンテナ */
-	TSharedPtr<SVerticalBox> ActorListContainer;
+	/** アクターリスト */
+	TSharedPtr<SListView<TSharedPtr<FUnifiedDebugActorItem>>> ActorListView;
 
 	/** 詳細パネルコンテナ */
 	TSharedPtr<SVerticalBox> DetailPanelContainer;